@@ -1,22 +1,33 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
 //
 // Interface:
 // * To get a buffer for a particular disk block, call bread.
+// * To have a block read into the cache in the background,
+//     call breadahead.
+// * To get a buffer for a block that is about to be overwritten
+//     in full, call bnew; it returns zeroed data without reading.
 // * After changing buffer data, call bwrite to write it to disk.
 // * When done with the buffer, call brelse.
+// * Or call bawrite to start the write and release the buffer
+//     at once; bwait waits for all such writes to finish.
+// * A block written without going through the cache must be
+//     passed to bupdate, which refreshes any cached copy.
 // * Do not use the buffer after calling brelse.
 // * Only one process at a time can use a buffer,
 //     so do not keep them longer than necessary.
 //
-// The implementation uses two state flags internally:
+// The implementation uses three state flags internally:
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+// * B_BUSY: bawrite or breadahead handed the buffer to the disk
+//     driver; the next user must wait for the request to finish
+//     before touching the data.
 
 #include "types.h"
 #include "defs.h"
@@ -26,19 +37,83 @@
 #include "fs.h"
 #include "buf.h"
 
+#include "mmu.h"
+
+#define BCHAIN   4     // buffers per hash bucket, on average, when full
+#define BMINFREE 1024  // free pages to leave before growing
+
+#define BNODEV  0xffffffff  // dev of a buffer on no hash chain
+
+// Is b's disk request unfinished?  A write keeps B_DIRTY until it
+// is done; a read started by breadahead has B_BUSY and no B_VALID.
+#define BINFLIGHT(b) \
+  (((b)->flags & B_DIRTY) || ((b)->flags & (B_BUSY|B_VALID)) == B_BUSY)
+
+// Buffers live in chunks taken from kalloc(): one page holding
+// the headers, and the pages holding their data, NBPP to a page.
+// binit() lets the cache have BCACHEPCT percent of free memory,
+// and bsetmax() caps that at the size of the disk once it is
+// mounted.  bget() adds a chunk on a miss while the cache is
+// below that size and memory is plentiful; when kalloc() runs
+// out it takes whole chunks of unused buffers back with bshrink().
+#define NBPP      (PGSIZE/BSIZE)
+#define NCHUNKBUF ((PGSIZE-sizeof(void*))/sizeof(struct buf)/NBPP*NBPP)
+
+struct bchunk {
+  struct bchunk *next;
+  struct buf buf[NCHUNKBUF];
+};
+
+// Each cached buffer is on the hash chain of the bucket its
+// (dev, blockno) hashes to; a bucket's lock protects its chain and
+// the refcnt of the buffers on it, so lookups of different blocks
+// do not contend.  bcache.lock protects the LRU and free lists and
+// the chunk list, and serializes recycling, which is the only thing
+// that moves a buffer from one chain to another.
+// Lock order: bcache.lock, then bucket locks.
+// binit() sizes the table from the most buffers the cache may
+// have, so chains stay short however much memory there is; the
+// buckets live in kalloc() pages, NBKPP to a page.
+struct bucket {
+  struct spinlock lock;
+  struct buf *head;  // chain through hnext
+};
+
+#define NBKPP (PGSIZE/sizeof(struct bucket))
+
 struct {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct bucket **bucket;  // NBKPP to a page
+  uint nbucket;
+  struct bchunk *chunks;
+  int nbuf;    // buffers in the cache
+  int maxbuf;  // most buffers binit() or bsetmax() allows
 
-  // Linked list of all buffers, through prev/next.
+  // Linked list of hashed buffers, through prev/next.
   // head.next is most recently used.
   struct buf head;
+
+  // Linked list of buffers never used since their chunk
+  // was allocated, through prev/next.
+  struct buf free;
 } bcache;
 
+static int bgrow(void);
+
+// The bucket block dev, blockno hashes to.
+static struct bucket*
+bhash(uint dev, uint blockno)
+{
+  uint h;
+
+  h = (dev*131 + blockno) % bcache.nbucket;
+  return &bcache.bucket[h / NBKPP][h % NBKPP];
+}
+
 void
 binit(void)
 {
-  struct buf *b;
+  uint i;
 
   initlock(&bcache.lock, "bcache");
 
@@ -46,13 +121,216 @@ binit(void)
   // Create linked list of buffers
   bcache.head.prev = &bcache.head;
   bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+  bcache.free.prev = &bcache.free;
+  bcache.free.next = &bcache.free;
+
+  bcache.maxbuf = kfreecount() / 100 * BCACHEPCT * NBPP;
+  bcache.nbucket = bcache.maxbuf / BCHAIN | 1;
+  if(bcache.nbucket > PGSIZE / sizeof(struct bucket*) * NBKPP)
+    bcache.nbucket = PGSIZE / sizeof(struct bucket*) * NBKPP;
+  if((bcache.bucket = (struct bucket**)kalloc()) == 0)
+    panic("binit");
+  for(i = 0; i < bcache.nbucket; i++){
+    if(i % NBKPP == 0 && (bcache.bucket[i / NBKPP] = (struct bucket*)kalloc()) == 0)
+      panic("binit");
+    initlock(&bcache.bucket[i / NBKPP][i % NBKPP].lock, "bcache.bucket");
+    bcache.bucket[i / NBKPP][i % NBKPP].head = 0;
+  }
+
+  // The rest is added as blocks are read.
+  if(!bgrow())
+    panic("binit");
+}
+
+// Cap the cache at the nblocks blocks of the mounted disk: there
+// is no point caching more blocks than it has.
+void
+bsetmax(uint nblocks)
+{
+  acquire(&bcache.lock);
+  if(bcache.maxbuf > nblocks)
+    bcache.maxbuf = nblocks;
+  release(&bcache.lock);
+}
+
+// Add a chunk of buffers to the free list.
+// Return 0 if there is not enough memory.
+static int
+bgrow(void)
+{
+  struct bchunk *c;
+  struct buf *b;
+  char *page;
+  int i;
+
+  page = 0;
+  if((c = (struct bchunk*)kalloc()) == 0)
+    return 0;
+  memset(c, 0, PGSIZE);
+  for(i = 0; i < NCHUNKBUF; i++){
+    b = &c->buf[i];
+    if(i % NBPP == 0 && (page = kalloc()) == 0){
+      for(i -= NBPP; i >= 0; i -= NBPP)
+        kfree((char*)c->buf[i].data);
+      kfree((char*)c);
+      return 0;
+    }
+    b->data = (uchar*)page + i%NBPP*BSIZE;
+    b->dev = BNODEV;
+    initsleeplock(&b->lock, "buffer");
+  }
+
+  acquire(&bcache.lock);
+  for(b = c->buf; b < c->buf+NCHUNKBUF; b++){
+    b->next = bcache.free.next;
+    b->prev = &bcache.free;
+    bcache.free.next->prev = b;
+    bcache.free.next = b;
+  }
+  c->next = bcache.chunks;
+  bcache.chunks = c;
+  bcache.nbuf += NCHUNKBUF;
+  release(&bcache.lock);
+  return 1;
+}
+
+// Take b off its hash chain if no one is using it.
+// Return 0 if b is in use.  Caller must hold bcache.lock.
+static int
+bunhash(struct buf *b)
+{
+  struct bucket *bk;
+  struct buf **pp;
+  int ok;
+
+  if(b->dev == BNODEV)
+    return 1;
+  bk = bhash(b->dev, b->blockno);
+  acquire(&bk->lock);
+  ok = b->refcnt == 0 && !BINFLIGHT(b);
+  if(ok){
+    for(pp = &bk->head; *pp != b; pp = &(*pp)->hnext)
+      ;
+    *pp = b->hnext;
+  }
+  release(&bk->lock);
+  return ok;
+}
+
+// Undo bunhash(b).  Caller must hold bcache.lock.
+static void
+brehash(struct buf *b)
+{
+  struct bucket *bk;
+
+  if(b->dev == BNODEV)
+    return;
+  bk = bhash(b->dev, b->blockno);
+  acquire(&bk->lock);
+  b->hnext = bk->head;
+  bk->head = b;
+  release(&bk->lock);
+}
+
+// Give a chunk of unused buffers back to the page allocator,
+// dropping whatever they cache.  kalloc() calls this when it
+// runs out of pages.  Return 0 if every chunk is in use.
+int
+bshrink(void)
+{
+  struct bchunk *c, **cp;
+  struct buf *b;
+  int i;
+
+  if(bcache.chunks == 0)
+    return 0;  // binit() has not run yet
+
+  acquire(&bcache.lock);
+  for(cp = &bcache.chunks; (c = *cp) != 0; cp = &c->next){
+    for(i = 0; i < NCHUNKBUF; i++)
+      if(!bunhash(&c->buf[i]))
+        break;
+    if(i == NCHUNKBUF)
+      break;
+    while(--i >= 0)
+      brehash(&c->buf[i]);
+  }
+  if(c == 0){
+    release(&bcache.lock);
+    return 0;
+  }
+  *cp = c->next;
+  for(b = c->buf; b < c->buf+NCHUNKBUF; b++){
+    b->next->prev = b->prev;
+    b->prev->next = b->next;
+  }
+  bcache.nbuf -= NCHUNKBUF;
+  release(&bcache.lock);
+
+  for(i = 0; i < NCHUNKBUF; i += NBPP)
+    kfree((char*)c->buf[i].data);
+  kfree((char*)c);
+  return 1;
+}
+
+// Find the buffer for block on device dev on bk's chain.
+// Caller must hold bk->lock.
+static struct buf*
+blookup(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bk->head; b != 0; b = b->hnext)
+    if(b->dev == dev && b->blockno == blockno)
+      return b;
+  return 0;
+}
+
+// Take a never-used buffer, or else recycle the least recently
+// used unused one, for block on device dev and put it on bk's
+// chain.  Caller must hold bcache.lock and bk->lock.
+static struct buf*
+brecycle(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b, **pp;
+  struct bucket *old;
+
+  if((b = bcache.free.next) != &bcache.free){
+    b->next->prev = b->prev;
+    b->prev->next = b->next;
     b->next = bcache.head.next;
     b->prev = &bcache.head;
-    initsleeplock(&b->lock, "buffer");
     bcache.head.next->prev = b;
     bcache.head.next = b;
+    goto found;
   }
+
+  // Even if refcnt==0, a buffer is in use until
+  // its disk request has finished.
+  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
+    old = bhash(b->dev, b->blockno);
+    if(old != bk)
+      acquire(&old->lock);
+    if(b->refcnt == 0 && !BINFLIGHT(b)){
+      for(pp = &old->head; *pp != b; pp = &(*pp)->hnext)
+        ;
+      *pp = b->hnext;
+      if(old != bk)
+        release(&old->lock);
+      goto found;
+    }
+    if(old != bk)
+      release(&old->lock);
+  }
+  panic("bget: no buffers");
+
+found:
+  b->hnext = bk->head;
+  bk->head = b;
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  return b;
 }
 
 // Look through buffer cache for block on device dev.
@@ -61,35 +339,35 @@ binit(void)
 static struct buf*
 bget(uint dev, uint blockno)
 {
+  struct bucket *bk;
   struct buf *b;
 
-  acquire(&bcache.lock);
+  bk = bhash(dev, blockno);
+  acquire(&bk->lock);
 
   // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
-    }
+  if((b = blookup(bk, dev, blockno)) == 0){
+    // Not cached; recycle an unused buffer.  Look again once
+    // recycling is locked out: another process may have got
+    // there first.
+    release(&bk->lock);
+    if(bcache.nbuf < bcache.maxbuf && kfreecount() > BMINFREE)
+      bgrow();
+    acquire(&bcache.lock);
+    acquire(&bk->lock);
+    if((b = blookup(bk, dev, blockno)) == 0)
+      b = brecycle(bk, dev, blockno);
+    release(&bcache.lock);
   }
+  b->refcnt++;
+  release(&bk->lock);
 
-  // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
-    }
+  acquiresleep(&b->lock);
+  if(b->flags & B_BUSY){
+    idesync(b);
+    b->flags &= ~B_BUSY;
   }
-  panic("bget: no buffers");
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -100,11 +378,72 @@ bread(uint dev, uint blockno)
 
   b = bget(dev, blockno);
   if((b->flags & B_VALID) == 0) {
-    iderw(b);
+    // The block may still be waiting in the LFS segment writer.
+    if(!lfs_segread(b))
+      iderw(b);
+  }
+  return b;
+}
+
+// Start reading the indicated block into the cache unless it
+// is there already, and return without waiting for it.
+// B_BUSY makes the next bget() of the block wait for the read.
+void
+breadahead(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  if((b->flags & B_VALID) == 0 && !lfs_segread(b)){
+    b->flags |= B_BUSY;
+    idesubmit(b);
   }
+  brelse(b);
+}
+
+// Return a locked, zeroed buf for the indicated block
+// without reading it from disk.  For blocks freshly
+// allocated at the log tail, whose old contents are garbage
+// and are about to be overwritten anyway.
+struct buf*
+bnew(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  memset(b->data, 0, BSIZE);
+  b->flags |= B_VALID;
   return b;
 }
 
+// The indicated block is being written to disk without going
+// through the cache: if the cache holds a copy, replace its
+// contents with data.  Does not take a buffer otherwise.
+void
+bupdate(uint dev, uint blockno, uchar *data)
+{
+  struct bucket *bk;
+  struct buf *b;
+
+  bk = bhash(dev, blockno);
+  acquire(&bk->lock);
+  if((b = blookup(bk, dev, blockno)) == 0){
+    release(&bk->lock);
+    return;
+  }
+  b->refcnt++;
+  release(&bk->lock);
+
+  acquiresleep(&b->lock);
+  if(b->flags & B_BUSY){
+    idesync(b);
+    b->flags &= ~B_BUSY;
+  }
+  memmove(b->data, data, BSIZE);
+  b->flags |= B_VALID;
+  brelse(b);
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -115,17 +454,64 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Start writing b's contents to disk and release b without
+// waiting for the write.  Must be locked.
+void
+bawrite(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("bawrite");
+  b->flags |= B_DIRTY|B_BUSY;
+  idesubmit(b);
+  brelse(b);
+}
+
+// Wait until every write started by bawrite has reached the disk.
+void
+bwait(void)
+{
+  struct bucket *bk;
+  struct buf *b;
+  int busy;
+
+  acquire(&bcache.lock);
+  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+    bk = bhash(b->dev, b->blockno);
+    acquire(&bk->lock);
+    busy = (b->flags & (B_BUSY|B_DIRTY)) == (B_BUSY|B_DIRTY);
+    if(busy)
+      b->refcnt++;  // keep b from being recycled while we sleep
+    release(&bk->lock);
+    if(!busy)
+      continue;
+    release(&bcache.lock);
+    idesync(b);
+    acquire(&bk->lock);
+    b->refcnt--;
+    release(&bk->lock);
+    acquire(&bcache.lock);
+    b = &bcache.head;  // the list may have changed; start over
+  }
+  release(&bcache.lock);
+}
+
 // Release a locked buffer.
 // Move to the head of the MRU list.
 void
 brelse(struct buf *b)
 {
+  struct bucket *bk;
+
   if(!holdingsleep(&b->lock))
     panic("brelse");
 
   releasesleep(&b->lock);
 
+  // Drop the reference and relink b in one critical section:
+  // once refcnt is 0, bshrink() may free b's chunk.
+  bk = bhash(b->dev, b->blockno);
   acquire(&bcache.lock);
+  acquire(&bk->lock);
   b->refcnt--;
   if (b->refcnt == 0) {
     // no one is waiting for it.
@@ -136,9 +522,8 @@ brelse(struct buf *b)
     bcache.head.next->prev = b;
     bcache.head.next = b;
   }
-  
+  release(&bk->lock);
   release(&bcache.lock);
 }
 //PAGEBREAK!
 // Blank page.
-
@@ -0,0 +1,1861 @@
+
+_crashtest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "Cleanup done.\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  if(argc < 2){
+   f:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc < 2){
+  15:	7e 51                	jle    68 <main+0x68>
+    printf(1, "  verify - Verify files after reboot (test roll-forward)\n");
+    printf(1, "  clean  - Remove test files\n");
+    exit();
+  }
+
+  if(strcmp(argv[1], "write") == 0){
+  17:	50                   	push   %eax
+  18:	50                   	push   %eax
+  19:	68 24 0f 00 00       	push   $0xf24
+  1e:	ff 73 04             	push   0x4(%ebx)
+  21:	e8 fa 06 00 00       	call   720 <strcmp>
+  26:	83 c4 10             	add    $0x10,%esp
+  29:	85 c0                	test   %eax,%eax
+  2b:	75 05                	jne    32 <main+0x32>
+    write_mode();
+  2d:	e8 be 02 00 00       	call   2f0 <write_mode>
+  } else if(strcmp(argv[1], "verify") == 0){
+  32:	51                   	push   %ecx
+  33:	51                   	push   %ecx
+  34:	68 2a 0f 00 00       	push   $0xf2a
+  39:	ff 73 04             	push   0x4(%ebx)
+  3c:	e8 df 06 00 00       	call   720 <strcmp>
+  41:	83 c4 10             	add    $0x10,%esp
+  44:	85 c0                	test   %eax,%eax
+  46:	74 6b                	je     b3 <main+0xb3>
+    verify_mode();
+  } else if(strcmp(argv[1], "clean") == 0){
+  48:	52                   	push   %edx
+  49:	52                   	push   %edx
+  4a:	68 31 0f 00 00       	push   $0xf31
+  4f:	ff 73 04             	push   0x4(%ebx)
+  52:	e8 c9 06 00 00       	call   720 <strcmp>
+  57:	83 c4 10             	add    $0x10,%esp
+  5a:	85 c0                	test   %eax,%eax
+  5c:	75 5c                	jne    ba <main+0xba>
+    cleanup();
+  5e:	e8 cd 05 00 00       	call   630 <cleanup>
+  } else {
+    printf(1, "Unknown command: %s\n", argv[1]);
+  }
+
+  exit();
+  63:	e8 cb 08 00 00       	call   933 <exit>
+    printf(1, "Usage: crashtest <write|verify|clean>\n");
+  68:	50                   	push   %eax
+  69:	50                   	push   %eax
+  6a:	68 20 13 00 00       	push   $0x1320
+  6f:	6a 01                	push   $0x1
+  71:	e8 0a 0a 00 00       	call   a80 <printf>
+    printf(1, "\n");
+  76:	58                   	pop    %eax
+  77:	5a                   	pop    %edx
+  78:	68 f5 0e 00 00       	push   $0xef5
+  7d:	6a 01                	push   $0x1
+  7f:	e8 fc 09 00 00       	call   a80 <printf>
+    printf(1, "  write  - Create test files and simulate crash\n");
+  84:	59                   	pop    %ecx
+  85:	5b                   	pop    %ebx
+  86:	68 48 13 00 00       	push   $0x1348
+  8b:	6a 01                	push   $0x1
+  8d:	e8 ee 09 00 00       	call   a80 <printf>
+    printf(1, "  verify - Verify files after reboot (test roll-forward)\n");
+  92:	58                   	pop    %eax
+  93:	5a                   	pop    %edx
+  94:	68 7c 13 00 00       	push   $0x137c
+  99:	6a 01                	push   $0x1
+  9b:	e8 e0 09 00 00       	call   a80 <printf>
+    printf(1, "  clean  - Remove test files\n");
+  a0:	59                   	pop    %ecx
+  a1:	5b                   	pop    %ebx
+  a2:	68 06 0f 00 00       	push   $0xf06
+  a7:	6a 01                	push   $0x1
+  a9:	e8 d2 09 00 00       	call   a80 <printf>
+    exit();
+  ae:	e8 80 08 00 00       	call   933 <exit>
+    verify_mode();
+  b3:	e8 a8 03 00 00       	call   460 <verify_mode>
+  b8:	eb a9                	jmp    63 <main+0x63>
+    printf(1, "Unknown command: %s\n", argv[1]);
+  ba:	50                   	push   %eax
+  bb:	ff 73 04             	push   0x4(%ebx)
+  be:	68 37 0f 00 00       	push   $0xf37
+  c3:	6a 01                	push   $0x1
+  c5:	e8 b6 09 00 00       	call   a80 <printf>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	eb 94                	jmp    63 <main+0x63>
+  cf:	90                   	nop
+
+000000d0 <write_test_file>:
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	57                   	push   %edi
+  d4:	56                   	push   %esi
+  d5:	53                   	push   %ebx
+  d6:	83 ec 14             	sub    $0x14,%esp
+  d9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd = open(name, O_CREATE | O_WRONLY);
+  df:	68 01 02 00 00       	push   $0x201
+  e4:	57                   	push   %edi
+  e5:	e8 89 08 00 00       	call   973 <open>
+  if(fd < 0){
+  ea:	83 c4 10             	add    $0x10,%esp
+  ed:	85 c0                	test   %eax,%eax
+  ef:	78 37                	js     128 <write_test_file+0x58>
+  write(fd, content, strlen(content));
+  f1:	83 ec 0c             	sub    $0xc,%esp
+  f4:	89 c3                	mov    %eax,%ebx
+  f6:	56                   	push   %esi
+  f7:	e8 84 06 00 00       	call   780 <strlen>
+  fc:	83 c4 0c             	add    $0xc,%esp
+  ff:	50                   	push   %eax
+ 100:	56                   	push   %esi
+ 101:	53                   	push   %ebx
+ 102:	e8 4c 08 00 00       	call   953 <write>
+  close(fd);
+ 107:	89 1c 24             	mov    %ebx,(%esp)
+ 10a:	e8 4c 08 00 00       	call   95b <close>
+  printf(1, "crashtest: wrote '%s' to %s\n", content, name);
+ 10f:	57                   	push   %edi
+ 110:	56                   	push   %esi
+ 111:	68 c5 0d 00 00       	push   $0xdc5
+ 116:	6a 01                	push   $0x1
+ 118:	e8 63 09 00 00       	call   a80 <printf>
+}
+ 11d:	83 c4 20             	add    $0x20,%esp
+ 120:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 123:	5b                   	pop    %ebx
+ 124:	5e                   	pop    %esi
+ 125:	5f                   	pop    %edi
+ 126:	5d                   	pop    %ebp
+ 127:	c3                   	ret
+    printf(1, "crashtest: cannot create %s\n", name);
+ 128:	50                   	push   %eax
+ 129:	57                   	push   %edi
+ 12a:	68 a8 0d 00 00       	push   $0xda8
+ 12f:	6a 01                	push   $0x1
+ 131:	e8 4a 09 00 00       	call   a80 <printf>
+    exit();
+ 136:	e8 f8 07 00 00       	call   933 <exit>
+ 13b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+
+00000140 <verify_file>:
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	56                   	push   %esi
+ 145:	53                   	push   %ebx
+ 146:	81 ec 14 02 00 00    	sub    $0x214,%esp
+  fd = open(name, O_RDONLY);
+ 14c:	6a 00                	push   $0x0
+ 14e:	ff 75 08             	push   0x8(%ebp)
+ 151:	e8 1d 08 00 00       	call   973 <open>
+  if(fd < 0){
+ 156:	83 c4 10             	add    $0x10,%esp
+ 159:	85 c0                	test   %eax,%eax
+ 15b:	0f 88 97 00 00 00    	js     1f8 <verify_file+0xb8>
+  n = read(fd, buf, sizeof(buf) - 1);
+ 161:	83 ec 04             	sub    $0x4,%esp
+ 164:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+ 16a:	89 c3                	mov    %eax,%ebx
+ 16c:	68 ff 01 00 00       	push   $0x1ff
+ 171:	56                   	push   %esi
+ 172:	50                   	push   %eax
+ 173:	e8 d3 07 00 00       	call   94b <read>
+  close(fd);
+ 178:	89 1c 24             	mov    %ebx,(%esp)
+  n = read(fd, buf, sizeof(buf) - 1);
+ 17b:	89 c7                	mov    %eax,%edi
+  close(fd);
+ 17d:	e8 d9 07 00 00       	call   95b <close>
+  if(n < 0){
+ 182:	83 c4 10             	add    $0x10,%esp
+ 185:	85 ff                	test   %edi,%edi
+ 187:	0f 88 8b 00 00 00    	js     218 <verify_file+0xd8>
+  if(strcmp(buf, expected) == 0){
+ 18d:	83 ec 08             	sub    $0x8,%esp
+  buf[n] = '\0';
+ 190:	c6 84 3d e8 fd ff ff 	movb   $0x0,-0x218(%ebp,%edi,1)
+ 197:	00 
+  if(strcmp(buf, expected) == 0){
+ 198:	ff 75 0c             	push   0xc(%ebp)
+ 19b:	56                   	push   %esi
+ 19c:	e8 7f 05 00 00       	call   720 <strcmp>
+ 1a1:	83 c4 10             	add    $0x10,%esp
+ 1a4:	85 c0                	test   %eax,%eax
+ 1a6:	75 28                	jne    1d0 <verify_file+0x90>
+    printf(1, "crashtest: PASS - %s contains '%s'\n", name, expected);
+ 1a8:	ff 75 0c             	push   0xc(%ebp)
+ 1ab:	ff 75 08             	push   0x8(%ebp)
+ 1ae:	68 94 0f 00 00       	push   $0xf94
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	e8 c6 08 00 00       	call   a80 <printf>
+    return 1;
+ 1ba:	83 c4 10             	add    $0x10,%esp
+}
+ 1bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 1;
+ 1c0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 1c5:	5b                   	pop    %ebx
+ 1c6:	5e                   	pop    %esi
+ 1c7:	5f                   	pop    %edi
+ 1c8:	5d                   	pop    %ebp
+ 1c9:	c3                   	ret
+ 1ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, "crashtest: FAIL - %s contains '%s', expected '%s'\n", name, buf, expected);
+ 1d0:	83 ec 0c             	sub    $0xc,%esp
+ 1d3:	ff 75 0c             	push   0xc(%ebp)
+ 1d6:	56                   	push   %esi
+ 1d7:	ff 75 08             	push   0x8(%ebp)
+ 1da:	68 b8 0f 00 00       	push   $0xfb8
+ 1df:	6a 01                	push   $0x1
+ 1e1:	e8 9a 08 00 00       	call   a80 <printf>
+    return 0;
+ 1e6:	83 c4 20             	add    $0x20,%esp
+    return 0;
+ 1e9:	31 c0                	xor    %eax,%eax
+}
+ 1eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ee:	5b                   	pop    %ebx
+ 1ef:	5e                   	pop    %esi
+ 1f0:	5f                   	pop    %edi
+ 1f1:	5d                   	pop    %ebp
+ 1f2:	c3                   	ret
+ 1f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1f7:	90                   	nop
+    printf(1, "crashtest: FAIL - cannot open %s\n", name);
+ 1f8:	83 ec 04             	sub    $0x4,%esp
+ 1fb:	ff 75 08             	push   0x8(%ebp)
+ 1fe:	68 4c 0f 00 00       	push   $0xf4c
+ 203:	6a 01                	push   $0x1
+ 205:	e8 76 08 00 00       	call   a80 <printf>
+    return 0;
+ 20a:	83 c4 10             	add    $0x10,%esp
+ 20d:	31 c0                	xor    %eax,%eax
+ 20f:	eb da                	jmp    1eb <verify_file+0xab>
+ 211:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "crashtest: FAIL - cannot read %s\n", name);
+ 218:	83 ec 04             	sub    $0x4,%esp
+ 21b:	ff 75 08             	push   0x8(%ebp)
+ 21e:	68 70 0f 00 00       	push   $0xf70
+ 223:	6a 01                	push   $0x1
+ 225:	e8 56 08 00 00       	call   a80 <printf>
+    return 0;
+ 22a:	83 c4 10             	add    $0x10,%esp
+    return 0;
+ 22d:	31 c0                	xor    %eax,%eax
+ 22f:	eb ba                	jmp    1eb <verify_file+0xab>
+ 231:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <force_flush_no_checkpoint>:
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+  for(i = 0; i < 20; i++){
+ 244:	31 ff                	xor    %edi,%edi
+{
+ 246:	56                   	push   %esi
+ 247:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 24a:	53                   	push   %ebx
+    name[5] = '0' + (i / 10);
+ 24b:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+{
+ 250:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "crashtest: creating dummy files to force inode flush...\n");
+ 253:	68 ec 0f 00 00       	push   $0xfec
+ 258:	6a 01                	push   $0x1
+ 25a:	e8 21 08 00 00       	call   a80 <printf>
+ 25f:	83 c4 10             	add    $0x10,%esp
+ 262:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[5] = '0' + (i / 10);
+ 268:	89 f8                	mov    %edi,%eax
+    int fd = open(name, O_CREATE | O_WRONLY);
+ 26a:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'd';
+ 26d:	c7 45 d8 64 75 6d 6d 	movl   $0x6d6d7564,-0x28(%ebp)
+    name[5] = '0' + (i / 10);
+ 274:	f7 e3                	mul    %ebx
+    name[4] = 'y';
+ 276:	c6 45 dc 79          	movb   $0x79,-0x24(%ebp)
+    name[7] = '\0';
+ 27a:	c6 45 df 00          	movb   $0x0,-0x21(%ebp)
+    name[5] = '0' + (i / 10);
+ 27e:	c1 ea 03             	shr    $0x3,%edx
+ 281:	8d 42 30             	lea    0x30(%edx),%eax
+    name[6] = '0' + (i % 10);
+ 284:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[5] = '0' + (i / 10);
+ 287:	88 45 dd             	mov    %al,-0x23(%ebp)
+    name[6] = '0' + (i % 10);
+ 28a:	01 d2                	add    %edx,%edx
+ 28c:	89 f8                	mov    %edi,%eax
+ 28e:	29 d0                	sub    %edx,%eax
+ 290:	83 c0 30             	add    $0x30,%eax
+ 293:	88 45 de             	mov    %al,-0x22(%ebp)
+    int fd = open(name, O_CREATE | O_WRONLY);
+ 296:	68 01 02 00 00       	push   $0x201
+ 29b:	56                   	push   %esi
+ 29c:	e8 d2 06 00 00       	call   973 <open>
+    if(fd >= 0){
+ 2a1:	83 c4 10             	add    $0x10,%esp
+ 2a4:	85 c0                	test   %eax,%eax
+ 2a6:	78 21                	js     2c9 <force_flush_no_checkpoint+0x89>
+      write(fd, "x", 1);
+ 2a8:	83 ec 04             	sub    $0x4,%esp
+ 2ab:	6a 01                	push   $0x1
+ 2ad:	68 e2 0d 00 00       	push   $0xde2
+ 2b2:	50                   	push   %eax
+ 2b3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 2b6:	e8 98 06 00 00       	call   953 <write>
+      close(fd);
+ 2bb:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 2be:	89 14 24             	mov    %edx,(%esp)
+ 2c1:	e8 95 06 00 00       	call   95b <close>
+ 2c6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 20; i++){
+ 2c9:	83 c7 01             	add    $0x1,%edi
+ 2cc:	83 ff 14             	cmp    $0x14,%edi
+ 2cf:	75 97                	jne    268 <force_flush_no_checkpoint+0x28>
+  printf(1, "crashtest: dummy files created, inodes should be flushed to log\n");
+ 2d1:	83 ec 08             	sub    $0x8,%esp
+ 2d4:	68 28 10 00 00       	push   $0x1028
+ 2d9:	6a 01                	push   $0x1
+ 2db:	e8 a0 07 00 00       	call   a80 <printf>
+}
+ 2e0:	83 c4 10             	add    $0x10,%esp
+ 2e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2e6:	5b                   	pop    %ebx
+ 2e7:	5e                   	pop    %esi
+ 2e8:	5f                   	pop    %edi
+ 2e9:	5d                   	pop    %ebp
+ 2ea:	c3                   	ret
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+
+000002f0 <write_mode>:
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "\n=== CRASH TEST: WRITE MODE ===\n\n");
+ 2f7:	68 6c 10 00 00       	push   $0x106c
+ 2fc:	6a 01                	push   $0x1
+ 2fe:	e8 7d 07 00 00       	call   a80 <printf>
+  printf(1, "Step 1: Creating marker file (will be checkpointed)...\n");
+ 303:	59                   	pop    %ecx
+ 304:	5b                   	pop    %ebx
+ 305:	68 90 10 00 00       	push   $0x1090
+ 30a:	6a 01                	push   $0x1
+ 30c:	e8 6f 07 00 00       	call   a80 <printf>
+  write_test_file(CRASH_MARKER_FILE, "CHECKPOINT_OK");
+ 311:	58                   	pop    %eax
+ 312:	5a                   	pop    %edx
+ 313:	68 e4 0d 00 00       	push   $0xde4
+ 318:	68 f2 0d 00 00       	push   $0xdf2
+ 31d:	e8 ae fd ff ff       	call   d0 <write_test_file>
+  printf(1, "Step 2: Syncing marker file to a checkpoint...\n");
+ 322:	59                   	pop    %ecx
+ 323:	5b                   	pop    %ebx
+ 324:	68 c8 10 00 00       	push   $0x10c8
+ 329:	6a 01                	push   $0x1
+ 32b:	e8 50 07 00 00       	call   a80 <printf>
+  int fd = open(CRASH_MARKER_FILE, O_RDONLY);
+ 330:	58                   	pop    %eax
+ 331:	5a                   	pop    %edx
+ 332:	6a 00                	push   $0x0
+ 334:	68 f2 0d 00 00       	push   $0xdf2
+ 339:	e8 35 06 00 00       	call   973 <open>
+  if(fd < 0 || fsync(fd) < 0){
+ 33e:	83 c4 10             	add    $0x10,%esp
+ 341:	85 c0                	test   %eax,%eax
+ 343:	78 12                	js     357 <write_mode+0x67>
+ 345:	83 ec 0c             	sub    $0xc,%esp
+ 348:	89 c3                	mov    %eax,%ebx
+ 34a:	50                   	push   %eax
+ 34b:	e8 83 06 00 00       	call   9d3 <fsync>
+ 350:	83 c4 10             	add    $0x10,%esp
+ 353:	85 c0                	test   %eax,%eax
+ 355:	79 19                	jns    370 <write_mode+0x80>
+    printf(1, "crashtest: fsync %s failed\n", CRASH_MARKER_FILE);
+ 357:	83 ec 04             	sub    $0x4,%esp
+ 35a:	68 f2 0d 00 00       	push   $0xdf2
+ 35f:	68 ff 0d 00 00       	push   $0xdff
+ 364:	6a 01                	push   $0x1
+ 366:	e8 15 07 00 00       	call   a80 <printf>
+    exit();
+ 36b:	e8 c3 05 00 00       	call   933 <exit>
+  close(fd);
+ 370:	83 ec 0c             	sub    $0xc,%esp
+ 373:	53                   	push   %ebx
+ 374:	e8 e2 05 00 00       	call   95b <close>
+  printf(1, "Step 3: Creating test files (should be recovered by roll-forward)...\n");
+ 379:	58                   	pop    %eax
+ 37a:	5a                   	pop    %edx
+ 37b:	68 f8 10 00 00       	push   $0x10f8
+ 380:	6a 01                	push   $0x1
+ 382:	e8 f9 06 00 00       	call   a80 <printf>
+  write_test_file(TEST_FILE1, "RECOVER_ME_1");
+ 387:	59                   	pop    %ecx
+ 388:	5b                   	pop    %ebx
+ 389:	68 1b 0e 00 00       	push   $0xe1b
+ 38e:	68 28 0e 00 00       	push   $0xe28
+ 393:	e8 38 fd ff ff       	call   d0 <write_test_file>
+  write_test_file(TEST_FILE2, "RECOVER_ME_2");
+ 398:	58                   	pop    %eax
+ 399:	5a                   	pop    %edx
+ 39a:	68 32 0e 00 00       	push   $0xe32
+ 39f:	68 3f 0e 00 00       	push   $0xe3f
+ 3a4:	e8 27 fd ff ff       	call   d0 <write_test_file>
+  write_test_file(TEST_FILE3, "RECOVER_ME_3");
+ 3a9:	59                   	pop    %ecx
+ 3aa:	5b                   	pop    %ebx
+ 3ab:	68 49 0e 00 00       	push   $0xe49
+ 3b0:	68 56 0e 00 00       	push   $0xe56
+ 3b5:	e8 16 fd ff ff       	call   d0 <write_test_file>
+  force_flush_no_checkpoint();
+ 3ba:	e8 81 fe ff ff       	call   240 <force_flush_no_checkpoint>
+  printf(1, "\n");
+ 3bf:	58                   	pop    %eax
+ 3c0:	5a                   	pop    %edx
+ 3c1:	68 f5 0e 00 00       	push   $0xef5
+ 3c6:	6a 01                	push   $0x1
+ 3c8:	e8 b3 06 00 00       	call   a80 <printf>
+  printf(1, "=== DATA WRITTEN TO LOG ===\n");
+ 3cd:	59                   	pop    %ecx
+ 3ce:	5b                   	pop    %ebx
+ 3cf:	68 60 0e 00 00       	push   $0xe60
+ 3d4:	6a 01                	push   $0x1
+ 3d6:	e8 a5 06 00 00       	call   a80 <printf>
+  printf(1, "Now CRASH the system by pressing Ctrl+A then X (QEMU quit)\n");
+ 3db:	58                   	pop    %eax
+ 3dc:	5a                   	pop    %edx
+ 3dd:	68 40 11 00 00       	push   $0x1140
+ 3e2:	6a 01                	push   $0x1
+ 3e4:	e8 97 06 00 00       	call   a80 <printf>
+  printf(1, "Or wait... the system will halt in 5 seconds.\n");
+ 3e9:	59                   	pop    %ecx
+ 3ea:	5b                   	pop    %ebx
+ 3eb:	68 7c 11 00 00       	push   $0x117c
+ 3f0:	6a 01                	push   $0x1
+ 3f2:	e8 89 06 00 00       	call   a80 <printf>
+  printf(1, "\n");
+ 3f7:	58                   	pop    %eax
+ 3f8:	5a                   	pop    %edx
+ 3f9:	68 f5 0e 00 00       	push   $0xef5
+ 3fe:	6a 01                	push   $0x1
+ 400:	e8 7b 06 00 00       	call   a80 <printf>
+  sleep(500);  // 5 seconds (100 ticks = 1 sec)
+ 405:	c7 04 24 f4 01 00 00 	movl   $0x1f4,(%esp)
+ 40c:	e8 b2 05 00 00       	call   9c3 <sleep>
+  printf(1, "HALTING SYSTEM (simulating crash)...\n");
+ 411:	59                   	pop    %ecx
+ 412:	5b                   	pop    %ebx
+ 413:	68 ac 11 00 00       	push   $0x11ac
+ 418:	6a 01                	push   $0x1
+ 41a:	e8 61 06 00 00       	call   a80 <printf>
+  printf(1, "\nPress Ctrl+A, X to quit QEMU now!\n");
+ 41f:	58                   	pop    %eax
+ 420:	5a                   	pop    %edx
+ 421:	68 d4 11 00 00       	push   $0x11d4
+ 426:	6a 01                	push   $0x1
+ 428:	e8 53 06 00 00       	call   a80 <printf>
+  printf(1, "Then run: make qemu-nox\n");
+ 42d:	59                   	pop    %ecx
+ 42e:	5b                   	pop    %ebx
+ 42f:	68 7d 0e 00 00       	push   $0xe7d
+ 434:	6a 01                	push   $0x1
+ 436:	e8 45 06 00 00       	call   a80 <printf>
+  printf(1, "Then run: crashtest verify\n");
+ 43b:	58                   	pop    %eax
+ 43c:	5a                   	pop    %edx
+ 43d:	68 96 0e 00 00       	push   $0xe96
+ 442:	6a 01                	push   $0x1
+ 444:	e8 37 06 00 00       	call   a80 <printf>
+ 449:	83 c4 10             	add    $0x10,%esp
+ 44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    sleep(100);
+ 450:	83 ec 0c             	sub    $0xc,%esp
+ 453:	6a 64                	push   $0x64
+ 455:	e8 69 05 00 00       	call   9c3 <sleep>
+ 45a:	83 c4 10             	add    $0x10,%esp
+ 45d:	eb f1                	jmp    450 <write_mode+0x160>
+ 45f:	90                   	nop
+
+00000460 <verify_mode>:
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	56                   	push   %esi
+ 464:	53                   	push   %ebx
+  printf(1, "\n=== CRASH TEST: VERIFY MODE ===\n\n");
+ 465:	83 ec 08             	sub    $0x8,%esp
+ 468:	68 f8 11 00 00       	push   $0x11f8
+ 46d:	6a 01                	push   $0x1
+ 46f:	e8 0c 06 00 00       	call   a80 <printf>
+  printf(1, "Checking if crash marker exists (should exist from checkpoint)...\n");
+ 474:	59                   	pop    %ecx
+ 475:	5b                   	pop    %ebx
+ 476:	68 1c 12 00 00       	push   $0x121c
+ 47b:	6a 01                	push   $0x1
+ 47d:	e8 fe 05 00 00       	call   a80 <printf>
+  if(verify_file(CRASH_MARKER_FILE, "CHECKPOINT_OK")){
+ 482:	5e                   	pop    %esi
+ 483:	58                   	pop    %eax
+ 484:	68 e4 0d 00 00       	push   $0xde4
+ 489:	68 f2 0d 00 00       	push   $0xdf2
+ 48e:	e8 ad fc ff ff       	call   140 <verify_file>
+ 493:	83 c4 10             	add    $0x10,%esp
+ 496:	85 c0                	test   %eax,%eax
+ 498:	0f 84 c2 00 00 00    	je     560 <verify_mode+0x100>
+  int pass = 0, fail = 0;
+ 49e:	31 f6                	xor    %esi,%esi
+    pass++;
+ 4a0:	bb 01 00 00 00       	mov    $0x1,%ebx
+  printf(1, "\nChecking if test files were recovered by roll-forward...\n");
+ 4a5:	83 ec 08             	sub    $0x8,%esp
+ 4a8:	68 60 12 00 00       	push   $0x1260
+ 4ad:	6a 01                	push   $0x1
+ 4af:	e8 cc 05 00 00       	call   a80 <printf>
+  if(verify_file(TEST_FILE1, "RECOVER_ME_1")){
+ 4b4:	58                   	pop    %eax
+ 4b5:	5a                   	pop    %edx
+ 4b6:	68 1b 0e 00 00       	push   $0xe1b
+ 4bb:	68 28 0e 00 00       	push   $0xe28
+ 4c0:	e8 7b fc ff ff       	call   140 <verify_file>
+ 4c5:	83 c4 10             	add    $0x10,%esp
+ 4c8:	85 c0                	test   %eax,%eax
+ 4ca:	0f 84 20 01 00 00    	je     5f0 <verify_mode+0x190>
+    pass++;
+ 4d0:	83 c3 01             	add    $0x1,%ebx
+  if(verify_file(TEST_FILE2, "RECOVER_ME_2")){
+ 4d3:	83 ec 08             	sub    $0x8,%esp
+ 4d6:	68 32 0e 00 00       	push   $0xe32
+ 4db:	68 3f 0e 00 00       	push   $0xe3f
+ 4e0:	e8 5b fc ff ff       	call   140 <verify_file>
+ 4e5:	83 c4 10             	add    $0x10,%esp
+ 4e8:	85 c0                	test   %eax,%eax
+ 4ea:	0f 84 80 00 00 00    	je     570 <verify_mode+0x110>
+  if(verify_file(TEST_FILE3, "RECOVER_ME_3")){
+ 4f0:	83 ec 08             	sub    $0x8,%esp
+ 4f3:	68 49 0e 00 00       	push   $0xe49
+ 4f8:	68 56 0e 00 00       	push   $0xe56
+ 4fd:	e8 3e fc ff ff       	call   140 <verify_file>
+ 502:	83 c4 10             	add    $0x10,%esp
+ 505:	85 c0                	test   %eax,%eax
+ 507:	0f 84 eb 00 00 00    	je     5f8 <verify_mode+0x198>
+  printf(1, "\n=== RESULTS ===\n");
+ 50d:	83 ec 08             	sub    $0x8,%esp
+    pass++;
+ 510:	83 c3 02             	add    $0x2,%ebx
+  printf(1, "\n=== RESULTS ===\n");
+ 513:	68 b2 0e 00 00       	push   $0xeb2
+ 518:	6a 01                	push   $0x1
+ 51a:	e8 61 05 00 00       	call   a80 <printf>
+  printf(1, "PASSED: %d\n", pass);
+ 51f:	83 c4 0c             	add    $0xc,%esp
+ 522:	53                   	push   %ebx
+ 523:	68 c4 0e 00 00       	push   $0xec4
+ 528:	6a 01                	push   $0x1
+ 52a:	e8 51 05 00 00       	call   a80 <printf>
+  printf(1, "FAILED: %d\n", fail);
+ 52f:	83 c4 0c             	add    $0xc,%esp
+ 532:	56                   	push   %esi
+ 533:	68 d0 0e 00 00       	push   $0xed0
+ 538:	6a 01                	push   $0x1
+ 53a:	e8 41 05 00 00       	call   a80 <printf>
+  if(fail == 0){
+ 53f:	83 c4 10             	add    $0x10,%esp
+ 542:	85 f6                	test   %esi,%esi
+ 544:	75 7b                	jne    5c1 <verify_mode+0x161>
+    printf(1, "\nROLL-FORWARD RECOVERY SUCCESSFUL!\n");
+ 546:	83 ec 08             	sub    $0x8,%esp
+ 549:	68 9c 12 00 00       	push   $0x129c
+ 54e:	6a 01                	push   $0x1
+ 550:	e8 2b 05 00 00       	call   a80 <printf>
+ 555:	83 c4 10             	add    $0x10,%esp
+}
+ 558:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 55b:	5b                   	pop    %ebx
+ 55c:	5e                   	pop    %esi
+ 55d:	5d                   	pop    %ebp
+ 55e:	c3                   	ret
+ 55f:	90                   	nop
+ 560:	89 c3                	mov    %eax,%ebx
+ 562:	be 01 00 00 00       	mov    $0x1,%esi
+ 567:	e9 39 ff ff ff       	jmp    4a5 <verify_mode+0x45>
+ 56c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(verify_file(TEST_FILE3, "RECOVER_ME_3")){
+ 570:	83 ec 08             	sub    $0x8,%esp
+    fail++;
+ 573:	83 c6 01             	add    $0x1,%esi
+  if(verify_file(TEST_FILE3, "RECOVER_ME_3")){
+ 576:	68 49 0e 00 00       	push   $0xe49
+ 57b:	68 56 0e 00 00       	push   $0xe56
+ 580:	e8 bb fb ff ff       	call   140 <verify_file>
+ 585:	83 c4 10             	add    $0x10,%esp
+ 588:	85 c0                	test   %eax,%eax
+ 58a:	75 71                	jne    5fd <verify_mode+0x19d>
+  printf(1, "\n=== RESULTS ===\n");
+ 58c:	83 ec 08             	sub    $0x8,%esp
+    fail++;
+ 58f:	83 c6 01             	add    $0x1,%esi
+  printf(1, "\n=== RESULTS ===\n");
+ 592:	68 b2 0e 00 00       	push   $0xeb2
+ 597:	6a 01                	push   $0x1
+ 599:	e8 e2 04 00 00       	call   a80 <printf>
+  printf(1, "PASSED: %d\n", pass);
+ 59e:	83 c4 0c             	add    $0xc,%esp
+ 5a1:	53                   	push   %ebx
+ 5a2:	68 c4 0e 00 00       	push   $0xec4
+ 5a7:	6a 01                	push   $0x1
+ 5a9:	e8 d2 04 00 00       	call   a80 <printf>
+  printf(1, "FAILED: %d\n", fail);
+ 5ae:	83 c4 0c             	add    $0xc,%esp
+ 5b1:	56                   	push   %esi
+ 5b2:	68 d0 0e 00 00       	push   $0xed0
+ 5b7:	6a 01                	push   $0x1
+ 5b9:	e8 c2 04 00 00       	call   a80 <printf>
+ 5be:	83 c4 10             	add    $0x10,%esp
+    printf(1, "\nROLL-FORWARD RECOVERY INCOMPLETE.\n");
+ 5c1:	83 ec 08             	sub    $0x8,%esp
+ 5c4:	68 c0 12 00 00       	push   $0x12c0
+ 5c9:	6a 01                	push   $0x1
+ 5cb:	e8 b0 04 00 00       	call   a80 <printf>
+    printf(1, "Some files written after checkpoint were not recovered.\n");
+ 5d0:	5a                   	pop    %edx
+ 5d1:	59                   	pop    %ecx
+ 5d2:	68 e4 12 00 00       	push   $0x12e4
+ 5d7:	6a 01                	push   $0x1
+ 5d9:	e8 a2 04 00 00       	call   a80 <printf>
+ 5de:	83 c4 10             	add    $0x10,%esp
+}
+ 5e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5e4:	5b                   	pop    %ebx
+ 5e5:	5e                   	pop    %esi
+ 5e6:	5d                   	pop    %ebp
+ 5e7:	c3                   	ret
+ 5e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+    fail++;
+ 5f0:	83 c6 01             	add    $0x1,%esi
+ 5f3:	e9 db fe ff ff       	jmp    4d3 <verify_mode+0x73>
+    pass++;
+ 5f8:	83 c3 01             	add    $0x1,%ebx
+ 5fb:	eb 8f                	jmp    58c <verify_mode+0x12c>
+  printf(1, "\n=== RESULTS ===\n");
+ 5fd:	50                   	push   %eax
+    pass++;
+ 5fe:	83 c3 01             	add    $0x1,%ebx
+  printf(1, "\n=== RESULTS ===\n");
+ 601:	50                   	push   %eax
+ 602:	68 b2 0e 00 00       	push   $0xeb2
+ 607:	6a 01                	push   $0x1
+ 609:	e8 72 04 00 00       	call   a80 <printf>
+  printf(1, "PASSED: %d\n", pass);
+ 60e:	83 c4 0c             	add    $0xc,%esp
+ 611:	53                   	push   %ebx
+ 612:	68 c4 0e 00 00       	push   $0xec4
+ 617:	6a 01                	push   $0x1
+ 619:	e8 62 04 00 00       	call   a80 <printf>
+  printf(1, "FAILED: %d\n", fail);
+ 61e:	83 c4 0c             	add    $0xc,%esp
+ 621:	eb 8e                	jmp    5b1 <verify_mode+0x151>
+ 623:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000630 <cleanup>:
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	57                   	push   %edi
+  for(i = 0; i < 20; i++){
+ 634:	31 ff                	xor    %edi,%edi
+{
+ 636:	56                   	push   %esi
+ 637:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 63a:	53                   	push   %ebx
+    name[5] = '0' + (i / 10);
+ 63b:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+{
+ 640:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "Cleaning up test files...\n");
+ 643:	68 dc 0e 00 00       	push   $0xedc
+ 648:	6a 01                	push   $0x1
+ 64a:	e8 31 04 00 00       	call   a80 <printf>
+  unlink(CRASH_MARKER_FILE);
+ 64f:	c7 04 24 f2 0d 00 00 	movl   $0xdf2,(%esp)
+ 656:	e8 28 03 00 00       	call   983 <unlink>
+  unlink(TEST_FILE1);
+ 65b:	c7 04 24 28 0e 00 00 	movl   $0xe28,(%esp)
+ 662:	e8 1c 03 00 00       	call   983 <unlink>
+  unlink(TEST_FILE2);
+ 667:	c7 04 24 3f 0e 00 00 	movl   $0xe3f,(%esp)
+ 66e:	e8 10 03 00 00       	call   983 <unlink>
+  unlink(TEST_FILE3);
+ 673:	c7 04 24 56 0e 00 00 	movl   $0xe56,(%esp)
+ 67a:	e8 04 03 00 00       	call   983 <unlink>
+ 67f:	83 c4 10             	add    $0x10,%esp
+ 682:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[5] = '0' + (i / 10);
+ 688:	89 f8                	mov    %edi,%eax
+    unlink(name);
+ 68a:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'd';
+ 68d:	c7 45 d8 64 75 6d 6d 	movl   $0x6d6d7564,-0x28(%ebp)
+    name[5] = '0' + (i / 10);
+ 694:	f7 e3                	mul    %ebx
+    name[4] = 'y';
+ 696:	c6 45 dc 79          	movb   $0x79,-0x24(%ebp)
+    name[7] = '\0';
+ 69a:	c6 45 df 00          	movb   $0x0,-0x21(%ebp)
+    name[5] = '0' + (i / 10);
+ 69e:	c1 ea 03             	shr    $0x3,%edx
+ 6a1:	8d 42 30             	lea    0x30(%edx),%eax
+    name[6] = '0' + (i % 10);
+ 6a4:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[5] = '0' + (i / 10);
+ 6a7:	88 45 dd             	mov    %al,-0x23(%ebp)
+    name[6] = '0' + (i % 10);
+ 6aa:	01 d2                	add    %edx,%edx
+ 6ac:	89 f8                	mov    %edi,%eax
+  for(i = 0; i < 20; i++){
+ 6ae:	83 c7 01             	add    $0x1,%edi
+    name[6] = '0' + (i % 10);
+ 6b1:	29 d0                	sub    %edx,%eax
+ 6b3:	83 c0 30             	add    $0x30,%eax
+ 6b6:	88 45 de             	mov    %al,-0x22(%ebp)
+    unlink(name);
+ 6b9:	56                   	push   %esi
+ 6ba:	e8 c4 02 00 00       	call   983 <unlink>
+  for(i = 0; i < 20; i++){
+ 6bf:	83 c4 10             	add    $0x10,%esp
+ 6c2:	83 ff 14             	cmp    $0x14,%edi
+ 6c5:	75 c1                	jne    688 <cleanup+0x58>
+  printf(1, "Cleanup done.\n");
+ 6c7:	83 ec 08             	sub    $0x8,%esp
+ 6ca:	68 f7 0e 00 00       	push   $0xef7
+ 6cf:	6a 01                	push   $0x1
+ 6d1:	e8 aa 03 00 00       	call   a80 <printf>
+}
+ 6d6:	83 c4 10             	add    $0x10,%esp
+ 6d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6dc:	5b                   	pop    %ebx
+ 6dd:	5e                   	pop    %esi
+ 6de:	5f                   	pop    %edi
+ 6df:	5d                   	pop    %ebp
+ 6e0:	c3                   	ret
+ 6e1:	66 90                	xchg   %ax,%ax
+ 6e3:	66 90                	xchg   %ax,%ax
+ 6e5:	66 90                	xchg   %ax,%ax
+ 6e7:	66 90                	xchg   %ax,%ax
+ 6e9:	66 90                	xchg   %ax,%ax
+ 6eb:	66 90                	xchg   %ax,%ax
+ 6ed:	66 90                	xchg   %ax,%ax
+ 6ef:	90                   	nop
+
+000006f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 6f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 6f1:	31 c0                	xor    %eax,%eax
+{
+ 6f3:	89 e5                	mov    %esp,%ebp
+ 6f5:	53                   	push   %ebx
+ 6f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 6f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 6fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 700:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 704:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 707:	83 c0 01             	add    $0x1,%eax
+ 70a:	84 d2                	test   %dl,%dl
+ 70c:	75 f2                	jne    700 <strcpy+0x10>
+    ;
+  return os;
+}
+ 70e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 711:	89 c8                	mov    %ecx,%eax
+ 713:	c9                   	leave
+ 714:	c3                   	ret
+ 715:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000720 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	53                   	push   %ebx
+ 724:	8b 55 08             	mov    0x8(%ebp),%edx
+ 727:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 72a:	0f b6 02             	movzbl (%edx),%eax
+ 72d:	84 c0                	test   %al,%al
+ 72f:	75 17                	jne    748 <strcmp+0x28>
+ 731:	eb 3a                	jmp    76d <strcmp+0x4d>
+ 733:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 737:	90                   	nop
+ 738:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 73c:	83 c2 01             	add    $0x1,%edx
+ 73f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 742:	84 c0                	test   %al,%al
+ 744:	74 1a                	je     760 <strcmp+0x40>
+    p++, q++;
+ 746:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 748:	0f b6 19             	movzbl (%ecx),%ebx
+ 74b:	38 c3                	cmp    %al,%bl
+ 74d:	74 e9                	je     738 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 74f:	29 d8                	sub    %ebx,%eax
+}
+ 751:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 754:	c9                   	leave
+ 755:	c3                   	ret
+ 756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 760:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 764:	31 c0                	xor    %eax,%eax
+ 766:	29 d8                	sub    %ebx,%eax
+}
+ 768:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 76b:	c9                   	leave
+ 76c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 76d:	0f b6 19             	movzbl (%ecx),%ebx
+ 770:	31 c0                	xor    %eax,%eax
+ 772:	eb db                	jmp    74f <strcmp+0x2f>
+ 774:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 77f:	90                   	nop
+
+00000780 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 786:	80 3a 00             	cmpb   $0x0,(%edx)
+ 789:	74 15                	je     7a0 <strlen+0x20>
+ 78b:	31 c0                	xor    %eax,%eax
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+ 790:	83 c0 01             	add    $0x1,%eax
+ 793:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 797:	89 c1                	mov    %eax,%ecx
+ 799:	75 f5                	jne    790 <strlen+0x10>
+    ;
+  return n;
+}
+ 79b:	89 c8                	mov    %ecx,%eax
+ 79d:	5d                   	pop    %ebp
+ 79e:	c3                   	ret
+ 79f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 7a0:	31 c9                	xor    %ecx,%ecx
+}
+ 7a2:	5d                   	pop    %ebp
+ 7a3:	89 c8                	mov    %ecx,%eax
+ 7a5:	c3                   	ret
+ 7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 7b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7bd:	89 d7                	mov    %edx,%edi
+ 7bf:	fc                   	cld
+ 7c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 7c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 7c5:	89 d0                	mov    %edx,%eax
+ 7c7:	c9                   	leave
+ 7c8:	c3                   	ret
+ 7c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 7da:	0f b6 10             	movzbl (%eax),%edx
+ 7dd:	84 d2                	test   %dl,%dl
+ 7df:	75 12                	jne    7f3 <strchr+0x23>
+ 7e1:	eb 1d                	jmp    800 <strchr+0x30>
+ 7e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7e7:	90                   	nop
+ 7e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 7ec:	83 c0 01             	add    $0x1,%eax
+ 7ef:	84 d2                	test   %dl,%dl
+ 7f1:	74 0d                	je     800 <strchr+0x30>
+    if(*s == c)
+ 7f3:	38 d1                	cmp    %dl,%cl
+ 7f5:	75 f1                	jne    7e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 7f7:	5d                   	pop    %ebp
+ 7f8:	c3                   	ret
+ 7f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 800:	31 c0                	xor    %eax,%eax
+}
+ 802:	5d                   	pop    %ebp
+ 803:	c3                   	ret
+ 804:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 80f:	90                   	nop
+
+00000810 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 815:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 818:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 819:	31 db                	xor    %ebx,%ebx
+{
+ 81b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 81e:	eb 27                	jmp    847 <gets+0x37>
+    cc = read(0, &c, 1);
+ 820:	83 ec 04             	sub    $0x4,%esp
+ 823:	6a 01                	push   $0x1
+ 825:	56                   	push   %esi
+ 826:	6a 00                	push   $0x0
+ 828:	e8 1e 01 00 00       	call   94b <read>
+    if(cc < 1)
+ 82d:	83 c4 10             	add    $0x10,%esp
+ 830:	85 c0                	test   %eax,%eax
+ 832:	7e 1d                	jle    851 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 834:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 838:	8b 55 08             	mov    0x8(%ebp),%edx
+ 83b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 83f:	3c 0a                	cmp    $0xa,%al
+ 841:	74 10                	je     853 <gets+0x43>
+ 843:	3c 0d                	cmp    $0xd,%al
+ 845:	74 0c                	je     853 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 847:	89 df                	mov    %ebx,%edi
+ 849:	83 c3 01             	add    $0x1,%ebx
+ 84c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 84f:	7c cf                	jl     820 <gets+0x10>
+ 851:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 853:	8b 45 08             	mov    0x8(%ebp),%eax
+ 856:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 85a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 85d:	5b                   	pop    %ebx
+ 85e:	5e                   	pop    %esi
+ 85f:	5f                   	pop    %edi
+ 860:	5d                   	pop    %ebp
+ 861:	c3                   	ret
+ 862:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000870 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 870:	55                   	push   %ebp
+ 871:	89 e5                	mov    %esp,%ebp
+ 873:	56                   	push   %esi
+ 874:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 875:	83 ec 08             	sub    $0x8,%esp
+ 878:	6a 00                	push   $0x0
+ 87a:	ff 75 08             	push   0x8(%ebp)
+ 87d:	e8 f1 00 00 00       	call   973 <open>
+  if(fd < 0)
+ 882:	83 c4 10             	add    $0x10,%esp
+ 885:	85 c0                	test   %eax,%eax
+ 887:	78 27                	js     8b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 889:	83 ec 08             	sub    $0x8,%esp
+ 88c:	ff 75 0c             	push   0xc(%ebp)
+ 88f:	89 c3                	mov    %eax,%ebx
+ 891:	50                   	push   %eax
+ 892:	e8 f4 00 00 00       	call   98b <fstat>
+  close(fd);
+ 897:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 89a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 89c:	e8 ba 00 00 00       	call   95b <close>
+  return r;
+ 8a1:	83 c4 10             	add    $0x10,%esp
+}
+ 8a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 8a7:	89 f0                	mov    %esi,%eax
+ 8a9:	5b                   	pop    %ebx
+ 8aa:	5e                   	pop    %esi
+ 8ab:	5d                   	pop    %ebp
+ 8ac:	c3                   	ret
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 8b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 8b5:	eb ed                	jmp    8a4 <stat+0x34>
+ 8b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8be:	66 90                	xchg   %ax,%ax
+
+000008c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	53                   	push   %ebx
+ 8c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 8c7:	0f be 02             	movsbl (%edx),%eax
+ 8ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 8cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 8d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 8d5:	77 1e                	ja     8f5 <atoi+0x35>
+ 8d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 8e0:	83 c2 01             	add    $0x1,%edx
+ 8e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 8e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 8ea:	0f be 02             	movsbl (%edx),%eax
+ 8ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 8f0:	80 fb 09             	cmp    $0x9,%bl
+ 8f3:	76 eb                	jbe    8e0 <atoi+0x20>
+  return n;
+}
+ 8f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8f8:	89 c8                	mov    %ecx,%eax
+ 8fa:	c9                   	leave
+ 8fb:	c3                   	ret
+ 8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000900 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	56                   	push   %esi
+ 905:	8b 45 10             	mov    0x10(%ebp),%eax
+ 908:	8b 55 08             	mov    0x8(%ebp),%edx
+ 90b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 90e:	85 c0                	test   %eax,%eax
+ 910:	7e 13                	jle    925 <memmove+0x25>
+ 912:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 914:	89 d7                	mov    %edx,%edi
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 920:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 921:	39 f8                	cmp    %edi,%eax
+ 923:	75 fb                	jne    920 <memmove+0x20>
+  return vdst;
+}
+ 925:	5e                   	pop    %esi
+ 926:	89 d0                	mov    %edx,%eax
+ 928:	5f                   	pop    %edi
+ 929:	5d                   	pop    %ebp
+ 92a:	c3                   	ret
+
+0000092b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 92b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 930:	cd 40                	int    $0x40
+ 932:	c3                   	ret
+
+00000933 <exit>:
+SYSCALL(exit)
+ 933:	b8 02 00 00 00       	mov    $0x2,%eax
+ 938:	cd 40                	int    $0x40
+ 93a:	c3                   	ret
+
+0000093b <wait>:
+SYSCALL(wait)
+ 93b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 940:	cd 40                	int    $0x40
+ 942:	c3                   	ret
+
+00000943 <pipe>:
+SYSCALL(pipe)
+ 943:	b8 04 00 00 00       	mov    $0x4,%eax
+ 948:	cd 40                	int    $0x40
+ 94a:	c3                   	ret
+
+0000094b <read>:
+SYSCALL(read)
+ 94b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 950:	cd 40                	int    $0x40
+ 952:	c3                   	ret
+
+00000953 <write>:
+SYSCALL(write)
+ 953:	b8 10 00 00 00       	mov    $0x10,%eax
+ 958:	cd 40                	int    $0x40
+ 95a:	c3                   	ret
+
+0000095b <close>:
+SYSCALL(close)
+ 95b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 960:	cd 40                	int    $0x40
+ 962:	c3                   	ret
+
+00000963 <kill>:
+SYSCALL(kill)
+ 963:	b8 06 00 00 00       	mov    $0x6,%eax
+ 968:	cd 40                	int    $0x40
+ 96a:	c3                   	ret
+
+0000096b <exec>:
+SYSCALL(exec)
+ 96b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 970:	cd 40                	int    $0x40
+ 972:	c3                   	ret
+
+00000973 <open>:
+SYSCALL(open)
+ 973:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 978:	cd 40                	int    $0x40
+ 97a:	c3                   	ret
+
+0000097b <mknod>:
+SYSCALL(mknod)
+ 97b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 980:	cd 40                	int    $0x40
+ 982:	c3                   	ret
+
+00000983 <unlink>:
+SYSCALL(unlink)
+ 983:	b8 12 00 00 00       	mov    $0x12,%eax
+ 988:	cd 40                	int    $0x40
+ 98a:	c3                   	ret
+
+0000098b <fstat>:
+SYSCALL(fstat)
+ 98b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 990:	cd 40                	int    $0x40
+ 992:	c3                   	ret
+
+00000993 <link>:
+SYSCALL(link)
+ 993:	b8 13 00 00 00       	mov    $0x13,%eax
+ 998:	cd 40                	int    $0x40
+ 99a:	c3                   	ret
+
+0000099b <mkdir>:
+SYSCALL(mkdir)
+ 99b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 9a0:	cd 40                	int    $0x40
+ 9a2:	c3                   	ret
+
+000009a3 <chdir>:
+SYSCALL(chdir)
+ 9a3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 9a8:	cd 40                	int    $0x40
+ 9aa:	c3                   	ret
+
+000009ab <dup>:
+SYSCALL(dup)
+ 9ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 9b0:	cd 40                	int    $0x40
+ 9b2:	c3                   	ret
+
+000009b3 <getpid>:
+SYSCALL(getpid)
+ 9b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 9b8:	cd 40                	int    $0x40
+ 9ba:	c3                   	ret
+
+000009bb <sbrk>:
+SYSCALL(sbrk)
+ 9bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 9c0:	cd 40                	int    $0x40
+ 9c2:	c3                   	ret
+
+000009c3 <sleep>:
+SYSCALL(sleep)
+ 9c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 9c8:	cd 40                	int    $0x40
+ 9ca:	c3                   	ret
+
+000009cb <uptime>:
+SYSCALL(uptime)
+ 9cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 9d0:	cd 40                	int    $0x40
+ 9d2:	c3                   	ret
+
+000009d3 <fsync>:
+SYSCALL(fsync)
+ 9d3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 9d8:	cd 40                	int    $0x40
+ 9da:	c3                   	ret
+ 9db:	66 90                	xchg   %ax,%ax
+ 9dd:	66 90                	xchg   %ax,%ax
+ 9df:	90                   	nop
+
+000009e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 9e0:	55                   	push   %ebp
+ 9e1:	89 e5                	mov    %esp,%ebp
+ 9e3:	57                   	push   %edi
+ 9e4:	56                   	push   %esi
+ 9e5:	53                   	push   %ebx
+ 9e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 9e8:	89 d1                	mov    %edx,%ecx
+{
+ 9ea:	83 ec 3c             	sub    $0x3c,%esp
+ 9ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 9f0:	85 d2                	test   %edx,%edx
+ 9f2:	0f 89 80 00 00 00    	jns    a78 <printint+0x98>
+ 9f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 9fc:	74 7a                	je     a78 <printint+0x98>
+    x = -xx;
+ 9fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ a00:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a05:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a08:	31 f6                	xor    %esi,%esi
+ a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a10:	89 c8                	mov    %ecx,%eax
+ a12:	31 d2                	xor    %edx,%edx
+ a14:	89 f7                	mov    %esi,%edi
+ a16:	f7 f3                	div    %ebx
+ a18:	8d 76 01             	lea    0x1(%esi),%esi
+ a1b:	0f b6 92 18 14 00 00 	movzbl 0x1418(%edx),%edx
+ a22:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a26:	89 ca                	mov    %ecx,%edx
+ a28:	89 c1                	mov    %eax,%ecx
+ a2a:	39 da                	cmp    %ebx,%edx
+ a2c:	73 e2                	jae    a10 <printint+0x30>
+  if(neg)
+ a2e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a31:	85 c0                	test   %eax,%eax
+ a33:	74 07                	je     a3c <printint+0x5c>
+    buf[i++] = '-';
+ a35:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a3a:	89 f7                	mov    %esi,%edi
+ a3c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a3f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a42:	01 df                	add    %ebx,%edi
+ a44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a48:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ a4b:	83 ec 04             	sub    $0x4,%esp
+ a4e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a51:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a54:	6a 01                	push   $0x1
+ a56:	50                   	push   %eax
+ a57:	56                   	push   %esi
+ a58:	e8 f6 fe ff ff       	call   953 <write>
+  while(--i >= 0)
+ a5d:	89 f8                	mov    %edi,%eax
+ a5f:	83 c4 10             	add    $0x10,%esp
+ a62:	83 ef 01             	sub    $0x1,%edi
+ a65:	39 d8                	cmp    %ebx,%eax
+ a67:	75 df                	jne    a48 <printint+0x68>
+}
+ a69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a6c:	5b                   	pop    %ebx
+ a6d:	5e                   	pop    %esi
+ a6e:	5f                   	pop    %edi
+ a6f:	5d                   	pop    %ebp
+ a70:	c3                   	ret
+ a71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a78:	31 c0                	xor    %eax,%eax
+ a7a:	eb 89                	jmp    a05 <printint+0x25>
+ a7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a80 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+ a83:	57                   	push   %edi
+ a84:	56                   	push   %esi
+ a85:	53                   	push   %ebx
+ a86:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a89:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ a8c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ a8f:	0f b6 1e             	movzbl (%esi),%ebx
+ a92:	83 c6 01             	add    $0x1,%esi
+ a95:	84 db                	test   %bl,%bl
+ a97:	74 67                	je     b00 <printf+0x80>
+ a99:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ a9c:	31 d2                	xor    %edx,%edx
+ a9e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ aa1:	eb 34                	jmp    ad7 <printf+0x57>
+ aa3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aa7:	90                   	nop
+ aa8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ aab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ ab0:	83 f8 25             	cmp    $0x25,%eax
+ ab3:	74 18                	je     acd <printf+0x4d>
+  write(fd, &c, 1);
+ ab5:	83 ec 04             	sub    $0x4,%esp
+ ab8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ abb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ abe:	6a 01                	push   $0x1
+ ac0:	50                   	push   %eax
+ ac1:	57                   	push   %edi
+ ac2:	e8 8c fe ff ff       	call   953 <write>
+ ac7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ aca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ acd:	0f b6 1e             	movzbl (%esi),%ebx
+ ad0:	83 c6 01             	add    $0x1,%esi
+ ad3:	84 db                	test   %bl,%bl
+ ad5:	74 29                	je     b00 <printf+0x80>
+    c = fmt[i] & 0xff;
+ ad7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ ada:	85 d2                	test   %edx,%edx
+ adc:	74 ca                	je     aa8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ ade:	83 fa 25             	cmp    $0x25,%edx
+ ae1:	75 ea                	jne    acd <printf+0x4d>
+      if(c == 'd'){
+ ae3:	83 f8 25             	cmp    $0x25,%eax
+ ae6:	0f 84 24 01 00 00    	je     c10 <printf+0x190>
+ aec:	83 e8 63             	sub    $0x63,%eax
+ aef:	83 f8 15             	cmp    $0x15,%eax
+ af2:	77 1c                	ja     b10 <printf+0x90>
+ af4:	ff 24 85 c0 13 00 00 	jmp    *0x13c0(,%eax,4)
+ afb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ b00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b03:	5b                   	pop    %ebx
+ b04:	5e                   	pop    %esi
+ b05:	5f                   	pop    %edi
+ b06:	5d                   	pop    %ebp
+ b07:	c3                   	ret
+ b08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b0f:	90                   	nop
+  write(fd, &c, 1);
+ b10:	83 ec 04             	sub    $0x4,%esp
+ b13:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b16:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ b1a:	6a 01                	push   $0x1
+ b1c:	52                   	push   %edx
+ b1d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ b20:	57                   	push   %edi
+ b21:	e8 2d fe ff ff       	call   953 <write>
+ b26:	83 c4 0c             	add    $0xc,%esp
+ b29:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b2c:	6a 01                	push   $0x1
+ b2e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ b31:	52                   	push   %edx
+ b32:	57                   	push   %edi
+ b33:	e8 1b fe ff ff       	call   953 <write>
+        putc(fd, c);
+ b38:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b3b:	31 d2                	xor    %edx,%edx
+ b3d:	eb 8e                	jmp    acd <printf+0x4d>
+ b3f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ b40:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b43:	83 ec 0c             	sub    $0xc,%esp
+ b46:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b4b:	8b 13                	mov    (%ebx),%edx
+ b4d:	6a 00                	push   $0x0
+ b4f:	89 f8                	mov    %edi,%eax
+        ap++;
+ b51:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ b54:	e8 87 fe ff ff       	call   9e0 <printint>
+        ap++;
+ b59:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b5c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b5f:	31 d2                	xor    %edx,%edx
+ b61:	e9 67 ff ff ff       	jmp    acd <printf+0x4d>
+ b66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ b70:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ b73:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b75:	83 c0 04             	add    $0x4,%eax
+ b78:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ b7b:	85 db                	test   %ebx,%ebx
+ b7d:	0f 84 9d 00 00 00    	je     c20 <printf+0x1a0>
+        while(*s != 0){
+ b83:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ b86:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ b88:	84 c0                	test   %al,%al
+ b8a:	0f 84 3d ff ff ff    	je     acd <printf+0x4d>
+ b90:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b93:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ b96:	89 de                	mov    %ebx,%esi
+ b98:	89 d3                	mov    %edx,%ebx
+ b9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ ba0:	83 ec 04             	sub    $0x4,%esp
+ ba3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ ba6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ ba9:	6a 01                	push   $0x1
+ bab:	53                   	push   %ebx
+ bac:	57                   	push   %edi
+ bad:	e8 a1 fd ff ff       	call   953 <write>
+        while(*s != 0){
+ bb2:	0f b6 06             	movzbl (%esi),%eax
+ bb5:	83 c4 10             	add    $0x10,%esp
+ bb8:	84 c0                	test   %al,%al
+ bba:	75 e4                	jne    ba0 <printf+0x120>
+      state = 0;
+ bbc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ bbf:	31 d2                	xor    %edx,%edx
+ bc1:	e9 07 ff ff ff       	jmp    acd <printf+0x4d>
+ bc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bcd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ bd0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ bd3:	83 ec 0c             	sub    $0xc,%esp
+ bd6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ bdb:	8b 13                	mov    (%ebx),%edx
+ bdd:	6a 01                	push   $0x1
+ bdf:	e9 6b ff ff ff       	jmp    b4f <printf+0xcf>
+ be4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ be8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ beb:	83 ec 04             	sub    $0x4,%esp
+ bee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ bf1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ bf3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ bf6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ bf9:	6a 01                	push   $0x1
+ bfb:	52                   	push   %edx
+ bfc:	57                   	push   %edi
+ bfd:	e8 51 fd ff ff       	call   953 <write>
+        ap++;
+ c02:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c05:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c08:	31 d2                	xor    %edx,%edx
+ c0a:	e9 be fe ff ff       	jmp    acd <printf+0x4d>
+ c0f:	90                   	nop
+  write(fd, &c, 1);
+ c10:	83 ec 04             	sub    $0x4,%esp
+ c13:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c16:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c19:	6a 01                	push   $0x1
+ c1b:	e9 11 ff ff ff       	jmp    b31 <printf+0xb1>
+ c20:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ c25:	bb b6 13 00 00       	mov    $0x13b6,%ebx
+ c2a:	e9 61 ff ff ff       	jmp    b90 <printf+0x110>
+ c2f:	90                   	nop
+
+00000c30 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c30:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c31:	a1 dc 17 00 00       	mov    0x17dc,%eax
+{
+ c36:	89 e5                	mov    %esp,%ebp
+ c38:	57                   	push   %edi
+ c39:	56                   	push   %esi
+ c3a:	53                   	push   %ebx
+ c3b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c3e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c48:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c4a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c4c:	39 ca                	cmp    %ecx,%edx
+ c4e:	73 30                	jae    c80 <free+0x50>
+ c50:	39 c1                	cmp    %eax,%ecx
+ c52:	72 04                	jb     c58 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c54:	39 c2                	cmp    %eax,%edx
+ c56:	72 f0                	jb     c48 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c58:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c5b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c5e:	39 f8                	cmp    %edi,%eax
+ c60:	74 2e                	je     c90 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c62:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c65:	8b 42 04             	mov    0x4(%edx),%eax
+ c68:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c6b:	39 f1                	cmp    %esi,%ecx
+ c6d:	74 38                	je     ca7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c6f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c71:	5b                   	pop    %ebx
+  freep = p;
+ c72:	89 15 dc 17 00 00    	mov    %edx,0x17dc
+}
+ c78:	5e                   	pop    %esi
+ c79:	5f                   	pop    %edi
+ c7a:	5d                   	pop    %ebp
+ c7b:	c3                   	ret
+ c7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c80:	39 c1                	cmp    %eax,%ecx
+ c82:	72 d0                	jb     c54 <free+0x24>
+ c84:	eb c2                	jmp    c48 <free+0x18>
+ c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c8d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c90:	03 70 04             	add    0x4(%eax),%esi
+ c93:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c96:	8b 02                	mov    (%edx),%eax
+ c98:	8b 00                	mov    (%eax),%eax
+ c9a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c9d:	8b 42 04             	mov    0x4(%edx),%eax
+ ca0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ca3:	39 f1                	cmp    %esi,%ecx
+ ca5:	75 c8                	jne    c6f <free+0x3f>
+    p->s.size += bp->s.size;
+ ca7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ caa:	89 15 dc 17 00 00    	mov    %edx,0x17dc
+    p->s.size += bp->s.size;
+ cb0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ cb3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ cb6:	89 0a                	mov    %ecx,(%edx)
+}
+ cb8:	5b                   	pop    %ebx
+ cb9:	5e                   	pop    %esi
+ cba:	5f                   	pop    %edi
+ cbb:	5d                   	pop    %ebp
+ cbc:	c3                   	ret
+ cbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000cc0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ cc0:	55                   	push   %ebp
+ cc1:	89 e5                	mov    %esp,%ebp
+ cc3:	57                   	push   %edi
+ cc4:	56                   	push   %esi
+ cc5:	53                   	push   %ebx
+ cc6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ ccc:	8b 15 dc 17 00 00    	mov    0x17dc,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cd2:	8d 78 07             	lea    0x7(%eax),%edi
+ cd5:	c1 ef 03             	shr    $0x3,%edi
+ cd8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ cdb:	85 d2                	test   %edx,%edx
+ cdd:	0f 84 8d 00 00 00    	je     d70 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ce3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ce5:	8b 48 04             	mov    0x4(%eax),%ecx
+ ce8:	39 f9                	cmp    %edi,%ecx
+ cea:	73 64                	jae    d50 <malloc+0x90>
+  if(nu < 4096)
+ cec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ cf1:	39 df                	cmp    %ebx,%edi
+ cf3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ cf6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ cfd:	eb 0a                	jmp    d09 <malloc+0x49>
+ cff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d00:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d02:	8b 48 04             	mov    0x4(%eax),%ecx
+ d05:	39 f9                	cmp    %edi,%ecx
+ d07:	73 47                	jae    d50 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d09:	89 c2                	mov    %eax,%edx
+ d0b:	39 05 dc 17 00 00    	cmp    %eax,0x17dc
+ d11:	75 ed                	jne    d00 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d13:	83 ec 0c             	sub    $0xc,%esp
+ d16:	56                   	push   %esi
+ d17:	e8 9f fc ff ff       	call   9bb <sbrk>
+  if(p == (char*)-1)
+ d1c:	83 c4 10             	add    $0x10,%esp
+ d1f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d22:	74 1c                	je     d40 <malloc+0x80>
+  hp->s.size = nu;
+ d24:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d27:	83 ec 0c             	sub    $0xc,%esp
+ d2a:	83 c0 08             	add    $0x8,%eax
+ d2d:	50                   	push   %eax
+ d2e:	e8 fd fe ff ff       	call   c30 <free>
+  return freep;
+ d33:	8b 15 dc 17 00 00    	mov    0x17dc,%edx
+      if((p = morecore(nunits)) == 0)
+ d39:	83 c4 10             	add    $0x10,%esp
+ d3c:	85 d2                	test   %edx,%edx
+ d3e:	75 c0                	jne    d00 <malloc+0x40>
+        return 0;
+  }
+}
+ d40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d43:	31 c0                	xor    %eax,%eax
+}
+ d45:	5b                   	pop    %ebx
+ d46:	5e                   	pop    %esi
+ d47:	5f                   	pop    %edi
+ d48:	5d                   	pop    %ebp
+ d49:	c3                   	ret
+ d4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d50:	39 cf                	cmp    %ecx,%edi
+ d52:	74 4c                	je     da0 <malloc+0xe0>
+        p->s.size -= nunits;
+ d54:	29 f9                	sub    %edi,%ecx
+ d56:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d59:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d5c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d5f:	89 15 dc 17 00 00    	mov    %edx,0x17dc
+}
+ d65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d68:	83 c0 08             	add    $0x8,%eax
+}
+ d6b:	5b                   	pop    %ebx
+ d6c:	5e                   	pop    %esi
+ d6d:	5f                   	pop    %edi
+ d6e:	5d                   	pop    %ebp
+ d6f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d70:	c7 05 dc 17 00 00 e0 	movl   $0x17e0,0x17dc
+ d77:	17 00 00 
+    base.s.size = 0;
+ d7a:	b8 e0 17 00 00       	mov    $0x17e0,%eax
+    base.s.ptr = freep = prevp = &base;
+ d7f:	c7 05 e0 17 00 00 e0 	movl   $0x17e0,0x17e0
+ d86:	17 00 00 
+    base.s.size = 0;
+ d89:	c7 05 e4 17 00 00 00 	movl   $0x0,0x17e4
+ d90:	00 00 00 
+    if(p->s.size >= nunits){
+ d93:	e9 54 ff ff ff       	jmp    cec <malloc+0x2c>
+ d98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d9f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ da0:	8b 08                	mov    (%eax),%ecx
+ da2:	89 0a                	mov    %ecx,(%edx)
+ da4:	eb b9                	jmp    d5f <malloc+0x9f>
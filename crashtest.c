@@ -99,9 +99,13 @@ write_mode(void)
   write_test_file(CRASH_MARKER_FILE, "CHECKPOINT_OK");
 
   // Force sync to create checkpoint
-  // Note: In xv6 LFS, there's no explicit sync syscall,
-  // so we rely on periodic sync or buffer full
-  printf(1, "Step 2: Waiting for periodic sync (30 sec) or forcing flush...\n");
+  printf(1, "Step 2: Syncing marker file to a checkpoint...\n");
+  int fd = open(CRASH_MARKER_FILE, O_RDONLY);
+  if(fd < 0 || fsync(fd) < 0){
+    printf(1, "crashtest: fsync %s failed\n", CRASH_MARKER_FILE);
+    exit();
+  }
+  close(fd);
 
   // Step 2: Create test files AFTER checkpoint
   // These should be recovered by roll-forward
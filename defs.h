@@ -13,8 +13,15 @@ struct superblock;
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
+struct buf*     bnew(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+void            bawrite(struct buf*);
+void            bwait(void);
+void            breadahead(uint, uint);
+void            bupdate(uint, uint, uchar*);
+int             bshrink(void);
+void            bsetmax(uint);
 
 // console.c
 void            consoleinit(void);
@@ -36,9 +43,10 @@ int             filewrite(struct file*, char*, int n);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
+void            dcache_invalidate(struct inode*, char*);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
-struct inode*   ialloc(uint, short);
+struct inode*   ialloc(uint, short, uint);
 struct inode*   idup(struct inode*);
 void            iinit(int dev);
 void            ilock(struct inode*);
@@ -53,11 +61,17 @@ int             readi(struct inode*, char*, uint, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
 void            lfs_sync(void);  // LFS: flush dirty inodes, imap, checkpoint
+void            lfs_fsync(void);
+int             lfs_segread(struct buf*);
+void            cleanerinit(void);
 
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            idesubmit(struct buf*);
+void            idesubmitv(struct buf**, int);
+void            idesync(struct buf*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -69,6 +83,7 @@ char*           kalloc(void);
 void            kfree(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+int             kfreecount(void);
 
 // kbd.c
 void            kbdintr(void);
@@ -108,6 +123,7 @@ int             cpuid(void);
 void            exit(void);
 int             fork(void);
 int             growproc(int);
+void            kproc(char*, void(*)(void));
 int             kill(int);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
@@ -14,16 +14,22 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  struct inode *prev; // LRU list of unreferenced inodes
+  struct inode *next;
+  struct inode *hnext; // hash chain
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
   uint version;       // LFS: inode version (for stale handle detection)
+  uint ra_next;       // readahead: block a sequential reader reads next
+  uint ra_end;        // readahead: first block not yet read ahead
+  uint ra_win;        // readahead: window, in blocks
 
   short type;         // copy of disk inode
   short major;
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint addrs[NDIRECT+2];
 };
 
 // table mapping major device number to
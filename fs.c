@@ -34,72 +34,1269 @@
 static void itrunc(struct inode*);
 static void lfs_flush_inodes(void);
 static void lfs_flush_only(void);  // Flush dirty inodes/SSB only, no checkpoint
+static void lfs_sync_run(void);    // lfs_sync() once lfs.syncing is set
 static void lfs_write_imap(void);
 static void lfs_write_sut(void);
-void lfs_flush_ssb_inline(void);  // Legacy compatibility
 static uint lfs_write_ssb_now(void);  // Write SSB to log immediately
 static uint gc_compute_checksum(struct ssb_entry *entries, int count);
 static void lfs_gc(void);
-static uint lfs_alloc(void);  // Allocate block from log (no SSB entry)
+static void lfs_gc_check(void);  // Run GC if free segments are low
 static uint lfs_alloc_with_ssb(uchar ssb_type, uint ssb_inum, uint ssb_offset, uint ssb_version);  // Allocate with atomic SSB entry
 static void lfs_write_pending_ssb(void);  // Write pending SSB
+static void lfs_segwrite(struct buf*);   // Stage a log block in the segment writer
+static void lfs_segflush(void);          // Push staged log blocks to disk and wait
+void lfs_update_usage(uint block_addr, int delta);
+static void dcache_init(void);
+static void dcache_purge(uint dev, uint inum);  // Forget a freed inode's names
 
 // There should be one superblock per disk device, but we run with only one device
 struct superblock sb;
 
+// Liveness of log blocks, for the cleaner.  Each segment has a bitmap
+// of its live blocks and a list of the inodes stored in it, with a
+// count per block.  lfs_update_usage() keeps the bits of data and
+// indirect blocks.  imap_set() keeps the inode lists, and an inode
+// block's bit follows its count.  All of it is built at mount by
+// lfs_build_live() and protected by lfs.lock.
+struct seglive {
+  uint live;                  // bit i: block i of the segment is live
+  uint ihead;                 // first inode on the segment's list, 0 if none
+  uchar icount[LFS_SEGSIZE];  // inodes stored in each block
+};
+
+// live has a bit per block of a segment.
+#if LFS_SEGSIZE > 32
+#error "LFS_SEGSIZE too big for struct seglive"
+#endif
+
+// An inode's links on its segment's list.
+struct ilink {
+  uint next;
+  uint prev;
+};
+
+#define SEGLIVE_PER_PAGE (PGSIZE / sizeof(struct seglive))
+
 // LFS state
 struct {
   struct spinlock lock;
-  uint imap[LFS_NINODES];      // inode number -> IMAP_ENCODE(block, version, slot)
+  struct imap_entry *imap[NIMAP_BLOCKS]; // in-memory imap, cp.imap_nblocks blocks
+  uchar imap_dirty[NIMAP_BLOCKS];        // imap block changed since last written
+  uint inum_used[LFS_MAXINODES / 32];    // bit per inode number with an imap entry
+  struct ilink *ilink[NIMAP_BLOCKS];     // segment list links, beside the imap
+  ushort imap_nfree[NIMAP_BLOCKS];       // free inode numbers in each imap block
+  uint *imap_ind[NIMAP_IND];             // in-memory imap index: addresses of imap blocks
+  uchar imap_ind_dirty[NIMAP_IND];       // index block changed since last written
   struct checkpoint cp;        // current checkpoint
   uint log_tail;               // next block to write
   uint cur_seg_end;            // end of current valid allocation region
   int dev;                     // device number
   int syncing;                 // recursion guard
+  struct proc *sync_proc;      // process that set syncing
   // GC / SUT state
-  struct sut_entry sut[LFS_NSEGS_MAX]; // Segment Usage Table
+  struct sut_entry **sut;      // Segment Usage Table, in PGSIZE pieces
+  uchar *sut_dirty;            // SUT block changed since last written
+  uint *sut_ind[NSUT_IND];     // in-memory SUT index: addresses of SUT blocks
+  uchar sut_ind_dirty[NSUT_IND]; // index block changed since last written
   struct ssb_entry ssb_buf[SSB_ENTRIES_PER_BLOCK]; // Buffer for current segment's SSBs
   uint ssb_count;              // Number of entries in ssb_buf
   uint ssb_seg_start;          // Start block of segment that SSB entries belong to
   int ssb_flushing;            // SSB flush in progress flag (prevent recursion)
   struct ssb_entry ssb_flush_buf[SSB_ENTRIES_PER_BLOCK]; // Separate buffer for flushing (to avoid races)
   uint ssb_pending_block;      // Block allocated for pending SSB (to write after alloc returns)
+  uint ssb_pending_prev;       // prev_ssb for the pending SSB, see ssb_chain()
   uint reserved_ssb_block;     // Explicitly reserved block for SSB (at end of segment)
   int ssb_pending_count;       // Number of entries in pending SSB
   uint ssb_next_seg;           // Next segment address for roll-forward (set at segment boundary)
   // GC free segment list (circular buffer)
-  uint free_segs[LFS_NSEGS_MAX];  // Free segment indices
+  uint **free_segs;                // Free segment indices, in PGSIZE pieces
+  struct seglive **live;           // in PGSIZE pieces, see lfs_build_live()
   int free_head;                   // Free list head index
   int free_tail;                   // Free list tail index
   int free_count;                  // Number of free segments
   int gc_running;                  // GC recursion guard
+  struct proc *gc_proc;            // process running the GC
+  uint write_tick;                 // last time a writer asked for a block
   int gc_failed;                   // GC found no segments last run
+  // Cleaner log head, see gc_alloc_block()
+  uint gc_tail;                    // next block of the cleaner's segment
+  uint gc_seg_end;                 // end of the cleaner's segment, 0 if none
+  uint gc_next;                    // segment set aside for it, 0 if none
+  struct ssb_entry gc_ssb_buf[SSB_ENTRIES_PER_BLOCK]; // entries for its next SSB
+  uint gc_ssb_count;               // Number of entries in gc_ssb_buf
   
-  // Pending free segments (waiting for checkpoint sync)
+  // Pending free segments (waiting for checkpoint sync), see gc_free_segment()
   uint pending_free_segs[GC_TARGET_SEGS];
   int pending_free_count;
 } lfs;
 
-// Dirty inode buffer - holds up to IPB (16) inodes before writing
+// Dirty inodes.  iupdate() and ialloc() stage an inode here instead
+// of writing it; lfs_flush_inodes() packs the staged inodes IPB to a
+// block and writes the blocks out together.  Slots are found through
+// a hash on the inode number.  Each staged copy belongs to a
+// generation: a flush takes the whole current generation and starts
+// the next, so an inode changed while the flush runs is staged again
+// in the new generation instead of waiting for it.  An inode thus has
+// at most two slots, the one being flushed and a newer one, and its
+// hash chain lists the newer first.
+#define NDSLOT   (2*LFS_NDIRTYINODE)
+#define NDBUCKET 61  // hash buckets; prime
+#define DHASH(inum) ((inum) % NDBUCKET)
+
 struct {
   struct spinlock lock;
-  // Active buffer
-  struct dinode inodes[IPB];
-  uint inums[IPB];
-  uint versions[IPB];
-  int count;
-  // Flushing buffer
-  struct dinode flushing_inodes[IPB];
-  uint flushing_inums[IPB];
-  uint flushing_versions[IPB];
+  struct dinode inodes[NDSLOT];
+  uint inums[NDSLOT];      // 0 if the slot is free
+  uint versions[NDSLOT];
+  uint gens[NDSLOT];       // generation the copy was staged in
+  int hnext[NDSLOT];       // hash chain or free list, -1 at the end
+  int bucket[NDBUCKET];
+  int free;                // first free slot
+  uint gen;                // generation being staged
+  int count;               // slots staged in generation gen
+  int flushing[LFS_NDIRTYINODE]; // slots lfs_flush_inodes() is writing
   int flushing_count;
 } dirty_inodes;
 
-// In-memory inode cache
-struct {
-  struct spinlock lock;
-  struct inode inode[NINODE];
-} icache;
+// Return the slot of inode inum's newest copy, or -1.  If staged is
+// set, only a copy in the current generation counts.
+// Caller must hold dirty_inodes.lock.
+static int
+dirty_find(uint inum, int staged)
+{
+  int d;
+
+  for(d = dirty_inodes.bucket[DHASH(inum)]; d >= 0; d = dirty_inodes.hnext[d]){
+    if(dirty_inodes.inums[d] == inum){
+      if(staged && dirty_inodes.gens[d] != dirty_inodes.gen)
+        return -1;
+      return d;
+    }
+  }
+  return -1;
+}
+
+// Stage a copy of inode inum in the current generation and return its
+// slot.  The caller must have made room with dirty_reserve().
+// Caller must hold dirty_inodes.lock.
+static int
+dirty_add(uint inum, uint version, struct dinode *dip)
+{
+  int d;
+
+  if((d = dirty_inodes.free) < 0 || dirty_inodes.count >= LFS_NDIRTYINODE)
+    panic("dirty_add");
+  dirty_inodes.free = dirty_inodes.hnext[d];
+  memmove(&dirty_inodes.inodes[d], dip, sizeof(*dip));
+  dirty_inodes.inums[d] = inum;
+  dirty_inodes.versions[d] = version;
+  dirty_inodes.gens[d] = dirty_inodes.gen;
+  dirty_inodes.hnext[d] = dirty_inodes.bucket[DHASH(inum)];
+  dirty_inodes.bucket[DHASH(inum)] = d;
+  dirty_inodes.count++;
+  return d;
+}
+
+// Free slot d.  Caller must hold dirty_inodes.lock.
+static void
+dirty_remove(int d)
+{
+  int *pp;
+
+  for(pp = &dirty_inodes.bucket[DHASH(dirty_inodes.inums[d])]; *pp != d;
+      pp = &dirty_inodes.hnext[*pp])
+    ;
+  *pp = dirty_inodes.hnext[d];
+  if(dirty_inodes.gens[d] == dirty_inodes.gen)
+    dirty_inodes.count--;
+  dirty_inodes.inums[d] = 0;
+  dirty_inodes.hnext[d] = dirty_inodes.free;
+  dirty_inodes.free = d;
+}
+
+// Make sure the current generation has room for one more inode,
+// flushing it if it is full.
+// Called and returns with dirty_inodes.lock held.
+static void
+dirty_reserve(void)
+{
+  if(dirty_inodes.count < LFS_NDIRTYINODE)
+    return;
+  // Buffer is full - flush only (no checkpoint, recoverable via roll-forward)
+  release(&dirty_inodes.lock);
+  lfs_flush_only();
+  acquire(&dirty_inodes.lock);
+  if(dirty_inodes.count < LFS_NDIRTYINODE)
+    return;
+  // lfs_flush_only() does nothing while the cleaner runs.
+  release(&dirty_inodes.lock);
+  lfs_flush_inodes();
+  acquire(&dirty_inodes.lock);
+  if(dirty_inodes.count >= LFS_NDIRTYINODE)
+    panic("dirty_reserve: no room");
+}
+
+// Dirty indirect blocks.  writei() updates an inode's indirect blocks
+// here instead of copying them to new log blocks for every data block
+// it writes; lfs_flush_inodes() gives each block a log address once,
+// together with its inode.  Protected by dirty_inodes.lock.
+struct {
+  uint inums[LFS_NDIRTYIND];             // owning inode, 0 if slot is free
+  uint keys[LFS_NDIRTYIND];              // which indirect block, see ind_locate()
+  uint olds[LFS_NDIRTYIND];              // log block the contents replace, 0 if none
+  uint addrs[LFS_NDIRTYIND][NINDIRECT];  // block contents
+} dirty_ind;
+
+// Dirty file data.  writei() leaves data blocks here instead of giving
+// them a log address; lfs_flush_inodes() writes them out with their
+// inode, so a block rewritten many times between syncs costs one log
+// block.  The blocks live in kalloc()ed pages, see lfs_data_grow().
+// Protected by dirty_inodes.lock.
+#define NDPP      (PGSIZE/BSIZE)  // cached blocks per page
+#define DMINFREE  1024            // free pages to leave before growing
+
+struct {
+  uint inums[LFS_NDIRTYDATA];          // owning inode, 0 if slot is free
+  uint bns[LFS_NDIRTYDATA];            // block number within the file
+  uchar *data[LFS_NDIRTYDATA];         // the block; slots n and up have none
+  int n;                               // slots with a block, NDPP per page
+} dirty_data;
+
+// In-memory inode cache.
+//
+// Every cached inode is on the hash chain of its (dev, inum), whether
+// or not it is referenced.  An inode whose last reference goes away
+// keeps its contents and moves to the LRU list, so the next iget() of
+// it finds it still valid and ilock() need not read it again.  iget()
+// recycles the least recently used entry when it has to.  iinit()
+// sizes the cache at ICACHEPCT percent of free memory.  icache.lock
+// protects ref, the hash chains and the LRU list.
+#define NIBUCKET 1021  // hash buckets; prime
+#define NIPP     (PGSIZE / sizeof(struct inode))
+
+#define IHASH(dev, inum) (((dev)*131 + (inum)) % NIBUCKET)
+
+struct {
+  struct spinlock lock;
+  struct inode *bucket[NIBUCKET];  // chains through hnext
+  int ninode;                      // inodes in the cache
+
+  // Unreferenced inodes, through prev/next.
+  // lru.next is most recently used.
+  struct inode lru;
+} icache;
+
+// Find the cached copy of (dev, inum).  Caller holds icache.lock.
+static struct inode*
+icache_find(uint dev, uint inum)
+{
+  struct inode *ip;
+
+  for(ip = icache.bucket[IHASH(dev, inum)]; ip != 0; ip = ip->hnext)
+    if(ip->dev == dev && ip->inum == inum)
+      return ip;
+  return 0;
+}
+
+// Take ip off its hash chain.  Caller holds icache.lock.
+static void
+icache_unhash(struct inode *ip)
+{
+  struct inode **pp;
+
+  for(pp = &icache.bucket[IHASH(ip->dev, ip->inum)]; *pp != 0; pp = &(*pp)->hnext){
+    if(*pp == ip){
+      *pp = ip->hnext;
+      return;
+    }
+  }
+}
+
+// Put ip on the LRU list: at the front, or at the back if its
+// contents are not worth keeping.  Caller holds icache.lock.
+static void
+icache_lru_add(struct inode *ip, int front)
+{
+  struct inode *at = front ? &icache.lru : icache.lru.prev;
+
+  ip->next = at->next;
+  ip->prev = at;
+  at->next->prev = ip;
+  at->next = ip;
+}
+
+// Segment writer.
+//
+// Log blocks are not written to disk one at a time.  lfs_segwrite()
+// copies each block into an in-memory image of the segment it belongs
+// to, and the whole segment is handed to the disk driver when the log
+// moves on to another segment, when the segment is full, or when a
+// checkpoint needs everything on disk (lfs_segflush).  Each log head
+// (the log proper, and the cleaner's, see gc_alloc_block) has two
+// segment buffers, so its next segment can fill while the previous one
+// is still being written.
+//
+// A staged block may be evicted from the buffer cache before its
+// segment reaches the disk, so bread() asks lfs_segread() first.
+struct segbuf {
+  uint start;                   // first block of the staged segment, 0 if unused
+  int nvalid;                   // number of slots holding data
+  uchar valid[LFS_SEGSIZE];     // slot holds the latest copy of its block
+  uchar dirty[LFS_SEGSIZE];     // slot not yet handed to the disk driver
+  struct buf blk[LFS_SEGSIZE];  // private buffers, not part of bcache
+  uchar data[LFS_SEGSIZE][BSIZE];  // their data
+};
+
+#define NHEAD    2  // log heads
+#define HEAD_LOG 0  // the log proper
+#define HEAD_GC  1  // blocks relocated by the cleaner
+
+struct {
+  struct sleeplock lock;
+  struct segbuf seg[2*NHEAD];   // seg[2*h] and seg[2*h+1] belong to head h
+  int cur[NHEAD];               // segment buffer each head is filling
+} segw;
+
+// Return the segment buffer staging the segment that holds blockno.
+// Caller must hold segw.lock.
+static struct segbuf*
+segw_lookup(uint blockno)
+{
+  uint start;
+  int i;
+
+  start = sb.segstart + (blockno - sb.segstart) / sb.segsize * sb.segsize;
+  for(i = 0; i < 2*NHEAD; i++){
+    if(segw.seg[i].start == start)
+      return &segw.seg[i];
+  }
+  return 0;
+}
+
+// Hand every dirty slot of s to the disk driver without waiting.
+// Runs of consecutive slots go out as single disk commands.
+// Caller must hold segw.lock.
+static void
+segw_submit(struct segbuf *s)
+{
+  struct buf *bv[LFS_SEGSIZE];
+  uint i;
+  int n;
+
+  n = 0;
+  for(i = 0; i < sb.segsize; i++){
+    if(!s->dirty[i])
+      continue;
+    s->dirty[i] = 0;
+    s->blk[i].flags = B_DIRTY;
+    bv[n++] = &s->blk[i];
+  }
+  idesubmitv(bv, n);
+}
+
+// Wait until every slot of s handed to the driver is on disk.
+// Caller must hold segw.lock.
+static void
+segw_drain(struct segbuf *s)
+{
+  uint i;
+
+  for(i = 0; i < sb.segsize; i++){
+    if(s->blk[i].flags & B_DIRTY)
+      idesync(&s->blk[i]);
+  }
+}
+
+// Stage data as the contents of log block blockno, which log head
+// head is writing.
+static void
+segw_put(int head, uint dev, uint blockno, uchar *data)
+{
+  struct segbuf *s;
+  struct buf *b;
+  uint slot;
+  int i, open;
+
+  acquiresleep(&segw.lock);
+  if((s = segw_lookup(blockno)) == 0){
+    // The head moved to a new segment: send its current one to the
+    // disk and switch to its other buffer once that write has finished.
+    s = &segw.seg[segw.cur[head]];
+    if(s->start != 0){
+      segw_submit(s);
+      segw.cur[head] ^= 1;
+      s = &segw.seg[segw.cur[head]];
+      segw_drain(s);
+    }
+    s->start = sb.segstart + (blockno - sb.segstart) / sb.segsize * sb.segsize;
+    s->nvalid = 0;
+    memset(s->valid, 0, sizeof(s->valid));
+    memset(s->dirty, 0, sizeof(s->dirty));
+  }
+
+  slot = blockno - s->start;
+  b = &s->blk[slot];
+  if(b->flags & B_DIRTY)
+    idesync(b);  // an older copy is still being written
+  b->dev = dev;
+  b->blockno = blockno;
+  memmove(b->data, data, BSIZE);
+  if(!s->valid[slot]){
+    s->valid[slot] = 1;
+    s->nvalid++;
+  }
+  s->dirty[slot] = 1;
+
+  // A late block for the segment already on its way (e.g. its SSB)
+  // goes out at once; a full segment goes out as a whole.
+  open = 0;
+  for(i = 0; i < NHEAD; i++)
+    if(s == &segw.seg[segw.cur[i]])
+      open = 1;
+  if(!open || s->nvalid == sb.segsize)
+    segw_submit(s);
+  releasesleep(&segw.lock);
+}
+
+// Write log block bp through the segment writer.
+// bp must be locked; it stays valid in the buffer cache.
+static void
+lfs_segwrite(struct buf *bp)
+{
+  if(!holdingsleep(&bp->lock))
+    panic("lfs_segwrite");
+  if(bp->blockno < sb.segstart || bp->blockno >= sb.size){
+    bwrite(bp);  // not a log block
+    return;
+  }
+  segw_put(HEAD_LOG, bp->dev, bp->blockno, bp->data);
+  bp->flags |= B_VALID;
+}
+
+// If b's block is staged in the segment writer, copy it into b
+// and return 1; otherwise return 0 and let the caller read the disk.
+int
+lfs_segread(struct buf *b)
+{
+  struct segbuf *s;
+  uint slot;
+  int r = 0;
+
+  if(sb.segsize == 0 || b->blockno < sb.segstart || b->blockno >= sb.size)
+    return 0;  // not mounted yet, or not a log block
+
+  acquiresleep(&segw.lock);
+  if((s = segw_lookup(b->blockno)) != 0){
+    slot = b->blockno - s->start;
+    if(s->valid[slot]){
+      memmove(b->data, s->blk[slot].data, BSIZE);
+      b->flags |= B_VALID;
+      r = 1;
+    }
+  }
+  releasesleep(&segw.lock);
+  return r;
+}
+
+// The cleaner freed the segment that starts at start: wait for any
+// staged copy of it to reach the disk and drop it, so that the
+// segment's next use starts on an empty buffer.
+static void
+segw_forget(uint start)
+{
+  struct segbuf *s;
+
+  acquiresleep(&segw.lock);
+  if((s = segw_lookup(start)) != 0){
+    segw_submit(s);
+    segw_drain(s);
+    s->start = 0;
+  }
+  releasesleep(&segw.lock);
+}
+
+// Send every staged log block to the disk and wait for it.
+// Must be called before a checkpoint refers to those blocks.
+static void
+lfs_segflush(void)
+{
+  int i;
+
+  acquiresleep(&segw.lock);
+  for(i = 0; i < 2*NHEAD; i++)
+    segw_submit(&segw.seg[i]);
+  for(i = 0; i < 2*NHEAD; i++)
+    segw_drain(&segw.seg[i]);
+  releasesleep(&segw.lock);
+}
+
+// Indirect blocks.
+//
+// Block bn of a file is at addrs[bn] of its inode if bn < NDIRECT.
+// The next NINDIRECT blocks are listed in the indirect block at
+// addrs[NDIRECT], and the NDINDIRECT after those in second-level
+// blocks listed in the double-indirect block at addrs[NDIRECT+1].
+//
+// Every indirect block is named by a key, which is also the offset
+// in its SSB entry: IND_SINGLE and IND_DROOT for the two blocks the
+// inode points at, and for a second-level block the number of the
+// first file block it maps.
+#define IND_SINGLE  NDIRECT
+#define IND_DROOT   (NDIRECT+1)
+#define IND_DSTART  (NDIRECT+NINDIRECT)  // first block under IND_DROOT
+#define IND_TYPE(key) ((key) == IND_DROOT ? SSB_TYPE_DINDIRECT : SSB_TYPE_INDIRECT)
+
+// Set *key and *n to the indirect block and entry holding the
+// address of file block bn.  *key is 0 for a direct block: its
+// address is addrs[*n] of the inode.
+static void
+ind_locate(uint bn, uint *key, uint *n)
+{
+  if(bn < NDIRECT){
+    *key = 0;
+    *n = bn;
+  } else if(bn < IND_DSTART){
+    *key = IND_SINGLE;
+    *n = bn - NDIRECT;
+  } else {
+    *n = (bn - IND_DSTART) % NINDIRECT;
+    *key = bn - *n;
+  }
+}
+
+// Set *pkey and *pn to where the address of indirect block key is
+// kept, in the same form as ind_locate().
+static void
+ind_parent(uint key, uint *pkey, uint *pn)
+{
+  if(key == IND_SINGLE || key == IND_DROOT){
+    *pkey = 0;
+    *pn = key;
+  } else {
+    *pkey = IND_DROOT;
+    *pn = (key - IND_DSTART) / NINDIRECT;
+  }
+}
+
+// Does key name an indirect block?
+static int
+ind_valid(uint key)
+{
+  if(key == IND_SINGLE || key == IND_DROOT)
+    return 1;
+  return key >= IND_DSTART && key < MAXFILE && (key - IND_DSTART) % NINDIRECT == 0;
+}
+
+// Return how many of the first max addresses in a continue a[0] in
+// consecutive log blocks: the length of the run a file written
+// sequentially leaves in one block list.  1 if a[0] is 0.
+static uint
+ind_run(uint *a, uint max)
+{
+  uint i;
+
+  if(a[0] == 0)
+    return 1;
+  for(i = 1; i < max && a[i] == a[0] + i; i++)
+    ;
+  return i;
+}
+
+// Dirty indirect blocks.
+//
+// An indirect block is loaded into dirty_ind the first time writei()
+// changes it and stays there, updated in place, until
+// lfs_flush_inodes() writes it to the log next to the inode.  While
+// a copy is in memory it is newer than the block its parent points
+// at, so every lookup through it goes through here.  A second-level
+// block is only loaded while the double-indirect block is, so that
+// flushing it can fill in its new address there.
+
+// Return the dirty_ind slot holding inum's indirect block key, or -1.
+// lfs_ind_find(0, 0) returns a free slot.
+// Caller must hold dirty_inodes.lock.
+static int
+lfs_ind_find(uint inum, uint key)
+{
+  int k;
+
+  for(k = 0; k < LFS_NDIRTYIND; k++){
+    if(dirty_ind.inums[k] == inum && (inum == 0 || dirty_ind.keys[k] == key))
+      return k;
+  }
+  return -1;
+}
+
+// Return a pointer to entry n of inum's indirect block pkey in
+// dirty_ind, or to addrs[n] if pkey is 0; 0 if the block is not in
+// memory.  Caller must hold dirty_inodes.lock.
+static uint*
+lfs_ind_ref(uint inum, uint pkey, uint n, uint *addrs)
+{
+  int k;
+
+  if(pkey == 0)
+    return &addrs[n];
+  if((k = lfs_ind_find(inum, pkey)) < 0)
+    return 0;
+  return &dirty_ind.addrs[k][n];
+}
+
+// Point addrs[i] of every in-memory copy of inode inum at addr: the
+// dirty inode slots, staged or being flushed, and the inode cache.
+// Caller must hold dirty_inodes.lock.
+static void
+lfs_patch_addr(uint inum, uint i, uint addr)
+{
+  struct inode *ip;
+  int d;
+
+  for(d = dirty_inodes.bucket[DHASH(inum)]; d >= 0; d = dirty_inodes.hnext[d]){
+    if(dirty_inodes.inums[d] == inum)
+      dirty_inodes.inodes[d].addrs[i] = addr;
+  }
+  acquire(&icache.lock);
+  if((ip = icache_find(lfs.dev, inum)) != 0)
+    ip->addrs[i] = addr;
+  release(&icache.lock);
+}
+
+// Copy inode inum's indirect block key into a free dirty_ind slot,
+// loading its parent first.  addrs is the inode's block list.
+// Returns 0 once the block is in memory, or -1 if every slot is taken.
+static int
+lfs_ind_load(uint inum, uint key, uint *addrs)
+{
+  struct buf *bp;
+  uint addr, pkey, pn, *ref;
+  int k;
+
+  ind_parent(key, &pkey, &pn);
+  for(;;){
+    if(pkey != 0 && lfs_ind_load(inum, pkey, addrs) < 0)
+      return -1;
+    acquire(&dirty_inodes.lock);
+    if(lfs_ind_find(inum, key) >= 0){
+      release(&dirty_inodes.lock);
+      return 0;
+    }
+    if((ref = lfs_ind_ref(inum, pkey, pn, addrs)) == 0){
+      // The parent was flushed meanwhile.
+      release(&dirty_inodes.lock);
+      continue;
+    }
+    addr = *ref;
+    release(&dirty_inodes.lock);
+    if(addr >= sb.size){
+      cprintf("lfs_ind_load: INVALID indirect addr=%d >= size=%d (inum=%d)\n",
+              addr, sb.size, inum);
+      panic("lfs_ind_load: corrupted indirect block address");
+    }
+    bp = addr ? bread(lfs.dev, addr) : 0;
+
+    acquire(&dirty_inodes.lock);
+    if((ref = lfs_ind_ref(inum, pkey, pn, addrs)) == 0 || *ref != addr){
+      // The cleaner moved the block while we read it.
+      release(&dirty_inodes.lock);
+      if(bp)
+        brelse(bp);
+      continue;
+    }
+    k = 0;
+    if(lfs_ind_find(inum, key) < 0){
+      if((k = lfs_ind_find(0, 0)) >= 0){
+        dirty_ind.inums[k] = inum;
+        dirty_ind.keys[k] = key;
+        dirty_ind.olds[k] = addr;
+        if(bp)
+          memmove(dirty_ind.addrs[k], bp->data, BSIZE);
+        else
+          memset(dirty_ind.addrs[k], 0, BSIZE);
+      }
+    }
+    release(&dirty_inodes.lock);
+    if(bp)
+      brelse(bp);
+    return k < 0 ? -1 : 0;
+  }
+}
+
+static uint lfs_ind_get(uint, uint*, uint, uint);
+
+// Return the address of inode inum's indirect block key, 0 if there
+// is none.
+static uint
+lfs_ind_addr(uint inum, uint *addrs, uint key)
+{
+  uint addr, pkey, pn;
+
+  ind_parent(key, &pkey, &pn);
+  if(pkey != 0)
+    return lfs_ind_get(inum, addrs, pkey, pn);
+  acquire(&dirty_inodes.lock);
+  addr = addrs[pn];
+  release(&dirty_inodes.lock);
+  return addr;
+}
+
+// Return entry n of inode inum's indirect block key, 0 if there is
+// no such block, and set *len to the length of the run of blocks it
+// starts, counting at most max entries.
+static uint
+lfs_ind_run(uint inum, uint *addrs, uint key, uint n, uint max, uint *len)
+{
+  struct buf *bp;
+  uint addr;
+  int k;
+
+  if(max > NINDIRECT - n)
+    max = NINDIRECT - n;
+  acquire(&dirty_inodes.lock);
+  if((k = lfs_ind_find(inum, key)) >= 0){
+    addr = dirty_ind.addrs[k][n];
+    *len = ind_run(&dirty_ind.addrs[k][n], max);
+    release(&dirty_inodes.lock);
+    return addr;
+  }
+  release(&dirty_inodes.lock);
+
+  *len = 1;
+  if((addr = lfs_ind_addr(inum, addrs, key)) == 0)
+    return 0;
+  if(addr >= sb.size){
+    cprintf("lfs_ind_run: INVALID indirect addr=%d >= size=%d (inum=%d)\n",
+            addr, sb.size, inum);
+    panic("lfs_ind_run: corrupted indirect block address");
+  }
+  bp = bread(lfs.dev, addr);
+  addr = ((uint*)bp->data)[n];
+  *len = ind_run((uint*)bp->data + n, max);
+  brelse(bp);
+  return addr;
+}
+
+// Return entry n of inode inum's indirect block key, 0 if there is
+// no such block.
+static uint
+lfs_ind_get(uint inum, uint *addrs, uint key, uint n)
+{
+  uint len;
+
+  return lfs_ind_run(inum, addrs, key, n, 1, &len);
+}
+
+static uint lfs_ind_update(uint, uint, uint*, uint, uint, uint, int);
+
+// Copy inode inum's indirect block key to the log tail right away,
+// with entry n set to addr, and point its parent at the copy.
+// Used when dirty_ind has no free slot.  Returns the entry's previous
+// value.
+static uint
+lfs_ind_cow(uint inum, uint version, uint *addrs, uint key, uint n, uint addr)
+{
+  struct buf *bp_old, *bp_new;
+  uint new_ind, old_ind, old, pkey, pn;
+
+  new_ind = lfs_alloc_with_ssb(IND_TYPE(key), inum, key, version);
+  lfs_write_pending_ssb();
+  lfs_update_usage(new_ind, BSIZE);
+  bp_new = bnew(lfs.dev, new_ind);
+  if((old_ind = lfs_ind_addr(inum, addrs, key)) != 0){
+    bp_old = bread(lfs.dev, old_ind);
+    memmove(bp_new->data, bp_old->data, BSIZE);
+    brelse(bp_old);
+  }
+  old = ((uint*)bp_new->data)[n];
+  ((uint*)bp_new->data)[n] = addr;
+  lfs_segwrite(bp_new);
+  brelse(bp_new);
+
+  ind_parent(key, &pkey, &pn);
+  if(pkey == 0){
+    acquire(&dirty_inodes.lock);
+    lfs_patch_addr(inum, pn, new_ind);
+    release(&dirty_inodes.lock);
+  } else
+    lfs_ind_update(inum, version, addrs, pkey, pn, new_ind, 0);
+  if(old_ind != 0)
+    lfs_update_usage(old_ind, -BSIZE);
+  return old;
+}
+
+// Set entry n of inode inum's indirect block key to addr and return
+// the entry's previous value.  The block is changed in dirty_ind,
+// after writing out the dirty inodes to free a slot if canflush is
+// set, or else copied to the log right away.
+static uint
+lfs_ind_update(uint inum, uint version, uint *addrs, uint key, uint n,
+               uint addr, int canflush)
+{
+  uint old;
+  int k;
+
+  for(;;){
+    acquire(&dirty_inodes.lock);
+    if((k = lfs_ind_find(inum, key)) >= 0){
+      old = dirty_ind.addrs[k][n];
+      dirty_ind.addrs[k][n] = addr;
+      release(&dirty_inodes.lock);
+      return old;
+    }
+    release(&dirty_inodes.lock);
+    if(lfs_ind_load(inum, key, addrs) == 0)
+      continue;
+    if(!canflush)
+      break;
+    lfs_flush_only();  // writes out the indirect blocks of dirty inodes
+    // lfs_flush_only() does nothing while the cleaner runs.
+    lfs_flush_inodes();
+    canflush = 0;
+  }
+
+  // Still no slot: copy the indirect block now.
+  return lfs_ind_cow(inum, version, addrs, key, n, addr);
+}
+
+// Return the address of block bn (>= NDIRECT) of ip, 0 if there is
+// none.  Caller must hold ip->lock.
+static uint
+lfs_ind_lookup(struct inode *ip, uint bn)
+{
+  uint key, n;
+
+  ind_locate(bn, &key, &n);
+  return lfs_ind_get(ip->inum, ip->addrs, key, n);
+}
+
+// Set the address of block bn (>= NDIRECT) of ip to addr.  The
+// indirect blocks are changed in memory and reach the log when ip is
+// next flushed; the caller must iupdate(ip).
+// Caller must hold ip->lock.
+static void
+lfs_ind_set(struct inode *ip, uint bn, uint addr)
+{
+  uint key, n;
+
+  ind_locate(bn, &key, &n);
+  lfs_ind_update(ip->inum, ip->version, ip->addrs, key, n, addr, 1);
+}
+
+// Is inum's indirect block key dirty in memory?
+static int
+lfs_ind_dirty(uint inum, uint key)
+{
+  int k;
+
+  acquire(&dirty_inodes.lock);
+  k = lfs_ind_find(inum, key);
+  release(&dirty_inodes.lock);
+  return k >= 0;
+}
+
+// Release every block listed in ip's indirect block key, and in the
+// blocks below it, and the block itself, dropping any dirty copies.
+// Caller must hold ip->lock.
+static void
+lfs_ind_free(struct inode *ip, uint key)
+{
+  uint j, addr, pkey, pn, *ref;
+  int k;
+
+  for(j = 0; j < NINDIRECT; j++){
+    addr = lfs_ind_get(ip->inum, ip->addrs, key, j);
+    if(key == IND_DROOT){
+      if(addr != 0 || lfs_ind_dirty(ip->inum, IND_DSTART + j*NINDIRECT))
+        lfs_ind_free(ip, IND_DSTART + j*NINDIRECT);
+    } else if(addr != 0)
+      lfs_update_usage(addr, -BSIZE);
+  }
+
+  // Read and clear the parent's pointer together with dropping the
+  // dirty copy, so that lfs_ind_flush() cannot move it in between.
+  ind_parent(key, &pkey, &pn);
+  acquire(&dirty_inodes.lock);
+  if((ref = lfs_ind_ref(ip->inum, pkey, pn, ip->addrs)) != 0){
+    addr = *ref;
+    *ref = 0;
+  }
+  if((k = lfs_ind_find(ip->inum, key)) >= 0)
+    dirty_ind.inums[k] = 0;
+  release(&dirty_inodes.lock);
+  if(ref == 0)
+    addr = lfs_ind_get(ip->inum, ip->addrs, pkey, pn);
+
+  if(addr != 0)
+    lfs_update_usage(addr, -BSIZE);
+}
+
+// Does inum have a second-level block in dirty_ind?
+// Caller must hold dirty_inodes.lock.
+static int
+lfs_ind_haschild(uint inum)
+{
+  int k;
+
+  for(k = 0; k < LFS_NDIRTYIND; k++){
+    if(dirty_ind.inums[k] == inum && dirty_ind.keys[k] >= IND_DSTART)
+      return 1;
+  }
+  return 0;
+}
+
+// Write the dirty indirect blocks of the inode in dirty slot fi
+// to the log and point their parents at the new copies.  Second-level
+// blocks go first, since each changes the double-indirect block.
+// Called by lfs_flush_inodes() before the inode block is written.
+static void
+lfs_ind_flush(int fi)
+{
+  struct dinode *dip;
+  struct buf *bp;
+  uint inum, version, key, block, old, pkey, pn, *ref;
+  int j, k;
+
+  dip = &dirty_inodes.inodes[fi];
+  inum = dirty_inodes.inums[fi];
+  version = dirty_inodes.versions[fi];
+  if(dip->type == 0)
+    return;
+
+  for(;;){
+    // Highest key first: second-level blocks, then the
+    // double-indirect block, then the single indirect block.
+    acquire(&dirty_inodes.lock);
+    k = -1;
+    for(j = 0; j < LFS_NDIRTYIND; j++){
+      if(dirty_ind.inums[j] == inum && (k < 0 || dirty_ind.keys[j] > dirty_ind.keys[k]))
+        k = j;
+    }
+    key = k >= 0 ? dirty_ind.keys[k] : 0;
+    release(&dirty_inodes.lock);
+    if(k < 0)
+      return;
+
+    block = lfs_alloc_with_ssb(IND_TYPE(key), inum, key, version);
+    lfs_write_pending_ssb();
+    lfs_update_usage(block, BSIZE);
+    bp = bnew(lfs.dev, block);
+
+    acquire(&dirty_inodes.lock);
+    ind_parent(key, &pkey, &pn);
+    if((k = lfs_ind_find(inum, key)) < 0 ||
+       (key == IND_DROOT && lfs_ind_haschild(inum))){
+      // Truncated while the block was being allocated, or a
+      // second-level block was loaded that must go first.
+      release(&dirty_inodes.lock);
+      brelse(bp);
+      lfs_update_usage(block, -BSIZE);
+      continue;
+    }
+    if((ref = lfs_ind_ref(inum, pkey, pn, dip->addrs)) == 0)
+      panic("lfs_ind_flush: no parent");
+    memmove(bp->data, dirty_ind.addrs[k], BSIZE);
+    old = dirty_ind.olds[k];
+    dirty_ind.inums[k] = 0;
+
+    // Every copy of the inode, or the dirty parent, now refers to
+    // the new block.
+    if(pkey == 0)
+      lfs_patch_addr(inum, pn, block);
+    else
+      *ref = block;
+    release(&dirty_inodes.lock);
+
+    lfs_segwrite(bp);
+    brelse(bp);
+    if(old != 0)
+      lfs_update_usage(old, -BSIZE);
+  }
+}
+
+// Cleaner hooks: if inum's indirect block key is dirty in memory,
+// look up or change its entries n through n+cnt-1 there and return 1;
+// otherwise return 0.
+static int
+lfs_ind_peek(uint inum, uint key, uint n, uint cnt, uint *addrs)
+{
+  int k;
+
+  if(n + cnt > NINDIRECT)
+    return 0;
+  acquire(&dirty_inodes.lock);
+  if((k = lfs_ind_find(inum, key)) >= 0)
+    memmove(addrs, &dirty_ind.addrs[k][n], cnt * sizeof(uint));
+  release(&dirty_inodes.lock);
+  return k >= 0;
+}
+
+static int
+lfs_ind_poke(uint inum, uint key, uint n, uint cnt, uint *addrs)
+{
+  int k;
+
+  if(n + cnt > NINDIRECT)
+    return 0;
+  acquire(&dirty_inodes.lock);
+  if((k = lfs_ind_find(inum, key)) >= 0)
+    memmove(&dirty_ind.addrs[k][n], addrs, cnt * sizeof(uint));
+  release(&dirty_inodes.lock);
+  return k >= 0;
+}
+
+// The cleaner moved inum's on-disk indirect block key from old to new.
+static void
+lfs_ind_moved(uint inum, uint key, uint old, uint new)
+{
+  int k;
+
+  acquire(&dirty_inodes.lock);
+  if((k = lfs_ind_find(inum, key)) >= 0 && dirty_ind.olds[k] == old)
+    dirty_ind.olds[k] = new;
+  release(&dirty_inodes.lock);
+}
+
+// Dirty file data.
+//
+// A data block written by writei() stays in dirty_data until its
+// inode is flushed; only then does it get a log address and an SSB
+// entry, and the inode's block pointers are changed to it.  Until
+// then the cached copy is newer than the block the inode points at,
+// so readi() and writei() look here first.
+//
+// The cache grows a page at a time, up to LFS_NDIRTYDATA blocks,
+// while memory is plentiful.  Once fewer than DMINFREE pages are
+// free, a writer that finds it full writes it back instead, and the
+// emptied pages go back to the page allocator.
+
+// Return the dirty_data slot holding block bn of inode inum, or -1.
+// lfs_data_find(0, 0) returns a free slot.
+// Caller must hold dirty_inodes.lock.
+static int
+lfs_data_find(uint inum, uint bn)
+{
+  int k;
+
+  for(k = 0; k < dirty_data.n; k++){
+    if(dirty_data.inums[k] == inum && (inum == 0 || dirty_data.bns[k] == bn))
+      return k;
+  }
+  return -1;
+}
+
+// Add a page of slots to the cache, unless memory is short or the
+// cache is at LFS_NDIRTYDATA.  Returns 1 if it grew.
+static int
+lfs_data_grow(void)
+{
+  char *page;
+  int i, r = 0;
+
+  if(dirty_data.n + NDPP > LFS_NDIRTYDATA || kfreecount() <= DMINFREE)
+    return 0;
+  if((page = kalloc()) == 0)
+    return 0;
+  acquire(&dirty_inodes.lock);
+  if(dirty_data.n + NDPP <= LFS_NDIRTYDATA){
+    for(i = 0; i < NDPP; i++){
+      dirty_data.inums[dirty_data.n] = 0;
+      dirty_data.data[dirty_data.n++] = (uchar*)page + i*BSIZE;
+    }
+    r = 1;
+  }
+  release(&dirty_inodes.lock);
+  if(!r)
+    kfree(page);
+  return r;
+}
+
+// While memory is short, give the pages at the end of the cache
+// whose slots are all free back to the page allocator.
+static void
+lfs_data_shrink(void)
+{
+  char *page;
+  int i;
+
+  while(kfreecount() <= DMINFREE){
+    page = 0;
+    acquire(&dirty_inodes.lock);
+    if(dirty_data.n >= NDPP){
+      for(i = dirty_data.n - NDPP; i < dirty_data.n; i++)
+        if(dirty_data.inums[i] != 0)
+          break;
+      if(i == dirty_data.n){
+        dirty_data.n -= NDPP;
+        page = (char*)dirty_data.data[dirty_data.n];
+        for(i = dirty_data.n; i < dirty_data.n + NDPP; i++)
+          dirty_data.data[i] = 0;
+      }
+    }
+    release(&dirty_inodes.lock);
+    if(page == 0)
+      return;
+    kfree(page);
+  }
+}
+
+// If block bn of ip is cached, copy n bytes at offset off into dst
+// and return 1; otherwise return 0.
+// Caller must hold ip->lock.
+static int
+lfs_data_read(struct inode *ip, uint bn, char *dst, uint off, uint n)
+{
+  int k;
+
+  acquire(&dirty_inodes.lock);
+  if((k = lfs_data_find(ip->inum, bn)) >= 0)
+    memmove(dst, dirty_data.data[k] + off, n);
+  release(&dirty_inodes.lock);
+  return k >= 0;
+}
+
+// Write n bytes from src at offset off of block bn of ip into the
+// cache.  Returns 0 on success, or -1 if no slot could be freed by
+// flushing dirty inodes.
+// Caller must hold ip->lock.
+static int
+lfs_data_write(struct inode *ip, uint bn, uint off, char *src, uint n)
+{
+  struct buf *bp;
+  uint addr;
+  int k, flushed = 0;
+
+  for(;;){
+    acquire(&dirty_inodes.lock);
+    if((k = lfs_data_find(ip->inum, bn)) >= 0){
+      memmove(dirty_data.data[k] + off, src, n);
+      release(&dirty_inodes.lock);
+      return 0;
+    }
+    release(&dirty_inodes.lock);
+
+    // A partial write starts from the block's current contents.
+    bp = 0;
+    if(n < BSIZE){
+      addr = bn < NDIRECT ? ip->addrs[bn] : lfs_ind_lookup(ip, bn);
+      if(addr >= sb.size){
+        cprintf("lfs_data_write: INVALID addr=%d >= size=%d (inum=%d)\n",
+                addr, sb.size, ip->inum);
+        panic("lfs_data_write: corrupted block address");
+      }
+      if(addr != 0)
+        bp = bread(ip->dev, addr);
+    }
+
+    acquire(&dirty_inodes.lock);
+    if((k = lfs_data_find(0, 0)) >= 0){
+      dirty_data.inums[k] = ip->inum;
+      dirty_data.bns[k] = bn;
+      if(bp)
+        memmove(dirty_data.data[k], bp->data, BSIZE);
+      else
+        memset(dirty_data.data[k], 0, BSIZE);
+      memmove(dirty_data.data[k] + off, src, n);
+    }
+    release(&dirty_inodes.lock);
+    if(bp)
+      brelse(bp);
+
+    if(k >= 0)
+      return 0;
+    if(lfs_data_grow())
+      continue;
+    if(flushed)
+      return -1;
+    // Cache full, or memory short: write it back along with the
+    // dirty inodes, including ip, whose blocks may not be in the
+    // buffer yet.
+    iupdate(ip);
+    lfs_flush_only();
+    // lfs_flush_only() does nothing while the cleaner runs.
+    lfs_flush_inodes();
+    lfs_data_shrink();
+    flushed = 1;
+  }
+}
+
+// Discard every cached block of inode inum.
+static void
+lfs_data_drop(uint inum)
+{
+  int k;
+
+  acquire(&dirty_inodes.lock);
+  for(k = 0; k < dirty_data.n; k++){
+    if(dirty_data.inums[k] == inum)
+      dirty_data.inums[k] = 0;
+  }
+  release(&dirty_inodes.lock);
+}
+
+// Write the cached blocks of the inode in dirty slot fi to the
+// log, lowest block first, and point the inode at them.
+// Called by lfs_flush_inodes() before the inode's indirect blocks
+// and the inode block itself are written.
+static void
+lfs_data_flush(int fi)
+{
+  struct dinode *dip;
+  struct buf *bp;
+  uint inum, bn, addr, old, key, n;
+  int j, k;
+
+  dip = &dirty_inodes.inodes[fi];
+  inum = dirty_inodes.inums[fi];
+  if(dip->type == 0)
+    return;
+
+  for(;;){
+    acquire(&dirty_inodes.lock);
+    k = -1;
+    for(j = 0; j < dirty_data.n; j++){
+      if(dirty_data.inums[j] == inum && (k < 0 || dirty_data.bns[j] < dirty_data.bns[k]))
+        k = j;
+    }
+    bn = k >= 0 ? dirty_data.bns[k] : 0;
+    release(&dirty_inodes.lock);
+    if(k < 0)
+      return;
+
+    addr = lfs_alloc_with_ssb(SSB_TYPE_DATA, inum, bn, dirty_inodes.versions[fi]);
+    lfs_write_pending_ssb();
+    lfs_update_usage(addr, BSIZE);
+    bp = bnew(lfs.dev, addr);
+
+    acquire(&dirty_inodes.lock);
+    if(lfs_data_find(inum, bn) < 0){
+      // Truncated while the block was being allocated.
+      release(&dirty_inodes.lock);
+      brelse(bp);
+      lfs_update_usage(addr, -BSIZE);
+      continue;
+    }
+    if(bn < NDIRECT){
+      old = dip->addrs[bn];
+      lfs_patch_addr(inum, bn, addr);
+    } else {
+      release(&dirty_inodes.lock);
+      ind_locate(bn, &key, &n);
+      old = lfs_ind_update(inum, dirty_inodes.versions[fi], dip->addrs,
+                           key, n, addr, 0);
+      acquire(&dirty_inodes.lock);
+    }
+    // Copy last, in case writei() changed the block meanwhile.
+    if((k = lfs_data_find(inum, bn)) >= 0){
+      memmove(bp->data, dirty_data.data[k], BSIZE);
+      dirty_data.inums[k] = 0;
+    }
+    release(&dirty_inodes.lock);
+
+    lfs_segwrite(bp);
+    brelse(bp);
+    if(old != 0)
+      lfs_update_usage(old, -BSIZE);
+  }
+}
 
 // Read the super block.
 void
@@ -112,28 +1309,142 @@ readsb(int dev, struct superblock *sb)
   brelse(bp);
 }
 
-// Read SUT from disk (locations stored in checkpoint)
+// The SUT and the free segment ring are sized from the superblock at
+// mount and kept in kalloc()ed pages, so a small image pays for a few
+// pages and a large one for as many as it needs.  Like the imap, the
+// SUT stays resident: it is consulted under lfs.lock, where bread()
+// cannot sleep.  sut_dirty marks the blocks lfs_write_sut() must log.
+#define SUT_PER_PAGE (PGSIZE / sizeof(struct sut_entry))
+#define FREESEGS_PER_PAGE (PGSIZE / sizeof(uint))
+#define SUT_NBLOCKS() ((sb.nsegs + SUT_ENTRIES_PER_BLOCK - 1) / SUT_ENTRIES_PER_BLOCK)
+
+static void*
+lfs_pagealloc(void)
+{
+  char *page;
+
+  if((page = kalloc()) == 0)
+    panic("lfs_pagealloc: out of memory");
+  memset(page, 0, PGSIZE);
+  return page;
+}
+
+// Usage entry of segment seg.  Caller holds lfs.lock.
+static struct sut_entry*
+sut_get(uint seg)
+{
+  return &lfs.sut[seg / SUT_PER_PAGE][seg % SUT_PER_PAGE];
+}
+
+// Usage entry of segment seg, for a caller about to change it.
+// Caller holds lfs.lock.
+static struct sut_entry*
+sut_mod(uint seg)
+{
+  lfs.sut_dirty[seg / SUT_ENTRIES_PER_BLOCK] = 1;
+  return sut_get(seg);
+}
+
+// Put the SSB about to be written at blk at the head of its
+// segment's chain, and return the prev_ssb to write in its header.
+// A chain that does not grow upward is given up on, so the cleaner
+// will scan that segment instead.  Caller holds lfs.lock.
+static uint
+ssb_chain(uint blk)
+{
+  struct sut_entry *e = sut_mod((blk - sb.segstart) / sb.segsize);
+  uint prev = e->last_ssb;
+
+  if(prev >= blk)
+    e->nssb = SSB_CHAIN_UNKNOWN;
+  e->last_ssb = blk;
+  if(e->nssb == SSB_CHAIN_UNKNOWN)
+    return SSB_CHAIN_UNKNOWN;
+  e->nssb++;
+  return prev;
+}
+
+// Slot i of the free segment ring.  Caller holds lfs.lock.
+static uint*
+free_seg_at(uint i)
+{
+  return &lfs.free_segs[i / FREESEGS_PER_PAGE][i % FREESEGS_PER_PAGE];
+}
+
+// Log address of SUT block i.  Caller holds lfs.lock.
+static uint*
+sut_addr(uint i)
+{
+  return &lfs.sut_ind[i / SUT_ADDRS_PER_IND][i % SUT_ADDRS_PER_IND];
+}
+
+// Log address of imap block i.  Caller holds lfs.lock.
+static uint*
+imap_addr(uint i)
+{
+  return &lfs.imap_ind[i / IMAP_ADDRS_PER_IND][i % IMAP_ADDRS_PER_IND];
+}
+
+// Allocate the SUT for sb.nsegs segments and read it through the
+// index blocks named by the checkpoint.  Blocks the checkpoint does not
+// cover (a fresh image) start out zero and dirty.
 static void
 lfs_read_sut(int dev)
 {
   struct buf *bp;
-  uint i, j;
-  struct sut_entry *p;
-
-  // Initialize SUT
-  memset(lfs.sut, 0, sizeof(lfs.sut));
+  uint i, j, nblocks, nind, seg, n;
+  char *page = 0;
+
+  if(sb.nsegs > LFS_NSEGS_MAX)
+    panic("lfs_read_sut: too many segments");
+  nblocks = SUT_NBLOCKS();
+  nind = (nblocks + SUT_ADDRS_PER_IND - 1) / SUT_ADDRS_PER_IND;
+  if(lfs.cp.sut_nblocks > nblocks)
+    panic("lfs_read_sut: bad checkpoint");
+
+  lfs.sut = lfs_pagealloc();
+  for(i = 0; i * SUT_PER_PAGE < sb.nsegs; i++)
+    lfs.sut[i] = lfs_pagealloc();
+  lfs.free_segs = lfs_pagealloc();
+  for(i = 0; i * FREESEGS_PER_PAGE < sb.nsegs; i++)
+    lfs.free_segs[i] = lfs_pagealloc();
+  lfs.sut_dirty = lfs_pagealloc();
+  for(i = 0; i < nind; i++){
+    if(i % (PGSIZE / BSIZE) == 0)
+      page = lfs_pagealloc();
+    lfs.sut_ind[i] = (uint*)(page + (i % (PGSIZE / BSIZE)) * BSIZE);
+  }
 
-  for(i = 0; i < lfs.cp.sut_nblocks && i < NSUT_BLOCKS; i++){
-    if(lfs.cp.sut_addrs[i] == 0) continue; // Skip invalid address
-    bp = bread(dev, lfs.cp.sut_addrs[i]);
-    p = (struct sut_entry*)bp->data;
-    // Calculate how many entries fit in one block
-    int entries_per_block = BSIZE / sizeof(struct sut_entry);
-    for(j = 0; j < entries_per_block && (i * entries_per_block + j) < LFS_NSEGS_MAX; j++){
-      lfs.sut[i * entries_per_block + j] = p[j];
+  for(i = 0; i < nind; i++){
+    if(i * SUT_ADDRS_PER_IND >= lfs.cp.sut_nblocks || lfs.cp.sut_ind[i] == 0){
+      lfs.sut_ind_dirty[i] = 1;
+      continue;
+    }
+    bp = bread(dev, lfs.cp.sut_ind[i]);
+    memmove(lfs.sut_ind[i], bp->data, BSIZE);
+    brelse(bp);
+  }
+  for(i = 0; i < nblocks; i++){
+    if(i >= lfs.cp.sut_nblocks || *sut_addr(i) == 0){
+      // No usage recorded yet: the segments up to the log tail hold
+      // SSBs from mkfs that no chain knows about, and blocks that
+      // count as live until they are overwritten.
+      for(j = i * SUT_ENTRIES_PER_BLOCK; j < (i+1) * SUT_ENTRIES_PER_BLOCK && j < sb.nsegs; j++){
+        seg = sb.segstart + j * sb.segsize;
+        if(seg >= lfs.log_tail)
+          continue;
+        sut_get(j)->nssb = SSB_CHAIN_UNKNOWN;
+        n = lfs.log_tail - seg < sb.segsize ? lfs.log_tail - seg : sb.segsize;
+        sut_get(j)->live_bytes = n * BSIZE;
+      }
+      lfs.sut_dirty[i] = 1;
+      continue;
     }
+    bp = bread(dev, *sut_addr(i));
+    memmove(sut_get(i * SUT_ENTRIES_PER_BLOCK), bp->data, BSIZE);
     brelse(bp);
   }
+  lfs.cp.sut_nblocks = nblocks;
 }
 
 // Validate checkpoint: header timestamp must match footer timestamp
@@ -221,23 +1532,243 @@ lfs_read_checkpoint(int dev)
           selected, lfs.cp.timestamp, lfs.log_tail);
 }
 
-// Read imap from disk (locations stored in checkpoint)
+// The imap is kept in memory as block-sized pieces, one per imap
+// block named by the checkpoint, carved out of kalloc()ed pages.
+// imap_grow() adds a zeroed piece when ialloc() runs out of inode
+// numbers.  Pieces are never freed, so a racy read of an entry
+// always sees memory that belongs to the map.  A checkpoint writes
+// only the pieces marked dirty; the others keep their old address.
+#define IMAP_PER_PAGE (PGSIZE / BSIZE)
+
+// Marks an inode allocated but not yet written to the log.
+#define IMAP_NEW 0xFFFFFFFF
+
+// Liveness state of the segment holding log block addr, or 0 if addr
+// is not a log block or the state is not built yet.
+// Caller holds lfs.lock or is mounting.
+static struct seglive*
+seglive_of(uint addr)
+{
+  uint seg;
+
+  if(lfs.live == 0 || addr < sb.segstart || addr == IMAP_NEW)
+    return 0;
+  if((seg = (addr - sb.segstart) / sb.segsize) >= sb.nsegs)
+    return 0;
+  return &lfs.live[seg / SEGLIVE_PER_PAGE][seg % SEGLIVE_PER_PAGE];
+}
+
+#define SEG_BIT(addr) (1U << (((addr) - sb.segstart) % sb.segsize))
+
+// Mark log block addr live or dead.  Caller holds lfs.lock or is mounting.
 static void
-lfs_read_imap(int dev)
+live_mark(uint addr, int live)
 {
-  struct buf *bp;
-  uint i, j;
-  uint *p;
+  struct seglive *sl;
+
+  if((sl = seglive_of(addr)) == 0)
+    return;
+  if(live)
+    sl->live |= SEG_BIT(addr);
+  else
+    sl->live &= ~SEG_BIT(addr);
+}
+
+static struct ilink*
+ilink_get(uint inum)
+{
+  return &lfs.ilink[inum / IMAP_ENTRIES_PER_BLOCK][inum % IMAP_ENTRIES_PER_BLOCK];
+}
+
+// Inode inum is now stored in log block addr: put it on the segment's
+// list.  Caller holds lfs.lock or is mounting.
+static void
+ilist_add(uint inum, uint addr)
+{
+  struct seglive *sl = seglive_of(addr);
+  struct ilink *l = ilink_get(inum);
+
+  l->prev = 0;
+  l->next = sl->ihead;
+  if(sl->ihead)
+    ilink_get(sl->ihead)->prev = inum;
+  sl->ihead = inum;
+  if(sl->icount[(addr - sb.segstart) % sb.segsize]++ == 0)
+    sl->live |= SEG_BIT(addr);
+}
+
+// Inode inum is no longer stored in log block addr.
+// Caller holds lfs.lock.
+static void
+ilist_remove(uint inum, uint addr)
+{
+  struct seglive *sl = seglive_of(addr);
+  struct ilink *l = ilink_get(inum);
 
-  memset(lfs.imap, 0, sizeof(lfs.imap));
+  if(l->prev)
+    ilink_get(l->prev)->next = l->next;
+  else
+    sl->ihead = l->next;
+  if(l->next)
+    ilink_get(l->next)->prev = l->prev;
+  if(--sl->icount[(addr - sb.segstart) % sb.segsize] == 0)
+    sl->live &= ~SEG_BIT(addr);
+}
+
+// Number of inodes the in-memory imap covers.
+#define IMAP_NINODES() (lfs.cp.imap_nblocks * IMAP_ENTRIES_PER_BLOCK)
+
+// Add a zeroed block to the end of the imap.
+// Return -1 if the checkpoint has no room for it or memory is short.
+// Caller holds lfs.lock or is mounting.
+static int
+imap_grow(void)
+{
+  uint n = lfs.cp.imap_nblocks;
+  char *page, *lpage;
+  int i;
 
-  for(i = 0; i < lfs.cp.imap_nblocks && i < NIMAP_BLOCKS; i++){
-    bp = bread(dev, lfs.cp.imap_addrs[i]);
-    p = (uint*)bp->data;
-    for(j = 0; j < IMAP_ENTRIES_PER_BLOCK && (i * IMAP_ENTRIES_PER_BLOCK + j) < LFS_NINODES; j++){
-      lfs.imap[i * IMAP_ENTRIES_PER_BLOCK + j] = p[j];
+  if(n >= NIMAP_BLOCKS)
+    return -1;
+  if(n % IMAP_PER_PAGE == 0){
+    if((page = kalloc()) == 0)
+      return -1;
+    if((lpage = kalloc()) == 0){
+      kfree(page);
+      return -1;
     }
+    memset(page, 0, PGSIZE);
+    memset(lpage, 0, PGSIZE);
+    for(i = 0; i < IMAP_PER_PAGE && n + i < NIMAP_BLOCKS; i++){
+      lfs.imap[n + i] = (struct imap_entry*)(page + i*BSIZE);
+      lfs.ilink[n + i] = (struct ilink*)(lpage + i*BSIZE);
+    }
+  }
+  lfs.imap_dirty[n] = 1;
+  lfs.imap_nfree[n] = IMAP_ENTRIES_PER_BLOCK;
+  if(n == 0){
+    lfs.inum_used[0] |= 1;  // inode 0 is never handed out
+    lfs.imap_nfree[0]--;
+  }
+  lfs.cp.imap_nblocks = n + 1;
+  return 0;
+}
+
+// Return inode inum's imap entry; all zeros if the map does not
+// reach that far.
+static struct imap_entry
+imap_get(uint inum)
+{
+  struct imap_entry none = { 0, 0 };
+
+  if(inum >= IMAP_NINODES())
+    return none;
+  return lfs.imap[inum / IMAP_ENTRIES_PER_BLOCK][inum % IMAP_ENTRIES_PER_BLOCK];
+}
+
+// Record whether inode inum has an imap entry.
+// Caller holds lfs.lock or is mounting.
+static void
+inum_mark(uint inum, int used)
+{
+  uint b = inum / IMAP_ENTRIES_PER_BLOCK;
+
+  if(used){
+    lfs.inum_used[inum / 32] |= 1 << (inum % 32);
+    lfs.imap_nfree[b]--;
+  } else {
+    lfs.inum_used[inum / 32] &= ~(1 << (inum % 32));
+    lfs.imap_nfree[b]++;
+  }
+}
+
+// Point inode inum's imap entry at slot of block, growing the map to
+// reach inum if needed.  Caller holds lfs.lock or is mounting.
+static void
+imap_set(uint inum, uint block, uint version, uint slot)
+{
+  struct imap_entry *e;
+
+  while(inum >= IMAP_NINODES())
+    if(imap_grow() < 0)
+      panic("imap_set: imap full");
+  e = &lfs.imap[inum / IMAP_ENTRIES_PER_BLOCK][inum % IMAP_ENTRIES_PER_BLOCK];
+  if(inum != 0 && (e->block == 0) != (block == 0))
+    inum_mark(inum, block != 0);
+  if(inum != 0 && seglive_of(e->block))
+    ilist_remove(inum, e->block);
+  if(inum != 0 && seglive_of(block))
+    ilist_add(inum, block);
+  e->block = block;
+  e->vslot = IMAP_VSLOT(version, slot);
+  lfs.imap_dirty[inum / IMAP_ENTRIES_PER_BLOCK] = 1;
+}
+
+// Pick a free inode number and mark it IMAP_NEW.  Prefer the imap
+// block holding near, so that a directory's inodes share imap blocks
+// and a burst of creates dirties few of them.  Finding a block with a
+// free number looks at one counter per imap block, and finding the
+// number looks at that block's bitmap words.  Grows the map when
+// every number is in use; returns 0 if it cannot.
+// Caller holds lfs.lock.
+static uint
+inum_alloc(uint near)
+{
+  uint b, w, bit, inum;
+
+  b = near / IMAP_ENTRIES_PER_BLOCK;
+  if(b >= lfs.cp.imap_nblocks || lfs.imap_nfree[b] == 0){
+    for(b = 0; b < lfs.cp.imap_nblocks; b++)
+      if(lfs.imap_nfree[b] > 0)
+        break;
+    if(b == lfs.cp.imap_nblocks && imap_grow() < 0)
+      return 0;
+  }
+  for(w = b * IMAP_ENTRIES_PER_BLOCK / 32; ; w++)
+    if(lfs.inum_used[w] != 0xFFFFFFFF)
+      break;
+  for(bit = 0; lfs.inum_used[w] & (1 << bit); bit++)
+    ;
+  inum = w * 32 + bit;
+  imap_set(inum, IMAP_NEW, 0, 0);
+  return inum;
+}
+
+// Read imap from disk, through the index blocks named by the
+// checkpoint, and rebuild the free inode index from it.
+static void
+lfs_read_imap(int dev)
+{
+  struct buf *bp;
+  uint i, j, n, inum;
+  char *page = 0;
+
+  n = lfs.cp.imap_nblocks;
+  if(n > NIMAP_BLOCKS)
+    panic("lfs_read_imap: too many imap blocks");
+  for(i = 0; i < NIMAP_IND; i++){
+    if(i % (PGSIZE / BSIZE) == 0)
+      page = lfs_pagealloc();
+    lfs.imap_ind[i] = (uint*)(page + (i % (PGSIZE / BSIZE)) * BSIZE);
+    if(i * IMAP_ADDRS_PER_IND >= n)
+      continue;
+    bp = bread(dev, lfs.cp.imap_ind[i]);
+    memmove(lfs.imap_ind[i], bp->data, BSIZE);
+    brelse(bp);
+  }
+  lfs.cp.imap_nblocks = 0;
+  for(i = 0; i < n; i++){
+    if(imap_grow() < 0)
+      panic("lfs_read_imap: out of memory");
+    bp = bread(dev, *imap_addr(i));
+    memmove(lfs.imap[i], bp->data, BSIZE);
+    lfs.imap_dirty[i] = 0;
     brelse(bp);
+    for(j = 0; j < IMAP_ENTRIES_PER_BLOCK; j++){
+      inum = i * IMAP_ENTRIES_PER_BLOCK + j;
+      if(inum != 0 && lfs.imap[i][j].block != 0)
+        inum_mark(inum, 1);
+    }
   }
 }
 
@@ -252,6 +1783,9 @@ lfs_write_checkpoint(void)
   uint target_block;
   uchar *block_data;
 
+  // Everything the checkpoint points at must be on disk first.
+  lfs_segflush();
+
   // Prepare checkpoint data under lock
   acquire(&lfs.lock);
   ts = ++lfs.cp.timestamp;
@@ -287,9 +1821,7 @@ lfs_write_checkpoint(void)
   // STEP 3: Write footer timestamp LAST (last 4 bytes of block)
   // This marks successful completion of checkpoint write
   memmove(block_data + BSIZE - sizeof(uint), &ts, sizeof(uint));
-  bwrite(bp);
-
-  brelse(bp);
+  bawrite(bp);  // lfs_sync_run() waits for it with bwait()
 
   // Update in-memory footer timestamp
   acquire(&lfs.lock);
@@ -300,103 +1832,69 @@ lfs_write_checkpoint(void)
           (ts % 2 == 1) ? 0 : 1, ts);
 }
 
-// Write SUT to log (Dynamic size & Partial update)
+// Log one dirty block of the SUT, its index or the imap index and
+// record where it went.
+// Called with lfs.lock held; returns with it released.
 static void
-lfs_write_sut(void)
+lfs_write_meta_block(void *piece, uchar *dirty, uint *addr)
 {
   struct buf *bp;
-  uint i, j;
-  struct sut_entry *p;
-  int entries_per_block = BSIZE / sizeof(struct sut_entry);
-  
-  // 1. Dynamic Size: Use sb.nsegs instead of LFS_NSEGS_MAX
-  uint nsegs_to_write = sb.nsegs;
-  if(nsegs_to_write > LFS_NSEGS_MAX) nsegs_to_write = LFS_NSEGS_MAX;
-  uint nblocks = (nsegs_to_write + entries_per_block - 1) / entries_per_block;
-  
   uint block;
-  // Use static to avoid stack overflow
-  static struct sut_entry sut_copy[LFS_NSEGS_MAX];
-  char block_data[BSIZE]; // Temp buffer for comparison/writing
 
-  // Copy SUT under lock
+  // Check if we need to switch to a free segment
+  if(lfs.log_tail >= lfs.cur_seg_end){
+    if(lfs.free_count > 0){
+      uint free_seg = *free_seg_at(lfs.free_head);
+      lfs.free_head = (lfs.free_head + 1) % sb.nsegs;
+      lfs.free_count--;
+      lfs.log_tail = sb.segstart + free_seg * sb.segsize;
+      lfs.cur_seg_end = lfs.log_tail + sb.segsize;
+      sut_mod(free_seg)->live_bytes = 0;
+    } else {
+      release(&lfs.lock);
+      panic("lfs_write_sut: out of disk space (no free segments)");
+    }
+  }
+  block = lfs.log_tail++;
+  release(&lfs.lock);
+
+  bp = bnew(lfs.dev, block);
   acquire(&lfs.lock);
-  memmove(sut_copy, lfs.sut, sizeof(sut_copy));
-  lfs.cp.sut_nblocks = nblocks;
+  memmove(bp->data, piece, BSIZE);
+  *dirty = 0;
+  *addr = block;
   release(&lfs.lock);
+  lfs_segwrite(bp);
+  brelse(bp);
+}
 
-  for(i = 0; i < nblocks && i < NSUT_BLOCKS; i++){
-    // Prepare new block data
-    memset(block_data, 0, BSIZE);
-    p = (struct sut_entry*)block_data;
-    for(j = 0; j < entries_per_block && (i * entries_per_block + j) < nsegs_to_write; j++){
-      p[j] = sut_copy[i * entries_per_block + j];
-    }
+// Write the dirty SUT blocks to the log, then the index blocks
+// that now hold their new addresses.
+static void
+lfs_write_sut(void)
+{
+  uint i, ind;
 
-    // 2. Partial Update: Check against old block
-    uint old_addr;
+  for(i = 0; i < lfs.cp.sut_nblocks; i++){
     acquire(&lfs.lock);
-    old_addr = lfs.cp.sut_addrs[i];
-    release(&lfs.lock);
-
-    int need_write = 1;
-    if(old_addr != 0){
-      bp = bread(lfs.dev, old_addr);
-      if(memcmp(bp->data, block_data, BSIZE) == 0){
-        need_write = 0;
-      }
-      brelse(bp);
-    }
-
-    if(need_write){
-        // Allocate block for SUT
-        acquire(&lfs.lock);
-        // Check if we need to switch to a free segment
-        if(lfs.log_tail >= lfs.cur_seg_end){
-          if(lfs.free_count > 0){
-            uint free_seg = lfs.free_segs[lfs.free_head];
-            lfs.free_head = (lfs.free_head + 1) % LFS_NSEGS_MAX;
-            lfs.free_count--;
-            lfs.log_tail = sb.segstart + free_seg * sb.segsize;
-            lfs.cur_seg_end = lfs.log_tail + sb.segsize;
-            lfs.sut[free_seg].live_bytes = 0;
-
-          } else {
-            release(&lfs.lock);
-            panic("lfs_write_sut: out of disk space (no free segments)");
-          }
-        }
-        block = lfs.log_tail++;
-        lfs.cp.sut_addrs[i] = block;
-        release(&lfs.lock);
-
-        // Write SUT block (outside lock)
-        bp = bread(lfs.dev, block);
-        memmove(bp->data, block_data, BSIZE);
-        bwrite(bp);
-        brelse(bp);
+    if(!lfs.sut_dirty[i]){
+      release(&lfs.lock);
+      continue;
     }
+    ind = i / SUT_ADDRS_PER_IND;
+    lfs.sut_ind_dirty[ind] = 1;
+    lfs_write_meta_block(sut_get(i * SUT_ENTRIES_PER_BLOCK),
+                         &lfs.sut_dirty[i], sut_addr(i));
   }
-}
-
-// Add entry to SSB buffer
-// Called when a data block is written
-void
-lfs_add_ssb_entry(uchar type, uint inum, uint offset, uint version)
-{
-  acquire(&lfs.lock);
-  
-  // With LFS_SEGSIZE=32 and SSB capacity ~63, overflow is structurally impossible
-  // if we write 1 entry per block. We keep a basic check just in case.
-  if(lfs.ssb_count < SSB_ENTRIES_PER_BLOCK){
-    lfs.ssb_buf[lfs.ssb_count].type = type;
-    lfs.ssb_buf[lfs.ssb_count].inum = inum;
-    lfs.ssb_buf[lfs.ssb_count].offset = offset;
-    lfs.ssb_buf[lfs.ssb_count].version = version;
-    lfs.ssb_count++;
+  for(ind = 0; ind * SUT_ADDRS_PER_IND < lfs.cp.sut_nblocks; ind++){
+    acquire(&lfs.lock);
+    if(!lfs.sut_ind_dirty[ind]){
+      release(&lfs.lock);
+      continue;
+    }
+    lfs_write_meta_block(lfs.sut_ind[ind], &lfs.sut_ind_dirty[ind],
+                         &lfs.cp.sut_ind[ind]);
   }
-  
-  release(&lfs.lock);
 }
 
 // Write current SSB entries to log NOW (unconditionally)
@@ -408,7 +1906,7 @@ lfs_write_ssb_now_with_next(uint next_seg)
 {
   struct buf *bp;
   struct ssb *ssb_ptr;
-  uint block = 0;
+  uint block = 0, prev;
   int count;
   uint timestamp;
 
@@ -440,12 +1938,12 @@ lfs_write_ssb_now_with_next(uint next_seg)
     // Check if we need to switch to a free segment
     if(lfs.log_tail >= lfs.cur_seg_end){
       if(lfs.free_count > 0){
-        uint free_seg = lfs.free_segs[lfs.free_head];
-        lfs.free_head = (lfs.free_head + 1) % LFS_NSEGS_MAX;
+        uint free_seg = *free_seg_at(lfs.free_head);
+        lfs.free_head = (lfs.free_head + 1) % sb.nsegs;
         lfs.free_count--;
         lfs.log_tail = sb.segstart + free_seg * sb.segsize;
         lfs.cur_seg_end = lfs.log_tail + sb.segsize;
-        lfs.sut[free_seg].live_bytes = 0;
+        sut_mod(free_seg)->live_bytes = 0;
       } else {
         // Out of space - restore SSB entries and return 0
         // This can happen during GC when disk is critically full
@@ -459,19 +1957,20 @@ lfs_write_ssb_now_with_next(uint next_seg)
     }
     block = lfs.log_tail++;
   }
+  prev = ssb_chain(block);
   release(&lfs.lock);
 
   // Write SSB block (outside lock)
-  bp = bread(lfs.dev, block);
-  memset(bp->data, 0, BSIZE);
+  bp = bnew(lfs.dev, block);
   ssb_ptr = (struct ssb *)bp->data;
   ssb_ptr->magic = SSB_MAGIC;
   ssb_ptr->nblocks = count;
   ssb_ptr->checksum = gc_compute_checksum(lfs.ssb_flush_buf, count);
   ssb_ptr->timestamp = timestamp;
   ssb_ptr->next_seg_addr = next_seg;  // 0 if not at segment boundary
+  ssb_ptr->prev_ssb = prev;
   memmove(ssb_ptr->entries, lfs.ssb_flush_buf, count * sizeof(struct ssb_entry));
-  bwrite(bp);
+  lfs_segwrite(bp);
   brelse(bp);
 
   // Clear flushing flag
@@ -489,13 +1988,6 @@ lfs_write_ssb_now(void)
   return lfs_write_ssb_now_with_next(0);
 }
 
-// Legacy function for compatibility
-void
-lfs_flush_ssb_inline(void)
-{
-  lfs_write_ssb_now();
-}
-
 // Write pending SSB that was prepared during segment switch
 // MUST be called WITHOUT holding lfs.lock
 // Called from writei() after lfs_alloc() returns
@@ -503,7 +1995,7 @@ lfs_flush_ssb_inline(void)
 static void
 lfs_write_pending_ssb_with_next(uint next_seg)
 {
-  uint block;
+  uint block, prev;
   int count;
   uint timestamp;
 
@@ -513,21 +2005,22 @@ lfs_write_pending_ssb_with_next(uint next_seg)
     return;
   }
   block = lfs.ssb_pending_block;
+  prev = lfs.ssb_pending_prev;
   count = lfs.ssb_pending_count;
   timestamp = lfs.cp.timestamp;
   release(&lfs.lock);
 
   // Write SSB block (outside lock)
-  struct buf *bp = bread(lfs.dev, block);
-  memset(bp->data, 0, BSIZE);
+  struct buf *bp = bnew(lfs.dev, block);
   struct ssb *ssb_ptr = (struct ssb *)bp->data;
   ssb_ptr->magic = SSB_MAGIC;
   ssb_ptr->nblocks = count;
   ssb_ptr->checksum = gc_compute_checksum(lfs.ssb_flush_buf, count);
   ssb_ptr->timestamp = timestamp;
   ssb_ptr->next_seg_addr = next_seg;  // Next segment for roll-forward
+  ssb_ptr->prev_ssb = prev;
   memmove(ssb_ptr->entries, lfs.ssb_flush_buf, count * sizeof(struct ssb_entry));
-  bwrite(bp);
+  lfs_segwrite(bp);
   brelse(bp);
 
   // Clear pending state
@@ -580,6 +2073,7 @@ lfs_prepare_alloc(void)
     lfs.ssb_count = 0;
     // Allocate the LAST block for SSB
     lfs.ssb_pending_block = lfs.log_tail++;
+    lfs.ssb_pending_prev = ssb_chain(lfs.ssb_pending_block);
 
     // Calculate next segment address for roll-forward
     // After this SSB, allocation will move to the next segment
@@ -589,7 +2083,7 @@ lfs_prepare_alloc(void)
       lfs.ssb_next_seg = next_seg_start;
     } else if(lfs.free_count > 0){
       // Will use a free segment
-      lfs.ssb_next_seg = sb.segstart + lfs.free_segs[lfs.free_head] * sb.segsize;
+      lfs.ssb_next_seg = sb.segstart + *free_seg_at(lfs.free_head) * sb.segsize;
     } else {
       lfs.ssb_next_seg = 0;  // No next segment available
     }
@@ -615,17 +2109,19 @@ lfs_update_usage(uint block_addr, int delta)
   seg_idx = (block_addr - sb.segstart) / sb.segsize;
   
   acquire(&lfs.lock);
-  if(seg_idx < LFS_NSEGS_MAX){
+  if(seg_idx < sb.nsegs){
+    struct sut_entry *e = sut_mod(seg_idx);
     if(delta > 0){
-      lfs.sut[seg_idx].live_bytes += delta;
+      e->live_bytes += delta;
     } else {
-      if(lfs.sut[seg_idx].live_bytes >= -delta)
-        lfs.sut[seg_idx].live_bytes += delta;
+      if(e->live_bytes >= -delta)
+        e->live_bytes += delta;
       else
-        lfs.sut[seg_idx].live_bytes = 0;
+        e->live_bytes = 0;
     }
     // Update age (simple ticks)
-    lfs.sut[seg_idx].age = ticks;
+    e->age = ticks;
+    live_mark(block_addr, delta > 0);
   }
   release(&lfs.lock);
 }
@@ -635,6 +2131,95 @@ lfs_update_usage(uint block_addr, int delta)
 // Based on Sprite LFS paper: cost-benefit policy + UID-based live detection
 // ============================================================================
 
+#define GC_RUN LFS_SEGSIZE  // most blocks relocated as one run
+
+// The segment being cleaned.  gc_clean_segment() reads all of it
+// that can hold anything live in one disk transfer, into private
+// buffers that bypass the buffer cache, and relocated blocks go
+// straight to the segment writer: cleaning a segment pushes no
+// useful block out of the cache.  Only the process running the GC
+// uses it.
+struct {
+  uint start;                      // first block of the segment
+  uchar valid[LFS_SEGSIZE];        // slot has been read
+  struct buf blk[LFS_SEGSIZE];
+  uchar data[LFS_SEGSIZE][BSIZE];
+} gcseg;
+
+// Read slots [lo, hi) of the segment at gcseg.start that are not in
+// memory yet.  Consecutive slots go to the disk as one command.
+static void
+gc_seg_read(uint lo, uint hi)
+{
+  struct buf *bv[LFS_SEGSIZE];
+  struct buf *b;
+  uint i;
+  int n;
+
+  n = 0;
+  for(i = lo; i < hi; i++){
+    if(gcseg.valid[i])
+      continue;
+    b = &gcseg.blk[i];
+    b->dev = lfs.dev;
+    b->blockno = gcseg.start + i;
+    b->flags = 0;
+    b->data = gcseg.data[i];
+    bv[n++] = b;
+    gcseg.valid[i] = 1;
+  }
+  if(n == 0)
+    return;
+  idesubmitv(bv, n);
+  while(n > 0)
+    idesync(bv[--n]);
+}
+
+// Start cleaning the segment at seg_start: read its first n slots.
+// Blocks still staged in the segment writer are taken from there.
+static void
+gc_seg_load(uint seg_start, uint n)
+{
+  struct segbuf *s;
+  uint i;
+
+  gcseg.start = seg_start;
+  memset(gcseg.valid, 0, sizeof(gcseg.valid));
+  acquiresleep(&segw.lock);
+  if((s = segw_lookup(seg_start)) != 0){
+    for(i = 0; i < sb.segsize; i++){
+      if(s->valid[i]){
+        memmove(gcseg.data[i], s->blk[i].data, BSIZE);
+        gcseg.valid[i] = 1;
+      }
+    }
+  }
+  releasesleep(&segw.lock);
+  gc_seg_read(0, n);
+}
+
+// The contents of block blk of the segment being cleaned.
+static uchar*
+gc_seg_data(uint blk)
+{
+  uint i;
+
+  i = blk - gcseg.start;
+  if(blk < gcseg.start || i >= sb.segsize)
+    panic("gc_seg_data");
+  gc_seg_read(i, i + 1);
+  return gcseg.data[i];
+}
+
+// Write data to log block blk, which the cleaner allocated,
+// without taking a buffer for it.
+static void
+gc_segwrite(uint blk, uchar *data)
+{
+  segw_put(HEAD_GC, lfs.dev, blk, data);
+  bupdate(lfs.dev, blk, data);  // a stale copy from the segment's last use
+}
+
 // Compute checksum for SSB entries (simple XOR-based)
 static uint
 gc_compute_checksum(struct ssb_entry *entries, int count)
@@ -672,8 +2257,8 @@ gc_cost_benefit(uint seg_idx)
   uint score;
 
   acquire(&lfs.lock);
-  live_bytes = lfs.sut[seg_idx].live_bytes;
-  age = lfs.sut[seg_idx].age;
+  live_bytes = sut_get(seg_idx)->live_bytes;
+  age = sut_get(seg_idx)->age;
   release(&lfs.lock);
 
   // Calculate utilization percentage
@@ -711,22 +2296,29 @@ static int
 gc_select_victims(struct gc_victim *victims, int max_victims)
 {
   int i, j, k;
-  uint cur_seg;
+  uint cur_seg, end_seg, gc_seg, gc_next;
   uint seg_size_bytes = sb.segsize * BSIZE;
   int victim_count = 0;
 
-  // Get current segment (exclude from cleaning)
+  // Get the segments the two log heads write to (exclude from cleaning).
+  // Until the log first wraps, the log proper goes on into the
+  // unwritten segments past its tail, which are no victims either.
   acquire(&lfs.lock);
   cur_seg = (lfs.log_tail - sb.segstart) / sb.segsize;
+  end_seg = (lfs.cur_seg_end - sb.segstart + sb.segsize - 1) / sb.segsize;
+  gc_seg = lfs.gc_tail < lfs.gc_seg_end ?
+           (lfs.gc_tail - sb.segstart) / sb.segsize : sb.nsegs;
+  gc_next = lfs.gc_next ? (lfs.gc_next - sb.segstart) / sb.segsize : sb.nsegs;
   release(&lfs.lock);
 
-  // Scan all segments, skipping the current one being written to
-  for(i = 0; i < sb.nsegs && i < LFS_NSEGS_MAX; i++){
-    if(i == cur_seg) continue;  // Skip segment we're currently writing to
+  // Scan all segments, skipping the ones being written to
+  for(i = 0; i < sb.nsegs; i++){
+    if(i == cur_seg || (i > cur_seg && i < end_seg) || i == gc_seg ||
+       i == gc_next) continue;
     // Check utilization threshold
     uint live_bytes;
     acquire(&lfs.lock);
-    live_bytes = lfs.sut[i].live_bytes;
+    live_bytes = sut_get(i)->live_bytes;
     release(&lfs.lock);
 
     // Skip free segments (marked with special value)
@@ -772,21 +2364,45 @@ gc_select_victims(struct gc_victim *victims, int max_victims)
   return victim_count;
 }
 
-// Find SSB blocks within a segment by scanning for magic number
-// Returns number of SSBs found, fills ssb_addrs array
+// Find the SSB blocks of a segment, oldest first.
+// Returns number of SSBs found, fills ssb_addrs array.
+// Normally this follows the segment's chain from its SUT entry.  A
+// segment with SSBs outside the chain, or a chain that does not check
+// out, is scanned for SSB_MAGIC instead, which takes reading all of
+// it.  The segment must be the one in gcseg.
 static int
 gc_find_ssbs(uint seg_idx, uint *ssb_addrs, int max_ssbs)
 {
   uint seg_start = sb.segstart + seg_idx * sb.segsize;
   uint seg_end = seg_start + sb.segsize;
-  struct buf *bp;
   struct ssb *ssb_ptr;
   int count = 0;
-  uint blk;
+  uint blk, n;
+
+  acquire(&lfs.lock);
+  blk = sut_get(seg_idx)->last_ssb;
+  n = sut_get(seg_idx)->nssb;
+  release(&lfs.lock);
+
+  if(n != SSB_CHAIN_UNKNOWN && n <= max_ssbs){
+    for(count = n; count > 0; count--){
+      if(blk < seg_start || blk >= seg_end ||
+         (count < n && blk >= ssb_addrs[count]))
+        break;
+      ssb_ptr = (struct ssb *)gc_seg_data(blk);
+      if(ssb_ptr->magic != SSB_MAGIC || !gc_verify_checksum(ssb_ptr))
+        break;
+      ssb_addrs[count-1] = blk;
+      blk = ssb_ptr->prev_ssb;
+    }
+    if(count == 0 && blk == 0)
+      return n;
+    count = 0;
+  }
 
+  gc_seg_read(0, sb.segsize);
   for(blk = seg_start; blk < seg_end && count < max_ssbs; blk++){
-    bp = bread(lfs.dev, blk);
-    ssb_ptr = (struct ssb *)bp->data;
+    ssb_ptr = (struct ssb *)gc_seg_data(blk);
 
     if(ssb_ptr->magic == SSB_MAGIC){
       // Verify checksum
@@ -794,7 +2410,6 @@ gc_find_ssbs(uint seg_idx, uint *ssb_addrs, int max_ssbs)
         ssb_addrs[count++] = blk;
       }
     }
-    brelse(bp);
   }
 
   return count;
@@ -803,38 +2418,96 @@ gc_find_ssbs(uint seg_idx, uint *ssb_addrs, int max_ssbs)
 // Add segment to pending free list
 // Will be moved to real free list after checkpoint sync
 static void
-gc_free_segment(uint seg_idx)
+gc_free_segment(uint seg_idx)
+{
+  // Validate segment index
+  if(seg_idx >= sb.nsegs){
+    panic("gc_free_segment: invalid segment index");
+  }
+
+  // CRITICAL: Flush dirty inodes before freeing the segment
+  // This ensures that any relocated block's inode updates are persisted
+  // BEFORE the old segment can be reused
+  lfs_flush_inodes();
+  segw_forget(sb.segstart + seg_idx * sb.segsize);
+
+  acquire(&lfs.lock);
+  // Imap and SUT blocks carry no SSB entries and may have been left in
+  // place by several checkpoints.  Have the next one copy those here.
+  uint seg_start = sb.segstart + seg_idx * sb.segsize;
+  uint seg_end = seg_start + sb.segsize;
+  for(uint i = 0; i < lfs.cp.imap_nblocks; i++)
+    if(*imap_addr(i) >= seg_start && *imap_addr(i) < seg_end)
+      lfs.imap_dirty[i] = 1;
+  for(uint i = 0; i * IMAP_ADDRS_PER_IND < lfs.cp.imap_nblocks; i++)
+    if(lfs.cp.imap_ind[i] >= seg_start && lfs.cp.imap_ind[i] < seg_end)
+      lfs.imap_ind_dirty[i] = 1;
+  for(uint i = 0; i < lfs.cp.sut_nblocks; i++)
+    if(*sut_addr(i) >= seg_start && *sut_addr(i) < seg_end)
+      lfs.sut_dirty[i] = 1;
+  for(uint i = 0; i * SUT_ADDRS_PER_IND < lfs.cp.sut_nblocks; i++)
+    if(lfs.cp.sut_ind[i] >= seg_start && lfs.cp.sut_ind[i] < seg_end)
+      lfs.sut_ind_dirty[i] = 1;
+  // The last checkpoint may still point into the segment, so it
+  // cannot be reused until the next one is written.
+  if(lfs.pending_free_count >= GC_TARGET_SEGS)
+    panic("gc_free_segment: too many pending");
+  lfs.pending_free_segs[lfs.pending_free_count++] = seg_idx;
+  // Mark as free with special value (so GC won't re-select it)
+  sut_mod(seg_idx)->live_bytes = SUT_FREE_MARKER;
+  sut_get(seg_idx)->age = ticks;
+  sut_get(seg_idx)->last_ssb = 0;  // its SSBs are all stale now
+  sut_get(seg_idx)->nssb = 0;
+  seglive_of(seg_start)->live = 0;
+  release(&lfs.lock);
+}
+
+// Is no inode or SSB flush half done?  Until it is finished, a sync
+// skips its own inode flush, so inodes the cleaner moved may not be
+// written yet and its checkpoint cannot release any segment.
+// Caller must hold lfs.lock.
+static int
+lfs_flush_idle(void)
+{
+  int idle;
+
+  acquire(&dirty_inodes.lock);
+  idle = dirty_inodes.flushing_count == 0;
+  release(&dirty_inodes.lock);
+  return idle && !lfs.ssb_flushing;
+}
+
+// Put the first n pending segments on the free list, now that a
+// checkpoint no longer points into them.
+// Caller must hold lfs.lock.
+static void
+gc_release_pending(int n)
 {
-  // Validate segment index
-  if(seg_idx >= sb.nsegs){
-    panic("gc_free_segment: invalid segment index");
-  }
-
-  // CRITICAL: Flush dirty inodes before freeing the segment
-  // This ensures that any relocated block's inode updates are persisted
-  // BEFORE the old segment can be reused
-  lfs_flush_inodes();
+  int i;
 
-  acquire(&lfs.lock);
-  // Now safe to add to free list
-  if(lfs.free_count < LFS_NSEGS_MAX){
-    lfs.free_segs[lfs.free_tail] = seg_idx;
-    lfs.free_tail = (lfs.free_tail + 1) % LFS_NSEGS_MAX;
-    lfs.free_count++;
+  for(i = 0; i < n; i++){
+    if(lfs.free_count < sb.nsegs){
+      *free_seg_at(lfs.free_tail) = lfs.pending_free_segs[i];
+      lfs.free_tail = (lfs.free_tail + 1) % sb.nsegs;
+      lfs.free_count++;
+    }
   }
-  // Mark as free with special value (so GC won't re-select it)
-  lfs.sut[seg_idx].live_bytes = SUT_FREE_MARKER;
-  lfs.sut[seg_idx].age = ticks;
-  release(&lfs.lock);
+  lfs.pending_free_count -= n;
+  for(i = 0; i < lfs.pending_free_count; i++)
+    lfs.pending_free_segs[i] = lfs.pending_free_segs[n + i];
+  if(n > 0)
+    wakeup(&lfs.gc_running);  // writers waiting for a free segment
 }
 
-// Allocate a block during GC with proper SSB handling at segment boundaries.
+// Allocate a block during GC from the log proper's tail, with proper
+// SSB handling at segment boundaries.  Only used while the free list
+// has no segment for the cleaner's own head, see gc_alloc_block().
 // Flushes SSB buffer to disk when the current segment is about to fill up,
 // ensuring SSB entries stay within the segment they describe.
 // Returns allocated block number, or 0 on failure (out of space).
 // Caller must NOT hold lfs.lock.
 static uint
-gc_alloc_block(uchar type, uint inum, uint offset, uint version)
+gc_alloc_shared(uchar type, uint inum, uint offset, uint version)
 {
   static struct ssb_entry gc_ssb_tmp[SSB_ENTRIES_PER_BLOCK];
   uint block;
@@ -843,41 +2516,51 @@ gc_alloc_block(uchar type, uint inum, uint offset, uint version)
 
   // Check if current segment has only 1 block remaining and SSB needs flushing.
   // We must write SSB to the last block of the segment before switching.
-  if(lfs.log_tail < lfs.cur_seg_end){
-    uint remaining = lfs.cur_seg_end - lfs.log_tail;
-    if(remaining == 1 && lfs.ssb_count > 0){
+  // The segment ends before cur_seg_end while the log is still
+  // sequential; an SSB past the end would describe blocks that
+  // gc_find_ssbs() never looks for in the next segment.
+  uint seg_end = sb.segstart +
+    ((lfs.log_tail - sb.segstart) / sb.segsize + 1) * sb.segsize;
+  if(seg_end > lfs.cur_seg_end)
+    seg_end = lfs.cur_seg_end;
+  if(lfs.log_tail + 1 == seg_end){
+    if(lfs.ssb_count == 0){
+      lfs.log_tail++;  // No entries to cover: leave the block unused
+    } else {
       // Use the last block for SSB flush
       uint ssb_block = lfs.log_tail++;
+      uint prev = ssb_chain(ssb_block);
       int count = lfs.ssb_count;
       memmove(gc_ssb_tmp, lfs.ssb_buf, count * sizeof(struct ssb_entry));
       lfs.ssb_count = 0;
       release(&lfs.lock);
 
       // Write SSB to disk (outside lock)
-      struct buf *bp = bread(lfs.dev, ssb_block);
-      memset(bp->data, 0, BSIZE);
+      struct buf *bp = bnew(lfs.dev, ssb_block);
       struct ssb *ssb_ptr = (struct ssb *)bp->data;
       ssb_ptr->magic = SSB_MAGIC;
       ssb_ptr->nblocks = count;
       ssb_ptr->checksum = gc_compute_checksum(gc_ssb_tmp, count);
+      ssb_ptr->timestamp = lfs.cp.timestamp;
+      ssb_ptr->prev_ssb = prev;
       memmove(ssb_ptr->entries, gc_ssb_tmp, count * sizeof(struct ssb_entry));
-      bwrite(bp);
+      lfs_segwrite(bp);
       brelse(bp);
 
       acquire(&lfs.lock);
-      // Now log_tail == cur_seg_end, falls through to segment switch below
+      // Now log_tail == seg_end, falls through to segment switch below
     }
   }
 
   // Switch to new free segment if needed
   if(lfs.log_tail >= lfs.cur_seg_end){
     if(lfs.free_count > 0){
-      uint free_seg = lfs.free_segs[lfs.free_head];
-      lfs.free_head = (lfs.free_head + 1) % LFS_NSEGS_MAX;
+      uint free_seg = *free_seg_at(lfs.free_head);
+      lfs.free_head = (lfs.free_head + 1) % sb.nsegs;
       lfs.free_count--;
       lfs.log_tail = sb.segstart + free_seg * sb.segsize;
       lfs.cur_seg_end = lfs.log_tail + sb.segsize;
-      lfs.sut[free_seg].live_bytes = 0;
+      sut_mod(free_seg)->live_bytes = 0;
     } else {
       release(&lfs.lock);
       return 0;  // Out of space
@@ -890,6 +2573,7 @@ gc_alloc_block(uchar type, uint inum, uint offset, uint version)
   // Add SSB entry
   if(lfs.ssb_count < SSB_ENTRIES_PER_BLOCK){
     lfs.ssb_buf[lfs.ssb_count].type = type;
+    lfs.ssb_buf[lfs.ssb_count].slot = (block - sb.segstart) % sb.segsize;
     lfs.ssb_buf[lfs.ssb_count].inum = inum;
     lfs.ssb_buf[lfs.ssb_count].offset = offset;
     lfs.ssb_buf[lfs.ssb_count].version = version;
@@ -900,13 +2584,91 @@ gc_alloc_block(uchar type, uint inum, uint offset, uint version)
   return block;
 }
 
-// Relocate an inode block to the current log tail
+// Write the SSB entries of the cleaner's head to its next block.
+// Called when its segment is down to the last block, and at the end
+// of each GC run so the checkpoint that follows finds the cleaner's
+// segments summarized.  Only the GC calls this.
+static void
+gc_flush_ssb(void)
+{
+  static uchar blk[BSIZE];
+  struct ssb *ssb_ptr = (struct ssb *)blk;
+  uint block, prev;
+  int count;
+
+  acquire(&lfs.lock);
+  count = lfs.gc_ssb_count;
+  if(count == 0){
+    if(lfs.gc_tail + 1 == lfs.gc_seg_end)
+      lfs.gc_tail++;  // No entries to cover: leave the block unused
+    release(&lfs.lock);
+    return;
+  }
+  block = lfs.gc_tail++;
+  prev = ssb_chain(block);
+  memset(blk, 0, BSIZE);
+  ssb_ptr->magic = SSB_MAGIC;
+  ssb_ptr->nblocks = count;
+  ssb_ptr->checksum = gc_compute_checksum(lfs.gc_ssb_buf, count);
+  ssb_ptr->timestamp = lfs.cp.timestamp;
+  ssb_ptr->prev_ssb = prev;
+  memmove(ssb_ptr->entries, lfs.gc_ssb_buf, count * sizeof(struct ssb_entry));
+  lfs.gc_ssb_count = 0;
+  release(&lfs.lock);
+
+  gc_segwrite(block, blk);
+}
+
+// Allocate a block for a live block the GC is relocating.  Relocated
+// blocks have outlived everything else in their segment, so they are
+// cold: they go to a log head of their own, in a segment a checkpoint
+// set aside (see gc_reserve_seg), instead of beside the short-lived
+// blocks the log proper is writing.  The head's SSB takes the last
+// block of its segment, or the next one if gc_flush_ssb() is called
+// earlier.
+// Returns allocated block number, or 0 on failure (out of space).
+// Caller must NOT hold lfs.lock.
+static uint
+gc_alloc_block(uchar type, uint inum, uint offset, uint version)
+{
+  uint block;
+
+  acquire(&lfs.lock);
+  if(lfs.gc_tail + 1 == lfs.gc_seg_end){
+    release(&lfs.lock);
+    gc_flush_ssb();
+    acquire(&lfs.lock);
+  }
+
+  if(lfs.gc_tail >= lfs.gc_seg_end && lfs.gc_next != 0){
+    lfs.gc_tail = lfs.gc_next;
+    lfs.gc_seg_end = lfs.gc_tail + sb.segsize;
+    lfs.gc_next = 0;
+  }
+  if(lfs.gc_tail >= lfs.gc_seg_end){
+    // No segment set aside since the head's last one filled, e.g.
+    // before the log first wraps
+    release(&lfs.lock);
+    return gc_alloc_shared(type, inum, offset, version);
+  }
+
+  block = lfs.gc_tail++;
+  lfs.gc_ssb_buf[lfs.gc_ssb_count].type = type;
+  lfs.gc_ssb_buf[lfs.gc_ssb_count].slot = (block - sb.segstart) % sb.segsize;
+  lfs.gc_ssb_buf[lfs.gc_ssb_count].inum = inum;
+  lfs.gc_ssb_buf[lfs.gc_ssb_count].offset = offset;
+  lfs.gc_ssb_buf[lfs.gc_ssb_count].version = version;
+  lfs.gc_ssb_count++;
+  release(&lfs.lock);
+  return block;
+}
+
+// Relocate an inode block to the cleaner's log head
 // Updates imap entries for all inodes in the block
 // Returns 0 on success, -1 on failure (out of space)
 static int
 gc_relocate_inode_block(uint inum, uint old_block)
 {
-  struct buf *bp_old, *bp_new;
   uint new_block;
   int i;
 
@@ -917,425 +2679,381 @@ gc_relocate_inode_block(uint inum, uint old_block)
     return -1;
   }
 
-  // 1. Read old inode block
-  bp_old = bread(lfs.dev, old_block);
-
-  // 2. Find first inum in this block for SSB entry
-  uint first_inum = inum;
+  // 2. Find the inodes stored in this block on its segment's list
+  uint inums[IPB];
+  int ninums = 0;
   acquire(&lfs.lock);
-  for(i = 0; i < LFS_NINODES; i++){
-    uint entry = lfs.imap[i];
-    if(entry != 0 && entry != 0xFFFFFFFF){
-      if(IMAP_BLOCK(entry) == old_block){
-        first_inum = i;
-        break;
-      }
-    }
-  }
+  for(i = seglive_of(old_block)->ihead; i != 0 && ninums < IPB; i = ilink_get(i)->next)
+    if(imap_get(i).block == old_block)
+      inums[ninums++] = i;
   release(&lfs.lock);
+  if(ninums == 0)
+    return 0;  // its inodes have all moved on meanwhile
+  uint first_inum = inums[0];
 
   // 3. Allocate new block with SSB entry (handles segment boundary SSB flush)
   new_block = gc_alloc_block(SSB_TYPE_INODE, first_inum, 0, 0);
-  if(new_block == 0){
-    brelse(bp_old);
+  if(new_block == 0)
     return -1;  // Out of space
-  }
 
   // 3. Write inode block to new location
-  // IMPORTANT: Apply any dirty buffer updates to the copied data
-  bp_new = bread(lfs.dev, new_block);
-  memmove(bp_new->data, bp_old->data, BSIZE);
+  // IMPORTANT: Apply any dirty buffer updates to the copied data.
+  // The old copy is dead once moved, so they go into it in place.
+  uchar *data = gc_seg_data(old_block);
 
   // Merge dirty buffer inodes that belong to this block
   acquire(&dirty_inodes.lock);
-  struct dinode *new_dips = (struct dinode*)bp_new->data;
-  for(int di = 0; di < dirty_inodes.count; di++){
+  struct dinode *new_dips = (struct dinode*)data;
+  for(int di = 0; di < NDSLOT; di++){
     uint inum = dirty_inodes.inums[di];
-    uint imap_entry = lfs.imap[inum];  // Note: lfs.lock already released, but reading is OK
-    if(imap_entry != 0 && imap_entry != 0xFFFFFFFF){
-      if(IMAP_BLOCK(imap_entry) == old_block){
-        // This dirty inode belongs to the block being relocated
-        uint slot = IMAP_SLOT(imap_entry);
-        if(slot < IPB){
-          memmove(&new_dips[slot], &dirty_inodes.inodes[di], sizeof(struct dinode));
-        }
-      }
-    }
-  }
-  // Also check flushing buffer
-  for(int di = 0; di < dirty_inodes.flushing_count; di++){
-    uint inum = dirty_inodes.flushing_inums[di];
-    uint imap_entry = lfs.imap[inum];
-    if(imap_entry != 0 && imap_entry != 0xFFFFFFFF){
-      if(IMAP_BLOCK(imap_entry) == old_block){
-        uint slot = IMAP_SLOT(imap_entry);
-        if(slot < IPB){
-          memmove(&new_dips[slot], &dirty_inodes.flushing_inodes[di], sizeof(struct dinode));
-        }
-      }
+    if(inum == 0 || dirty_find(inum, 0) != di)
+      continue;  // free, or an older copy of an inode staged again
+    struct imap_entry e = imap_get(inum);  // racy read is OK
+    if(e.block == old_block){
+      // This dirty inode belongs to the block being relocated
+      memmove(&new_dips[IMAP_SLOT(e)], &dirty_inodes.inodes[di], sizeof(struct dinode));
     }
   }
   release(&dirty_inodes.lock);
 
-  bwrite(bp_new);
-  brelse(bp_new);
-  brelse(bp_old);
+  gc_segwrite(new_block, data);
 
   // 4. Update SUT
   lfs_update_usage(new_block, BSIZE);
   lfs_update_usage(old_block, -BSIZE);
 
-  // 5. Update imap for all inodes that point to old_block
+  // 5. Update imap for the inodes still pointing to old_block
   acquire(&lfs.lock);
-  for(i = 0; i < LFS_NINODES; i++){
-    uint entry = lfs.imap[i];
-    if(entry != 0 && entry != 0xFFFFFFFF){
-      if(IMAP_BLOCK(entry) == old_block){
-        uint version = IMAP_VERSION(entry);
-        uint slot = IMAP_SLOT(entry);
-        lfs.imap[i] = IMAP_ENCODE(new_block, version, slot);
-      }
-    }
+  for(i = 0; i < ninums; i++){
+    struct imap_entry e = imap_get(inums[i]);
+    if(e.block == old_block)
+      imap_set(inums[i], new_block, IMAP_VERSION(e), IMAP_SLOT(e));
   }
   release(&lfs.lock);
 
   return 0;  // Success
 }
 
-// Relocate a live block to the current log tail
-// Updates inode's addrs[] to point to new location
-// NOTE: Lock ordering must be lfs.lock -> dirty_inodes.lock to avoid deadlock
-// Returns 0 on success, -1 on failure (out of space)
-static int
-gc_relocate_block(struct ssb_entry *entry, uint old_block)
+// Return addrs[i] of inode inum as the cleaner must see it: from the
+// dirty or flushing inode buffer if the inode is there, otherwise
+// from the inode block the imap points at.  0 if the inode is free.
+static uint
+gc_inode_addr(uint inum, uint i)
 {
-  struct buf *bp_old, *bp_new, *bp_inode;
+  struct buf *bp;
   struct dinode *dip;
-  uint new_block;
-  uint imap_entry;
-  uint inode_block, inode_slot;
-  uint bn;
-  uint current_version;
-  int found_in_dirty = 0;
-  int dirty_idx = -1;
+  struct imap_entry e;
+  uint addr;
+  int d;
 
-  // 0. Validate old_block before any operation
-  if(old_block >= sb.size){
-    cprintf("gc_relocate_block: INVALID old_block=%d >= size=%d (inum=%d)\n",
-            old_block, sb.size, entry->inum);
-    return -1;
+  acquire(&dirty_inodes.lock);
+  if((d = dirty_find(inum, 0)) >= 0){
+    dip = &dirty_inodes.inodes[d];
+    addr = dip->type ? dip->addrs[i] : 0;
+    release(&dirty_inodes.lock);
+    return addr;
   }
+  release(&dirty_inodes.lock);
 
-  // 1. Get current version from imap (NOT the old SSB entry version!)
   acquire(&lfs.lock);
-  imap_entry = lfs.imap[entry->inum];
+  e = imap_get(inum);
   release(&lfs.lock);
-  current_version = IMAP_VERSION(imap_entry);
+  if(e.block == 0 || e.block == IMAP_NEW)
+    return 0;
+  if(e.block >= sb.size){
+    cprintf("gc_inode_addr: INVALID inode_block=%d >= size=%d (inum=%d)\n",
+            e.block, sb.size, inum);
+    return 0;
+  }
+  bp = bread(lfs.dev, e.block);
+  dip = (struct dinode*)bp->data + IMAP_SLOT(e);
+  // A freed inode's addrs[] may contain garbage
+  addr = dip->type ? dip->addrs[i] : 0;
+  brelse(bp);
+  return addr;
+}
 
-  // 2. Read old block data
-  bp_old = bread(lfs.dev, old_block);
+// Copy entries n through n+cnt-1 of inode inum's indirect block key,
+// or addrs[n...] of the inode if key is 0, as the cleaner must see
+// them into ptrs; zeros if the block does not exist.
+static void
+gc_get_ptrs(uint inum, uint key, uint n, uint cnt, uint *ptrs)
+{
+  struct buf *bp;
+  uint addr, pkey, pn, i;
 
-  // 3. Allocate new block with SSB entry (handles segment boundary SSB flush)
-  new_block = gc_alloc_block(entry->type, entry->inum, entry->offset, current_version);
-  if(new_block == 0){
-    brelse(bp_old);
-    return -1;  // Out of space
+  if(key == 0){
+    for(i = 0; i < cnt; i++)
+      ptrs[i] = gc_inode_addr(inum, n + i);
+    return;
+  }
+  if(lfs_ind_peek(inum, key, n, cnt, ptrs))
+    return;  // dirty in memory; its copy is the latest
+  memset(ptrs, 0, cnt * sizeof(uint));
+  ind_parent(key, &pkey, &pn);
+  gc_get_ptrs(inum, pkey, pn, 1, &addr);
+  if(addr == 0)
+    return;
+  if(addr >= sb.size){
+    cprintf("gc_get_ptrs: INVALID indirect addr=%d >= size=%d (inum=%d)\n",
+            addr, sb.size, inum);
+    return;
   }
+  bp = bread(lfs.dev, addr);
+  memmove(ptrs, (uint*)bp->data + n, cnt * sizeof(uint));
+  brelse(bp);
+}
 
-  // 4. Write data to new block
-  bp_new = bread(lfs.dev, new_block);
-  memmove(bp_new->data, bp_old->data, BSIZE);
-  bwrite(bp_new);
-  brelse(bp_new);
-  brelse(bp_old);
+// Return entry n of inode inum's indirect block key, or addrs[n] of
+// the inode if key is 0, as the cleaner must see it.
+static uint
+gc_get_ptr(uint inum, uint key, uint n)
+{
+  uint addr;
 
-  // 5. Update SUT: new block is live, old block is dead
-  lfs_update_usage(new_block, BSIZE);
-  lfs_update_usage(old_block, -BSIZE);
+  gc_get_ptrs(inum, key, n, 1, &addr);
+  return addr;
+}
+
+// Point addrs[i] of every in-memory copy of inode inum at addr,
+// first adding the inode to the dirty buffer if it is not there so
+// that the change reaches the log.
+static void
+gc_set_inode_addr(uint inum, uint version, uint i, uint addr)
+{
+  struct buf *bp;
+  struct dinode di;
+  struct imap_entry e;
+  int d;
 
-  // 6. Update inode's addrs[] to point to new block
-  bn = entry->offset;
+  // The newest copy: staged, being flushed, or on disk.
+  acquire(&dirty_inodes.lock);
+  if((d = dirty_find(inum, 0)) >= 0)
+    memmove(&di, &dirty_inodes.inodes[d], sizeof(di));
+  release(&dirty_inodes.lock);
 
-  // Validate bn
-  if(bn >= MAXFILE){
-    cprintf("gc_relocate_block: INVALID bn=%d >= MAXFILE=%d (inum=%d, type=%d)\n",
-            bn, MAXFILE, entry->inum, entry->type);
-    return -1;  // Skip this block instead of corrupting data
+  if(d < 0){
+    acquire(&lfs.lock);
+    e = imap_get(inum);
+    release(&lfs.lock);
+    if(e.block == 0 || e.block == IMAP_NEW)
+      return;  // Inode was freed during relocation - this is OK
+    if(e.block >= sb.size){
+      cprintf("gc_set_inode_addr: INVALID inode_block=%d >= size=%d (inum=%d)\n",
+              e.block, sb.size, inum);
+      return;
+    }
+    bp = bread(lfs.dev, e.block);
+    memmove(&di, (struct dinode*)bp->data + IMAP_SLOT(e), sizeof(di));
+    brelse(bp);
   }
+  if(di.type == 0)
+    return;  // Inode was freed - this is OK
 
-  // Check if inode is in dirty buffer (just check, don't modify yet)
   acquire(&dirty_inodes.lock);
-  for(int i = 0; i < dirty_inodes.count; i++){
-    if(dirty_inodes.inums[i] == entry->inum){
-      found_in_dirty = 1;
-      dirty_idx = i;
-      break;
-    }
+  if(dirty_find(inum, 1) < 0){
+    dirty_reserve();
+    if(dirty_find(inum, 1) < 0)
+      dirty_add(inum, version, &di);
   }
+  lfs_patch_addr(inum, i, addr);
   release(&dirty_inodes.lock);
+}
 
-  if(found_in_dirty){
-    // Inode is in dirty buffer - update it directly
-    // NOTE: We must re-find the index each time we acquire lock because
-    // dirty buffer might have been flushed between lock releases.
-
-    // First check if inode is freed (type == 0)
-    acquire(&dirty_inodes.lock);
-    // Re-find dirty_idx (buffer may have changed)
-    dirty_idx = -1;
-    for(int i = 0; i < dirty_inodes.count; i++){
-      if(dirty_inodes.inums[i] == entry->inum){
-        dirty_idx = i;
-        break;
-      }
-    }
-    if(dirty_idx < 0 || dirty_inodes.inodes[dirty_idx].type == 0){
-      release(&dirty_inodes.lock);
-      // Inode no longer in dirty buffer or was freed - fall through to disk path
-      found_in_dirty = 0;
-      goto read_from_disk;
-    }
-    release(&dirty_inodes.lock);
-
-    // For direct blocks or INDIRECT block type, just update addrs[] directly
-    // For DATA blocks accessed through indirect, we need to handle COW
-    uint new_ind_for_icache = 0;
-    if(bn < NDIRECT || entry->type == SSB_TYPE_INDIRECT){
-      acquire(&dirty_inodes.lock);
-      // Re-find dirty_idx again
-      dirty_idx = -1;
-      for(int i = 0; i < dirty_inodes.count; i++){
-        if(dirty_inodes.inums[i] == entry->inum){
-          dirty_idx = i;
-          break;
-        }
-      }
-      if(dirty_idx >= 0){
-        if(entry->type == SSB_TYPE_INDIRECT){
-          // INDIRECT block: update addrs[NDIRECT]
-          dirty_inodes.inodes[dirty_idx].addrs[NDIRECT] = new_block;
-        } else {
-          // Direct data block: update addrs[bn]
-          dirty_inodes.inodes[dirty_idx].addrs[bn] = new_block;
-        }
-      }
-      release(&dirty_inodes.lock);
-      if(dirty_idx < 0) goto read_from_disk;
-    } else {
-      // Indirect block case - read old indirect, create new, update
-      uint old_ind;
-      acquire(&dirty_inodes.lock);
-      // Re-find dirty_idx
-      dirty_idx = -1;
-      for(int i = 0; i < dirty_inodes.count; i++){
-        if(dirty_inodes.inums[i] == entry->inum){
-          dirty_idx = i;
-          break;
-        }
-      }
-      if(dirty_idx < 0){
-        release(&dirty_inodes.lock);
-        goto read_from_disk;
-      }
-      old_ind = dirty_inodes.inodes[dirty_idx].addrs[NDIRECT];
-      release(&dirty_inodes.lock);
+// Point entries n through n+cnt-1 of inode inum's indirect block
+// key, or addrs[n...] of the inode if key is 0, at addrs[0..cnt-1].
+// A dirty indirect block is changed in memory; one on disk is copied
+// to the log tail once for all cnt entries, and its parent pointed at
+// the copy in turn.
+// Returns 0 on success, -1 on failure (out of space)
+static int
+gc_set_ptrs(uint inum, uint version, uint key, uint n, uint cnt, uint *addrs)
+{
+  static uchar ind[BSIZE];
+  struct buf *bp;
+  uint old_ind, new_ind, pkey, pn, i;
 
-      if(old_ind != 0){
-        struct buf *bp_ind, *bp_new_ind;
-        uint new_ind;
+  if(key == 0){
+    for(i = 0; i < cnt; i++)
+      gc_set_inode_addr(inum, version, n + i, addrs[i]);
+    return 0;
+  }
+  if(lfs_ind_poke(inum, key, n, cnt, addrs))
+    return 0;  // written out with its inode
+
+  ind_parent(key, &pkey, &pn);
+  if((old_ind = gc_get_ptr(inum, pkey, pn)) == 0)
+    return 0;  // truncated meanwhile
+  if(old_ind >= sb.size){
+    cprintf("gc_set_ptrs: INVALID old_ind=%d >= size=%d (inum=%d)\n",
+            old_ind, sb.size, inum);
+    return -1;
+  }
+  if((new_ind = gc_alloc_block(IND_TYPE(key), inum, key, version)) == 0)
+    return -1;  // Out of space
 
-        new_ind = gc_alloc_block(SSB_TYPE_INDIRECT, entry->inum, NDIRECT, current_version);
-        if(new_ind == 0){
-          return -1;  // Out of space
-        }
+  bp = bread(lfs.dev, old_ind);
+  memmove(ind, bp->data, BSIZE);
+  brelse(bp);
+  memmove((uint*)ind + n, addrs, cnt * sizeof(uint));
+  gc_segwrite(new_ind, ind);
 
-        // Validate old_ind before reading
-        if(old_ind >= sb.size){
-          cprintf("gc_relocate_block: INVALID old_ind=%d >= size=%d (inum=%d)\n",
-                  old_ind, sb.size, entry->inum);
-          return -1;
-        }
+  lfs_update_usage(new_ind, BSIZE);
+  lfs_update_usage(old_ind, -BSIZE);
+  return gc_set_ptrs(inum, version, pkey, pn, 1, &new_ind);
+}
 
-        bp_ind = bread(lfs.dev, old_ind);
-        bp_new_ind = bread(lfs.dev, new_ind);
-        memmove(bp_new_ind->data, bp_ind->data, BSIZE);
-        if(entry->type == SSB_TYPE_DATA){
-          uint *a = (uint*)bp_new_ind->data;
-          // Validate index into indirect block
-          if(bn < NDIRECT || bn - NDIRECT >= NINDIRECT){
-            cprintf("gc_relocate_block: INVALID indirect index bn=%d (NDIRECT=%d, NINDIRECT=%d)\n",
-                    bn, NDIRECT, NINDIRECT);
-            brelse(bp_new_ind);
-            brelse(bp_ind);
-            return -1;
-          }
-          a[bn - NDIRECT] = new_block;
-        }
-        bwrite(bp_new_ind);
-        brelse(bp_new_ind);
-        brelse(bp_ind);
-
-        lfs_update_usage(new_ind, BSIZE);
-        lfs_update_usage(old_ind, -BSIZE);
-
-        acquire(&dirty_inodes.lock);
-        // Re-find dirty_idx
-        dirty_idx = -1;
-        for(int i = 0; i < dirty_inodes.count; i++){
-          if(dirty_inodes.inums[i] == entry->inum){
-            dirty_idx = i;
-            break;
-          }
-        }
-        if(dirty_idx >= 0){
-          dirty_inodes.inodes[dirty_idx].addrs[NDIRECT] = new_ind;
-        }
-        release(&dirty_inodes.lock);
+// Relocate a run of live blocks to the cleaner's log head: entries
+// entry[0..cnt-1] describe the blocks now at old[0..cnt-1].  A run
+// longer than one block is consecutive data blocks of one file under
+// one indirect block, so their new addresses go in with one update.
+// The blocks are in the segment being cleaned, see gcseg.
+// NOTE: Lock ordering must be lfs.lock -> dirty_inodes.lock to avoid deadlock
+// Returns 0 on success, -1 on failure (out of space)
+static int
+gc_relocate_run(struct ssb_entry *entry, uint *old, int cnt)
+{
+  uint new[GC_RUN];
+  uint key, n;
+  uint current_version;
+  int i;
 
-        new_ind_for_icache = new_ind;
-      }
+  // 0. Validate the run and find where its addresses are kept
+  for(i = 0; i < cnt; i++){
+    if(old[i] >= sb.size){
+      cprintf("gc_relocate_run: INVALID old_block=%d >= size=%d (inum=%d)\n",
+              old[i], sb.size, entry->inum);
+      return -1;
     }
-
-    // NOTE: We rely on lock-free optimistic update for icache to avoid panic.
-    for(struct inode *ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-      if(ip->ref > 0 && ip->dev == lfs.dev && ip->inum == entry->inum){
-        if(bn < NDIRECT){
-          ip->addrs[bn] = new_block;
-        } else if(new_ind_for_icache != 0){
-          ip->addrs[NDIRECT] = new_ind_for_icache;
-        }
-        break;
-      }
+  }
+  if(entry->type == SSB_TYPE_DATA){
+    if(entry->offset + cnt > MAXFILE){
+      cprintf("gc_relocate_run: INVALID bn=%d >= MAXFILE=%d (inum=%d)\n",
+              entry->offset + cnt - 1, MAXFILE, entry->inum);
+      return -1;  // Skip this block instead of corrupting data
     }
-    return 0;  // Success for dirty buffer path
+    ind_locate(entry->offset, &key, &n);
+  } else {
+    if(!ind_valid(entry->offset) || cnt != 1){
+      cprintf("gc_relocate_run: INVALID indirect key=%d (inum=%d, type=%d)\n",
+              entry->offset, entry->inum, entry->type);
+      return -1;
+    }
+    ind_parent(entry->offset, &key, &n);
   }
 
-read_from_disk:
-  // Inode not in dirty buffer - need to read, modify, and add to dirty buffer
+  // 1. Get current version from imap (NOT the old SSB entry version!)
   acquire(&lfs.lock);
-  imap_entry = lfs.imap[entry->inum];
+  current_version = IMAP_VERSION(imap_get(entry->inum));
   release(&lfs.lock);
 
-  if(imap_entry == 0 || imap_entry == 0xFFFFFFFF){
-    return 0;  // Inode was freed during relocation - this is OK
-  }
-
-  inode_block = IMAP_BLOCK(imap_entry);
-  inode_slot = IMAP_SLOT(imap_entry);
-
-  // Validate inode_block
-  if(inode_block >= sb.size){
-    cprintf("gc_relocate_block: INVALID inode_block=%d >= size=%d (inum=%d, imap_entry=0x%x)\n",
-            inode_block, sb.size, entry->inum, imap_entry);
-    return -1;
-  }
-
-  bp_inode = bread(lfs.dev, inode_block);
-  dip = (struct dinode*)bp_inode->data + inode_slot;
+  for(i = 0; i < cnt; i++){
+    // 2. Allocate new block with SSB entry (handles segment boundary SSB flush)
+    new[i] = gc_alloc_block(entry[i].type, entry->inum, entry[i].offset, current_version);
+    if(new[i] == 0)
+      break;  // Out of space
 
-  // Create a copy of the dinode
-  struct dinode di_copy;
-  memmove(&di_copy, dip, sizeof(di_copy));
-  brelse(bp_inode);
+    // 3. Copy the block from the segment read into memory
+    gc_segwrite(new[i], gc_seg_data(old[i]));
 
-  // Skip if inode is freed (type == 0) - addrs[] may contain garbage
-  if(di_copy.type == 0){
-    return 0;  // Inode was freed - this is OK
+    // 4. Update SUT: new block is live, old block is dead
+    lfs_update_usage(new[i], BSIZE);
+    lfs_update_usage(old[i], -BSIZE);
   }
 
-  if(bn < NDIRECT || entry->type == SSB_TYPE_INDIRECT){
-    // Direct block or INDIRECT block type: just update addrs directly
-    if(entry->type == SSB_TYPE_INDIRECT){
-      di_copy.addrs[NDIRECT] = new_block;
-    } else {
-      di_copy.addrs[bn] = new_block;
-    }
-  } else {
-    // DATA block accessed through indirect - need COW for indirect block
-    uint old_ind = di_copy.addrs[NDIRECT];
-    if(old_ind != 0){
-      struct buf *bp_ind, *bp_new_ind;
-      uint new_ind;
-
-      new_ind = gc_alloc_block(SSB_TYPE_INDIRECT, entry->inum, NDIRECT, current_version);
-      if(new_ind == 0){
-        return -1;  // Out of space
-      }
+  // 5. Point the inode or indirect block at the blocks moved so far
+  if(i > 0 && entry->type != SSB_TYPE_DATA)
+    lfs_ind_moved(entry->inum, entry->offset, old[0], new[0]);
+  if(i > 0 && gc_set_ptrs(entry->inum, current_version, key, n, i, new) < 0)
+    return -1;
+  return i == cnt ? 0 : -1;
+}
 
-      // Validate old_ind before reading
-      if(old_ind >= sb.size){
-        cprintf("gc_relocate_block(not dirty): INVALID old_ind=%d >= size=%d (inum=%d)\n",
-                old_ind, sb.size, entry->inum);
-        return -1;
-      }
+// Relocate a single live block to the current log tail
+// Returns 0 on success, -1 on failure (out of space)
+static int
+gc_relocate_block(struct ssb_entry *entry, uint old_block)
+{
+  return gc_relocate_run(entry, &old_block, 1);
+}
 
-      bp_ind = bread(lfs.dev, old_ind);
-      bp_new_ind = bread(lfs.dev, new_ind);
-      memmove(bp_new_ind->data, bp_ind->data, BSIZE);
-      if(entry->type == SSB_TYPE_DATA){
-        uint *a = (uint*)bp_new_ind->data;
-        // Validate index
-        if(bn < NDIRECT || bn - NDIRECT >= NINDIRECT){
-          cprintf("gc_relocate_block: INVALID indirect index bn=%d\n", bn);
-          brelse(bp_new_ind);
-          brelse(bp_ind);
-          return -1;
-        }
-        a[bn - NDIRECT] = new_block;
-      }
-      bwrite(bp_new_ind);
-      brelse(bp_new_ind);
-      brelse(bp_ind);
+// Entry e of an SSB is a live data block at olds[0] in segment
+// [start, end).  Return how many entries from e on, up to GC_RUN,
+// describe consecutive blocks of the same file under the same
+// indirect block that are still live in the segment, filling in
+// olds[] with their addresses, so they can be moved as one run.
+static int
+gc_live_run(struct ssb *ssb, int e, uint start, uint end, uint *olds)
+{
+  struct ssb_entry *first, *x;
+  uint key, n, key1, n1, ptrs[GC_RUN];
+  int len, i;
 
-      lfs_update_usage(new_ind, BSIZE);
-      lfs_update_usage(old_ind, -BSIZE);
-      di_copy.addrs[NDIRECT] = new_ind;
-    }
+  first = &ssb->entries[e];
+  if(first->type != SSB_TYPE_DATA)
+    return 1;
+  ind_locate(first->offset, &key, &n);
+  for(len = 1; len < GC_RUN && e + len < ssb->nblocks; len++){
+    x = &ssb->entries[e + len];
+    if(x->type != SSB_TYPE_DATA || x->inum != first->inum ||
+       x->version != first->version || x->offset != first->offset + len)
+      break;
+    ind_locate(x->offset, &key1, &n1);
+    if(key1 != key)
+      break;
   }
+  if(len == 1)
+    return 1;
 
-  // Add modified inode to dirty buffer (or update if already exists)
-  acquire(&dirty_inodes.lock);
-
-  // Check if inode already exists in dirty buffer
-  int found_slot = -1;
-  for(int di = 0; di < dirty_inodes.count; di++){
-    if(dirty_inodes.inums[di] == entry->inum){
-      found_slot = di;
+  // One lookup maps the whole run
+  gc_get_ptrs(first->inum, key, n, len, ptrs);
+  for(i = 1; i < len; i++){
+    if(ptrs[i] < start || ptrs[i] >= end)
       break;
-    }
+    olds[i] = ptrs[i];
   }
+  return i;
+}
+
+// Relocate the block of inode inum whose address is at entry n of
+// indirect block key (addrs[n] of the inode if key is 0) if it lies
+// in [start, end), and then, for an indirect block, every block it
+// lists.  Adds the number of blocks moved to *live.
+// Returns 0 on success, -1 on failure (out of space)
+static int
+gc_scan_ptr(uint inum, uint key, uint n, uint start, uint end, int *live)
+{
+  struct ssb_entry e;
+  uint addr, j;
+
+  if((addr = gc_get_ptr(inum, key, n)) == 0)
+    return 0;
 
-  if(found_slot >= 0){
-    // Update existing entry
-    memmove(&dirty_inodes.inodes[found_slot], &di_copy, sizeof(di_copy));
-    dirty_inodes.versions[found_slot] = current_version;
+  e.inum = inum;
+  e.version = 0;  // gc_relocate_block() uses the imap's version
+  if(key == 0 && n >= NDIRECT){
+    e.offset = n;  // IND_SINGLE or IND_DROOT
+    e.type = IND_TYPE(n);
+  } else if(key == IND_DROOT){
+    e.offset = IND_DSTART + n*NINDIRECT;
+    e.type = SSB_TYPE_INDIRECT;
   } else {
-    // Add new entry
-    if(dirty_inodes.count >= IPB){
-      release(&dirty_inodes.lock);
-      lfs_flush_only();  // Flush only, no checkpoint (recoverable via roll-forward)
-      acquire(&dirty_inodes.lock);
-    }
-    memmove(&dirty_inodes.inodes[dirty_inodes.count], &di_copy, sizeof(di_copy));
-    dirty_inodes.inums[dirty_inodes.count] = entry->inum;
-    dirty_inodes.versions[dirty_inodes.count] = current_version;
-    dirty_inodes.count++;
+    e.offset = key == 0 ? n : key == IND_SINGLE ? NDIRECT + n : key + n;
+    e.type = SSB_TYPE_DATA;
   }
-  release(&dirty_inodes.lock);
 
-  // NOTE: We rely on lock-free optimistic update for icache to avoid panic.
-  for(struct inode *ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == lfs.dev && ip->inum == entry->inum){
-      if(bn < NDIRECT){
-        ip->addrs[bn] = new_block;
-      } else {
-        // For indirect, update the indirect block pointer
-        ip->addrs[NDIRECT] = di_copy.addrs[NDIRECT];
-      }
-      break;
+  if(addr >= start && addr < end){
+    if(gc_relocate_block(&e, addr) < 0)
+      return -1;
+    (*live)++;
+  }
+  if(e.type != SSB_TYPE_DATA){
+    for(j = 0; j < NINDIRECT; j++){
+      if(gc_scan_ptr(inum, e.offset, j, start, end, live) < 0)
+        return -1;
     }
   }
-  return 0;  // Success
+  return 0;
 }
 
 // Clean a single segment: relocate live blocks, mark segment as free
@@ -1346,208 +3064,99 @@ gc_clean_segment(uint seg_idx)
   uint ssb_addrs[LFS_SEGSIZE];  // Max SSBs in a segment
   int ssb_count;
   int live_blocks = 0;
-  int total_blocks = 0;
   int stopped_early = 0;  // Flag for early exit due to out of space
+  uint seg_start = sb.segstart + seg_idx * sb.segsize;
+  uint seg_end = seg_start + sb.segsize;
+  uint ino, iblk, live, last;
+  int i;
+
+  // 0. Read the segment, in one go, up to its last live block or
+  //    the last SSB, whichever is later.  A segment with no live
+  //    blocks is not read at all.
+  acquire(&lfs.lock);
+  live = seglive_of(seg_start)->live;
+  last = sut_get(seg_idx)->nssb == SSB_CHAIN_UNKNOWN ? seg_end - 1 :
+         sut_get(seg_idx)->last_ssb;
+  release(&lfs.lock);
+  if(live == 0)
+    goto gc_early_exit;
+  for(i = sb.segsize - 1; i > 0 && !(live & (1U << i)); i--)
+    ;
+  if(last >= seg_start && last < seg_end && last - seg_start > i)
+    i = last - seg_start;
+  gc_seg_load(seg_start, i + 1);
+
+  // 1. Inode blocks: the segment's inode list names every live one,
+  //    and relocating a block takes all its inodes off the list.
+  for(;;){
+    acquire(&lfs.lock);
+    ino = seglive_of(seg_start)->ihead;
+    iblk = ino ? imap_get(ino).block : 0;
+    release(&lfs.lock);
+    if(ino == 0)
+      break;
+    if(gc_relocate_inode_block(ino, iblk) < 0){
+      cprintf("GC: out of space relocating inode block\n");
+      stopped_early = 1;
+      goto gc_early_exit;
+    }
+    live_blocks++;
+  }
 
-  // Track relocated inode blocks to avoid duplicates
-  // (Multiple inodes may share the same block)
-  uint relocated_inode_blocks[IPB * 4];  // Track up to IPB*4 unique blocks
-  int relocated_count = 0;
+  // 2. Data and indirect blocks: only entries whose block is marked
+  //    live need a lookup, and once no bits are left the rest of the
+  //    summaries need not be looked at.
+  acquire(&lfs.lock);
+  live = seglive_of(seg_start)->live;
+  release(&lfs.lock);
+  if(live == 0)
+    goto gc_early_exit;
 
-  // 1. Find all SSB blocks in this segment
   ssb_count = gc_find_ssbs(seg_idx, ssb_addrs, LFS_SEGSIZE);
-  // Even if no SSBs found (e.g., mkfs segments), we continue to the
-  // imap safety scan below, which catches inode blocks without SSB entries.
-
-  // 2. Process each SSB and its described blocks
-  for(int s = 0; s < ssb_count; s++){
-    struct buf *bp = bread(lfs.dev, ssb_addrs[s]);
-    struct ssb *ssb_ptr = (struct ssb *)bp->data;
-
-    // Calculate block addresses for entries
-    // SSB entries describe blocks written BEFORE the SSB in the segment
-    // We need to figure out which blocks correspond to which entries
-    // In our implementation, entries are added as blocks are written,
-    // so entry[i] corresponds to the i-th data block before this SSB
-
-    // For simplicity, we'll use the offset stored in ssb_entry
-    // to identify blocks and check if they're live
-    for(int e = 0; e < ssb_ptr->nblocks; e++){
-      struct ssb_entry *entry = &ssb_ptr->entries[e];
-      total_blocks++;
 
-      if(entry->type == SSB_TYPE_INODE){
-        // Inode Block entry. Check if ANY imap entry points to a block in this segment.
-        // Simplified: one SSB entry per inode block, no version check needed.
-        // Liveness is determined by whether imap points to this block.
-        uint seg_start = sb.segstart + seg_idx * sb.segsize;
-        uint seg_end = seg_start + sb.segsize;
+  for(int s = 0; s < ssb_count && live != 0; s++){
+    struct ssb *ssb_ptr = (struct ssb *)gc_seg_data(ssb_addrs[s]);
 
-        acquire(&lfs.lock);
-        for(int ino = 1; ino < LFS_NINODES; ino++){
-          uint imap_entry = lfs.imap[ino];
-          if(imap_entry != 0 && imap_entry != 0xFFFFFFFF){
-            uint iblk = IMAP_BLOCK(imap_entry);
-            // Check if this imap points to a block in the segment being cleaned
-            if(iblk >= seg_start && iblk < seg_end){
-              // Block is live. Check if already relocated.
-              int already_relocated = 0;
-              for(int r = 0; r < relocated_count; r++){
-                if(relocated_inode_blocks[r] == iblk){
-                  already_relocated = 1;
-                  break;
-                }
-              }
-              if(!already_relocated){
-                release(&lfs.lock);
-                if(gc_relocate_inode_block(ino, iblk) < 0){
-                  brelse(bp);
-                  cprintf("GC: out of space relocating inode block\n");
-                  stopped_early = 1;
-                  goto gc_early_exit;
-                }
-                live_blocks++;
-                if(relocated_count < IPB * 4)
-                  relocated_inode_blocks[relocated_count++] = iblk;
-                acquire(&lfs.lock);
-              }
-            }
-          }
-        }
-        release(&lfs.lock);
+    for(int e = 0; e < ssb_ptr->nblocks; e++){
+      struct ssb_entry *entry = &ssb_ptr->entries[e];
+
+      acquire(&lfs.lock);
+      live = seglive_of(seg_start)->live;
+      release(&lfs.lock);
+      if(live == 0)
+        break;
+      if(entry->type == SSB_TYPE_INODE || !(live & (1U << entry->slot)))
         continue;
-      }
 
-      // DATA or INDIRECT block
       // Get imap entry for this inode
-      uint imap_entry;
+      struct imap_entry ie;
       acquire(&lfs.lock);
-      imap_entry = lfs.imap[entry->inum];
+      ie = imap_get(entry->inum);
       release(&lfs.lock);
 
-      if(imap_entry == 0 || imap_entry == 0xFFFFFFFF){
+      if(ie.block == 0 || ie.block == IMAP_NEW){
         continue;  // Inode deleted or in-flight
       }
 
       // Check version first (fast path)
-      if(IMAP_VERSION(imap_entry) != entry->version){
+      if(IMAP_VERSION(ie) != entry->version){
         continue;  // Version mismatch - block is dead
       }
 
-      // Find the actual block address for data block entries
-      uint block_addr = 0;
-      uint bn = entry->offset;
-      int found_in_dirty = 0;
-      struct dinode di_copy;
-
-      // IMPORTANT: Check dirty buffer first for latest inode state!
-      // This prevents GC from using stale disk data when inode was recently modified.
-      acquire(&dirty_inodes.lock);
-      for(int di = 0; di < dirty_inodes.count; di++){
-        if(dirty_inodes.inums[di] == entry->inum){
-          // Found in dirty buffer - use this (latest state)
-          memmove(&di_copy, &dirty_inodes.inodes[di], sizeof(di_copy));
-          found_in_dirty = 1;
-          break;
-        }
-      }
-      // Also check flushing buffer
-      if(!found_in_dirty){
-        for(int di = 0; di < dirty_inodes.flushing_count; di++){
-          if(dirty_inodes.flushing_inums[di] == entry->inum){
-            memmove(&di_copy, &dirty_inodes.flushing_inodes[di], sizeof(di_copy));
-            found_in_dirty = 1;
-            break;
-          }
-        }
-      }
-      release(&dirty_inodes.lock);
-
-      if(found_in_dirty){
-        // Use inode data from dirty buffer
-        if(di_copy.type == 0){
-          continue;  // Inode freed
-        }
-        if(entry->type == SSB_TYPE_INDIRECT){
-          block_addr = di_copy.addrs[NDIRECT];
-        } else {
-          // DATA block
-          if(bn < NDIRECT){
-            block_addr = di_copy.addrs[bn];
-          } else {
-            uint ind_addr = di_copy.addrs[NDIRECT];
-            if(ind_addr == 0){
-              continue;
-            }
-            if(ind_addr >= sb.size){
-              cprintf("gc_clean_segment: INVALID ind_addr=%d (dirty, inum=%d)\n",
-                      ind_addr, entry->inum);
-              continue;
-            }
-            if(bn - NDIRECT >= NINDIRECT){
-              continue;
-            }
-            struct buf *bp_ind = bread(lfs.dev, ind_addr);
-            uint *a = (uint*)bp_ind->data;
-            block_addr = a[bn - NDIRECT];
-            brelse(bp_ind);
-          }
-        }
-      } else {
-        // Read inode from disk
-        uint inode_block = IMAP_BLOCK(imap_entry);
-        uint inode_slot = IMAP_SLOT(imap_entry);
-
-        // Validate inode_block before reading
-        if(inode_block >= sb.size){
-          cprintf("gc_clean_segment: INVALID inode_block=%d >= size=%d (inum=%d)\n",
-                  inode_block, sb.size, entry->inum);
-          continue;  // Skip this entry
-        }
-
-        struct buf *bp_inode = bread(lfs.dev, inode_block);
-        struct dinode *dip = (struct dinode*)bp_inode->data + inode_slot;
-
-        // Skip if inode is freed (type == 0) - addrs[] may contain garbage
-        if(dip->type == 0){
-          brelse(bp_inode);
+      // Find where the block's address is kept and look it up
+      uint block_addr, key, n;
+      if(entry->type == SSB_TYPE_DATA){
+        if(entry->offset >= MAXFILE)
           continue;
-        }
-
-        if(entry->type == SSB_TYPE_INDIRECT){
-           // Indirect block is stored at addrs[NDIRECT]
-           block_addr = dip->addrs[NDIRECT];
-        } else {
-           // DATA block
-           if(bn < NDIRECT){
-             block_addr = dip->addrs[bn];
-           } else {
-             uint ind_addr = dip->addrs[NDIRECT];
-             brelse(bp_inode);
-             if(ind_addr == 0){
-               continue;
-             }
-             // Validate ind_addr before reading
-             if(ind_addr >= sb.size){
-               cprintf("gc_clean_segment: INVALID ind_addr=%d >= size=%d (inum=%d)\n",
-                       ind_addr, sb.size, entry->inum);
-               continue;  // Skip this entry
-             }
-             // Validate bn for indirect access
-             if(bn < NDIRECT || bn - NDIRECT >= NINDIRECT){
-               cprintf("gc_clean_segment: INVALID bn=%d for indirect access\n", bn);
-               continue;
-             }
-             struct buf *bp_ind = bread(lfs.dev, ind_addr);
-             uint *a = (uint*)bp_ind->data;
-             block_addr = a[bn - NDIRECT];
-             brelse(bp_ind);
-             bp_inode = 0;  // Mark as released
-           }
-        }
-
-        if(bp_inode) brelse(bp_inode);
+        ind_locate(entry->offset, &key, &n);
+      } else if(entry->type == SSB_TYPE_INDIRECT || entry->type == SSB_TYPE_DINDIRECT){
+        if(!ind_valid(entry->offset))
+          continue;
+        ind_parent(entry->offset, &key, &n);
+      } else {
+        continue;
       }
+      block_addr = gc_get_ptr(entry->inum, key, n);
 
       if(block_addr == 0){
         continue;  // Block not allocated
@@ -1561,210 +3170,120 @@ gc_clean_segment(uint seg_idx)
       }
 
       // Check if block is in this segment
-      if(block_addr < sb.segstart){
-        continue;  // Block not in log area
-      }
-      uint block_seg = (block_addr - sb.segstart) / sb.segsize;
-      if(block_seg != seg_idx){
+      if(block_addr < seg_start || block_addr >= seg_end){
         continue;  // Block not in this segment (already relocated?)
       }
 
-      // Block is live - relocate it
-      if(gc_relocate_block(entry, block_addr) < 0){
+      // Block is live - relocate it, with the rest of its run
+      uint olds[GC_RUN];
+      olds[0] = block_addr;
+      int run = gc_live_run(ssb_ptr, e, seg_start, seg_end, olds);
+      if(gc_relocate_run(entry, olds, run) < 0){
         // Out of space - stop cleaning this segment
-        brelse(bp);
         cprintf("GC: out of space during relocation, stopping early\n");
         stopped_early = 1;
         goto gc_early_exit;
       }
-      live_blocks++;
+      live_blocks += run;
+      e += run - 1;
     }
-
-    brelse(bp);
   }
 
-  // 3. Fallback scan for segments without SSBs (e.g., corrupted or very old segments)
-  if(ssb_count == 0){
-    uint seg_start = sb.segstart + seg_idx * sb.segsize;
-    uint seg_end = seg_start + sb.segsize;
-
-    // Scan imap for inode blocks in this segment
-    acquire(&lfs.lock);
-    for(int i = 1; i < LFS_NINODES; i++){
-      uint entry = lfs.imap[i];
-      if(entry != 0 && entry != 0xFFFFFFFF){
-        uint blk = IMAP_BLOCK(entry);
-        if(blk >= seg_start && blk < seg_end){
-          // Check if we already relocated this block
-          int already_done = 0;
-          for(int r = 0; r < relocated_count; r++){
-            if(relocated_inode_blocks[r] == blk){
-              already_done = 1;
-              break;
-            }
-          }
-          if(!already_done && relocated_count < IPB * 4){
-            relocated_inode_blocks[relocated_count++] = blk;
-            release(&lfs.lock);
-            if(gc_relocate_inode_block(i, blk) < 0){
-              cprintf("GC: out of space in fallback inode relocation\n");
-              stopped_early = 1;
-              goto gc_early_exit;
-            }
-            live_blocks++;
-            acquire(&lfs.lock);
-          }
+  // 3. Fallback scan for segments without SSBs (e.g., corrupted or
+  //    very old segments), or whose SSBs missed some live blocks.
+  //    Data and indirect blocks can only be found through the inodes,
+  //    so this is O(N) and only for segments the summaries failed.
+  acquire(&lfs.lock);
+  live = seglive_of(seg_start)->live;
+  release(&lfs.lock);
+  if(live != 0){
+    for(int i = 1; i < IMAP_NINODES(); i++){
+      for(uint n = 0; n < NDIRECT + 2; n++){
+        if(gc_scan_ptr(i, 0, n, seg_start, seg_end, &live_blocks) < 0){
+          cprintf("GC: out of space in fallback scan, stopping\n");
+          stopped_early = 1;
+          goto gc_early_exit;
         }
       }
     }
-    release(&lfs.lock);
-
-    // For segments with no SSBs, we also need to scan data blocks
-    // This is the O(N) fallback for mkfs segments only
-    for(int i = 1; i < LFS_NINODES; i++){
-      uint imap_entry;
-      acquire(&lfs.lock);
-      imap_entry = lfs.imap[i];
-      release(&lfs.lock);
+  }
 
-      if(imap_entry == 0 || imap_entry == 0xFFFFFFFF)
-        continue;
+gc_early_exit:
+  // 4. Flush SSB for blocks relocated to the log proper's tail, if
+  //    the cleaner had no head of its own (see gc_alloc_block)
+  lfs_write_ssb_now();
 
-      // Read inode
-      struct dinode di;
-      uint iblk = IMAP_BLOCK(imap_entry);
-      uint islot = IMAP_SLOT(imap_entry);
+  // 5. Mark segment as free ONLY if we completed successfully and
+  //    nothing in it is still live
+  if(stopped_early)
+    return -1;
+  acquire(&lfs.lock);
+  live = seglive_of(seg_start)->live;
+  ino = seglive_of(seg_start)->ihead;
+  release(&lfs.lock);
+  if(live != 0 || ino != 0){
+    cprintf("GC: segment %d still live (%x, inode %d), not freed\n",
+            seg_idx, live, ino);
+    return live_blocks;
+  }
+  gc_free_segment(seg_idx);
+  return live_blocks;
+}
 
-      // Validate iblk before reading
-      if(iblk >= sb.size){
-        cprintf("GC fallback scan: INVALID iblk=%d (inum=%d)\n", iblk, i);
-        continue;
-      }
+// Free segments, counting the unwritten space past the log tail.
+// Caller must hold lfs.lock.
+static uint
+gc_room(void)
+{
+  return lfs.free_count + (lfs.cur_seg_end - lfs.log_tail) / sb.segsize;
+}
 
-      struct buf *bp_in = bread(lfs.dev, iblk);
-      memmove(&di, (struct dinode*)bp_in->data + islot, sizeof(di));
-      brelse(bp_in);
-
-      if(di.type == 0) continue;
-
-      // Check direct blocks
-      for(int bn = 0; bn < NDIRECT; bn++){
-        uint dblk = di.addrs[bn];
-        if(dblk != 0 && dblk >= seg_start && dblk < seg_end){
-          struct ssb_entry fake_entry;
-          fake_entry.type = SSB_TYPE_DATA;
-          fake_entry.inum = i;
-          fake_entry.offset = bn;
-          fake_entry.version = IMAP_VERSION(imap_entry);
-          if(gc_relocate_block(&fake_entry, dblk) < 0){
-            cprintf("GC: out of space in fallback direct, stopping\n");
-            stopped_early = 1;
-            goto gc_early_exit;
-          }
-          live_blocks++;
-        }
-      }
+// Set aside a free segment for the cleaner's head, if it has none,
+// and mark it in use in the SUT the checkpoint being written records.
+// Once the head writes a block there, a flush of the log proper may
+// write an inode that points at it; after a crash roll-forward
+// recovers that inode but follows only the log proper, so the segment
+// must already be in use in the checkpoint it starts from.  Leave the
+// last few segments to the log proper.
+// Caller must hold lfs.lock.
+static void
+gc_reserve_seg(void)
+{
+  uint seg;
 
-      // Check indirect block pointer
-      uint ind_addr = di.addrs[NDIRECT];
-      if(ind_addr != 0 && ind_addr >= seg_start && ind_addr < seg_end){
-        // Relocate indirect block itself
-        live_blocks++;
-        struct buf *bp_old = bread(lfs.dev, ind_addr);
-        uint new_ind = lfs_alloc();
-        lfs_write_pending_ssb();
-        struct buf *bp_new = bread(lfs.dev, new_ind);
-        memmove(bp_new->data, bp_old->data, BSIZE);
-        bwrite(bp_new);
-        brelse(bp_new);
-        brelse(bp_old);
-        lfs_update_usage(new_ind, BSIZE);
-        lfs_update_usage(ind_addr, -BSIZE);
-
-        // Add SSB entry for the relocated indirect block
-        lfs_add_ssb_entry(SSB_TYPE_INDIRECT, i, NDIRECT, IMAP_VERSION(imap_entry));
-
-        // Update inode
-        acquire(&dirty_inodes.lock);
-        int found = 0;
-        for(int d = 0; d < dirty_inodes.count; d++){
-          if(dirty_inodes.inums[d] == (uint)i){
-            dirty_inodes.inodes[d].addrs[NDIRECT] = new_ind;
-            found = 1;
-            break;
-          }
-        }
-        if(!found && dirty_inodes.count < IPB){
-          di.addrs[NDIRECT] = new_ind;
-          memmove(&dirty_inodes.inodes[dirty_inodes.count], &di, sizeof(di));
-          dirty_inodes.inums[dirty_inodes.count] = i;
-          dirty_inodes.versions[dirty_inodes.count] = IMAP_VERSION(imap_entry);
-          dirty_inodes.count++;
-        }
-        release(&dirty_inodes.lock);
-        ind_addr = new_ind;
-      }
+  if(lfs.gc_next != 0 || lfs.free_count == 0 || gc_room() <= GC_CRITICAL)
+    return;
+  seg = *free_seg_at(lfs.free_head);
+  lfs.free_head = (lfs.free_head + 1) % sb.nsegs;
+  lfs.free_count--;
+  sut_mod(seg)->live_bytes = 0;
+  lfs.gc_next = sb.segstart + seg * sb.segsize;
+}
 
-      // Check data blocks in indirect
-      if(ind_addr != 0){
-        struct buf *bp_ind = bread(lfs.dev, ind_addr);
-        uint *ind_data = (uint*)bp_ind->data;
-        for(int bn = 0; bn < NINDIRECT; bn++){
-          uint dblk = ind_data[bn];
-          if(dblk != 0 && dblk >= seg_start && dblk < seg_end){
-            struct ssb_entry fake_entry;
-            fake_entry.type = SSB_TYPE_DATA;
-            fake_entry.inum = i;
-            fake_entry.offset = NDIRECT + bn;
-            fake_entry.version = IMAP_VERSION(imap_entry);
-            brelse(bp_ind);
-            if(gc_relocate_block(&fake_entry, dblk) < 0){
-              cprintf("GC: out of space in fallback indirect, stopping\n");
-              stopped_early = 1;
-              goto gc_early_exit;
-            }
-            live_blocks++;
-            // Re-read indirect after relocation
-            acquire(&lfs.lock);
-            imap_entry = lfs.imap[i];
-            release(&lfs.lock);
-            if(imap_entry == 0 || imap_entry == 0xFFFFFFFF){
-              break;  // Inode was deleted during relocation
-            }
-            iblk = IMAP_BLOCK(imap_entry);
-            islot = IMAP_SLOT(imap_entry);
-            if(iblk >= sb.size){
-              cprintf("GC fallback: INVALID iblk=%d (inum=%d)\n", iblk, i);
-              break;
-            }
-            bp_in = bread(lfs.dev, iblk);
-            ind_addr = ((struct dinode*)bp_in->data + islot)->addrs[NDIRECT];
-            brelse(bp_in);
-            if(ind_addr == 0) break;
-            if(ind_addr >= sb.size){
-              cprintf("GC fallback: INVALID ind_addr=%d (inum=%d)\n", ind_addr, i);
-              break;
-            }
-            bp_ind = bread(lfs.dev, ind_addr);
-            ind_data = (uint*)bp_ind->data;
-          }
-        }
-        brelse(bp_ind);
-      }
-    }
+// The segments a GC run frees cannot be reused until a checkpoint
+// is written, so once the log is down to GC_CRITICAL segments, write
+// one before cleaning the next victim rather than let the relocated
+// blocks use up the room that checkpoint needs.  Returns -1 if it is
+// needed but cannot be written now, as a sync or flush is under way.
+static int
+gc_checkpoint(void)
+{
+  acquire(&lfs.lock);
+  if(lfs.pending_free_count == 0 || gc_room() >= GC_CRITICAL){
+    release(&lfs.lock);
+    return 0;
   }
-
-gc_early_exit:
-  // 4. Flush SSB for all relocated blocks in this cleaning run
-  lfs_write_ssb_now();
-
-  // 5. Mark segment as free ONLY if we completed successfully
-  //    If stopped_early, there are still live blocks in this segment
-  if(!stopped_early){
-    gc_free_segment(seg_idx);
+  if(lfs.syncing || !lfs_flush_idle()){
+    release(&lfs.lock);
+    return -1;
   }
+  lfs.syncing = 1;
+  lfs.sync_proc = myproc();
+  release(&lfs.lock);
 
-  return stopped_early ? -1 : live_blocks;
+  gc_flush_ssb();
+  lfs_sync_run();
+  return 0;
 }
 
 // Main GC function: select and clean victim segments
@@ -1774,6 +3293,7 @@ lfs_gc(void)
   struct gc_victim victims[GC_TARGET_SEGS];
   int victim_count;
   int total_cleaned = 0;
+  int nested;
 
   // 1. Set GC running flag
   acquire(&lfs.lock);
@@ -1782,18 +3302,26 @@ lfs_gc(void)
     return;  // GC already in progress
   }
   lfs.gc_running = 1;
+  lfs.gc_proc = myproc();
   release(&lfs.lock);
 
   // cprintf("GC: starting garbage collection (free_count=%d)\n", lfs.free_count);
 
-  // 2. Select victim segments using cost-benefit policy
-  victim_count = gc_select_victims(victims, GC_TARGET_SEGS);
+  // 2. Select victim segments using cost-benefit policy, as many as
+  //    there is room for on the pending list
+  acquire(&lfs.lock);
+  victim_count = GC_TARGET_SEGS - lfs.pending_free_count;
+  release(&lfs.lock);
+  if(victim_count > 0)
+    victim_count = gc_select_victims(victims, victim_count);
 
   if(victim_count == 0){
     // cprintf("GC: no suitable segments to clean\n");
     acquire(&lfs.lock);
     lfs.gc_failed = 1;  // Prevent repeated GC triggers
     lfs.gc_running = 0;
+    wakeup(&lfs.gc_running);
+    wakeup(&lfs.syncing);
     release(&lfs.lock);
     return;
   }
@@ -1802,11 +3330,15 @@ lfs_gc(void)
   //      We need at least half a segment's worth of space to safely relocate blocks
   acquire(&lfs.lock);
   uint remaining_in_current = lfs.cur_seg_end - lfs.log_tail;
+  uint remaining_for_gc = lfs.gc_seg_end - lfs.gc_tail;
   uint min_space_needed = sb.segsize / 2;  // Need at least half a segment
-  if(remaining_in_current < min_space_needed && lfs.free_count == 0){
+  if(remaining_in_current < min_space_needed &&
+     remaining_for_gc < min_space_needed && lfs.free_count == 0){
     // Not enough space to safely perform GC - skip
     lfs.gc_failed = 1;
     lfs.gc_running = 0;
+    wakeup(&lfs.gc_running);
+    wakeup(&lfs.syncing);
     release(&lfs.lock);
     return;
   }
@@ -1817,6 +3349,8 @@ lfs_gc(void)
   // 3. Clean each victim segment (one at a time, freeing as we go)
   int gc_success = 1;
   for(int i = 0; i < victim_count; i++){
+    if(gc_checkpoint() < 0)
+      break;  // Leave the room to the next sync
     // cprintf("GC: cleaning segment %d, score %d, util %d%%\n",
     //         victims[i].seg_idx, victims[i].score, victims[i].util_percent);
     int result = gc_clean_segment(victims[i].seg_idx);
@@ -1828,14 +3362,24 @@ lfs_gc(void)
     total_cleaned += result;
   }
 
-  // 4. Clear gc_running BEFORE sync so lfs_sync() actually runs
+  // 4. Summarize what went to the cleaner's head, then clear
+  //    gc_running BEFORE sync so lfs_sync() actually runs
   //    Timer interrupt sync is still blocked by syncing flag inside lfs_sync()
+  gc_flush_ssb();
   acquire(&lfs.lock);
   lfs.gc_running = 0;
+  wakeup(&lfs.gc_running);
+  wakeup(&lfs.syncing);  // lfs_fsync() waits for the GC too
+  nested = lfs.syncing && lfs.sync_proc == myproc();
   release(&lfs.lock);
 
-  // 5. Sync to persist changes (flushes dirty inodes and writes checkpoint)
-  lfs_sync();
+  // 5. Sync to persist changes (flushes dirty inodes and writes
+  //    checkpoint).  Its checkpoint releases the cleaned segments.
+  //    A sync already under way may have started before they were
+  //    cleaned, so wait for it and sync again.  If we cleaned from
+  //    inside a sync of our own, they wait for the next one.
+  if(!nested)
+    lfs_fsync();
 
   // cprintf("GC: done, %d free segments available\n", lfs.free_count);
   acquire(&lfs.lock);
@@ -1863,6 +3407,7 @@ lfs_flush_only(void)
     return;
   }
   lfs.syncing = 1;
+  lfs.sync_proc = myproc();
   release(&lfs.lock);
 
   // Check if there's anything to flush
@@ -1877,6 +3422,7 @@ lfs_flush_only(void)
   if(!has_dirty && !has_ssb){
     acquire(&lfs.lock);
     lfs.syncing = 0;
+    wakeup(&lfs.syncing);
     release(&lfs.lock);
     return;
   }
@@ -1891,6 +3437,7 @@ lfs_flush_only(void)
 
   acquire(&lfs.lock);
   lfs.syncing = 0;
+  wakeup(&lfs.syncing);
   release(&lfs.lock);
 }
 
@@ -1907,20 +3454,48 @@ lfs_sync(void)
     return;
   }
   lfs.syncing = 1;
+  lfs.sync_proc = myproc();
+  release(&lfs.lock);
+  lfs_sync_run();
+}
+
+// Sync for fsync(): lfs_sync() skips while a sync or GC run is under
+// way, and that one may have started before the caller's writes, so
+// wait for it to finish and then sync.
+void
+lfs_fsync(void)
+{
+  acquire(&lfs.lock);
+  while(lfs.syncing || lfs.gc_running)
+    sleep(&lfs.syncing, &lfs.lock);
+  lfs.syncing = 1;
+  lfs.sync_proc = myproc();
   release(&lfs.lock);
+  lfs_sync_run();
+}
 
+// The body of lfs_sync(); the caller has set lfs.syncing.
+static void
+lfs_sync_run(void)
+{
   // Check if there's anything to sync
   acquire(&dirty_inodes.lock);
   int has_dirty = (dirty_inodes.count > 0);
   release(&dirty_inodes.lock);
 
+  // Segments the cleaner freed so far are released by this
+  // checkpoint; any freed while it is written wait for the next.
   acquire(&lfs.lock);
   int has_ssb = (lfs.ssb_count > 0);
+  int has_pending = (lfs.pending_free_count > 0);
+  int npending = lfs_flush_idle() ? lfs.pending_free_count : 0;
   release(&lfs.lock);
 
-  if(!has_dirty && !has_ssb){
+  if(!has_dirty && !has_ssb && !has_pending){
+    lfs_segflush();  // Staged blocks still go out on every sync
     acquire(&lfs.lock);
     lfs.syncing = 0;
+    wakeup(&lfs.syncing);
     release(&lfs.lock);
     return;  // Nothing to sync
   }
@@ -1933,51 +3508,59 @@ lfs_sync(void)
   lfs_write_ssb_now();
 
   // 3. Write SUT (Segment Usage Table)
+  acquire(&lfs.lock);
+  gc_reserve_seg();
+  release(&lfs.lock);
   lfs_write_sut();
 
   // 4. Write imap to log
   lfs_write_imap();
 
-  // 5. Write checkpoint
+  // 5. Write checkpoint, and wait for its footer to reach the disk
+  //    before the cleaned segments can be reused
   lfs_write_checkpoint();
+  bwait();
 
   // Debug: cprintf("LFS sync: log_tail now %d\n", lfs.log_tail);
 
   acquire(&lfs.lock);
+  gc_release_pending(npending);
   lfs.syncing = 0;
+  wakeup(&lfs.syncing);
   release(&lfs.lock);
 }
 
-// Write imap to log
+// Write the imap blocks that changed since they were last written
+// to the log, then the index blocks that now hold their new
+// addresses.  The index keeps the old address of every other block.
+// Each block is copied into its log buffer under lfs.lock, so it is
+// consistent even if inodes move while others are written.
 static void
 lfs_write_imap(void)
 {
   struct buf *bp;
-  uint i, j;
-  uint *p;
-  uint nblocks = (LFS_NINODES + IMAP_ENTRIES_PER_BLOCK - 1) / IMAP_ENTRIES_PER_BLOCK;
-  uint block;
-  // Use static to avoid potential stack issues
-  static uint imap_copy[LFS_NINODES];
+  uint i, ind, block;
 
-  // Copy imap under lock
-  acquire(&lfs.lock);
-  memmove(imap_copy, lfs.imap, sizeof(imap_copy));
-  lfs.cp.imap_nblocks = nblocks;
-  release(&lfs.lock);
-
-  for(i = 0; i < nblocks && i < NIMAP_BLOCKS; i++){
+  for(i = 0; ; i++){
     // Allocate block for imap
     acquire(&lfs.lock);
+    if(i >= lfs.cp.imap_nblocks){
+      release(&lfs.lock);
+      break;
+    }
+    if(!lfs.imap_dirty[i]){
+      release(&lfs.lock);
+      continue;
+    }
     // Check if we need to switch to a free segment
     if(lfs.log_tail >= lfs.cur_seg_end){
       if(lfs.free_count > 0){
-        uint free_seg = lfs.free_segs[lfs.free_head];
-        lfs.free_head = (lfs.free_head + 1) % LFS_NSEGS_MAX;
+        uint free_seg = *free_seg_at(lfs.free_head);
+        lfs.free_head = (lfs.free_head + 1) % sb.nsegs;
         lfs.free_count--;
         lfs.log_tail = sb.segstart + free_seg * sb.segsize;
         lfs.cur_seg_end = lfs.log_tail + sb.segsize;
-        lfs.sut[free_seg].live_bytes = 0;
+        sut_mod(free_seg)->live_bytes = 0;
         // cprintf("LFS: imap switching to free segment %d\n", free_seg);
       } else {
         release(&lfs.lock);
@@ -1985,71 +3568,178 @@ lfs_write_imap(void)
       }
     }
     block = lfs.log_tail++;
-    lfs.cp.imap_addrs[i] = block;
     release(&lfs.lock);
 
-    // Write imap block (outside lock)
-    bp = bread(lfs.dev, block);
-    memset(bp->data, 0, BSIZE);
-    p = (uint*)bp->data;
-    for(j = 0; j < IMAP_ENTRIES_PER_BLOCK && (i * IMAP_ENTRIES_PER_BLOCK + j) < LFS_NINODES; j++){
-      p[j] = imap_copy[i * IMAP_ENTRIES_PER_BLOCK + j];
-    }
-    bwrite(bp);
+    bp = bnew(lfs.dev, block);
+    acquire(&lfs.lock);
+    memmove(bp->data, lfs.imap[i], BSIZE);
+    lfs.imap_dirty[i] = 0;
+    *imap_addr(i) = block;
+    lfs.imap_ind_dirty[i / IMAP_ADDRS_PER_IND] = 1;
+    release(&lfs.lock);
+    lfs_segwrite(bp);
     brelse(bp);
   }
+  for(ind = 0; ind * IMAP_ADDRS_PER_IND < lfs.cp.imap_nblocks; ind++){
+    acquire(&lfs.lock);
+    if(!lfs.imap_ind_dirty[ind]){
+      release(&lfs.lock);
+      continue;
+    }
+    lfs_write_meta_block(lfs.imap_ind[ind], &lfs.imap_ind_dirty[ind],
+                         &lfs.cp.imap_ind[ind]);
+  }
 }
 
-// Allocate a block from the log tail with optional atomic SSB entry
-// ssb_type = 0 means no SSB entry (for internal metadata like imap, checkpoint)
-// With GC integration: triggers GC when disk is nearly full
-static uint
-lfs_alloc_with_ssb(uchar ssb_type, uint ssb_inum, uint ssb_offset, uint ssb_version)
+// Is the log short of free segments, by the mark given?  Until the
+// log first wraps, the space past its tail counts as free only while
+// the disk is less than GC_THRESHOLD full.
+// Caller must hold lfs.lock.
+static int
+lfs_gc_below(int mark)
 {
-  uint block;
-  int should_sync = 0;
-  int should_gc = 0;
+  uint used_blocks, total_blocks;
 
-  if(holding(&lfs.lock))
-    panic("lfs_alloc: recursive lock acquisition");
+  if(lfs.free_count >= mark)
+    return 0;
+  if(lfs.cur_seg_end < sb.size)
+    return 1;  // Already using free segments
+  used_blocks = lfs.log_tail - sb.segstart;
+  total_blocks = sb.size - sb.segstart;
+  return used_blocks * 100 / total_blocks >= GC_THRESHOLD;
+}
+
+// The cleaner process.  Writers wake it once free segments drop
+// below GC_LOWAT; it then cleans until there are GC_HIWAT of them,
+// but above GC_LOWAT only while no writer has asked for a block for
+// GC_IDLE_TICKS, so that it mostly runs when the disk is idle.
+struct {
+  struct spinlock lock;
+  int wanted;              // a writer found free segments low
+} cleaner;
+
+static void
+cleaner_wake(void)
+{
+  acquire(&cleaner.lock);
+  if(!cleaner.wanted){
+    cleaner.wanted = 1;
+    wakeup(&cleaner);
+  }
+  release(&cleaner.lock);
+}
+
+// One step of the cleaner: a GC run, or a tick's wait for the log
+// to go idle or for a sync to finish.  Returns 0 to be called
+// again, -1 once there is nothing left to do.
+static int
+lfs_clean(void)
+{
+  int low, high, idle, syncing;
 
-  // Check if GC should be triggered (before acquiring lock)
   acquire(&lfs.lock);
-  
+  if(lfs.gc_failed || lfs.gc_running){
+    release(&lfs.lock);
+    return -1;
+  }
+  low = lfs_gc_below(GC_LOWAT);
+  high = lfs_gc_below(GC_HIWAT);
+  idle = ticks - lfs.write_tick >= GC_IDLE_TICKS;
+  syncing = lfs.syncing;
+  release(&lfs.lock);
+
+  if(!high)
+    return -1;
+  if(syncing || (!low && !idle)){
+    acquire(&tickslock);
+    sleep(&ticks, &tickslock);
+    release(&tickslock);
+    return 0;
+  }
+  // Flush SSB before GC to ensure all blocks have SSB coverage
+  lfs_write_ssb_now();
+  lfs_write_pending_ssb();
+  lfs_gc();
+  return 0;
+}
+
+static void
+lfs_cleaner(void)
+{
+  for(;;){
+    acquire(&cleaner.lock);
+    while(!cleaner.wanted)
+      sleep(&cleaner, &cleaner.lock);
+    cleaner.wanted = 0;
+    release(&cleaner.lock);
+
+    while(lfs_clean() == 0)
+      ;
+  }
+}
+
+// Start the cleaner process.  It sleeps until the first writer
+// wakes it, by which time the file system is mounted.
+void
+cleanerinit(void)
+{
+  initlock(&cleaner.lock, "cleaner");
+  kproc("cleaner", lfs_cleaner);
+}
+
+// Called by writers before they take log blocks.  Wakes the cleaner
+// if free segments are running low; the writer only cleans itself
+// once they are critically low, as the log may run out before the
+// cleaner gets to run.  Not while syncing: the cleaner flushes
+// inodes and syncs itself.
+// Caller must not hold lfs.lock.
+static void
+lfs_gc_check(void)
+{
+  int low, critical;
+
+  acquire(&lfs.lock);
+  if(lfs.gc_running && lfs.gc_proc == myproc()){
+    release(&lfs.lock);
+    return;  // The GC's own writes
+  }
+  lfs.write_tick = ticks;
+
   // If we are low on segments, reset gc_failed to try again 
   // (deletion might have happened since last failure).
   // We check free_count because cur_seg_end wraps around when recycling.
-  if(lfs.gc_failed && lfs.free_count < GC_TARGET_SEGS){
+  if(lfs.gc_failed && lfs.free_count < GC_LOWAT){
     lfs.gc_failed = 0;
   }
 
-  // Trigger GC when running low on free segments
-  if(!lfs.gc_running && !lfs.syncing && !lfs.gc_failed && lfs.free_count < GC_TARGET_SEGS){
-    if(lfs.cur_seg_end < sb.size){
-      // Already using free segments - disk is full, need GC
-      should_gc = 1;
-    } else {
-      uint used_blocks = lfs.log_tail - sb.segstart;
-      uint total_blocks = sb.size - sb.segstart;
-      uint usage_percent = (used_blocks * 100) / total_blocks;
-      if(usage_percent >= GC_THRESHOLD){
-        should_gc = 1;
-      }
-    }
-  }
-
+  low = !lfs.gc_failed && lfs_gc_below(GC_LOWAT);
+  critical = low && !lfs.gc_running && !lfs.syncing &&
+             lfs.free_count + (lfs.cur_seg_end - lfs.log_tail) / sb.segsize < GC_CRITICAL;
   release(&lfs.lock);
 
-  // Run GC if needed (outside of lock)
-  if(should_gc){
+  if(critical){
     // Flush SSB before GC to ensure all blocks have SSB coverage
-    // But only if we're not already in a sync operation (to avoid recursion)
-    if(!lfs.syncing){
-      lfs_write_ssb_now();
-      lfs_write_pending_ssb();
-    }
+    lfs_write_ssb_now();
+    lfs_write_pending_ssb();
     lfs_gc();
+  } else if(low){
+    cleaner_wake();
   }
+}
+
+// Allocate a block from the log tail with optional atomic SSB entry
+// ssb_type = 0 means no SSB entry (for internal metadata like imap, checkpoint)
+// With GC integration: triggers GC when disk is nearly full
+static uint
+lfs_alloc_with_ssb(uchar ssb_type, uint ssb_inum, uint ssb_offset, uint ssb_version)
+{
+  uint block;
+  int should_sync = 0;
+
+  if(holding(&lfs.lock))
+    panic("lfs_alloc: recursive lock acquisition");
+
+  lfs_gc_check();
 
   acquire(&lfs.lock);
   
@@ -2077,31 +3767,25 @@ lfs_alloc_with_ssb(uchar ssb_type, uint ssb_inum, uint ssb_offset, uint ssb_vers
     uint off = (lfs.log_tail - sb.segstart) % sb.segsize;
     uint rem = sb.segsize - off;
 
-    // If we're in reserved zone (last 2 blocks), flush inodes and write SSB
-    // Use ssb_flushing as guard against recursion from lfs_flush_inodes
+    // If we're in reserved zone (last 2 blocks), close this segment's
+    // SSB.  Do not flush dirty inodes first: the flush writes data and
+    // indirect blocks too, which spill into the next segment, and
+    // their entries belong in that segment's SSB, not this one.
     if(rem <= 2 && rem > 0 && lfs.ssb_count > 0 && !lfs.ssb_flushing){
-      // Mark as flushing FIRST to prevent recursion
       lfs.ssb_flushing = 1;
 
-      // Reserve first block for SSB (before calling flush which may allocate)
       uint ssb_block = lfs.log_tail;
       lfs.log_tail++;  // Reserve this block for SSB
 
       // Calculate next segment start
       uint next_seg_start = ((lfs.log_tail - sb.segstart + sb.segsize - 1) / sb.segsize) * sb.segsize + sb.segstart;
 
-      release(&lfs.lock);
-
-      // Flush dirty inodes - allocates blocks AFTER ssb_block
-      lfs_flush_inodes();
-
-      acquire(&lfs.lock);
-
-      // Prepare SSB for writing (now includes inode entries from flush)
+      // Prepare SSB for writing
       lfs.ssb_pending_count = lfs.ssb_count;
       memmove(lfs.ssb_flush_buf, lfs.ssb_buf, lfs.ssb_count * sizeof(struct ssb_entry));
       lfs.ssb_count = 0;
       lfs.ssb_pending_block = ssb_block;  // Use reserved block for SSB
+      lfs.ssb_pending_prev = ssb_chain(ssb_block);
       lfs.ssb_next_seg = next_seg_start;
     }
 
@@ -2132,6 +3816,7 @@ lfs_alloc_with_ssb(uchar ssb_type, uint ssb_inum, uint ssb_offset, uint ssb_vers
       lfs.ssb_count = 0;
       // Set pending block to reserved one
       lfs.ssb_pending_block = lfs.reserved_ssb_block;
+      lfs.ssb_pending_prev = ssb_chain(lfs.ssb_pending_block);
       
       // Consume the block
       lfs.log_tail++;
@@ -2164,8 +3849,8 @@ use_free_segment:
     // Current allocation region exhausted - try to use a free segment
     if(lfs.free_count > 0){
       // Get next free segment
-      uint free_seg = lfs.free_segs[lfs.free_head];
-      lfs.free_head = (lfs.free_head + 1) % LFS_NSEGS_MAX;
+      uint free_seg = *free_seg_at(lfs.free_head);
+      lfs.free_head = (lfs.free_head + 1) % sb.nsegs;
       lfs.free_count--;
 
       // Validate free segment index
@@ -2188,11 +3873,21 @@ use_free_segment:
       }
 
       // Reset live_bytes for reuse (was marked with SUT_FREE_MARKER)
-      lfs.sut[free_seg].live_bytes = 0;
+      sut_mod(free_seg)->live_bytes = 0;
       // Update ssb_seg_start for new segment
       lfs.ssb_seg_start = lfs.log_tail;
     } else {
-      // No free segments - try GC one more time before giving up
+      // No free segments.  If another process is cleaning, wait for
+      // it to free one; the log tail may have moved on meanwhile.
+      if(lfs.gc_running && lfs.gc_proc != myproc()){
+        while(lfs.free_count == 0 && lfs.gc_running)
+          sleep(&lfs.gc_running, &lfs.lock);
+        if(lfs.log_tail < lfs.cur_seg_end)
+          goto alloc_block;
+        if(lfs.free_count > 0)
+          goto use_free_segment;
+      }
+      // Try GC one more time before giving up
       if(!lfs.gc_running && !lfs.gc_failed){
         lfs.gc_failed = 0;  // Reset to force another attempt
         release(&lfs.lock);
@@ -2200,12 +3895,12 @@ use_free_segment:
         acquire(&lfs.lock);
         // Check if GC freed any segments
         if(lfs.free_count > 0){
-          uint free_seg = lfs.free_segs[lfs.free_head];
-          lfs.free_head = (lfs.free_head + 1) % LFS_NSEGS_MAX;
+          uint free_seg = *free_seg_at(lfs.free_head);
+          lfs.free_head = (lfs.free_head + 1) % sb.nsegs;
           lfs.free_count--;
           lfs.log_tail = sb.segstart + free_seg * sb.segsize;
           lfs.cur_seg_end = lfs.log_tail + sb.segsize;
-          lfs.sut[free_seg].live_bytes = 0;
+          sut_mod(free_seg)->live_bytes = 0;
           lfs.ssb_seg_start = lfs.log_tail;
           // Continue to allocate
           goto alloc_block;
@@ -2231,6 +3926,7 @@ alloc_block:
   // This ensures the entry is added BEFORE any SSB flush that could affect this segment
   if(ssb_type != 0 && lfs.ssb_count < SSB_ENTRIES_PER_BLOCK){
     lfs.ssb_buf[lfs.ssb_count].type = ssb_type;
+    lfs.ssb_buf[lfs.ssb_count].slot = (block - sb.segstart) % sb.segsize;
     lfs.ssb_buf[lfs.ssb_count].inum = ssb_inum;
     lfs.ssb_buf[lfs.ssb_count].offset = ssb_offset;
     lfs.ssb_buf[lfs.ssb_count].version = ssb_version;
@@ -2243,81 +3939,80 @@ alloc_block:
   return block;
 }
 
-// Legacy wrapper for internal allocations (imap, checkpoint, SSB itself)
-static uint
-lfs_alloc(void)
-{
-  return lfs_alloc_with_ssb(0, 0, 0, 0);
-}
-
 // Simplified: inode blocks now use a single SSB entry per block
 // GC determines liveness by checking if any imap entry points to the block
 
-// Flush dirty inodes to a single block
-// Must be called before checkpoint or when buffer is full
+// Flush the staged generation of dirty inodes, IPB to a block.
+// Must be called before checkpoint or when buffer is full.  Only one
+// flush runs at a time; a call made while one is under way returns
+// at once, leaving what it would have written staged for the next.
 static void
 lfs_flush_inodes(void)
 {
   struct buf *bp;
   struct dinode *dip;
   uint block;
-  int i, count;
+  int i, j, d, n, count;
 
-  // 1. Move to flushing buffer
+  // 1. Close the current generation; later changes stage a new one
   acquire(&dirty_inodes.lock);
-  count = dirty_inodes.count;
-  if(count == 0){
+  if(dirty_inodes.count == 0 || dirty_inodes.flushing_count > 0){
     release(&dirty_inodes.lock);
     return;
   }
-  
-  if(dirty_inodes.flushing_count > 0)
-    panic("lfs_flush_inodes: flush already in progress");
-
-  for(i = 0; i < count; i++){
-    memmove(&dirty_inodes.flushing_inodes[i], &dirty_inodes.inodes[i], sizeof(struct dinode));
-    dirty_inodes.flushing_inums[i] = dirty_inodes.inums[i];
-    dirty_inodes.flushing_versions[i] = dirty_inodes.versions[i];
+  count = 0;
+  for(d = 0; d < NDSLOT; d++){
+    if(dirty_inodes.inums[d] != 0 && dirty_inodes.gens[d] == dirty_inodes.gen)
+      dirty_inodes.flushing[count++] = d;
   }
   dirty_inodes.flushing_count = count;
+  dirty_inodes.gen++;
   dirty_inodes.count = 0;
   release(&dirty_inodes.lock);
 
-  // 2. Allocate block with single SSB entry for the inode block
-  // Debug: cprintf("LFS flush %d inodes\n", count);
-  // Use first inum as identifier; GC will check all imaps pointing to this block
-  block = lfs_alloc_with_ssb(SSB_TYPE_INODE, dirty_inodes.flushing_inums[0], 0, 0);
-  lfs_write_pending_ssb();  // Write any pending SSB before bread
-
-  // 3. Write inodes to block (using flushing buffer)
-  bp = bread(lfs.dev, block);
-  memset(bp->data, 0, BSIZE);
-  dip = (struct dinode*)bp->data;
-
-  // Safe to read flushing buffer without lock?
-  // Yes, because flushing_count > 0 prevents others from overwriting it.
-  // And iput only reads it or modifies active buffer.
+  // Data and indirect blocks go to the log first so the inodes
+  // can point at them
   for(i = 0; i < count; i++){
-    memmove(&dip[i], &dirty_inodes.flushing_inodes[i], sizeof(struct dinode));
+    lfs_data_flush(dirty_inodes.flushing[i]);
+    lfs_ind_flush(dirty_inodes.flushing[i]);
   }
-  bwrite(bp);
-  brelse(bp);
 
-  // 4. Update imap (SSB entries already added atomically in lfs_alloc_for_inode_block)
-  acquire(&lfs.lock);
-  for(i = 0; i < count; i++){
-    uint inum = dirty_inodes.flushing_inums[i];
-    uint version = dirty_inodes.flushing_versions[i];
-    // Only update if inode is valid (type != 0).
-    // Check type, not imap, because new inodes have imap=0 initially.
-    if(dirty_inodes.flushing_inodes[i].type != 0) {
-      lfs.imap[inum] = IMAP_ENCODE(block, version, i);
+  // 2. Write the inodes IPB to a block.  The segment writer stages
+  // the blocks and sends them to the disk together.
+  for(i = 0; i < count; i += IPB){
+    n = count - i < IPB ? count - i : IPB;
+
+    // Use first inum as identifier; GC will check all imaps pointing to this block
+    block = lfs_alloc_with_ssb(SSB_TYPE_INODE, dirty_inodes.inums[dirty_inodes.flushing[i]], 0, 0);
+    lfs_write_pending_ssb();  // Write any pending SSB before bread
+
+    // The slots being flushed belong to a closed generation, so only
+    // lfs_patch_addr() changes them, and it holds the lock.
+    bp = bnew(lfs.dev, block);
+    dip = (struct dinode*)bp->data;
+    acquire(&dirty_inodes.lock);
+    for(j = 0; j < n; j++)
+      memmove(&dip[j], &dirty_inodes.inodes[dirty_inodes.flushing[i+j]], sizeof(struct dinode));
+    release(&dirty_inodes.lock);
+    lfs_segwrite(bp);
+    brelse(bp);
+
+    // 3. Update imap
+    acquire(&lfs.lock);
+    for(j = 0; j < n; j++){
+      d = dirty_inodes.flushing[i+j];
+      // Only update if inode is valid (type != 0).
+      // Check type, not imap, because new inodes have imap=0 initially.
+      if(dirty_inodes.inodes[d].type != 0)
+        imap_set(dirty_inodes.inums[d], block, dirty_inodes.versions[d], j);
     }
+    release(&lfs.lock);
   }
-  release(&lfs.lock);
 
-  // 5. Clear flushing buffer
+  // 4. Free the flushed slots
   acquire(&dirty_inodes.lock);
+  for(i = 0; i < count; i++)
+    dirty_remove(dirty_inodes.flushing[i]);
   dirty_inodes.flushing_count = 0;
   release(&dirty_inodes.lock);
 }
@@ -2327,11 +4022,75 @@ lfs_flush_inodes(void)
 // Scans log from checkpoint to find and recover data written after checkpoint
 // ============================================================================
 
-// Find the actual end of the log by scanning SSBs from checkpoint's log_tail
+// Recover from an SSB written after the checkpoint: point the imap at
+// the inode blocks it describes, and put it on its segment's SSB
+// chain.  Returns the number of imap entries updated.
+static int
+lfs_rollforward_ssb(uint blk, struct ssb *ssb_ptr, uint checkpoint_tail)
+{
+  struct sut_entry *su;
+  int recovered = 0;
+
+  // Process SSB entries
+  for(uint e = 0; e < ssb_ptr->nblocks && e < SSB_ENTRIES_PER_BLOCK; e++){
+    struct ssb_entry *entry = &ssb_ptr->entries[e];
+
+    if(entry->type == SSB_TYPE_INODE){
+      // Recover inode block - update imap
+      // SSB entries are added in order, so entry index corresponds to block offset
+      // Blocks are written BEFORE their SSB, so calculate block address
+      uint inode_block = blk - ssb_ptr->nblocks + e;
+
+      if(inode_block >= checkpoint_tail && inode_block < blk){
+        // Read the inode block
+        struct buf *bp_inode = bread(lfs.dev, inode_block);
+        struct dinode *dips = (struct dinode*)bp_inode->data;
+
+        // First inum is stored in entry->inum
+        // Scan all slots in the inode block
+        for(int slot = 0; slot < IPB; slot++){
+          if(dips[slot].type != 0){
+            uint inum = entry->inum + slot;
+            if(inum > 0 && inum < LFS_MAXINODES){
+              // Update imap with new location
+              struct imap_entry old = imap_get(inum);
+
+              // Only update if version is newer or equal
+              if(old.block == 0 || old.block == IMAP_NEW ||
+                 entry->version >= IMAP_VERSION(old)){
+                imap_set(inum, inode_block, entry->version, slot);
+                recovered++;
+              }
+            }
+          }
+        }
+        brelse(bp_inode);
+      }
+    }
+    // DATA and indirect blocks are recovered through their inodes
+  }
+
+  // The checkpointed SUT may predate this SSB.  An SSB that starts a
+  // chain means its segment was reused since.
+  su = sut_mod((blk - sb.segstart) / sb.segsize);
+  if(su->last_ssb != blk){
+    if(ssb_ptr->prev_ssb == 0)
+      su->nssb = 0;
+    else if(ssb_ptr->prev_ssb != su->last_ssb)
+      su->nssb = SSB_CHAIN_UNKNOWN;
+    su->last_ssb = blk;
+    if(su->nssb != SSB_CHAIN_UNKNOWN)
+      su->nssb++;
+  }
+  return recovered;
+}
+
+// Find the actual end of the log by scanning SSBs from checkpoint's log_tail,
+// recovering from each SSB on the way.
 // Uses SSB magic + checksum + next_seg_addr to trace the log
 // Returns the block number of the first invalid/unwritten block
 static uint
-lfs_find_log_end(int dev, uint start_block)
+lfs_find_log_end(int dev, uint start_block, int *recovered)
 {
   struct buf *bp;
   struct ssb *ssb_ptr;
@@ -2356,9 +4115,17 @@ lfs_find_log_end(int dev, uint start_block)
 
       // Check for valid SSB
       if(ssb_ptr->magic == SSB_MAGIC && gc_verify_checksum(ssb_ptr)){
+        // SSBs older than the checkpoint are left over from a previous
+        // use of a recycled segment, not part of the current log.
+        if(ssb_ptr->timestamp < lfs.cp.timestamp){
+          brelse(bp);
+          cprintf("lfs_find_log_end: stale SSB at %d, end=%d\n", blk, last_valid_end);
+          return last_valid_end;
+        }
         found_ssb_in_seg = 1;
         // This SSB describes blocks written before it
         last_valid_end = blk + 1;
+        *recovered += lfs_rollforward_ssb(blk, ssb_ptr, start_block);
 
         // Check if SSB has next_seg_addr (segment boundary marker)
         if(ssb_ptr->next_seg_addr != 0){
@@ -2407,104 +4174,23 @@ lfs_find_log_end(int dev, uint start_block)
 }
 
 // Roll forward from checkpoint, recovering data from SSBs
-// Called after lfs_read_checkpoint() and lfs_read_imap()
+// Called after lfs_read_checkpoint(), lfs_read_imap() and lfs_read_sut().
+// The log is read once: lfs_find_log_end() recovers from each SSB
+// as it finds it.
 static void
 lfs_rollforward(int dev)
 {
   uint checkpoint_tail = lfs.log_tail;
   uint actual_end;
-  struct buf *bp;
-  struct ssb *ssb_ptr;
   int recovered_inodes = 0;
 
-  // Find actual end of log
-  actual_end = lfs_find_log_end(dev, checkpoint_tail);
+  actual_end = lfs_find_log_end(dev, checkpoint_tail, &recovered_inodes);
 
   if(actual_end <= checkpoint_tail){
     cprintf("lfs_rollforward: no data to recover\n");
     return;
   }
 
-  cprintf("lfs_rollforward: scanning blocks %d to %d\n", checkpoint_tail, actual_end);
-
-  // Scan from checkpoint to actual end, processing SSBs
-  uint current_block = checkpoint_tail;
-
-  while(current_block < actual_end){
-    uint seg_idx = (current_block - sb.segstart) / sb.segsize;
-    uint seg_start = sb.segstart + seg_idx * sb.segsize;
-    uint seg_end = seg_start + sb.segsize;
-    if(seg_end > actual_end) seg_end = actual_end;
-
-    // Scan segment for SSBs
-    for(uint blk = current_block; blk < seg_end; blk++){
-      bp = bread(dev, blk);
-      ssb_ptr = (struct ssb *)bp->data;
-
-      if(ssb_ptr->magic != SSB_MAGIC || !gc_verify_checksum(ssb_ptr)){
-        brelse(bp);
-        continue;
-      }
-
-      // SSB is valid and located after checkpoint's log_tail
-      // This means it was written after the last checkpoint
-      // (No need to check timestamp - position is sufficient)
-
-      // Process SSB entries
-      for(uint e = 0; e < ssb_ptr->nblocks && e < SSB_ENTRIES_PER_BLOCK; e++){
-        struct ssb_entry *entry = &ssb_ptr->entries[e];
-
-        if(entry->type == SSB_TYPE_INODE){
-          // Recover inode block - update imap
-          // SSB entries are added in order, so entry index corresponds to block offset
-          // Blocks are written BEFORE their SSB, so calculate block address
-          uint inode_block = blk - ssb_ptr->nblocks + e;
-
-          if(inode_block >= checkpoint_tail && inode_block < blk){
-            // Read the inode block
-            struct buf *bp_inode = bread(dev, inode_block);
-            struct dinode *dips = (struct dinode*)bp_inode->data;
-
-            // First inum is stored in entry->inum
-            // Scan all slots in the inode block
-            for(int slot = 0; slot < IPB; slot++){
-              if(dips[slot].type != 0){
-                uint inum = entry->inum + slot;
-                if(inum > 0 && inum < LFS_NINODES){
-                  // Update imap with new location
-                  uint new_entry = IMAP_ENCODE(inode_block, entry->version, slot);
-                  uint old_entry = lfs.imap[inum];
-
-                  // Only update if version is newer or equal
-                  if(old_entry == 0 || old_entry == 0xFFFFFFFF ||
-                     IMAP_VERSION(new_entry) >= IMAP_VERSION(old_entry)){
-                    lfs.imap[inum] = new_entry;
-                    recovered_inodes++;
-                  }
-                }
-              }
-            }
-            brelse(bp_inode);
-          }
-        }
-        // DATA and INDIRECT blocks are recovered through their inodes
-      }
-
-      // Check for segment boundary jump
-      if(ssb_ptr->next_seg_addr != 0 && ssb_ptr->next_seg_addr < sb.size){
-        uint next_seg = ssb_ptr->next_seg_addr;
-        brelse(bp);
-        current_block = next_seg;
-        goto next_seg_rollforward;
-      }
-
-      brelse(bp);
-    }
-
-    current_block = seg_end;
-    next_seg_rollforward:;
-  }
-
   // Update log_tail to actual end
   lfs.log_tail = actual_end;
 
@@ -2512,6 +4198,63 @@ lfs_rollforward(int dev)
           recovered_inodes, actual_end);
 }
 
+// Mark the indirect block at addr live, and the blocks it lists; for
+// a double-indirect block (level 2), the indirect blocks it lists.
+static void
+lfs_build_live_ind(int dev, uint addr, int level)
+{
+  struct buf *bp;
+  uint *a;
+  int i;
+
+  if(addr == 0)
+    return;
+  live_mark(addr, 1);
+  bp = bread(dev, addr);
+  a = (uint*)bp->data;
+  for(i = 0; i < NINDIRECT; i++){
+    if(level == 1)
+      live_mark(a[i], 1);
+    else
+      lfs_build_live_ind(dev, a[i], 1);
+  }
+  brelse(bp);
+}
+
+// Build the cleaner's liveness state (see struct seglive) from the
+// imap and the inodes.  Runs at mount after roll-forward, when the
+// disk holds every inode.
+static void
+lfs_build_live(int dev)
+{
+  struct imap_entry e;
+  struct buf *bp;
+  struct seglive **live;
+  uint addrs[NDIRECT+2];
+  uint inum, i;
+
+  if((sb.nsegs + SEGLIVE_PER_PAGE - 1) / SEGLIVE_PER_PAGE > PGSIZE / sizeof(struct seglive*))
+    panic("lfs_build_live: too many segments");
+  live = lfs_pagealloc();
+  for(i = 0; i * SEGLIVE_PER_PAGE < sb.nsegs; i++)
+    live[i] = lfs_pagealloc();
+  lfs.live = live;
+
+  for(inum = 1; inum < IMAP_NINODES(); inum++){
+    e = imap_get(inum);
+    if(seglive_of(e.block) == 0)
+      continue;
+    ilist_add(inum, e.block);
+    bp = bread(dev, e.block);
+    memmove(addrs, ((struct dinode*)bp->data)[IMAP_SLOT(e)].addrs, sizeof(addrs));
+    brelse(bp);
+    for(i = 0; i < NDIRECT; i++)
+      live_mark(addrs[i], 1);
+    lfs_build_live_ind(dev, addrs[NDIRECT], 1);
+    lfs_build_live_ind(dev, addrs[NDIRECT+1], 2);
+  }
+}
+
 // Inodes.
 //
 // An inode describes a single unnamed file.
@@ -2525,15 +4268,27 @@ lfs_rollforward(int dev)
 void
 iinit(int dev)
 {
-  int i = 0;
+  int i = 0, j, maxinode;
+  struct inode *ip;
 
   initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
+  dcache_init();
+  icache.lru.prev = &icache.lru;
+  icache.lru.next = &icache.lru;
+  initsleeplock(&segw.lock, "segw");
+  for(i = 0; i < 2*NHEAD; i++)
+    for(j = 0; j < LFS_SEGSIZE; j++)
+      segw.seg[i].blk[j].data = segw.seg[i].data[j];
+  for(i = 0; i < NHEAD; i++)
+    segw.cur[i] = 2*i;
 
   initlock(&lfs.lock, "lfs");
   initlock(&dirty_inodes.lock, "dirty_inodes");
+  for(i = 0; i < NDBUCKET; i++)
+    dirty_inodes.bucket[i] = -1;
+  for(i = 0; i < NDSLOT; i++)
+    dirty_inodes.hnext[i] = i + 1 < NDSLOT ? i + 1 : -1;
+  dirty_inodes.free = 0;
   dirty_inodes.count = 0;
   dirty_inodes.flushing_count = 0;
   lfs.dev = dev;
@@ -2542,6 +4297,7 @@ iinit(int dev)
   lfs.free_head = 0;
   lfs.free_tail = 0;
   lfs.free_count = 0;
+  lfs.pending_free_count = 0;
   lfs.gc_running = 0;
   lfs.reserved_ssb_block = 0;
 
@@ -2551,6 +4307,28 @@ iinit(int dev)
   if(sb.magic != LFS_MAGIC){
     panic("iinit: not an LFS filesystem");
   }
+  // The segment writer, the cleaner and the live bitmaps have room
+  // for LFS_SEGSIZE blocks per segment and index it by sb.segsize.
+  if(sb.segsize == 0 || sb.segsize > LFS_SEGSIZE)
+    panic("iinit: segment larger than LFS_SEGSIZE");
+  if(sb.segstart + sb.nsegs * sb.segsize > sb.size)
+    panic("iinit: segments past end of disk");
+  bsetmax(sb.size);
+
+  // No point caching more inodes than the disk has.
+  maxinode = kfreecount() / 100 * ICACHEPCT * NIPP;
+  if(maxinode > sb.ninodes)
+    maxinode = sb.ninodes;
+  while(icache.ninode < maxinode && (ip = (struct inode*)kalloc()) != 0){
+    memset(ip, 0, PGSIZE);
+    for(i = 0; i < NIPP; i++){
+      initsleeplock(&ip[i].lock, "inode");
+      icache_lru_add(&ip[i], 0);
+    }
+    icache.ninode += NIPP;
+  }
+  if(icache.ninode == 0)
+    panic("iinit: icache");
 
   // Read checkpoint and imap
   lfs_read_checkpoint(dev);
@@ -2559,6 +4337,7 @@ iinit(int dev)
 
   // Roll-forward recovery: scan log from checkpoint to recover newer data
   lfs_rollforward(dev);
+  lfs_build_live(dev);
 
   // Initialize cur_seg_end: sequential allocation up to end of disk
   lfs.cur_seg_end = sb.size;
@@ -2574,59 +4353,47 @@ static struct inode* iget(uint dev, uint inum);
 
 //PAGEBREAK!
 // Allocate an inode on device dev.
-// Mark it as allocated by giving it type type.
+// Mark it as allocated by giving it type type.  The inode number is
+// taken near near (the parent directory) when one is free there.
 // Returns an unlocked but allocated and referenced inode.
 // Sprite LFS: inode is added to dirty buffer, NOT persisted immediately.
 struct inode*
-ialloc(uint dev, short type)
+ialloc(uint dev, short type, uint near)
 {
-  int inum;
+  uint inum;
   struct dinode di;
   int need_sync = 0;
 
-  // Find a free inode slot
+  // Find a free inode slot; IMAP_NEW marks it as being in the dirty buffer
   acquire(&lfs.lock);
-  for(inum = 1; inum < LFS_NINODES; inum++){
-    if(lfs.imap[inum] == 0){
-      // Mark slot as used with a placeholder (0xFFFFFFFF means "in dirty buffer")
-      lfs.imap[inum] = 0xFFFFFFFF;
-      release(&lfs.lock);
-      // Debug: cprintf("ialloc: inum %d type %d\n", inum, type);
-
-      // Initialize inode
-      memset(&di, 0, sizeof(di));
-      di.type = type;
-      di.nlink = 0;
-      di.size = 0;
+  if((inum = inum_alloc(near)) == 0){
+    release(&lfs.lock);
+    panic("ialloc: no inodes");
+  }
+  release(&lfs.lock);
+  // Debug: cprintf("ialloc: inum %d type %d\n", inum, type);
 
-      // Add inode to dirty buffer
-      acquire(&dirty_inodes.lock);
-      if(dirty_inodes.count >= IPB){
-        // Buffer is full - flush only (no checkpoint, recoverable via roll-forward)
-        release(&dirty_inodes.lock);
-        lfs_flush_only();
-        acquire(&dirty_inodes.lock);
-      }
-      memmove(&dirty_inodes.inodes[dirty_inodes.count], &di, sizeof(di));
-      dirty_inodes.inums[dirty_inodes.count] = inum;
-      dirty_inodes.versions[dirty_inodes.count] = 0; // Initialize version to 0
-      dirty_inodes.count++;
-      if(dirty_inodes.count >= IPB){
-        need_sync = 1;
-      }
-      release(&dirty_inodes.lock);
+  // Initialize inode
+  memset(&di, 0, sizeof(di));
+  di.type = type;
+  di.nlink = 0;
+  di.size = 0;
 
-      if(need_sync){
-        lfs_flush_only();  // Flush only, no checkpoint
-      }
-      // NO checkpoint here - Sprite LFS approach
+  // Add inode to dirty buffer
+  acquire(&dirty_inodes.lock);
+  dirty_reserve();
+  dirty_add(inum, 0, &di);  // Initialize version to 0
+  if(dirty_inodes.count >= LFS_NDIRTYINODE){
+    need_sync = 1;
+  }
+  release(&dirty_inodes.lock);
 
-      return iget(dev, inum);
-    }
+  if(need_sync){
+    lfs_flush_only();  // Flush only, no checkpoint
   }
+  // NO checkpoint here - Sprite LFS approach
 
-  release(&lfs.lock);
-  panic("ialloc: no inodes");
+  return iget(dev, inum);
 }
 
 // Copy a modified in-memory inode to dirty buffer.
@@ -2637,7 +4404,7 @@ void
 iupdate(struct inode *ip)
 {
   struct dinode di;
-  int i, found;
+  int d;
   int need_sync = 0;
 
   // Prepare dinode
@@ -2646,37 +4413,23 @@ iupdate(struct inode *ip)
   di.minor = ip->minor;
   di.nlink = ip->nlink;
   di.size = ip->size;
-  memmove(di.addrs, ip->addrs, sizeof(ip->addrs));
 
   acquire(&dirty_inodes.lock);
+  // lfs_ind_flush() may move the indirect block addresses under this lock
+  memmove(di.addrs, ip->addrs, sizeof(ip->addrs));
 
-  // Check if this inode is already in the buffer (update in place)
-  found = 0;
-  for(i = 0; i < dirty_inodes.count; i++){
-    if(dirty_inodes.inums[i] == ip->inum){
-      memmove(&dirty_inodes.inodes[i], &di, sizeof(di));
-      dirty_inodes.versions[i] = ip->version; // Update version
-      found = 1;
-      break;
-    }
-  }
-
-  if(!found){
-    // Add new inode to buffer
-    if(dirty_inodes.count >= IPB){
-      // Buffer is full - flush only (no checkpoint, recoverable via roll-forward)
-      release(&dirty_inodes.lock);
-      lfs_flush_only();
-      acquire(&dirty_inodes.lock);
-    }
-    memmove(&dirty_inodes.inodes[dirty_inodes.count], &di, sizeof(di));
-    dirty_inodes.inums[dirty_inodes.count] = ip->inum;
-    dirty_inodes.versions[dirty_inodes.count] = ip->version; // Store version
-    dirty_inodes.count++;
+  // Check if this inode is already staged (update in place)
+  if((d = dirty_find(ip->inum, 1)) >= 0){
+    memmove(&dirty_inodes.inodes[d], &di, sizeof(di));
+    dirty_inodes.versions[d] = ip->version; // Update version
+  } else {
+    // Stage a new copy; one being flushed is left alone
+    dirty_reserve();
+    dirty_add(ip->inum, ip->version, &di);
   }
 
   // Check if we need to flush after adding
-  if(dirty_inodes.count >= IPB){
+  if(dirty_inodes.count >= LFS_NDIRTYINODE){
     need_sync = 1;
   }
   release(&dirty_inodes.lock);
@@ -2693,31 +4446,35 @@ iupdate(struct inode *ip)
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
-      release(&icache.lock);
-      return ip;
+  if((ip = icache_find(dev, inum)) != 0){
+    if(ip->ref++ == 0){
+      ip->prev->next = ip->next;
+      ip->next->prev = ip->prev;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
+    release(&icache.lock);
+    return ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
+  // Recycle the least recently used inode cache entry.
+  ip = icache.lru.prev;
+  if(ip == &icache.lru)
     panic("iget: no inodes");
-
-  ip = empty;
+  ip->prev->next = ip->next;
+  ip->next->prev = ip->prev;
+  if(ip->inum != 0)  // 0 if the entry was never used
+    icache_unhash(ip);
   ip->dev = dev;
   ip->inum = inum;
+  ip->hnext = icache.bucket[IHASH(dev, inum)];
+  icache.bucket[IHASH(dev, inum)] = ip;
   ip->ref = 1;
   ip->valid = 0;
+  ip->ra_next = ip->ra_end = ip->ra_win = 0;
   release(&icache.lock);
 
   return ip;
@@ -2742,7 +4499,7 @@ ilock(struct inode *ip)
 {
   struct buf *bp;
   struct dinode *dip;
-  uint imap_entry;
+  struct imap_entry e;
   uint block;
   uint slot;
   int i, found;
@@ -2753,55 +4510,29 @@ ilock(struct inode *ip)
   acquiresleep(&ip->lock);
 
   if(ip->valid == 0){
-    // First check if inode is in dirty buffer
+    // First check if inode is in dirty buffer, staged or being flushed
     found = 0;
     acquire(&dirty_inodes.lock);
-    
-    // Check active buffer
-    for(i = 0; i < dirty_inodes.count; i++){
-      if(dirty_inodes.inums[i] == ip->inum){
-        // Found in dirty buffer - copy from there
-        dip = &dirty_inodes.inodes[i];
-        ip->type = dip->type;
-        ip->major = dip->major;
-        ip->minor = dip->minor;
-        ip->nlink = dip->nlink;
-        ip->size = dip->size;
-        ip->version = dirty_inodes.versions[i]; 
-        memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
-        found = 1;
-        break;
-      }
-    }
-    
-    // Check flushing buffer if not found
-    if(!found){
-      for(i = 0; i < dirty_inodes.flushing_count; i++){
-        if(dirty_inodes.flushing_inums[i] == ip->inum){
-          // Found in flushing buffer
-          dip = &dirty_inodes.flushing_inodes[i];
-          ip->type = dip->type;
-          ip->major = dip->major;
-          ip->minor = dip->minor;
-          ip->nlink = dip->nlink;
-          ip->size = dip->size;
-          ip->version = dirty_inodes.flushing_versions[i];
-          memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
-          found = 1;
-          break;
-        }
-      }
+    if((i = dirty_find(ip->inum, 0)) >= 0){
+      dip = &dirty_inodes.inodes[i];
+      ip->type = dip->type;
+      ip->major = dip->major;
+      ip->minor = dip->minor;
+      ip->nlink = dip->nlink;
+      ip->size = dip->size;
+      ip->version = dirty_inodes.versions[i];
+      memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+      found = 1;
     }
-    
     release(&dirty_inodes.lock);
 
     if(!found){
       // Look up inode location in imap
       acquire(&lfs.lock);
-      imap_entry = lfs.imap[ip->inum];
+      e = imap_get(ip->inum);
       release(&lfs.lock);
 
-      if(imap_entry == 0){
+      if(e.block == 0){
         // Newly allocated inode (from ialloc) might not be in imap yet if not flushed?
         // But ialloc puts it in dirty buffer. 
         // So this case is only for truly empty inodes?
@@ -2820,18 +4551,18 @@ ilock(struct inode *ip)
       }
 
       // Check for placeholder (inode should be in dirty buffer but wasn't found)
-      if(imap_entry == 0xFFFFFFFF)
+      if(e.block == IMAP_NEW)
         panic("ilock: inode marked in-flight but not in dirty buffer");
 
       // Decode block address and slot from imap entry
-      block = IMAP_BLOCK(imap_entry);
-      slot = IMAP_SLOT(imap_entry);
-      ip->version = IMAP_VERSION(imap_entry); // Load version from imap
+      block = e.block;
+      slot = IMAP_SLOT(e);
+      ip->version = IMAP_VERSION(e); // Load version from imap
 
       // Validate block before reading
       if(block >= sb.size){
-        cprintf("ilock: INVALID block=%d >= size=%d (inum=%d, imap_entry=0x%x)\n",
-                block, sb.size, ip->inum, imap_entry);
+        cprintf("ilock: INVALID block=%d >= size=%d (inum=%d, vslot=0x%x)\n",
+                block, sb.size, ip->inum, e.vslot);
         panic("ilock: corrupted imap entry");
       }
 
@@ -2863,8 +4594,8 @@ iunlock(struct inode *ip)
 }
 
 // Drop a reference to an in-memory inode.
-// If that was the last reference, the inode cache entry can
-// be recycled.
+// If that was the last reference, the inode cache entry keeps
+// its contents but can be recycled.
 // If that was the last reference and the inode has no links
 // to it, free the inode (and its content) on disk.
 void
@@ -2883,23 +4614,16 @@ iput(struct inode *ip)
       // Remove inode from dirty buffer if present
       // (itrunc called iupdate which added it, but we don't want to persist type=0)
       acquire(&dirty_inodes.lock);
-      for(int i = 0; i < dirty_inodes.count; i++){
-        if(dirty_inodes.inums[i] == ip->inum){
-          // Remove by shifting remaining entries
-          for(int j = i; j < dirty_inodes.count - 1; j++){
-            memmove(&dirty_inodes.inodes[j], &dirty_inodes.inodes[j+1], sizeof(struct dinode));
-            dirty_inodes.inums[j] = dirty_inodes.inums[j+1];
-            dirty_inodes.versions[j] = dirty_inodes.versions[j+1];
-          }
-          dirty_inodes.count--;
-          break;
-        }
-      }
+      int d = dirty_find(ip->inum, 1);
+      if(d >= 0)
+        dirty_remove(d);
       release(&dirty_inodes.lock);
 
+      dcache_purge(ip->dev, ip->inum);
+
       // Mark inode as free in imap
       acquire(&lfs.lock);
-      lfs.imap[ip->inum] = 0;
+      imap_set(ip->inum, 0, 0, 0);
       release(&lfs.lock);
 
       // Sync to persist the freed inode slot
@@ -2911,7 +4635,8 @@ iput(struct inode *ip)
   releasesleep(&ip->lock);
 
   acquire(&icache.lock);
-  ip->ref--;
+  if(--ip->ref == 0)
+    icache_lru_add(ip, ip->valid);
   release(&icache.lock);
 }
 
@@ -2929,7 +4654,10 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT], and the NDINDIRECT after
+// those in the second-level blocks listed in block
+// ip->addrs[NDIRECT+1].  An indirect block with unflushed changes
+// is read from its dirty copy in dirty_ind instead.
 
 // Return the disk block address of the nth block in inode ip.
 // If there is no such block, bmap allocates one.
@@ -2937,7 +4665,7 @@ iunlockput(struct inode *ip)
 static uint
 bmap(struct inode *ip, uint bn)
 {
-  uint addr, *a;
+  uint addr;
   struct buf *bp;
 
   if(bn < NDIRECT){
@@ -2948,66 +4676,100 @@ bmap(struct inode *ip, uint bn)
       lfs_update_usage(addr, BSIZE); // New block is live
 
       // Zero out the new block
-      bp = bread(ip->dev, addr);
-      memset(bp->data, 0, BSIZE);
-      bwrite(bp);
+      bp = bnew(ip->dev, addr);
+      lfs_segwrite(bp);
       brelse(bp);
     }
     return addr;
   }
-  bn -= NDIRECT;
-
-  if(bn < NINDIRECT){
-    // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0){
-      // Allocate indirect block with atomic SSB entry
-      ip->addrs[NDIRECT] = addr = lfs_alloc_with_ssb(SSB_TYPE_INDIRECT, ip->inum, NDIRECT, ip->version);
-      lfs_write_pending_ssb();  // Write any pending SSB before bread
-      lfs_update_usage(addr, BSIZE); // Indirect block live
 
-      // Zero out the new indirect block
-      bp = bread(ip->dev, addr);
-      memset(bp->data, 0, BSIZE);
-      bwrite(bp);
-      brelse(bp);
-    }
-    // Validate indirect block address before reading
-    if(addr >= sb.size){
-      cprintf("bmap: INVALID indirect addr=%d >= size=%d (inum=%d)\n",
-              addr, sb.size, ip->inum);
-      panic("bmap: corrupted indirect block address");
-    }
-    bp = bread(ip->dev, addr);
-    a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
+  if(bn < MAXFILE){
+    // The indirect blocks themselves are allocated when ip is flushed.
+    if((addr = lfs_ind_lookup(ip, bn)) == 0){
       // Allocate data block with atomic SSB entry
-      a[bn] = addr = lfs_alloc_with_ssb(SSB_TYPE_DATA, ip->inum, bn + NDIRECT, ip->version);
+      addr = lfs_alloc_with_ssb(SSB_TYPE_DATA, ip->inum, bn, ip->version);
       lfs_write_pending_ssb();  // Write any pending SSB before bread
       lfs_update_usage(addr, BSIZE); // Data block live
 
       // Zero out the new data block
-      struct buf *bp_data = bread(ip->dev, addr);
-      memset(bp_data->data, 0, BSIZE);
-      bwrite(bp_data);
-      brelse(bp_data);
+      bp = bnew(ip->dev, addr);
+      lfs_segwrite(bp);
+      brelse(bp);
 
-      bwrite(bp); // Update indirect block pointer
+      lfs_ind_set(ip, bn, addr);
+      iupdate(ip);
     }
-    brelse(bp);
     return addr;
   }
 
   panic("bmap: out of range");
 }
 
+// Like bmap, but return 0 instead of allocating, and map a run at a
+// time: set *len to the number of blocks from bn on, at most max,
+// that sit in consecutive log blocks.  LFS writes a file's blocks
+// next to each other, so a sequentially written file maps a whole
+// block list in one lookup.  A run ends where a block list does.
+static uint
+bmap_run(struct inode *ip, uint bn, uint max, uint *len)
+{
+  uint key, n;
+
+  *len = 1;
+  if(bn >= MAXFILE)
+    return 0;
+  ind_locate(bn, &key, &n);
+  if(key != 0)
+    return lfs_ind_run(ip->inum, ip->addrs, key, n, max, len);
+  *len = ind_run(&ip->addrs[n], min(max, NDIRECT - n));
+  return ip->addrs[n];
+}
+
+#define RA_MIN 4   // first readahead window, in blocks
+#define RA_MAX 32  // largest window: one segment
+
+// Sequential readahead.  While readi() keeps reading the block
+// after the one it read last, start reads of the blocks ahead of
+// it without waiting, doubling the window up to RA_MAX each time
+// the reader gets halfway through it.  A file's blocks sit next to
+// each other in the log, so the IDE queue merges these reads into
+// a few multi-sector commands.  bn's own read joins the batch, and
+// bread() waits for it.  Caller must hold ip->lock.
+static void
+readahead(struct inode *ip, uint bn)
+{
+  uint b, end, addr, len, i;
+
+  if(bn == ip->ra_next - 1)
+    return;  // same block again
+  if(bn != ip->ra_next){
+    ip->ra_win = 0;  // not sequential: start over
+    ip->ra_end = 0;
+  }
+  ip->ra_next = bn + 1;
+  if(ip->ra_end > bn + ip->ra_win/2)
+    return;  // enough already in flight
+
+  ip->ra_win = ip->ra_win ? min(2*ip->ra_win, RA_MAX) : RA_MIN;
+  end = min(bn + ip->ra_win, (ip->size + BSIZE - 1) / BSIZE);
+  for(b = ip->ra_end > bn ? ip->ra_end : bn; b < end; b += len){
+    // Blocks still in the dirty data cache have no address yet.
+    addr = bmap_run(ip, b, end - b, &len);
+    for(i = 0; addr != 0 && i < len && addr + i < sb.size; i++)
+      breadahead(ip->dev, addr + i);
+  }
+  ip->ra_end = end;
+}
+
 // Truncate inode (discard contents).
 // In LFS with GC, we mark blocks as dead in SUT.
 static void
 itrunc(struct inode *ip)
 {
-  int i, j;
-  struct buf *bp;
-  uint *a;
+  int i;
+
+  // Cached blocks never got a log address
+  lfs_data_drop(ip->inum);
 
   // Clear direct blocks
   for(i = 0; i < NDIRECT; i++){
@@ -3017,18 +4779,9 @@ itrunc(struct inode *ip)
     }
   }
 
-  // Clear indirect block
-  if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
-    a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        lfs_update_usage(a[j], -BSIZE);
-    }
-    brelse(bp);
-    lfs_update_usage(ip->addrs[NDIRECT], -BSIZE);
-    ip->addrs[NDIRECT] = 0;
-  }
+  // Clear indirect blocks (on disk or dirty in memory)
+  lfs_ind_free(ip, IND_SINGLE);
+  lfs_ind_free(ip, IND_DROOT);
 
   ip->size = 0;
   // Increment version on truncate/delete
@@ -3054,7 +4807,7 @@ stati(struct inode *ip, struct stat *st)
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, bn, addr, rbn, raddr, rlen, i;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -3068,15 +4821,30 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   if(off + n > ip->size)
     n = ip->size - off;
 
+  rbn = raddr = rlen = 0;
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    uint addr = bmap(ip, off/BSIZE);
+    bn = off/BSIZE;
+    m = min(n - tot, BSIZE - off%BSIZE);
+    readahead(ip, bn);
+    if(lfs_data_read(ip, bn, dst, off%BSIZE, m))
+      continue;
+    if(bn >= rbn + rlen){
+      // Map the run of log blocks bn starts and send the part of it
+      // this read needs to the disk as one transfer.
+      rbn = bn;
+      raddr = bmap_run(ip, bn, (off%BSIZE + n - tot + BSIZE - 1) / BSIZE, &rlen);
+      if(raddr == 0)
+        raddr = bmap(ip, bn);
+      for(i = 0; rlen > 1 && i < rlen && raddr + i < sb.size; i++)
+        breadahead(ip->dev, raddr + i);
+    }
+    addr = raddr + (bn - rbn);
     if(addr >= sb.size){
       cprintf("readi: INVALID bmap addr=%d >= size=%d (inum=%d, off=%d)\n",
               addr, sb.size, ip->inum, off);
       return -1;
     }
     bp = bread(ip->dev, addr);
-    m = min(n - tot, BSIZE - off%BSIZE);
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
   }
@@ -3094,8 +4862,6 @@ writei(struct inode *ip, char *src, uint off, uint n)
   uint tot, m;
   struct buf *bp;
   uint bn, old_addr, new_addr;
-  struct buf *bp_ind, *bp_new_ind;
-  uint *a;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
@@ -3112,6 +4878,15 @@ writei(struct inode *ip, char *src, uint off, uint n)
     bn = off / BSIZE;
     m = min(n - tot, BSIZE - off%BSIZE);
 
+    // Normally the block just goes to the dirty data cache and gets
+    // its log address when the inode is flushed.  If the cache is
+    // full, it is written to the log tail right away.  Allocation
+    // then mostly happens inside lfs_sync(), where the cleaner
+    // cannot start, so give it its chance here.
+    lfs_gc_check();
+    if(lfs_data_write(ip, bn, off%BSIZE, src, m) == 0)
+      continue;
+
     // 0. Check if SSB needs to be flushed before allocation
     //    This ensures SSB is written to the same segment as data
     if(lfs_prepare_alloc()){
@@ -3119,23 +4894,10 @@ writei(struct inode *ip, char *src, uint off, uint n)
     }
 
     // 1. Determine old block address
-    old_addr = 0;
     if(bn < NDIRECT){
       old_addr = ip->addrs[bn];
     } else {
-      uint ind_bn = bn - NDIRECT;
-      if(ip->addrs[NDIRECT] != 0){
-        // Validate indirect block address before reading
-        if(ip->addrs[NDIRECT] >= sb.size){
-          cprintf("writei: INVALID indirect addr=%d >= size=%d (inum=%d)\n",
-                  ip->addrs[NDIRECT], sb.size, ip->inum);
-          return -1;
-        }
-        bp_ind = bread(ip->dev, ip->addrs[NDIRECT]);
-        a = (uint*)bp_ind->data;
-        old_addr = a[ind_bn];
-        brelse(bp_ind);
-      }
+      old_addr = lfs_ind_lookup(ip, bn);
     }
 
     // 2. Allocate NEW block with atomic SSB entry
@@ -3146,7 +4908,7 @@ writei(struct inode *ip, char *src, uint off, uint n)
     lfs_write_pending_ssb();
 
     // 3. Copy data / Write new data
-    bp = bread(ip->dev, new_addr);
+    bp = bnew(ip->dev, new_addr);
     if(m < BSIZE && old_addr != 0){
       // Partial write: Read old data - validate old_addr first
       if(old_addr >= sb.size){
@@ -3158,52 +4920,18 @@ writei(struct inode *ip, char *src, uint off, uint n)
       struct buf *bp_old = bread(ip->dev, old_addr);
       memmove(bp->data, bp_old->data, BSIZE);
       brelse(bp_old);
-    } else if (m < BSIZE && old_addr == 0) {
-      memset(bp->data, 0, BSIZE);
     }
     memmove(bp->data + off%BSIZE, src, m);
-    bwrite(bp);
+    lfs_segwrite(bp);
     brelse(bp);
 
-    // 4. Update Inode / Indirect Block (Recursive COW for Indirect)
+    // 4. Update Inode / Indirect Block
+    //    Indirect blocks are updated in memory; each is copied to
+    //    the log once, when the inode is flushed.
     if(bn < NDIRECT){
       ip->addrs[bn] = new_addr;
     } else {
-      uint ind_bn = bn - NDIRECT;
-      uint old_ind = ip->addrs[NDIRECT];
-      uint new_ind;
-
-      if(old_ind == 0){
-         // New indirect block (with atomic SSB entry)
-         new_ind = lfs_alloc_with_ssb(SSB_TYPE_INDIRECT, ip->inum, NDIRECT, ip->version);
-         lfs_update_usage(new_ind, BSIZE);
-         bp_ind = bread(ip->dev, new_ind);
-         memset(bp_ind->data, 0, BSIZE);
-      } else {
-         // Copy old indirect block to new location (with atomic SSB entry)
-         // Validate old_ind before reading
-         if(old_ind >= sb.size){
-           cprintf("writei: INVALID old_ind=%d >= size=%d (inum=%d)\n",
-                   old_ind, sb.size, ip->inum);
-           return -1;
-         }
-         new_ind = lfs_alloc_with_ssb(SSB_TYPE_INDIRECT, ip->inum, NDIRECT, ip->version);
-         lfs_update_usage(new_ind, BSIZE);
-         lfs_update_usage(old_ind, -BSIZE); // Old indirect dies
-
-         bp_ind = bread(ip->dev, old_ind);
-         bp_new_ind = bread(ip->dev, new_ind);
-         memmove(bp_new_ind->data, bp_ind->data, BSIZE);
-         brelse(bp_ind);
-         bp_ind = bp_new_ind;
-      }
-
-      a = (uint*)bp_ind->data;
-      a[ind_bn] = new_addr;
-      bwrite(bp_ind);
-      brelse(bp_ind);
-
-      ip->addrs[NDIRECT] = new_ind;
+      lfs_ind_set(ip, bn, new_addr);
     }
 
     // 5. Update SUT (SSB entry already added atomically in lfs_alloc_with_ssb)
@@ -3234,17 +4962,305 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+// Hash a name for the hashed directory layout (FNV-1a).
+// mkfs.c has a copy that must agree.
+static uint
+dirhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261U;
+  for(i = 0; i < DIRSIZ && name[i]; i++){
+    h ^= (uchar)name[i];
+    h *= 16777619;
+  }
+  return h;
+}
+
+// Directory entry cache.
+//
+// Remembers the result of dirlookup() by (dev, directory inum, name);
+// inum 0 records that the name is absent.  Entries are filled and
+// changed only by code holding the directory's sleep-lock, so they
+// agree with the directory's contents: dirlink() enters the new name,
+// sys_unlink() drops the removed one, and freeing an inode drops every
+// entry naming it.  namex() reads the cache without locking the
+// directory.  dcache.lock protects everything; it is taken before
+// icache.lock.
+#define NDCBUCKET 127  // hash buckets; prime
+
+struct dentry {
+  uint dev;
+  uint dinum;               // directory, 0 if the entry is unused
+  uint inum;                // 0 for a negative entry
+  char name[DIRSIZ];
+  struct dentry *hnext;     // hash chain
+  struct dentry *prev;      // LRU list
+  struct dentry *next;
+};
+
+struct {
+  struct spinlock lock;
+  struct dentry ent[NDENTRY];
+  struct dentry *bucket[NDCBUCKET];
+  struct dentry lru;        // lru.next is most recently used
+} dcache;
+
+#define DCHASH(dev, dinum, name) \
+  (((dev)*131 + (dinum)*31 + dirhash(name)) % NDCBUCKET)
+
+static void
+dcache_init(void)
+{
+  struct dentry *d;
+
+  initlock(&dcache.lock, "dcache");
+  dcache.lru.prev = dcache.lru.next = &dcache.lru;
+  for(d = dcache.ent; d < dcache.ent + NDENTRY; d++){
+    d->next = dcache.lru.next;
+    d->prev = &dcache.lru;
+    dcache.lru.next->prev = d;
+    dcache.lru.next = d;
+  }
+}
+
+// Move d to the front of the LRU list, or to the back if unused.
+// Caller holds dcache.lock.
+static void
+dcache_touch(struct dentry *d)
+{
+  struct dentry *at;
+
+  d->prev->next = d->next;
+  d->next->prev = d->prev;
+  at = d->dinum ? &dcache.lru : dcache.lru.prev;  // d may have been lru.prev
+  d->next = at->next;
+  d->prev = at;
+  at->next->prev = d;
+  at->next = d;
+}
+
+// Caller holds dcache.lock.
+static struct dentry*
+dcache_find(uint dev, uint dinum, char *name)
+{
+  struct dentry *d;
+
+  for(d = dcache.bucket[DCHASH(dev, dinum, name)]; d != 0; d = d->hnext)
+    if(d->dev == dev && d->dinum == dinum && namecmp(d->name, name) == 0)
+      return d;
+  return 0;
+}
+
+// Unhash d and mark it unused.  Caller holds dcache.lock.
+static void
+dcache_drop(struct dentry *d)
+{
+  struct dentry **pp;
+
+  for(pp = &dcache.bucket[DCHASH(d->dev, d->dinum, d->name)]; *pp != 0; pp = &(*pp)->hnext){
+    if(*pp == d){
+      *pp = d->hnext;
+      break;
+    }
+  }
+  d->dinum = 0;
+  dcache_touch(d);
+}
+
+// Record that name in directory dp is inum (0: absent).
+// Caller holds dp's sleep-lock.
+static void
+dcache_enter(struct inode *dp, char *name, uint inum)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if((d = dcache_find(dp->dev, dp->inum, name)) == 0){
+    d = dcache.lru.prev;
+    if(d->dinum)
+      dcache_drop(d);
+    d->dev = dp->dev;
+    d->dinum = dp->inum;
+    strncpy(d->name, name, DIRSIZ);
+    d->hnext = dcache.bucket[DCHASH(d->dev, d->dinum, d->name)];
+    dcache.bucket[DCHASH(d->dev, d->dinum, d->name)] = d;
+  }
+  d->inum = inum;
+  dcache_touch(d);
+  release(&dcache.lock);
+}
+
+// Forget name in directory dp.  Caller holds dp's sleep-lock.
+void
+dcache_invalidate(struct inode *dp, char *name)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if((d = dcache_find(dp->dev, dp->inum, name)) != 0)
+    dcache_drop(d);
+  release(&dcache.lock);
+}
+
+// Forget every entry for inode inum, as directory or as target,
+// before the inode number is reused.
+static void
+dcache_purge(uint dev, uint inum)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  for(d = dcache.ent; d < dcache.ent + NDENTRY; d++)
+    if(d->dinum && d->dev == dev && (d->dinum == inum || d->inum == inum))
+      dcache_drop(d);
+  release(&dcache.lock);
+}
+
+// Look name up in directory dp without locking dp.  Returns 1 with a
+// referenced inode in *ipp on a hit, 0 if the name is known to be
+// absent, -1 if the cache does not know.  The iget() happens under
+// dcache.lock, so an unlink cannot free the inode in between.
+static int
+dcache_lookup(struct inode *dp, char *name, struct inode **ipp)
+{
+  struct dentry *d;
+  int r = -1;
+
+  acquire(&dcache.lock);
+  if((d = dcache_find(dp->dev, dp->inum, name)) != 0){
+    dcache_touch(d);
+    r = 0;
+    if(d->inum){
+      *ipp = iget(d->dev, d->inum);
+      r = 1;
+    }
+  }
+  release(&dcache.lock);
+  return r;
+}
+
+#define DIRCHUNK 16   // dirents read at a time from hashed directories
+
+// Walk the bucket chain of hashed directory dp that starts at block b,
+// looking for name, or for a free slot if name is 0.  Returns the byte
+// offset of the dirent and copies it to *de, or -1 with *plast set to
+// the last block of the chain.
+static int
+dirhash_scan(struct inode *dp, char *name, uint b, struct dirent *de, uint *plast)
+{
+  struct dirent des[DIRCHUNK];
+  uint off, end, next;
+  int i, n;
+
+  for(;;){
+    end = (b+1)*BSIZE;
+    for(off = b*BSIZE; off < end; off += sizeof(des)){
+      if(readi(dp, (char*)des, off, sizeof(des)) != sizeof(des))
+        panic("dirhash_scan read");
+      n = off + sizeof(des) == end ? DIRCHUNK-1 : DIRCHUNK;  // skip link
+      for(i = 0; i < n; i++){
+        if(name ? des[i].inum == 0 || namecmp(name, des[i].name) != 0
+                : des[i].inum != 0)
+          continue;
+        *de = des[i];
+        return off + i*sizeof(des[0]);
+      }
+    }
+    memmove(&next, des[DIRCHUNK-1].name, sizeof(next));
+    if(next == 0)
+      break;
+    b = next;
+  }
+  *plast = b;
+  return -1;
+}
+
+// Add (name, inum) to hashed directory dp, appending an overflow
+// block to the bucket's chain if it is full.
+static int
+dirhash_link(struct inode *dp, char *name, uint inum)
+{
+  struct dirent des[DIRCHUNK], de;
+  uint last, nb, off;
+  int doff;
+
+  if((doff = dirhash_scan(dp, 0, dirhash(name) % NDIRBUCKET, &de, &last)) < 0){
+    nb = dp->size / BSIZE;
+    if(nb >= MAXFILE)
+      return -1;
+    memset(des, 0, sizeof(des));
+    for(off = nb*BSIZE; off < (nb+1)*BSIZE; off += sizeof(des))
+      if(writei(dp, (char*)des, off, sizeof(des)) != sizeof(des))
+        panic("dirhash_link overflow");
+    memmove(des[0].name, &nb, sizeof(nb));
+    if(writei(dp, (char*)&des[0], (last+1)*BSIZE - sizeof(de), sizeof(de)) != sizeof(de))
+      panic("dirhash_link chain");
+    doff = nb*BSIZE;
+  }
+
+  memset(&de, 0, sizeof(de));
+  strncpy(de.name, name, DIRSIZ);
+  de.inum = inum;
+  if(writei(dp, (char*)&de, doff, sizeof(de)) != sizeof(de))
+    panic("dirhash_link");
+  return 0;
+}
+
+// Rewrite the full linear directory dp in the hashed layout.
+// The old entries are staged in one page, so only directories of at
+// most PGSIZE bytes are converted; larger ones stay linear.
+static int
+dirhash_convert(struct inode *dp)
+{
+  struct dirent des[DIRCHUNK], *de;
+  char *page;
+  uint n, off;
+
+  n = dp->size;
+  if(n > PGSIZE || (page = kalloc()) == 0)
+    return -1;
+  if(readi(dp, page, 0, n) != n)
+    panic("dirhash_convert read");
+
+  memset(des, 0, sizeof(des));
+  for(off = 0; off < NDIRBUCKET*BSIZE; off += sizeof(des))
+    if(writei(dp, (char*)des, off, sizeof(des)) != sizeof(des))
+      panic("dirhash_convert write");
+  dp->major = DIR_HASHED;
+  iupdate(dp);
+
+  for(de = (struct dirent*)page; de < (struct dirent*)(page + n); de++)
+    if(de->inum != 0 && dirhash_link(dp, de->name, de->inum) < 0)
+      panic("dirhash_convert link");
+  kfree(page);
+  return 0;
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
 struct inode*
 dirlookup(struct inode *dp, char *name, uint *poff)
 {
-  uint off, inum;
+  uint off, inum, last;
+  int hoff;
   struct dirent de;
 
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
+  if(dp->major == DIR_HASHED){
+    if((hoff = dirhash_scan(dp, name, dirhash(name) % NDIRBUCKET, &de, &last)) < 0){
+      dcache_enter(dp, name, 0);
+      return 0;
+    }
+    if(poff)
+      *poff = hoff;
+    dcache_enter(dp, name, de.inum);
+    return iget(dp->dev, de.inum);
+  }
+
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("dirlookup read");
@@ -3255,10 +5271,12 @@ dirlookup(struct inode *dp, char *name, uint *poff)
       if(poff)
         *poff = off;
       inum = de.inum;
+      dcache_enter(dp, name, inum);
       return iget(dp->dev, inum);
     }
   }
 
+  dcache_enter(dp, name, 0);
   return 0;
 }
 
@@ -3276,6 +5294,13 @@ dirlink(struct inode *dp, char *name, uint inum)
     return -1;
   }
 
+  if(dp->major == DIR_HASHED){
+    if(dirhash_link(dp, name, inum) < 0)
+      return -1;
+    dcache_enter(dp, name, inum);
+    return 0;
+  }
+
   // Look for an empty dirent.
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
@@ -3284,11 +5309,18 @@ dirlink(struct inode *dp, char *name, uint inum)
       break;
   }
 
-  strncpy(de.name, name, DIRSIZ);
-  de.inum = inum;
-  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-    panic("dirlink");
+  // A full directory of DIRHASH_MIN blocks switches to the hashed layout.
+  if(off >= DIRHASH_MIN*BSIZE && dirhash_convert(dp) == 0){
+    if(dirhash_link(dp, name, inum) < 0)
+      return -1;
+  } else {
+    strncpy(de.name, name, DIRSIZ);
+    de.inum = inum;
+    if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+      panic("dirlink");
+  }
 
+  dcache_enter(dp, name, inum);
   return 0;
 }
 
@@ -3339,6 +5371,7 @@ static struct inode*
 namex(char *path, int nameiparent, char *name)
 {
   struct inode *ip, *next;
+  int r;
 
   if(*path == '/')
     ip = iget(ROOTDEV, ROOTINO);
@@ -3346,6 +5379,18 @@ namex(char *path, int nameiparent, char *name)
     ip = idup(myproc()->cwd);
 
   while((path = skipelem(path, name)) != 0){
+    // Fast path: a cached entry needs no lock on ip, and a directory
+    // that has cached entries is known to be a directory.
+    if(!nameiparent || *path != '\0'){
+      r = dcache_lookup(ip, name, &next);
+      if(r >= 0){
+        iput(ip);
+        if(r == 0)
+          return 0;
+        ip = next;
+        continue;
+      }
+    }
     ilock(ip);
     if(ip->type != T_DIR){
       iunlockput(ip);
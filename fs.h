@@ -22,21 +22,23 @@ struct superblock {
   uint checkpoint1;   // Block number of checkpoint 1
 };
 
-// Maximum imap blocks (each block holds 128 inode locations)
-#define NIMAP_BLOCKS 4
+// The imap has more blocks than the checkpoint can name, so their
+// addresses are kept in imap index blocks, which are logged too.
+// The checkpoint names only the index blocks.
+#define NIMAP_IND 8
+#define IMAP_ADDRS_PER_IND (BSIZE / sizeof(uint))
+#define NIMAP_BLOCKS (NIMAP_IND * IMAP_ADDRS_PER_IND)
  
-// Maximum SUT blocks
-#define NSUT_BLOCKS 8
-#define LFS_NSEGS_MAX 1000
-
 // Block types for SSB (must be non-zero, 0 means no SSB entry)
 #define SSB_TYPE_DATA     1
 #define SSB_TYPE_INODE    2
 #define SSB_TYPE_INDIRECT 3
+#define SSB_TYPE_DINDIRECT 4  // root of the double-indirect tree
 
 // Segment Summary Block Entry
 struct ssb_entry {
   uchar type;    // Block type
+  uchar slot;    // Block's index within its segment
   uint inum;     // Inode number (or start inum for INODE block)
   uint offset;   // Block offset within the file
   uint version;  // Inode version
@@ -45,8 +47,13 @@ struct ssb_entry {
 // SSB Magic number for identification
 #define SSB_MAGIC 0x53534221  // "SSB!"
 
-// SSB entries per block: (BSIZE - 20) / 16 = 62 entries (adjusted for new header fields)
-#define SSB_ENTRIES_PER_BLOCK ((BSIZE - 5*sizeof(uint)) / sizeof(struct ssb_entry))
+// SSB entries per block: (BSIZE - 24) / 16 = 62 entries (adjusted for new header fields)
+#define SSB_ENTRIES_PER_BLOCK ((BSIZE - 6*sizeof(uint)) / sizeof(struct ssb_entry))
+
+// The SSBs of a segment form a chain through prev_ssb, newest first,
+// whose head is the segment's SUT entry.  SSB_CHAIN_UNKNOWN marks a
+// segment that also holds SSBs outside the chain (written by mkfs).
+#define SSB_CHAIN_UNKNOWN 0xFFFFFFFF
 
 // Segment Summary Block (on-disk format with header)
 struct ssb {
@@ -55,6 +62,7 @@ struct ssb {
   uint checksum;      // Checksum of entries for integrity verification
   uint timestamp;     // Timestamp for roll-forward ordering
   uint next_seg_addr; // Next segment address (0 if not at segment boundary)
+  uint prev_ssb;      // Previous SSB in this segment, 0 if none
   struct ssb_entry entries[SSB_ENTRIES_PER_BLOCK];
 };
 
@@ -62,12 +70,27 @@ struct ssb {
 struct sut_entry {
   uint live_bytes;
   uint age;      // Last modification time (ticks or sequence)
+  uint last_ssb; // Newest SSB in the segment, 0 if none
+  uint nssb;     // SSBs on the chain from last_ssb, or SSB_CHAIN_UNKNOWN
 };
 
+// SUT entries per block
+#define SUT_ENTRIES_PER_BLOCK (BSIZE / sizeof(struct sut_entry))
+
+// A large disk has more SUT blocks than the checkpoint can name, so
+// their addresses are kept in SUT index blocks, which are logged too.
+// The checkpoint names only the index blocks.
+#define NSUT_IND 8
+#define SUT_ADDRS_PER_IND (BSIZE / sizeof(uint))
+#define NSUT_BLOCKS (NSUT_IND * SUT_ADDRS_PER_IND)
+
+// Most segments the SUT can describe (4 GB with 32 KB segments)
+#define LFS_NSEGS_MAX (NSUT_BLOCKS * SUT_ENTRIES_PER_BLOCK)
+
 // Checkpoint structure - stored at fixed location (exactly BSIZE bytes)
 // Layout: [header_ts | metadata | padding | footer_ts]
 // Header and footer timestamps must match for valid checkpoint
-#define CP_METADATA_SIZE (6 * sizeof(uint) + NIMAP_BLOCKS * sizeof(uint) + NSUT_BLOCKS * sizeof(uint))
+#define CP_METADATA_SIZE (6 * sizeof(uint) + NIMAP_IND * sizeof(uint) + NSUT_IND * sizeof(uint))
 #define CP_PADDING_SIZE (BSIZE - CP_METADATA_SIZE - 2 * sizeof(uint))
 
 struct checkpoint {
@@ -78,9 +101,9 @@ struct checkpoint {
   uint log_tail;                     // Current log tail (next write position)
   uint cur_seg;                      // Current segment number
   uint seg_offset;                   // Offset within current segment
-  uint imap_addrs[NIMAP_BLOCKS];     // Disk addresses of imap blocks
+  uint imap_ind[NIMAP_IND];          // Disk addresses of imap index blocks
   uint imap_nblocks;                 // Number of imap blocks in use
-  uint sut_addrs[NSUT_BLOCKS];       // Disk addresses of SUT blocks
+  uint sut_ind[NSUT_IND];            // Disk addresses of SUT index blocks
   uint sut_nblocks;                  // Number of SUT blocks in use
   uint valid;                        // Is this checkpoint valid?
 
@@ -91,36 +114,43 @@ struct checkpoint {
   uint timestamp_end;                // Footer timestamp - written LAST
 };
 
+// Imap entry: where the newest copy of an inode lives in the log.
+// The block address gets a whole word; version and slot share the other.
+struct imap_entry {
+  uint block;   // Disk address of the inode block, 0 if the inode is free
+  uint vslot;   // (version << IMAP_SLOT_BITS) | slot within the block
+};
+
 // Imap entries per block
-#define IMAP_ENTRIES_PER_BLOCK (BSIZE / sizeof(uint))
+#define IMAP_ENTRIES_PER_BLOCK (BSIZE / sizeof(struct imap_entry))
+
+// Most inodes the imap can describe.  The map only grows as far as
+// the highest inode number in use.
+#define LFS_MAXINODES (NIMAP_BLOCKS * IMAP_ENTRIES_PER_BLOCK)
 
-// Imap entry encoding: block address + version + slot index
-// imap[inum] = (block_addr << 12) | (version << 4) | slot_index
-// slot_index: 0-15 (4 bits), version: 0-255 (8 bits), block_addr: remaining 20 bits
+// slot_index: 0-15 (4 bits), version: remaining 28 bits
 #define IMAP_SLOT_BITS 4
-#define IMAP_VERSION_BITS 8
 #define IMAP_SLOT_MASK ((1 << IMAP_SLOT_BITS) - 1)  // 0xF
-#define IMAP_VERSION_MASK ((1 << IMAP_VERSION_BITS) - 1)  // 0xFF
-#define IMAP_ENCODE(block, version, slot) \
-  (((block) << (IMAP_VERSION_BITS + IMAP_SLOT_BITS)) | \
-   (((version) & IMAP_VERSION_MASK) << IMAP_SLOT_BITS) | \
-   ((slot) & IMAP_SLOT_MASK))
-#define IMAP_BLOCK(entry) ((entry) >> (IMAP_VERSION_BITS + IMAP_SLOT_BITS))
-#define IMAP_VERSION(entry) (((entry) >> IMAP_SLOT_BITS) & IMAP_VERSION_MASK)
-#define IMAP_SLOT(entry) ((entry) & IMAP_SLOT_MASK)
-
-#define NDIRECT 12
+#define IMAP_VSLOT(version, slot) \
+  (((version) << IMAP_SLOT_BITS) | ((slot) & IMAP_SLOT_MASK))
+#define IMAP_VERSION(e) ((e).vslot >> IMAP_SLOT_BITS)
+#define IMAP_SLOT(e) ((e).vslot & IMAP_SLOT_MASK)
+
+#define NDIRECT 11
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+#define NDINDIRECT (NINDIRECT * NINDIRECT)
+#define MAXFILE (NDIRECT + NINDIRECT + NDINDIRECT)
 
-// On-disk inode structure (unchanged from original xv6)
+// On-disk inode structure.  The same size as xv6's; the last
+// direct block gave way to a double-indirect block.
 struct dinode {
   short type;           // File type
-  short major;          // Major device number (T_DEV only)
+  short major;          // Major device number (T_DEV), or DIR_HASHED
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint addrs[NDIRECT+2];   // Data block addresses, then the indirect
+                           // and double-indirect block addresses
 };
 
 // Inodes per block
@@ -137,3 +167,18 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+// Dirents per block
+#define DPB           (BSIZE / sizeof(struct dirent))
+
+// Hashed directory layout, marked by major == DIR_HASHED on a T_DIR.
+// File blocks 0..NDIRBUCKET-1 are the buckets; a name lives in the
+// chain that starts at block dirhash(name) % NDIRBUCKET.  The last
+// dirent of every block is the chain link: inum 0, so scanners skip
+// it, and the first 4 bytes of name hold the file block number of the
+// next overflow block (0 ends the chain).  Overflow blocks are
+// appended at the end of the directory.  A linear directory that
+// fills DIRHASH_MIN blocks is converted on its next dirlink.
+#define DIR_HASHED    1
+#define NDIRBUCKET    16
+#define DIRHASH_MIN   4
+
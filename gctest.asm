@@ -0,0 +1,1907 @@
+
+_gctest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "\nFill test complete. Created %d files.\n", i);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+    buf[i] = 'A' + (i % 26);
+  10:	bb 4f ec c4 4e       	mov    $0x4ec4ec4f,%ebx
+{
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  for(i = 0; i < sizeof(buf); i++)
+  1e:	31 c9                	xor    %ecx,%ecx
+    buf[i] = 'A' + (i % 26);
+  20:	89 c8                	mov    %ecx,%eax
+  22:	f7 e3                	mul    %ebx
+  24:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < sizeof(buf); i++)
+  26:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = 'A' + (i % 26);
+  29:	c1 ea 03             	shr    $0x3,%edx
+  2c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+  2f:	29 d0                	sub    %edx,%eax
+  31:	83 c0 41             	add    $0x41,%eax
+  34:	88 81 5f 17 00 00    	mov    %al,0x175f(%ecx)
+  for(i = 0; i < sizeof(buf); i++)
+  3a:	81 f9 00 02 00 00    	cmp    $0x200,%ecx
+  40:	75 de                	jne    20 <main+0x20>
+  int mode = 1;
+
+  fillbuf();
+
+  if(argc > 1){
+  42:	83 fe 01             	cmp    $0x1,%esi
+  45:	7f 34                	jg     7b <main+0x7b>
+    mode = atoi(argv[1]);
+  }
+
+  printf(1, "\n========================================\n");
+  47:	50                   	push   %eax
+  48:	50                   	push   %eax
+  49:	68 b8 11 00 00       	push   $0x11b8
+  4e:	6a 01                	push   $0x1
+  50:	e8 1b 0a 00 00       	call   a70 <printf>
+  printf(1, "LFS Garbage Collection Test\n");
+  55:	5a                   	pop    %edx
+  56:	59                   	pop    %ecx
+  57:	68 56 0e 00 00       	push   $0xe56
+  5c:	6a 01                	push   $0x1
+  5e:	e8 0d 0a 00 00       	call   a70 <printf>
+  printf(1, "========================================\n\n");
+  63:	5b                   	pop    %ebx
+  64:	5e                   	pop    %esi
+  65:	68 e4 11 00 00       	push   $0x11e4
+  6a:	6a 01                	push   $0x1
+  6c:	e8 ff 09 00 00       	call   a70 <printf>
+  71:	83 c4 10             	add    $0x10,%esp
+
+  switch(mode){
+  case 1:
+    test_fragmentation();
+  74:	e8 07 02 00 00       	call   280 <test_fragmentation>
+    break;
+  79:	eb 54                	jmp    cf <main+0xcf>
+    mode = atoi(argv[1]);
+  7b:	83 ec 0c             	sub    $0xc,%esp
+  7e:	ff 77 04             	push   0x4(%edi)
+  81:	e8 2a 08 00 00       	call   8b0 <atoi>
+  printf(1, "\n========================================\n");
+  86:	59                   	pop    %ecx
+  87:	5e                   	pop    %esi
+  88:	68 b8 11 00 00       	push   $0x11b8
+  8d:	6a 01                	push   $0x1
+    mode = atoi(argv[1]);
+  8f:	89 c3                	mov    %eax,%ebx
+  printf(1, "\n========================================\n");
+  91:	e8 da 09 00 00       	call   a70 <printf>
+  printf(1, "LFS Garbage Collection Test\n");
+  96:	5f                   	pop    %edi
+  97:	58                   	pop    %eax
+  98:	68 56 0e 00 00       	push   $0xe56
+  9d:	6a 01                	push   $0x1
+  9f:	e8 cc 09 00 00       	call   a70 <printf>
+  printf(1, "========================================\n\n");
+  a4:	58                   	pop    %eax
+  a5:	5a                   	pop    %edx
+  a6:	68 e4 11 00 00       	push   $0x11e4
+  ab:	6a 01                	push   $0x1
+  ad:	e8 be 09 00 00       	call   a70 <printf>
+  switch(mode){
+  b2:	83 c4 10             	add    $0x10,%esp
+  b5:	83 fb 03             	cmp    $0x3,%ebx
+  b8:	0f 84 ab 00 00 00    	je     169 <main+0x169>
+  be:	7f 69                	jg     129 <main+0x129>
+  c0:	83 fb 01             	cmp    $0x1,%ebx
+  c3:	74 af                	je     74 <main+0x74>
+  c5:	83 fb 02             	cmp    $0x2,%ebx
+  c8:	75 5f                	jne    129 <main+0x129>
+  case 2:
+    test_continuous();
+  ca:	e8 c1 03 00 00       	call   490 <test_continuous>
+    printf(1, "  2 - Continuous create/delete cycle\n");
+    printf(1, "  3 - Fill disk to trigger GC\n");
+    break;
+  }
+
+  printf(1, "\n========================================\n");
+  cf:	83 ec 08             	sub    $0x8,%esp
+  d2:	68 b8 11 00 00       	push   $0x11b8
+  d7:	6a 01                	push   $0x1
+  d9:	e8 92 09 00 00       	call   a70 <printf>
+  printf(1, "Check kernel console for GC output:\n");
+  de:	5f                   	pop    %edi
+  df:	58                   	pop    %eax
+  e0:	68 7c 12 00 00       	push   $0x127c
+  e5:	6a 01                	push   $0x1
+  e7:	e8 84 09 00 00       	call   a70 <printf>
+  printf(1, "  'GC: starting garbage collection'\n");
+  ec:	58                   	pop    %eax
+  ed:	5a                   	pop    %edx
+  ee:	68 a4 12 00 00       	push   $0x12a4
+  f3:	6a 01                	push   $0x1
+  f5:	e8 76 09 00 00       	call   a70 <printf>
+  printf(1, "  'GC: segment X cleaned, Y live / Z total'\n");
+  fa:	59                   	pop    %ecx
+  fb:	5b                   	pop    %ebx
+  fc:	68 cc 12 00 00       	push   $0x12cc
+ 101:	6a 01                	push   $0x1
+ 103:	e8 68 09 00 00       	call   a70 <printf>
+  printf(1, "  'GC: done, N free segments available'\n");
+ 108:	5e                   	pop    %esi
+ 109:	5f                   	pop    %edi
+ 10a:	68 fc 12 00 00       	push   $0x12fc
+ 10f:	6a 01                	push   $0x1
+ 111:	e8 5a 09 00 00       	call   a70 <printf>
+  printf(1, "========================================\n");
+ 116:	58                   	pop    %eax
+ 117:	5a                   	pop    %edx
+ 118:	68 28 13 00 00       	push   $0x1328
+ 11d:	6a 01                	push   $0x1
+ 11f:	e8 4c 09 00 00       	call   a70 <printf>
+
+  exit();
+ 124:	e8 fa 07 00 00       	call   923 <exit>
+    printf(1, "Usage: gctest [mode]\n");
+ 129:	51                   	push   %ecx
+ 12a:	51                   	push   %ecx
+ 12b:	68 73 0e 00 00       	push   $0xe73
+ 130:	6a 01                	push   $0x1
+ 132:	e8 39 09 00 00       	call   a70 <printf>
+    printf(1, "  1 - Fragmentation test (default)\n");
+ 137:	5b                   	pop    %ebx
+ 138:	5e                   	pop    %esi
+ 139:	68 10 12 00 00       	push   $0x1210
+ 13e:	6a 01                	push   $0x1
+ 140:	e8 2b 09 00 00       	call   a70 <printf>
+    printf(1, "  2 - Continuous create/delete cycle\n");
+ 145:	5f                   	pop    %edi
+ 146:	58                   	pop    %eax
+ 147:	68 34 12 00 00       	push   $0x1234
+ 14c:	6a 01                	push   $0x1
+ 14e:	e8 1d 09 00 00       	call   a70 <printf>
+    printf(1, "  3 - Fill disk to trigger GC\n");
+ 153:	58                   	pop    %eax
+ 154:	5a                   	pop    %edx
+ 155:	68 5c 12 00 00       	push   $0x125c
+ 15a:	6a 01                	push   $0x1
+ 15c:	e8 0f 09 00 00       	call   a70 <printf>
+    break;
+ 161:	83 c4 10             	add    $0x10,%esp
+ 164:	e9 66 ff ff ff       	jmp    cf <main+0xcf>
+    test_fill_disk();
+ 169:	e8 72 04 00 00       	call   5e0 <test_fill_disk>
+    break;
+ 16e:	e9 5c ff ff ff       	jmp    cf <main+0xcf>
+ 173:	66 90                	xchg   %ax,%ax
+ 175:	66 90                	xchg   %ax,%ax
+ 177:	66 90                	xchg   %ax,%ax
+ 179:	66 90                	xchg   %ax,%ax
+ 17b:	66 90                	xchg   %ax,%ax
+ 17d:	66 90                	xchg   %ax,%ax
+ 17f:	90                   	nop
+
+00000180 <fillbuf>:
+{
+ 180:	55                   	push   %ebp
+  for(i = 0; i < sizeof(buf); i++)
+ 181:	31 c9                	xor    %ecx,%ecx
+{
+ 183:	89 e5                	mov    %esp,%ebp
+ 185:	53                   	push   %ebx
+    buf[i] = 'A' + (i % 26);
+ 186:	bb 4f ec c4 4e       	mov    $0x4ec4ec4f,%ebx
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+ 190:	89 c8                	mov    %ecx,%eax
+ 192:	f7 e3                	mul    %ebx
+ 194:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < sizeof(buf); i++)
+ 196:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = 'A' + (i % 26);
+ 199:	c1 ea 03             	shr    $0x3,%edx
+ 19c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 19f:	29 d0                	sub    %edx,%eax
+ 1a1:	83 c0 41             	add    $0x41,%eax
+ 1a4:	88 81 5f 17 00 00    	mov    %al,0x175f(%ecx)
+  for(i = 0; i < sizeof(buf); i++)
+ 1aa:	81 f9 00 02 00 00    	cmp    $0x200,%ecx
+ 1b0:	75 de                	jne    190 <fillbuf+0x10>
+}
+ 1b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1b5:	c9                   	leave
+ 1b6:	c3                   	ret
+ 1b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1be:	66 90                	xchg   %ax,%ax
+
+000001c0 <createfile>:
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	57                   	push   %edi
+ 1c4:	56                   	push   %esi
+ 1c5:	53                   	push   %ebx
+ 1c6:	83 ec 14             	sub    $0x14,%esp
+ 1c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  fd = open(name, O_CREATE | O_WRONLY);
+ 1cc:	68 01 02 00 00       	push   $0x201
+ 1d1:	ff 75 08             	push   0x8(%ebp)
+ 1d4:	e8 8a 07 00 00       	call   963 <open>
+  if(fd < 0){
+ 1d9:	83 c4 10             	add    $0x10,%esp
+ 1dc:	85 c0                	test   %eax,%eax
+ 1de:	78 7e                	js     25e <createfile+0x9e>
+ 1e0:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < size; i += sizeof(buf)){
+ 1e2:	31 ff                	xor    %edi,%edi
+ 1e4:	85 f6                	test   %esi,%esi
+ 1e6:	7f 12                	jg     1fa <createfile+0x3a>
+ 1e8:	eb 5e                	jmp    248 <createfile+0x88>
+ 1ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 1f0:	81 c7 00 02 00 00    	add    $0x200,%edi
+ 1f6:	39 fe                	cmp    %edi,%esi
+ 1f8:	7e 4e                	jle    248 <createfile+0x88>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+ 1fa:	83 ec 04             	sub    $0x4,%esp
+ 1fd:	68 00 02 00 00       	push   $0x200
+ 202:	68 60 17 00 00       	push   $0x1760
+ 207:	53                   	push   %ebx
+ 208:	e8 36 07 00 00       	call   943 <write>
+ 20d:	83 c4 10             	add    $0x10,%esp
+ 210:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 215:	74 d9                	je     1f0 <createfile+0x30>
+      printf(1, "gctest: write error on %s\n", name);
+ 217:	83 ec 04             	sub    $0x4,%esp
+ 21a:	ff 75 08             	push   0x8(%ebp)
+ 21d:	68 b2 0d 00 00       	push   $0xdb2
+ 222:	6a 01                	push   $0x1
+ 224:	e8 47 08 00 00       	call   a70 <printf>
+      close(fd);
+ 229:	89 1c 24             	mov    %ebx,(%esp)
+ 22c:	e8 1a 07 00 00       	call   94b <close>
+      return -1;
+ 231:	83 c4 10             	add    $0x10,%esp
+}
+ 234:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+ 237:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 23c:	5b                   	pop    %ebx
+ 23d:	5e                   	pop    %esi
+ 23e:	5f                   	pop    %edi
+ 23f:	5d                   	pop    %ebp
+ 240:	c3                   	ret
+ 241:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  close(fd);
+ 248:	83 ec 0c             	sub    $0xc,%esp
+ 24b:	53                   	push   %ebx
+ 24c:	e8 fa 06 00 00       	call   94b <close>
+  return 0;
+ 251:	83 c4 10             	add    $0x10,%esp
+}
+ 254:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 257:	31 c0                	xor    %eax,%eax
+}
+ 259:	5b                   	pop    %ebx
+ 25a:	5e                   	pop    %esi
+ 25b:	5f                   	pop    %edi
+ 25c:	5d                   	pop    %ebp
+ 25d:	c3                   	ret
+    printf(1, "gctest: cannot create %s\n", name);
+ 25e:	83 ec 04             	sub    $0x4,%esp
+ 261:	ff 75 08             	push   0x8(%ebp)
+ 264:	68 98 0d 00 00       	push   $0xd98
+ 269:	6a 01                	push   $0x1
+ 26b:	e8 00 08 00 00       	call   a70 <printf>
+    return -1;
+ 270:	83 c4 10             	add    $0x10,%esp
+ 273:	eb bf                	jmp    234 <createfile+0x74>
+ 275:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <test_fragmentation>:
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+    name[1] = '0' + (i / 10);
+ 284:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+{
+ 289:	56                   	push   %esi
+  for(i = 0; i < NFILES; i++){
+ 28a:	31 f6                	xor    %esi,%esi
+{
+ 28c:	53                   	push   %ebx
+ 28d:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 290:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "=== GC Test Mode 1: Fragmentation Test ===\n");
+ 293:	68 8c 0e 00 00       	push   $0xe8c
+ 298:	6a 01                	push   $0x1
+ 29a:	e8 d1 07 00 00       	call   a70 <printf>
+  printf(1, "Phase 1: Creating %d files (%d bytes each)...\n", NFILES, FILESIZE);
+ 29f:	68 00 90 01 00       	push   $0x19000
+ 2a4:	6a 28                	push   $0x28
+ 2a6:	68 b8 0e 00 00       	push   $0xeb8
+ 2ab:	6a 01                	push   $0x1
+ 2ad:	e8 be 07 00 00       	call   a70 <printf>
+ 2b2:	83 c4 20             	add    $0x20,%esp
+ 2b5:	eb 0e                	jmp    2c5 <test_fragmentation+0x45>
+ 2b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2be:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < NFILES; i++){
+ 2c0:	83 fe 28             	cmp    $0x28,%esi
+ 2c3:	74 6b                	je     330 <test_fragmentation+0xb0>
+    name[1] = '0' + (i / 10);
+ 2c5:	89 f0                	mov    %esi,%eax
+    if(createfile(name, FILESIZE) < 0){
+ 2c7:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'f';
+ 2ca:	c6 45 d8 66          	movb   $0x66,-0x28(%ebp)
+    name[1] = '0' + (i / 10);
+ 2ce:	f7 e7                	mul    %edi
+    name[3] = '\0';
+ 2d0:	c6 45 db 00          	movb   $0x0,-0x25(%ebp)
+    name[1] = '0' + (i / 10);
+ 2d4:	c1 ea 03             	shr    $0x3,%edx
+ 2d7:	8d 42 30             	lea    0x30(%edx),%eax
+    name[2] = '0' + (i % 10);
+ 2da:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[1] = '0' + (i / 10);
+ 2dd:	88 45 d9             	mov    %al,-0x27(%ebp)
+    name[2] = '0' + (i % 10);
+ 2e0:	01 d2                	add    %edx,%edx
+ 2e2:	89 f0                	mov    %esi,%eax
+ 2e4:	29 d0                	sub    %edx,%eax
+ 2e6:	83 c0 30             	add    $0x30,%eax
+ 2e9:	88 45 da             	mov    %al,-0x26(%ebp)
+    if(createfile(name, FILESIZE) < 0){
+ 2ec:	68 00 90 01 00       	push   $0x19000
+ 2f1:	53                   	push   %ebx
+ 2f2:	e8 c9 fe ff ff       	call   1c0 <createfile>
+ 2f7:	83 c4 10             	add    $0x10,%esp
+ 2fa:	85 c0                	test   %eax,%eax
+ 2fc:	0f 88 4e 01 00 00    	js     450 <test_fragmentation+0x1d0>
+    if((i + 1) % 20 == 0)
+ 302:	83 c6 01             	add    $0x1,%esi
+ 305:	69 c6 cd cc cc cc    	imul   $0xcccccccd,%esi,%eax
+ 30b:	c1 c8 02             	ror    $0x2,%eax
+ 30e:	3d cc cc cc 0c       	cmp    $0xccccccc,%eax
+ 313:	77 ab                	ja     2c0 <test_fragmentation+0x40>
+      printf(1, "  Created %d files\n", i + 1);
+ 315:	83 ec 04             	sub    $0x4,%esp
+ 318:	56                   	push   %esi
+ 319:	68 e0 0d 00 00       	push   $0xde0
+ 31e:	6a 01                	push   $0x1
+ 320:	e8 4b 07 00 00       	call   a70 <printf>
+ 325:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NFILES; i++){
+ 328:	83 fe 28             	cmp    $0x28,%esi
+ 32b:	75 98                	jne    2c5 <test_fragmentation+0x45>
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+  printf(1, "  Created total %d files\n", i);
+ 330:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < NFILES; i += 2){
+ 333:	31 ff                	xor    %edi,%edi
+  printf(1, "  Created total %d files\n", i);
+ 335:	56                   	push   %esi
+ 336:	68 f4 0d 00 00       	push   $0xdf4
+ 33b:	6a 01                	push   $0x1
+ 33d:	e8 2e 07 00 00       	call   a70 <printf>
+  printf(1, "Phase 2: Deleting every other file (creating dead blocks)...\n");
+ 342:	59                   	pop    %ecx
+ 343:	5e                   	pop    %esi
+ 344:	68 e8 0e 00 00       	push   $0xee8
+ 349:	6a 01                	push   $0x1
+    name[1] = '0' + (i / 10);
+ 34b:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+  printf(1, "Phase 2: Deleting every other file (creating dead blocks)...\n");
+ 350:	e8 1b 07 00 00       	call   a70 <printf>
+ 355:	83 c4 10             	add    $0x10,%esp
+ 358:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+    name[1] = '0' + (i / 10);
+ 360:	89 f8                	mov    %edi,%eax
+    if(unlink(name) < 0){
+ 362:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+ 365:	c6 45 d8 66          	movb   $0x66,-0x28(%ebp)
+    name[1] = '0' + (i / 10);
+ 369:	f7 e6                	mul    %esi
+    name[3] = '\0';
+ 36b:	c6 45 db 00          	movb   $0x0,-0x25(%ebp)
+    name[1] = '0' + (i / 10);
+ 36f:	c1 ea 03             	shr    $0x3,%edx
+ 372:	8d 42 30             	lea    0x30(%edx),%eax
+    name[2] = '0' + (i % 10);
+ 375:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[1] = '0' + (i / 10);
+ 378:	88 45 d9             	mov    %al,-0x27(%ebp)
+    name[2] = '0' + (i % 10);
+ 37b:	01 d2                	add    %edx,%edx
+ 37d:	89 f8                	mov    %edi,%eax
+  for(i = 0; i < NFILES; i += 2){
+ 37f:	83 c7 02             	add    $0x2,%edi
+    name[2] = '0' + (i % 10);
+ 382:	29 d0                	sub    %edx,%eax
+ 384:	83 c0 30             	add    $0x30,%eax
+ 387:	88 45 da             	mov    %al,-0x26(%ebp)
+    if(unlink(name) < 0){
+ 38a:	53                   	push   %ebx
+ 38b:	e8 e3 05 00 00       	call   973 <unlink>
+  for(i = 0; i < NFILES; i += 2){
+ 390:	83 c4 10             	add    $0x10,%esp
+ 393:	83 ff 28             	cmp    $0x28,%edi
+ 396:	75 c8                	jne    360 <test_fragmentation+0xe0>
+  printf(1, "  Deleted %d files\n", NFILES / 2);
+ 398:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < NFILES / 2; i++){
+ 39b:	31 f6                	xor    %esi,%esi
+    name[1] = '0' + (i / 10);
+ 39d:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+  printf(1, "  Deleted %d files\n", NFILES / 2);
+ 3a2:	6a 14                	push   $0x14
+ 3a4:	68 0e 0e 00 00       	push   $0xe0e
+ 3a9:	6a 01                	push   $0x1
+ 3ab:	e8 c0 06 00 00       	call   a70 <printf>
+  printf(1, "Phase 3: Creating more files to trigger GC...\n");
+ 3b0:	58                   	pop    %eax
+ 3b1:	5a                   	pop    %edx
+ 3b2:	68 28 0f 00 00       	push   $0xf28
+ 3b7:	6a 01                	push   $0x1
+ 3b9:	e8 b2 06 00 00       	call   a70 <printf>
+ 3be:	83 c4 10             	add    $0x10,%esp
+ 3c1:	eb 0a                	jmp    3cd <test_fragmentation+0x14d>
+ 3c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3c7:	90                   	nop
+  for(i = 0; i < NFILES / 2; i++){
+ 3c8:	83 fe 14             	cmp    $0x14,%esi
+ 3cb:	74 64                	je     431 <test_fragmentation+0x1b1>
+    name[1] = '0' + (i / 10);
+ 3cd:	89 f0                	mov    %esi,%eax
+    if(createfile(name, FILESIZE) < 0){
+ 3cf:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'g';
+ 3d2:	c6 45 d8 67          	movb   $0x67,-0x28(%ebp)
+    name[1] = '0' + (i / 10);
+ 3d6:	f7 e7                	mul    %edi
+    name[3] = '\0';
+ 3d8:	c6 45 db 00          	movb   $0x0,-0x25(%ebp)
+    name[1] = '0' + (i / 10);
+ 3dc:	c1 ea 03             	shr    $0x3,%edx
+ 3df:	8d 42 30             	lea    0x30(%edx),%eax
+    name[2] = '0' + (i % 10);
+ 3e2:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[1] = '0' + (i / 10);
+ 3e5:	88 45 d9             	mov    %al,-0x27(%ebp)
+    name[2] = '0' + (i % 10);
+ 3e8:	01 d2                	add    %edx,%edx
+ 3ea:	89 f0                	mov    %esi,%eax
+ 3ec:	29 d0                	sub    %edx,%eax
+ 3ee:	83 c0 30             	add    $0x30,%eax
+ 3f1:	88 45 da             	mov    %al,-0x26(%ebp)
+    if(createfile(name, FILESIZE) < 0){
+ 3f4:	68 00 90 01 00       	push   $0x19000
+ 3f9:	53                   	push   %ebx
+ 3fa:	e8 c1 fd ff ff       	call   1c0 <createfile>
+ 3ff:	83 c4 10             	add    $0x10,%esp
+ 402:	85 c0                	test   %eax,%eax
+ 404:	78 6a                	js     470 <test_fragmentation+0x1f0>
+    if((i + 1) % 20 == 0)
+ 406:	83 c6 01             	add    $0x1,%esi
+ 409:	69 c6 cd cc cc cc    	imul   $0xcccccccd,%esi,%eax
+ 40f:	c1 c8 02             	ror    $0x2,%eax
+ 412:	3d cc cc cc 0c       	cmp    $0xccccccc,%eax
+ 417:	77 af                	ja     3c8 <test_fragmentation+0x148>
+      printf(1, "  Created %d more files\n", i + 1);
+ 419:	83 ec 04             	sub    $0x4,%esp
+ 41c:	56                   	push   %esi
+ 41d:	68 22 0e 00 00       	push   $0xe22
+ 422:	6a 01                	push   $0x1
+ 424:	e8 47 06 00 00       	call   a70 <printf>
+ 429:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NFILES / 2; i++){
+ 42c:	83 fe 14             	cmp    $0x14,%esi
+ 42f:	75 9c                	jne    3cd <test_fragmentation+0x14d>
+  printf(1, "Test complete. Check kernel output for GC messages.\n");
+ 431:	83 ec 08             	sub    $0x8,%esp
+ 434:	68 94 0f 00 00       	push   $0xf94
+ 439:	6a 01                	push   $0x1
+ 43b:	e8 30 06 00 00       	call   a70 <printf>
+}
+ 440:	83 c4 10             	add    $0x10,%esp
+ 443:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 446:	5b                   	pop    %ebx
+ 447:	5e                   	pop    %esi
+ 448:	5f                   	pop    %edi
+ 449:	5d                   	pop    %ebp
+ 44a:	c3                   	ret
+ 44b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 44f:	90                   	nop
+      printf(1, "Failed at file %d\n", i);
+ 450:	83 ec 04             	sub    $0x4,%esp
+ 453:	56                   	push   %esi
+ 454:	68 cd 0d 00 00       	push   $0xdcd
+ 459:	6a 01                	push   $0x1
+ 45b:	e8 10 06 00 00       	call   a70 <printf>
+      break;
+ 460:	83 c4 10             	add    $0x10,%esp
+ 463:	e9 c8 fe ff ff       	jmp    330 <test_fragmentation+0xb0>
+ 468:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46f:	90                   	nop
+      printf(1, "  Stopped at file %d (possibly disk full or GC triggered)\n", i);
+ 470:	83 ec 04             	sub    $0x4,%esp
+ 473:	56                   	push   %esi
+ 474:	68 58 0f 00 00       	push   $0xf58
+ 479:	6a 01                	push   $0x1
+ 47b:	e8 f0 05 00 00       	call   a70 <printf>
+      break;
+ 480:	83 c4 10             	add    $0x10,%esp
+ 483:	eb ac                	jmp    431 <test_fragmentation+0x1b1>
+ 485:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <test_continuous>:
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 498:	53                   	push   %ebx
+ 499:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "=== GC Test Mode 2: Continuous Cycle Test ===\n");
+ 49c:	68 cc 0f 00 00       	push   $0xfcc
+ 4a1:	6a 01                	push   $0x1
+ 4a3:	e8 c8 05 00 00       	call   a70 <printf>
+  printf(1, "This will run 10 rounds of create/delete cycles.\n");
+ 4a8:	58                   	pop    %eax
+ 4a9:	5a                   	pop    %edx
+ 4aa:	68 fc 0f 00 00       	push   $0xffc
+ 4af:	6a 01                	push   $0x1
+ 4b1:	e8 ba 05 00 00       	call   a70 <printf>
+  printf(1, "Watch kernel output for GC triggers.\n\n");
+ 4b6:	59                   	pop    %ecx
+ 4b7:	5b                   	pop    %ebx
+ 4b8:	68 30 10 00 00       	push   $0x1030
+ 4bd:	6a 01                	push   $0x1
+ 4bf:	e8 ac 05 00 00       	call   a70 <printf>
+  for(round = 0; round < 10; round++){
+ 4c4:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  printf(1, "Watch kernel output for GC triggers.\n\n");
+ 4cb:	83 c4 10             	add    $0x10,%esp
+    printf(1, "Round %d: Creating 20 files...\n", round + 1);
+ 4ce:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+ 4d2:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 4d5:	83 ec 04             	sub    $0x4,%esp
+    for(i = 0; i < 20; i++){
+ 4d8:	31 ff                	xor    %edi,%edi
+    printf(1, "Round %d: Creating 20 files...\n", round + 1);
+ 4da:	53                   	push   %ebx
+ 4db:	68 58 10 00 00       	push   $0x1058
+ 4e0:	6a 01                	push   $0x1
+ 4e2:	e8 89 05 00 00       	call   a70 <printf>
+      name[1] = '0' + round;
+ 4e7:	89 d8                	mov    %ebx,%eax
+ 4e9:	83 c4 10             	add    $0x10,%esp
+ 4ec:	8d 58 2f             	lea    0x2f(%eax),%ebx
+ 4ef:	eb 0f                	jmp    500 <test_continuous+0x70>
+ 4f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    for(i = 0; i < 20; i++){
+ 4f8:	83 c7 01             	add    $0x1,%edi
+ 4fb:	83 ff 14             	cmp    $0x14,%edi
+ 4fe:	74 70                	je     570 <test_continuous+0xe0>
+      name[2] = '0' + (i / 10);
+ 500:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+      if(createfile(name, FILESIZE) < 0){
+ 505:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 't';
+ 508:	c6 45 d8 74          	movb   $0x74,-0x28(%ebp)
+      name[2] = '0' + (i / 10);
+ 50c:	f7 e7                	mul    %edi
+      name[1] = '0' + round;
+ 50e:	88 5d d9             	mov    %bl,-0x27(%ebp)
+      name[4] = '\0';
+ 511:	c6 45 dc 00          	movb   $0x0,-0x24(%ebp)
+      name[2] = '0' + (i / 10);
+ 515:	c1 ea 03             	shr    $0x3,%edx
+ 518:	8d 42 30             	lea    0x30(%edx),%eax
+      name[3] = '0' + (i % 10);
+ 51b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+      name[2] = '0' + (i / 10);
+ 51e:	88 45 da             	mov    %al,-0x26(%ebp)
+      name[3] = '0' + (i % 10);
+ 521:	01 d2                	add    %edx,%edx
+ 523:	89 f8                	mov    %edi,%eax
+ 525:	29 d0                	sub    %edx,%eax
+ 527:	83 c0 30             	add    $0x30,%eax
+ 52a:	88 45 db             	mov    %al,-0x25(%ebp)
+      if(createfile(name, FILESIZE) < 0){
+ 52d:	68 00 90 01 00       	push   $0x19000
+ 532:	56                   	push   %esi
+ 533:	e8 88 fc ff ff       	call   1c0 <createfile>
+ 538:	83 c4 10             	add    $0x10,%esp
+ 53b:	85 c0                	test   %eax,%eax
+ 53d:	79 b9                	jns    4f8 <test_continuous+0x68>
+        printf(1, "  Write failed - disk may be full\n");
+ 53f:	83 ec 08             	sub    $0x8,%esp
+ 542:	68 78 10 00 00       	push   $0x1078
+ 547:	6a 01                	push   $0x1
+ 549:	e8 22 05 00 00       	call   a70 <printf>
+        goto cleanup;
+ 54e:	83 c4 10             	add    $0x10,%esp
+  printf(1, "Continuous test complete.\n");
+ 551:	83 ec 08             	sub    $0x8,%esp
+ 554:	68 3b 0e 00 00       	push   $0xe3b
+ 559:	6a 01                	push   $0x1
+ 55b:	e8 10 05 00 00       	call   a70 <printf>
+}
+ 560:	83 c4 10             	add    $0x10,%esp
+ 563:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 566:	5b                   	pop    %ebx
+ 567:	5e                   	pop    %esi
+ 568:	5f                   	pop    %edi
+ 569:	5d                   	pop    %ebp
+ 56a:	c3                   	ret
+ 56b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 56f:	90                   	nop
+    printf(1, "Round %d: Deleting 20 files...\n", round + 1);
+ 570:	83 ec 04             	sub    $0x4,%esp
+ 573:	ff 75 d4             	push   -0x2c(%ebp)
+    for(i = 0; i < 20; i++){
+ 576:	31 ff                	xor    %edi,%edi
+    printf(1, "Round %d: Deleting 20 files...\n", round + 1);
+ 578:	68 9c 10 00 00       	push   $0x109c
+ 57d:	6a 01                	push   $0x1
+ 57f:	e8 ec 04 00 00       	call   a70 <printf>
+ 584:	83 c4 10             	add    $0x10,%esp
+ 587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58e:	66 90                	xchg   %ax,%ax
+      name[2] = '0' + (i / 10);
+ 590:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+      unlink(name);
+ 595:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 't';
+ 598:	c6 45 d8 74          	movb   $0x74,-0x28(%ebp)
+      name[2] = '0' + (i / 10);
+ 59c:	f7 e7                	mul    %edi
+      name[1] = '0' + round;
+ 59e:	88 5d d9             	mov    %bl,-0x27(%ebp)
+      name[4] = '\0';
+ 5a1:	c6 45 dc 00          	movb   $0x0,-0x24(%ebp)
+      name[2] = '0' + (i / 10);
+ 5a5:	c1 ea 03             	shr    $0x3,%edx
+ 5a8:	8d 42 30             	lea    0x30(%edx),%eax
+      name[3] = '0' + (i % 10);
+ 5ab:	8d 14 92             	lea    (%edx,%edx,4),%edx
+      name[2] = '0' + (i / 10);
+ 5ae:	88 45 da             	mov    %al,-0x26(%ebp)
+      name[3] = '0' + (i % 10);
+ 5b1:	01 d2                	add    %edx,%edx
+ 5b3:	89 f8                	mov    %edi,%eax
+    for(i = 0; i < 20; i++){
+ 5b5:	83 c7 01             	add    $0x1,%edi
+      name[3] = '0' + (i % 10);
+ 5b8:	29 d0                	sub    %edx,%eax
+ 5ba:	83 c0 30             	add    $0x30,%eax
+ 5bd:	88 45 db             	mov    %al,-0x25(%ebp)
+      unlink(name);
+ 5c0:	56                   	push   %esi
+ 5c1:	e8 ad 03 00 00       	call   973 <unlink>
+    for(i = 0; i < 20; i++){
+ 5c6:	83 c4 10             	add    $0x10,%esp
+ 5c9:	83 ff 14             	cmp    $0x14,%edi
+ 5cc:	75 c2                	jne    590 <test_continuous+0x100>
+  for(round = 0; round < 10; round++){
+ 5ce:	83 7d d4 0a          	cmpl   $0xa,-0x2c(%ebp)
+ 5d2:	0f 85 f6 fe ff ff    	jne    4ce <test_continuous+0x3e>
+cleanup:
+ 5d8:	e9 74 ff ff ff       	jmp    551 <test_continuous+0xc1>
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005e0 <test_fill_disk>:
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+ 5e4:	56                   	push   %esi
+ 5e5:	8d 7d d8             	lea    -0x28(%ebp),%edi
+    name[1] = '0' + ((i / 10) % 10);
+ 5e8:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+{
+ 5ed:	53                   	push   %ebx
+  for(i = 0; i < 100; i++){  // 100 files * 256KB = 25MB (50% of 50MB disk)
+ 5ee:	31 db                	xor    %ebx,%ebx
+{
+ 5f0:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "=== GC Test Mode 3: Fill Disk Test ===\n");
+ 5f3:	68 bc 10 00 00       	push   $0x10bc
+ 5f8:	6a 01                	push   $0x1
+ 5fa:	e8 71 04 00 00       	call   a70 <printf>
+  printf(1, "Creating large files (%d KB each) to fill disk...\n", large_size / 1024);
+ 5ff:	83 c4 0c             	add    $0xc,%esp
+ 602:	68 00 01 00 00       	push   $0x100
+ 607:	68 e4 10 00 00       	push   $0x10e4
+ 60c:	6a 01                	push   $0x1
+ 60e:	e8 5d 04 00 00       	call   a70 <printf>
+  printf(1, "GC should trigger at 50%% disk usage.\n\n");
+ 613:	58                   	pop    %eax
+ 614:	5a                   	pop    %edx
+ 615:	68 18 11 00 00       	push   $0x1118
+ 61a:	6a 01                	push   $0x1
+ 61c:	e8 4f 04 00 00       	call   a70 <printf>
+ 621:	83 c4 10             	add    $0x10,%esp
+ 624:	eb 0f                	jmp    635 <test_fill_disk+0x55>
+ 626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; i < 100; i++){  // 100 files * 256KB = 25MB (50% of 50MB disk)
+ 630:	83 fb 64             	cmp    $0x64,%ebx
+ 633:	74 69                	je     69e <test_fill_disk+0xbe>
+    name[1] = '0' + ((i / 10) % 10);
+ 635:	89 d8                	mov    %ebx,%eax
+    if(createfile(name, large_size) < 0){
+ 637:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+ 63a:	c6 45 d8 78          	movb   $0x78,-0x28(%ebp)
+    name[1] = '0' + ((i / 10) % 10);
+ 63e:	f7 e6                	mul    %esi
+    name[3] = '\0';
+ 640:	c6 45 db 00          	movb   $0x0,-0x25(%ebp)
+    name[1] = '0' + ((i / 10) % 10);
+ 644:	c1 ea 03             	shr    $0x3,%edx
+ 647:	8d 42 30             	lea    0x30(%edx),%eax
+    name[2] = '0' + (i % 10);
+ 64a:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[1] = '0' + ((i / 10) % 10);
+ 64d:	88 45 d9             	mov    %al,-0x27(%ebp)
+    name[2] = '0' + (i % 10);
+ 650:	01 d2                	add    %edx,%edx
+ 652:	89 d8                	mov    %ebx,%eax
+ 654:	29 d0                	sub    %edx,%eax
+ 656:	83 c0 30             	add    $0x30,%eax
+ 659:	88 45 da             	mov    %al,-0x26(%ebp)
+    if(createfile(name, large_size) < 0){
+ 65c:	68 00 00 04 00       	push   $0x40000
+ 661:	57                   	push   %edi
+ 662:	e8 59 fb ff ff       	call   1c0 <createfile>
+ 667:	83 c4 10             	add    $0x10,%esp
+ 66a:	85 c0                	test   %eax,%eax
+ 66c:	78 52                	js     6c0 <test_fill_disk+0xe0>
+    if((i + 1) % 10 == 0)
+ 66e:	83 c3 01             	add    $0x1,%ebx
+ 671:	69 c3 cd cc cc cc    	imul   $0xcccccccd,%ebx,%eax
+ 677:	d1 c8                	ror    %eax
+ 679:	3d 99 99 99 19       	cmp    $0x19999999,%eax
+ 67e:	77 b0                	ja     630 <test_fill_disk+0x50>
+      printf(1, "  Created %d files (%d KB total)\n", i + 1, (i + 1) * large_size / 1024);
+ 680:	89 d8                	mov    %ebx,%eax
+ 682:	c1 e0 12             	shl    $0x12,%eax
+ 685:	c1 f8 0a             	sar    $0xa,%eax
+ 688:	50                   	push   %eax
+ 689:	53                   	push   %ebx
+ 68a:	68 6c 11 00 00       	push   $0x116c
+ 68f:	6a 01                	push   $0x1
+ 691:	e8 da 03 00 00       	call   a70 <printf>
+ 696:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){  // 100 files * 256KB = 25MB (50% of 50MB disk)
+ 699:	83 fb 64             	cmp    $0x64,%ebx
+ 69c:	75 97                	jne    635 <test_fill_disk+0x55>
+  printf(1, "\nFill test complete. Created %d files.\n", i);
+ 69e:	83 ec 04             	sub    $0x4,%esp
+ 6a1:	53                   	push   %ebx
+ 6a2:	68 90 11 00 00       	push   $0x1190
+ 6a7:	6a 01                	push   $0x1
+ 6a9:	e8 c2 03 00 00       	call   a70 <printf>
+}
+ 6ae:	83 c4 10             	add    $0x10,%esp
+ 6b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6b4:	5b                   	pop    %ebx
+ 6b5:	5e                   	pop    %esi
+ 6b6:	5f                   	pop    %edi
+ 6b7:	5d                   	pop    %ebp
+ 6b8:	c3                   	ret
+ 6b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "\nFailed at file %d - disk full or error\n", i);
+ 6c0:	83 ec 04             	sub    $0x4,%esp
+ 6c3:	53                   	push   %ebx
+ 6c4:	68 40 11 00 00       	push   $0x1140
+ 6c9:	6a 01                	push   $0x1
+ 6cb:	e8 a0 03 00 00       	call   a70 <printf>
+      break;
+ 6d0:	83 c4 10             	add    $0x10,%esp
+ 6d3:	eb c9                	jmp    69e <test_fill_disk+0xbe>
+ 6d5:	66 90                	xchg   %ax,%ax
+ 6d7:	66 90                	xchg   %ax,%ax
+ 6d9:	66 90                	xchg   %ax,%ax
+ 6db:	66 90                	xchg   %ax,%ax
+ 6dd:	66 90                	xchg   %ax,%ax
+ 6df:	90                   	nop
+
+000006e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 6e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 6e1:	31 c0                	xor    %eax,%eax
+{
+ 6e3:	89 e5                	mov    %esp,%ebp
+ 6e5:	53                   	push   %ebx
+ 6e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 6e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 6ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 6f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 6f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 6f7:	83 c0 01             	add    $0x1,%eax
+ 6fa:	84 d2                	test   %dl,%dl
+ 6fc:	75 f2                	jne    6f0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 6fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 701:	89 c8                	mov    %ecx,%eax
+ 703:	c9                   	leave
+ 704:	c3                   	ret
+ 705:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000710 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	53                   	push   %ebx
+ 714:	8b 55 08             	mov    0x8(%ebp),%edx
+ 717:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 71a:	0f b6 02             	movzbl (%edx),%eax
+ 71d:	84 c0                	test   %al,%al
+ 71f:	75 17                	jne    738 <strcmp+0x28>
+ 721:	eb 3a                	jmp    75d <strcmp+0x4d>
+ 723:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 727:	90                   	nop
+ 728:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 72c:	83 c2 01             	add    $0x1,%edx
+ 72f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 732:	84 c0                	test   %al,%al
+ 734:	74 1a                	je     750 <strcmp+0x40>
+    p++, q++;
+ 736:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 738:	0f b6 19             	movzbl (%ecx),%ebx
+ 73b:	38 c3                	cmp    %al,%bl
+ 73d:	74 e9                	je     728 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 73f:	29 d8                	sub    %ebx,%eax
+}
+ 741:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 744:	c9                   	leave
+ 745:	c3                   	ret
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 750:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 754:	31 c0                	xor    %eax,%eax
+ 756:	29 d8                	sub    %ebx,%eax
+}
+ 758:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 75b:	c9                   	leave
+ 75c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 75d:	0f b6 19             	movzbl (%ecx),%ebx
+ 760:	31 c0                	xor    %eax,%eax
+ 762:	eb db                	jmp    73f <strcmp+0x2f>
+ 764:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 76f:	90                   	nop
+
+00000770 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 776:	80 3a 00             	cmpb   $0x0,(%edx)
+ 779:	74 15                	je     790 <strlen+0x20>
+ 77b:	31 c0                	xor    %eax,%eax
+ 77d:	8d 76 00             	lea    0x0(%esi),%esi
+ 780:	83 c0 01             	add    $0x1,%eax
+ 783:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 787:	89 c1                	mov    %eax,%ecx
+ 789:	75 f5                	jne    780 <strlen+0x10>
+    ;
+  return n;
+}
+ 78b:	89 c8                	mov    %ecx,%eax
+ 78d:	5d                   	pop    %ebp
+ 78e:	c3                   	ret
+ 78f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 790:	31 c9                	xor    %ecx,%ecx
+}
+ 792:	5d                   	pop    %ebp
+ 793:	89 c8                	mov    %ecx,%eax
+ 795:	c3                   	ret
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	57                   	push   %edi
+ 7a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 7a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7ad:	89 d7                	mov    %edx,%edi
+ 7af:	fc                   	cld
+ 7b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 7b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 7b5:	89 d0                	mov    %edx,%eax
+ 7b7:	c9                   	leave
+ 7b8:	c3                   	ret
+ 7b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 7ca:	0f b6 10             	movzbl (%eax),%edx
+ 7cd:	84 d2                	test   %dl,%dl
+ 7cf:	75 12                	jne    7e3 <strchr+0x23>
+ 7d1:	eb 1d                	jmp    7f0 <strchr+0x30>
+ 7d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7d7:	90                   	nop
+ 7d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 7dc:	83 c0 01             	add    $0x1,%eax
+ 7df:	84 d2                	test   %dl,%dl
+ 7e1:	74 0d                	je     7f0 <strchr+0x30>
+    if(*s == c)
+ 7e3:	38 d1                	cmp    %dl,%cl
+ 7e5:	75 f1                	jne    7d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 7e7:	5d                   	pop    %ebp
+ 7e8:	c3                   	ret
+ 7e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 7f0:	31 c0                	xor    %eax,%eax
+}
+ 7f2:	5d                   	pop    %ebp
+ 7f3:	c3                   	ret
+ 7f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7ff:	90                   	nop
+
+00000800 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	57                   	push   %edi
+ 804:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 805:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 808:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 809:	31 db                	xor    %ebx,%ebx
+{
+ 80b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 80e:	eb 27                	jmp    837 <gets+0x37>
+    cc = read(0, &c, 1);
+ 810:	83 ec 04             	sub    $0x4,%esp
+ 813:	6a 01                	push   $0x1
+ 815:	56                   	push   %esi
+ 816:	6a 00                	push   $0x0
+ 818:	e8 1e 01 00 00       	call   93b <read>
+    if(cc < 1)
+ 81d:	83 c4 10             	add    $0x10,%esp
+ 820:	85 c0                	test   %eax,%eax
+ 822:	7e 1d                	jle    841 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 824:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 828:	8b 55 08             	mov    0x8(%ebp),%edx
+ 82b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 82f:	3c 0a                	cmp    $0xa,%al
+ 831:	74 10                	je     843 <gets+0x43>
+ 833:	3c 0d                	cmp    $0xd,%al
+ 835:	74 0c                	je     843 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 837:	89 df                	mov    %ebx,%edi
+ 839:	83 c3 01             	add    $0x1,%ebx
+ 83c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 83f:	7c cf                	jl     810 <gets+0x10>
+ 841:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 843:	8b 45 08             	mov    0x8(%ebp),%eax
+ 846:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 84a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 84d:	5b                   	pop    %ebx
+ 84e:	5e                   	pop    %esi
+ 84f:	5f                   	pop    %edi
+ 850:	5d                   	pop    %ebp
+ 851:	c3                   	ret
+ 852:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 859:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000860 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 860:	55                   	push   %ebp
+ 861:	89 e5                	mov    %esp,%ebp
+ 863:	56                   	push   %esi
+ 864:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 865:	83 ec 08             	sub    $0x8,%esp
+ 868:	6a 00                	push   $0x0
+ 86a:	ff 75 08             	push   0x8(%ebp)
+ 86d:	e8 f1 00 00 00       	call   963 <open>
+  if(fd < 0)
+ 872:	83 c4 10             	add    $0x10,%esp
+ 875:	85 c0                	test   %eax,%eax
+ 877:	78 27                	js     8a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 879:	83 ec 08             	sub    $0x8,%esp
+ 87c:	ff 75 0c             	push   0xc(%ebp)
+ 87f:	89 c3                	mov    %eax,%ebx
+ 881:	50                   	push   %eax
+ 882:	e8 f4 00 00 00       	call   97b <fstat>
+  close(fd);
+ 887:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 88a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 88c:	e8 ba 00 00 00       	call   94b <close>
+  return r;
+ 891:	83 c4 10             	add    $0x10,%esp
+}
+ 894:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 897:	89 f0                	mov    %esi,%eax
+ 899:	5b                   	pop    %ebx
+ 89a:	5e                   	pop    %esi
+ 89b:	5d                   	pop    %ebp
+ 89c:	c3                   	ret
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 8a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 8a5:	eb ed                	jmp    894 <stat+0x34>
+ 8a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ae:	66 90                	xchg   %ax,%ax
+
+000008b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	53                   	push   %ebx
+ 8b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 8b7:	0f be 02             	movsbl (%edx),%eax
+ 8ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 8bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 8c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 8c5:	77 1e                	ja     8e5 <atoi+0x35>
+ 8c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 8d0:	83 c2 01             	add    $0x1,%edx
+ 8d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 8d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 8da:	0f be 02             	movsbl (%edx),%eax
+ 8dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 8e0:	80 fb 09             	cmp    $0x9,%bl
+ 8e3:	76 eb                	jbe    8d0 <atoi+0x20>
+  return n;
+}
+ 8e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8e8:	89 c8                	mov    %ecx,%eax
+ 8ea:	c9                   	leave
+ 8eb:	c3                   	ret
+ 8ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	57                   	push   %edi
+ 8f4:	56                   	push   %esi
+ 8f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 8f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 8fe:	85 c0                	test   %eax,%eax
+ 900:	7e 13                	jle    915 <memmove+0x25>
+ 902:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 904:	89 d7                	mov    %edx,%edi
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 910:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 911:	39 f8                	cmp    %edi,%eax
+ 913:	75 fb                	jne    910 <memmove+0x20>
+  return vdst;
+}
+ 915:	5e                   	pop    %esi
+ 916:	89 d0                	mov    %edx,%eax
+ 918:	5f                   	pop    %edi
+ 919:	5d                   	pop    %ebp
+ 91a:	c3                   	ret
+
+0000091b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 91b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 920:	cd 40                	int    $0x40
+ 922:	c3                   	ret
+
+00000923 <exit>:
+SYSCALL(exit)
+ 923:	b8 02 00 00 00       	mov    $0x2,%eax
+ 928:	cd 40                	int    $0x40
+ 92a:	c3                   	ret
+
+0000092b <wait>:
+SYSCALL(wait)
+ 92b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 930:	cd 40                	int    $0x40
+ 932:	c3                   	ret
+
+00000933 <pipe>:
+SYSCALL(pipe)
+ 933:	b8 04 00 00 00       	mov    $0x4,%eax
+ 938:	cd 40                	int    $0x40
+ 93a:	c3                   	ret
+
+0000093b <read>:
+SYSCALL(read)
+ 93b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 940:	cd 40                	int    $0x40
+ 942:	c3                   	ret
+
+00000943 <write>:
+SYSCALL(write)
+ 943:	b8 10 00 00 00       	mov    $0x10,%eax
+ 948:	cd 40                	int    $0x40
+ 94a:	c3                   	ret
+
+0000094b <close>:
+SYSCALL(close)
+ 94b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 950:	cd 40                	int    $0x40
+ 952:	c3                   	ret
+
+00000953 <kill>:
+SYSCALL(kill)
+ 953:	b8 06 00 00 00       	mov    $0x6,%eax
+ 958:	cd 40                	int    $0x40
+ 95a:	c3                   	ret
+
+0000095b <exec>:
+SYSCALL(exec)
+ 95b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 960:	cd 40                	int    $0x40
+ 962:	c3                   	ret
+
+00000963 <open>:
+SYSCALL(open)
+ 963:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 968:	cd 40                	int    $0x40
+ 96a:	c3                   	ret
+
+0000096b <mknod>:
+SYSCALL(mknod)
+ 96b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 970:	cd 40                	int    $0x40
+ 972:	c3                   	ret
+
+00000973 <unlink>:
+SYSCALL(unlink)
+ 973:	b8 12 00 00 00       	mov    $0x12,%eax
+ 978:	cd 40                	int    $0x40
+ 97a:	c3                   	ret
+
+0000097b <fstat>:
+SYSCALL(fstat)
+ 97b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 980:	cd 40                	int    $0x40
+ 982:	c3                   	ret
+
+00000983 <link>:
+SYSCALL(link)
+ 983:	b8 13 00 00 00       	mov    $0x13,%eax
+ 988:	cd 40                	int    $0x40
+ 98a:	c3                   	ret
+
+0000098b <mkdir>:
+SYSCALL(mkdir)
+ 98b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 990:	cd 40                	int    $0x40
+ 992:	c3                   	ret
+
+00000993 <chdir>:
+SYSCALL(chdir)
+ 993:	b8 09 00 00 00       	mov    $0x9,%eax
+ 998:	cd 40                	int    $0x40
+ 99a:	c3                   	ret
+
+0000099b <dup>:
+SYSCALL(dup)
+ 99b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 9a0:	cd 40                	int    $0x40
+ 9a2:	c3                   	ret
+
+000009a3 <getpid>:
+SYSCALL(getpid)
+ 9a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 9a8:	cd 40                	int    $0x40
+ 9aa:	c3                   	ret
+
+000009ab <sbrk>:
+SYSCALL(sbrk)
+ 9ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 9b0:	cd 40                	int    $0x40
+ 9b2:	c3                   	ret
+
+000009b3 <sleep>:
+SYSCALL(sleep)
+ 9b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 9b8:	cd 40                	int    $0x40
+ 9ba:	c3                   	ret
+
+000009bb <uptime>:
+SYSCALL(uptime)
+ 9bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 9c0:	cd 40                	int    $0x40
+ 9c2:	c3                   	ret
+
+000009c3 <fsync>:
+SYSCALL(fsync)
+ 9c3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 9c8:	cd 40                	int    $0x40
+ 9ca:	c3                   	ret
+ 9cb:	66 90                	xchg   %ax,%ax
+ 9cd:	66 90                	xchg   %ax,%ax
+ 9cf:	90                   	nop
+
+000009d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+ 9d3:	57                   	push   %edi
+ 9d4:	56                   	push   %esi
+ 9d5:	53                   	push   %ebx
+ 9d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 9d8:	89 d1                	mov    %edx,%ecx
+{
+ 9da:	83 ec 3c             	sub    $0x3c,%esp
+ 9dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 9e0:	85 d2                	test   %edx,%edx
+ 9e2:	0f 89 80 00 00 00    	jns    a68 <printint+0x98>
+ 9e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 9ec:	74 7a                	je     a68 <printint+0x98>
+    x = -xx;
+ 9ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 9f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 9f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9f8:	31 f6                	xor    %esi,%esi
+ 9fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a00:	89 c8                	mov    %ecx,%eax
+ a02:	31 d2                	xor    %edx,%edx
+ a04:	89 f7                	mov    %esi,%edi
+ a06:	f7 f3                	div    %ebx
+ a08:	8d 76 01             	lea    0x1(%esi),%esi
+ a0b:	0f b6 92 b4 13 00 00 	movzbl 0x13b4(%edx),%edx
+ a12:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a16:	89 ca                	mov    %ecx,%edx
+ a18:	89 c1                	mov    %eax,%ecx
+ a1a:	39 da                	cmp    %ebx,%edx
+ a1c:	73 e2                	jae    a00 <printint+0x30>
+  if(neg)
+ a1e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a21:	85 c0                	test   %eax,%eax
+ a23:	74 07                	je     a2c <printint+0x5c>
+    buf[i++] = '-';
+ a25:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a2a:	89 f7                	mov    %esi,%edi
+ a2c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a2f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a32:	01 df                	add    %ebx,%edi
+ a34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a38:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ a3b:	83 ec 04             	sub    $0x4,%esp
+ a3e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a41:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a44:	6a 01                	push   $0x1
+ a46:	50                   	push   %eax
+ a47:	56                   	push   %esi
+ a48:	e8 f6 fe ff ff       	call   943 <write>
+  while(--i >= 0)
+ a4d:	89 f8                	mov    %edi,%eax
+ a4f:	83 c4 10             	add    $0x10,%esp
+ a52:	83 ef 01             	sub    $0x1,%edi
+ a55:	39 d8                	cmp    %ebx,%eax
+ a57:	75 df                	jne    a38 <printint+0x68>
+}
+ a59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a5c:	5b                   	pop    %ebx
+ a5d:	5e                   	pop    %esi
+ a5e:	5f                   	pop    %edi
+ a5f:	5d                   	pop    %ebp
+ a60:	c3                   	ret
+ a61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a68:	31 c0                	xor    %eax,%eax
+ a6a:	eb 89                	jmp    9f5 <printint+0x25>
+ a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a70 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a70:	55                   	push   %ebp
+ a71:	89 e5                	mov    %esp,%ebp
+ a73:	57                   	push   %edi
+ a74:	56                   	push   %esi
+ a75:	53                   	push   %ebx
+ a76:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a79:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ a7c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ a7f:	0f b6 1e             	movzbl (%esi),%ebx
+ a82:	83 c6 01             	add    $0x1,%esi
+ a85:	84 db                	test   %bl,%bl
+ a87:	74 67                	je     af0 <printf+0x80>
+ a89:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ a8c:	31 d2                	xor    %edx,%edx
+ a8e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ a91:	eb 34                	jmp    ac7 <printf+0x57>
+ a93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a97:	90                   	nop
+ a98:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ a9b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ aa0:	83 f8 25             	cmp    $0x25,%eax
+ aa3:	74 18                	je     abd <printf+0x4d>
+  write(fd, &c, 1);
+ aa5:	83 ec 04             	sub    $0x4,%esp
+ aa8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ aab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ aae:	6a 01                	push   $0x1
+ ab0:	50                   	push   %eax
+ ab1:	57                   	push   %edi
+ ab2:	e8 8c fe ff ff       	call   943 <write>
+ ab7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ aba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ abd:	0f b6 1e             	movzbl (%esi),%ebx
+ ac0:	83 c6 01             	add    $0x1,%esi
+ ac3:	84 db                	test   %bl,%bl
+ ac5:	74 29                	je     af0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ ac7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ aca:	85 d2                	test   %edx,%edx
+ acc:	74 ca                	je     a98 <printf+0x28>
+      }
+    } else if(state == '%'){
+ ace:	83 fa 25             	cmp    $0x25,%edx
+ ad1:	75 ea                	jne    abd <printf+0x4d>
+      if(c == 'd'){
+ ad3:	83 f8 25             	cmp    $0x25,%eax
+ ad6:	0f 84 24 01 00 00    	je     c00 <printf+0x190>
+ adc:	83 e8 63             	sub    $0x63,%eax
+ adf:	83 f8 15             	cmp    $0x15,%eax
+ ae2:	77 1c                	ja     b00 <printf+0x90>
+ ae4:	ff 24 85 5c 13 00 00 	jmp    *0x135c(,%eax,4)
+ aeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ af0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ af3:	5b                   	pop    %ebx
+ af4:	5e                   	pop    %esi
+ af5:	5f                   	pop    %edi
+ af6:	5d                   	pop    %ebp
+ af7:	c3                   	ret
+ af8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aff:	90                   	nop
+  write(fd, &c, 1);
+ b00:	83 ec 04             	sub    $0x4,%esp
+ b03:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b06:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ b0a:	6a 01                	push   $0x1
+ b0c:	52                   	push   %edx
+ b0d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ b10:	57                   	push   %edi
+ b11:	e8 2d fe ff ff       	call   943 <write>
+ b16:	83 c4 0c             	add    $0xc,%esp
+ b19:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b1c:	6a 01                	push   $0x1
+ b1e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ b21:	52                   	push   %edx
+ b22:	57                   	push   %edi
+ b23:	e8 1b fe ff ff       	call   943 <write>
+        putc(fd, c);
+ b28:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b2b:	31 d2                	xor    %edx,%edx
+ b2d:	eb 8e                	jmp    abd <printf+0x4d>
+ b2f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ b30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b33:	83 ec 0c             	sub    $0xc,%esp
+ b36:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b3b:	8b 13                	mov    (%ebx),%edx
+ b3d:	6a 00                	push   $0x0
+ b3f:	89 f8                	mov    %edi,%eax
+        ap++;
+ b41:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ b44:	e8 87 fe ff ff       	call   9d0 <printint>
+        ap++;
+ b49:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b4c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b4f:	31 d2                	xor    %edx,%edx
+ b51:	e9 67 ff ff ff       	jmp    abd <printf+0x4d>
+ b56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ b60:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ b63:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b65:	83 c0 04             	add    $0x4,%eax
+ b68:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ b6b:	85 db                	test   %ebx,%ebx
+ b6d:	0f 84 9d 00 00 00    	je     c10 <printf+0x1a0>
+        while(*s != 0){
+ b73:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ b76:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ b78:	84 c0                	test   %al,%al
+ b7a:	0f 84 3d ff ff ff    	je     abd <printf+0x4d>
+ b80:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b83:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ b86:	89 de                	mov    %ebx,%esi
+ b88:	89 d3                	mov    %edx,%ebx
+ b8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ b90:	83 ec 04             	sub    $0x4,%esp
+ b93:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ b96:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b99:	6a 01                	push   $0x1
+ b9b:	53                   	push   %ebx
+ b9c:	57                   	push   %edi
+ b9d:	e8 a1 fd ff ff       	call   943 <write>
+        while(*s != 0){
+ ba2:	0f b6 06             	movzbl (%esi),%eax
+ ba5:	83 c4 10             	add    $0x10,%esp
+ ba8:	84 c0                	test   %al,%al
+ baa:	75 e4                	jne    b90 <printf+0x120>
+      state = 0;
+ bac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ baf:	31 d2                	xor    %edx,%edx
+ bb1:	e9 07 ff ff ff       	jmp    abd <printf+0x4d>
+ bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ bc0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ bc3:	83 ec 0c             	sub    $0xc,%esp
+ bc6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ bcb:	8b 13                	mov    (%ebx),%edx
+ bcd:	6a 01                	push   $0x1
+ bcf:	e9 6b ff ff ff       	jmp    b3f <printf+0xcf>
+ bd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ bd8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ bdb:	83 ec 04             	sub    $0x4,%esp
+ bde:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ be1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ be3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ be6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ be9:	6a 01                	push   $0x1
+ beb:	52                   	push   %edx
+ bec:	57                   	push   %edi
+ bed:	e8 51 fd ff ff       	call   943 <write>
+        ap++;
+ bf2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ bf5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bf8:	31 d2                	xor    %edx,%edx
+ bfa:	e9 be fe ff ff       	jmp    abd <printf+0x4d>
+ bff:	90                   	nop
+  write(fd, &c, 1);
+ c00:	83 ec 04             	sub    $0x4,%esp
+ c03:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c06:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c09:	6a 01                	push   $0x1
+ c0b:	e9 11 ff ff ff       	jmp    b21 <printf+0xb1>
+ c10:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ c15:	bb 52 13 00 00       	mov    $0x1352,%ebx
+ c1a:	e9 61 ff ff ff       	jmp    b80 <printf+0x110>
+ c1f:	90                   	nop
+
+00000c20 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c20:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c21:	a1 60 19 00 00       	mov    0x1960,%eax
+{
+ c26:	89 e5                	mov    %esp,%ebp
+ c28:	57                   	push   %edi
+ c29:	56                   	push   %esi
+ c2a:	53                   	push   %ebx
+ c2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c2e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c38:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c3a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c3c:	39 ca                	cmp    %ecx,%edx
+ c3e:	73 30                	jae    c70 <free+0x50>
+ c40:	39 c1                	cmp    %eax,%ecx
+ c42:	72 04                	jb     c48 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c44:	39 c2                	cmp    %eax,%edx
+ c46:	72 f0                	jb     c38 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c48:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c4b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c4e:	39 f8                	cmp    %edi,%eax
+ c50:	74 2e                	je     c80 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c52:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c55:	8b 42 04             	mov    0x4(%edx),%eax
+ c58:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c5b:	39 f1                	cmp    %esi,%ecx
+ c5d:	74 38                	je     c97 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c5f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c61:	5b                   	pop    %ebx
+  freep = p;
+ c62:	89 15 60 19 00 00    	mov    %edx,0x1960
+}
+ c68:	5e                   	pop    %esi
+ c69:	5f                   	pop    %edi
+ c6a:	5d                   	pop    %ebp
+ c6b:	c3                   	ret
+ c6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c70:	39 c1                	cmp    %eax,%ecx
+ c72:	72 d0                	jb     c44 <free+0x24>
+ c74:	eb c2                	jmp    c38 <free+0x18>
+ c76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c7d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c80:	03 70 04             	add    0x4(%eax),%esi
+ c83:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c86:	8b 02                	mov    (%edx),%eax
+ c88:	8b 00                	mov    (%eax),%eax
+ c8a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c8d:	8b 42 04             	mov    0x4(%edx),%eax
+ c90:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c93:	39 f1                	cmp    %esi,%ecx
+ c95:	75 c8                	jne    c5f <free+0x3f>
+    p->s.size += bp->s.size;
+ c97:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c9a:	89 15 60 19 00 00    	mov    %edx,0x1960
+    p->s.size += bp->s.size;
+ ca0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ca3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ca6:	89 0a                	mov    %ecx,(%edx)
+}
+ ca8:	5b                   	pop    %ebx
+ ca9:	5e                   	pop    %esi
+ caa:	5f                   	pop    %edi
+ cab:	5d                   	pop    %ebp
+ cac:	c3                   	ret
+ cad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000cb0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ cb0:	55                   	push   %ebp
+ cb1:	89 e5                	mov    %esp,%ebp
+ cb3:	57                   	push   %edi
+ cb4:	56                   	push   %esi
+ cb5:	53                   	push   %ebx
+ cb6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ cbc:	8b 15 60 19 00 00    	mov    0x1960,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cc2:	8d 78 07             	lea    0x7(%eax),%edi
+ cc5:	c1 ef 03             	shr    $0x3,%edi
+ cc8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ ccb:	85 d2                	test   %edx,%edx
+ ccd:	0f 84 8d 00 00 00    	je     d60 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cd3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cd5:	8b 48 04             	mov    0x4(%eax),%ecx
+ cd8:	39 f9                	cmp    %edi,%ecx
+ cda:	73 64                	jae    d40 <malloc+0x90>
+  if(nu < 4096)
+ cdc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ce1:	39 df                	cmp    %ebx,%edi
+ ce3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ce6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ ced:	eb 0a                	jmp    cf9 <malloc+0x49>
+ cef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cf0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cf2:	8b 48 04             	mov    0x4(%eax),%ecx
+ cf5:	39 f9                	cmp    %edi,%ecx
+ cf7:	73 47                	jae    d40 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ cf9:	89 c2                	mov    %eax,%edx
+ cfb:	39 05 60 19 00 00    	cmp    %eax,0x1960
+ d01:	75 ed                	jne    cf0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d03:	83 ec 0c             	sub    $0xc,%esp
+ d06:	56                   	push   %esi
+ d07:	e8 9f fc ff ff       	call   9ab <sbrk>
+  if(p == (char*)-1)
+ d0c:	83 c4 10             	add    $0x10,%esp
+ d0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d12:	74 1c                	je     d30 <malloc+0x80>
+  hp->s.size = nu;
+ d14:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d17:	83 ec 0c             	sub    $0xc,%esp
+ d1a:	83 c0 08             	add    $0x8,%eax
+ d1d:	50                   	push   %eax
+ d1e:	e8 fd fe ff ff       	call   c20 <free>
+  return freep;
+ d23:	8b 15 60 19 00 00    	mov    0x1960,%edx
+      if((p = morecore(nunits)) == 0)
+ d29:	83 c4 10             	add    $0x10,%esp
+ d2c:	85 d2                	test   %edx,%edx
+ d2e:	75 c0                	jne    cf0 <malloc+0x40>
+        return 0;
+  }
+}
+ d30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d33:	31 c0                	xor    %eax,%eax
+}
+ d35:	5b                   	pop    %ebx
+ d36:	5e                   	pop    %esi
+ d37:	5f                   	pop    %edi
+ d38:	5d                   	pop    %ebp
+ d39:	c3                   	ret
+ d3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d40:	39 cf                	cmp    %ecx,%edi
+ d42:	74 4c                	je     d90 <malloc+0xe0>
+        p->s.size -= nunits;
+ d44:	29 f9                	sub    %edi,%ecx
+ d46:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d49:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d4c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d4f:	89 15 60 19 00 00    	mov    %edx,0x1960
+}
+ d55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d58:	83 c0 08             	add    $0x8,%eax
+}
+ d5b:	5b                   	pop    %ebx
+ d5c:	5e                   	pop    %esi
+ d5d:	5f                   	pop    %edi
+ d5e:	5d                   	pop    %ebp
+ d5f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d60:	c7 05 60 19 00 00 64 	movl   $0x1964,0x1960
+ d67:	19 00 00 
+    base.s.size = 0;
+ d6a:	b8 64 19 00 00       	mov    $0x1964,%eax
+    base.s.ptr = freep = prevp = &base;
+ d6f:	c7 05 64 19 00 00 64 	movl   $0x1964,0x1964
+ d76:	19 00 00 
+    base.s.size = 0;
+ d79:	c7 05 68 19 00 00 00 	movl   $0x0,0x1968
+ d80:	00 00 00 
+    if(p->s.size >= nunits){
+ d83:	e9 54 ff ff ff       	jmp    cdc <malloc+0x2c>
+ d88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d8f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d90:	8b 08                	mov    (%eax),%ecx
+ d92:	89 0a                	mov    %ecx,(%edx)
+ d94:	eb b9                	jmp    d4f <malloc+0x9f>
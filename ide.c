@@ -13,6 +13,8 @@
 #include "fs.h"
 #include "buf.h"
 
+extern struct superblock sb;  // fs.c; size is 0 until mounted
+
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
 #define IDE_DRDY      0x40
@@ -23,16 +25,41 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_READ_EXT  0x24
+#define IDE_CMD_WRITE_EXT 0x34
+#define IDE_CMD_RDMUL_EXT 0x29
+#define IDE_CMD_WRMUL_EXT 0x39
+#define IDE_CMD_SETMUL 0xc6
+
+#define IDE_MULT      16   // sectors per DRQ block (SET MULTIPLE)
+#define IDE_MAXRUN    64   // max blocks per command; 8-bit sector count
+#define SECPERBLK     (BSIZE/SECTOR_SIZE)
+#define IDE_RDEADLINE 50   // ticks a read may wait before it jumps the queue
+#define IDE_WDEADLINE 500  // same for a write
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
+// idequeue points to the run of bufs now being read/written to
+// the disk: iderun bufs, consecutive on disk, linked by qnext.
+// The first idemoved sectors of them have been through the data
+// port, idedrq at a time, and idexfer is the buf of the next one.
+// idepending holds the requests not yet started, sorted by
+// (dev, blockno) and linked by qnext; idehint is the last buf
+// inserted, where the next insert usually belongs.  idepos is
+// the block just past the last run started.
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static struct buf *idexfer;
+static int iderun;
+static int idemoved;
+static int idedrq;
+static struct buf *idepending;
+static struct buf *idehint;
+static uint idepos;
 
 static int havedisk1;
-static void idestart(struct buf*);
+static int idemult[2];  // DRQ block size set on each disk, 0 if refused
+static void idestart(void);
 
 // Wait for IDE disk to become ready.
 static int
@@ -50,7 +77,7 @@ idewait(int checkerr)
 void
 ideinit(void)
 {
-  int i;
+  int i, d;
 
   initlock(&idelock, "ide");
   ioapicenable(IRQ_IDE, ncpu - 1);
@@ -65,38 +92,141 @@ ideinit(void)
     }
   }
 
+  // Fix the DRQ block size of READ/WRITE MULTIPLE on each disk
+  // so that idestart() and ideintr() agree with the drive on it.
+  // A drive that refuses gets single-sector READ/WRITE instead.
+  outb(0x3f6, 2);  // no interrupt
+  for(d = 0; d <= havedisk1; d++){
+    outb(0x1f6, 0xe0 | (d<<4));
+    idewait(0);
+    outb(0x1f2, IDE_MULT);
+    outb(0x1f7, IDE_CMD_SETMUL);
+    if(idewait(1) >= 0)
+      idemult[d] = IDE_MULT;
+  }
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Move the next DRQ block of the active command through the
+// data port, at most idedrq sectors.  Caller must hold idelock.
 static void
-idestart(struct buf *b)
+idepio(void)
+{
+  uchar *p;
+  int i;
+
+  for(i = 0; i < idedrq && idemoved < iderun*SECPERBLK; i++, idemoved++){
+    p = idexfer->data + (idemoved % SECPERBLK) * SECTOR_SIZE;
+    if(idexfer->flags & B_DIRTY)
+      outsl(0x1f0, p, SECTOR_SIZE/4);
+    else
+      insl(0x1f0, p, SECTOR_SIZE/4);
+    if(idemoved % SECPERBLK == SECPERBLK - 1)
+      idexfer = idexfer->qnext;
+  }
+}
+
+// Choose the request the next run starts with and return the
+// link that points to it.  A request past its deadline goes
+// first, oldest first.  Otherwise reads, which have a process
+// waiting on them, go before writes, and within each direction
+// the disk sweeps upward from idepos and then wraps around to
+// the lowest block (C-LOOK).  Caller must hold idelock.
+static struct buf**
+idepick(void)
 {
-  if(b == 0)
+  struct buf **pp, **late, **low[2], **next[2], *b;
+  int w;
+
+  late = low[0] = low[1] = next[0] = next[1] = 0;
+  for(pp = &idepending; (b = *pp) != 0; pp = &b->qnext){
+    if((int)(ticks - b->deadline) >= 0 &&
+       (late == 0 || (int)(b->deadline - (*late)->deadline) < 0))
+      late = pp;
+    w = (b->flags & B_DIRTY) != 0;
+    if(low[w] == 0)
+      low[w] = pp;
+    if(next[w] == 0 && b->blockno >= idepos)
+      next[w] = pp;
+  }
+  if(late)
+    return late;
+  for(w = 0; w < 2; w++){
+    if(next[w])
+      return next[w];
+    if(low[w])
+      return low[w];
+  }
+  return 0;
+}
+
+// Cut the run that starts with the request idepick() chooses
+// out of idepending, together with the requests behind it that
+// continue it on disk, and start it as one READ/WRITE MULTIPLE
+// command.  Caller must hold idelock.
+static void
+idestart(void)
+{
+  struct buf **pp, *b, *e;
+  uint sector, nsect;
+  int n, write, mult;
+
+  if((pp = idepick()) == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
+  b = *pp;
+  write = (b->flags & B_DIRTY) != 0;
+  for(n = 1, e = b; n < IDE_MAXRUN && e->qnext != 0; n++, e = e->qnext){
+    if(e->qnext->dev != b->dev || e->qnext->blockno != e->blockno + 1 ||
+       ((e->qnext->flags & B_DIRTY) != 0) != write)
+      break;
+  }
+  if(sb.size != 0 && e->blockno >= sb.size)
     panic("incorrect blockno");
-  int sector_per_block =  BSIZE/SECTOR_SIZE;
-  int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
-
-  if (sector_per_block > 7) panic("idestart");
+  *pp = e->qnext;
+  e->qnext = 0;
+  idehint = 0;
+  idequeue = b;
+  idepos = e->blockno + 1;
+  sector = b->blockno * SECPERBLK;
+  nsect = n * SECPERBLK;
+  iderun = n;
+  idemoved = 0;
+  mult = idemult[b->dev & 1];
+  idedrq = mult ? mult : 1;
+  idexfer = b;
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
-  outb(0x1f3, sector & 0xff);
-  outb(0x1f4, (sector >> 8) & 0xff);
-  outb(0x1f5, (sector >> 16) & 0xff);
-  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
-    outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+  if(sector + nsect > 0x10000000){
+    // LBA48: high-order bytes first, then low-order.
+    outb(0x1f2, 0);
+    outb(0x1f3, (sector >> 24) & 0xff);
+    outb(0x1f4, 0);
+    outb(0x1f5, 0);
+    outb(0x1f2, nsect);
+    outb(0x1f3, sector & 0xff);
+    outb(0x1f4, (sector >> 8) & 0xff);
+    outb(0x1f5, (sector >> 16) & 0xff);
+    outb(0x1f6, 0x40 | ((b->dev&1)<<4));
+    if(mult)
+      outb(0x1f7, write ? IDE_CMD_WRMUL_EXT : IDE_CMD_RDMUL_EXT);
+    else
+      outb(0x1f7, write ? IDE_CMD_WRITE_EXT : IDE_CMD_READ_EXT);
   } else {
-    outb(0x1f7, read_cmd);
+    outb(0x1f2, nsect);  // number of sectors
+    outb(0x1f3, sector & 0xff);
+    outb(0x1f4, (sector >> 8) & 0xff);
+    outb(0x1f5, (sector >> 16) & 0xff);
+    outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+    if(mult)
+      outb(0x1f7, write ? IDE_CMD_WRMUL : IDE_CMD_RDMUL);
+    else
+      outb(0x1f7, write ? IDE_CMD_WRITE : IDE_CMD_READ);
   }
+  if(write)
+    idepio();
 }
 
 // Interrupt handler.
@@ -108,61 +238,159 @@ ideintr(void)
   // First queued buffer is the active request.
   acquire(&idelock);
 
-  if((b = idequeue) == 0){
+  if(idequeue == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  // The drive interrupts once per DRQ block: when a read block
+  // is ready, and when a written block has been taken.  Keep
+  // moving data until the whole run is through.
+  if(idequeue->flags & B_DIRTY){
+    if(idemoved < iderun*SECPERBLK){
+      idewait(0);
+      idepio();
+      release(&idelock);
+      return;
+    }
+  } else if(idewait(1) >= 0){
+    idepio();
+    if(idemoved < iderun*SECPERBLK){
+      release(&idelock);
+      return;
+    }
+  }
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  // Wake processes waiting for the bufs of the run.
+  for(; iderun > 0; iderun--){
+    b = idequeue;
+    idequeue = b->qnext;
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    wakeup(b);
+  }
 
-  // Start disk on next buf in queue.
-  if(idequeue != 0)
-    idestart(idequeue);
+  // Start disk on next request.
+  if(idepending != 0)
+    idestart();
 
   release(&idelock);
 }
 
 //PAGEBREAK!
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
-void
-iderw(struct buf *b)
+// Does a sort before b in idepending?
+static int
+idebefore(struct buf *a, struct buf *b)
 {
-  struct buf **pp;
+  return a->dev < b->dev || (a->dev == b->dev && a->blockno < b->blockno);
+}
 
-  if(!holdingsleep(&b->lock))
-    panic("iderw: buf not locked");
-  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
-    panic("iderw: nothing to do");
-  if(b->dev != 0 && !havedisk1)
-    panic("iderw: ide disk 1 not present");
+// A read of a block that is still queued or being written would
+// race the write, since requests are reordered: copy the newest
+// such write instead.  Return 1 if b was filled that way.
+static int
+idereadwrite(struct buf *b)
+{
+  struct buf *w, *last;
+  int i;
 
-  acquire(&idelock);  //DOC:acquire-lock
+  last = 0;
+  for(w = idequeue, i = 0; i < iderun; w = w->qnext, i++)
+    if(w->dev == b->dev && w->blockno == b->blockno)
+      last = w;
+  for(w = idepending; w != 0 && !idebefore(b, w); w = w->qnext)
+    if(w->dev == b->dev && w->blockno == b->blockno && (w->flags & B_DIRTY))
+      last = w;
+  if(last == 0 || !(last->flags & B_DIRTY))
+    return 0;
+  memmove(b->data, last->data, BSIZE);
+  b->flags |= B_VALID;
+  return 1;
+}
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+// Insert b into idepending after any requests for the same
+// block, so that writes of one block reach the disk in order.
+// A run of consecutive blocks submitted together is inserted
+// in constant time per buf.
+static void
+ideinsert(struct buf *b)
+{
+  struct buf **pp;
+
+  b->deadline = ticks + ((b->flags & B_DIRTY) ? IDE_WDEADLINE : IDE_RDEADLINE);
+  pp = &idepending;
+  if(idehint != 0 && !idebefore(b, idehint))
+    pp = &idehint->qnext;
+  for(; *pp != 0 && !idebefore(b, *pp); pp = &(*pp)->qnext)  //DOC:insert-queue
     ;
+  b->qnext = *pp;
   *pp = b;
+  idehint = b;
+}
+
+// Queue the n bufs of bv for the disk and return without waiting
+// for them.  If B_DIRTY is set a buf is written, else it is read.
+// Requests are served in elevator order, and bufs that are
+// consecutive on disk, whether queued together or not, go out as
+// one multi-sector command.  ideintr() clears B_DIRTY, sets
+// B_VALID and wakes up each buf when done; use idesync() to wait
+// for that.  The caller must not touch b->data until the request
+// has finished.
+void
+idesubmitv(struct buf **bv, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    if((bv[i]->flags & (B_VALID|B_DIRTY)) == B_VALID)
+      panic("idesubmit: nothing to do");
+    if(bv[i]->dev != 0 && !havedisk1)
+      panic("idesubmit: ide disk 1 not present");
+  }
+
+  acquire(&idelock);  //DOC:acquire-lock
+
+  for(i = 0; i < n; i++){
+    if(!(bv[i]->flags & B_DIRTY) && idereadwrite(bv[i]))
+      continue;
+    ideinsert(bv[i]);
+  }
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  if(idequeue == 0 && idepending != 0)
+    idestart();
+
+  release(&idelock);
+}
+
+void
+idesubmit(struct buf *b)
+{
+  idesubmitv(&b, 1);
+}
 
-  // Wait for request to finish.
+// Wait for a request queued by idesubmit() to finish.
+void
+idesync(struct buf *b)
+{
+  acquire(&idelock);
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
     sleep(b, &idelock);
   }
+  release(&idelock);
+}
 
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+    panic("iderw: nothing to do");
 
-  release(&idelock);
+  idesubmit(b);
+  idesync(b);
 }
@@ -23,8 +23,8 @@ struct superblock sb;
 struct checkpoint cp;
 char zeroes[BSIZE];
 
-// In-memory imap (uses IMAP_ENCODE format: block << 3 | slot)
-uint imap[LFS_NINODES];
+// In-memory imap, host byte order
+struct imap_entry imap[LFS_MAXINODES];
 uint freeinode = 1;  // next free inode number (0 is reserved)
 uint log_tail;       // current position in log
 
@@ -38,6 +38,12 @@ struct ssb_entry ssb_buf[SSB_ENTRIES_PER_BLOCK];
 int ssb_count = 0;
 uint ssb_seg_start;  // Start of current segment
 
+// Root directory entries, written out in one go by writeroot()
+#define MAXROOTENT 1024
+struct dirent rootents[MAXROOTENT];
+int nrootents = 0;
+int hashroot = 0;    // -h: use the hashed directory layout
+
 void wsect(uint, void*);
 void rsect(uint sec, void *buf);
 uint lfs_alloc_with_ssb(uchar type, uint inum, uint offset, uint version);
@@ -49,6 +55,8 @@ void lfs_write_imap(void);
 void lfs_write_checkpoint(void);
 uint ialloc(ushort type);
 void iappend(uint inum, void *p, int n);
+void rootlink(char *name, uint inum);
+int writeroot(uint rootino);
 
 // convert to intel byte order
 ushort
@@ -77,19 +85,25 @@ int
 main(int argc, char *argv[])
 {
   int i, cc, fd;
-  uint rootino, inum, off;
-  struct dirent de;
+  uint rootino, inum;
   char buf[BSIZE];
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
+  if(argc > 1 && strcmp(argv[1], "-h") == 0){
+    hashroot = 1;
+    argc--;
+    argv++;
+  }
+
   if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+    fprintf(stderr, "Usage: mkfs [-h] fs.img files...\n");
     exit(1);
   }
 
   assert((BSIZE % sizeof(struct dinode)) == 0);
   assert((BSIZE % sizeof(struct dirent)) == 0);
+  assert((FSSIZE - LFS_SEGSTART) / LFS_SEGSIZE <= LFS_NSEGS_MAX);
 
   fsfd = open(argv[1], O_RDWR|O_CREAT|O_TRUNC, 0666);
   if(fsfd < 0){
@@ -103,13 +117,13 @@ main(int argc, char *argv[])
   sb.nsegs = xint((FSSIZE - LFS_SEGSTART) / LFS_SEGSIZE);
   sb.segsize = xint(LFS_SEGSIZE);
   sb.segstart = xint(LFS_SEGSTART);
-  sb.ninodes = xint(LFS_NINODES);
+  sb.ninodes = xint(LFS_MAXINODES);
   sb.checkpoint0 = xint(2);  // block 2
   sb.checkpoint1 = xint(3);  // block 3
 
   printf("LFS: size %d, nsegs %d, segsize %d, segstart %d, ninodes %d\n",
          FSSIZE, (FSSIZE - LFS_SEGSTART) / LFS_SEGSIZE, LFS_SEGSIZE,
-         LFS_SEGSTART, LFS_NINODES);
+         LFS_SEGSTART, (int)LFS_MAXINODES);
 
   // Initialize log tail to start of log area
   log_tail = LFS_SEGSTART;
@@ -131,17 +145,8 @@ main(int argc, char *argv[])
   rootino = ialloc(T_DIR);
   assert(rootino == ROOTINO);
 
-  // Add "." entry
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, ".");
-  iappend(rootino, &de, sizeof(de));
-
-  // Add ".." entry
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, "..");
-  iappend(rootino, &de, sizeof(de));
+  rootlink(".", rootino);
+  rootlink("..", rootino);
 
   // Add files from command line
   for(i = 2; i < argc; i++){
@@ -157,11 +162,7 @@ main(int argc, char *argv[])
       ++argv[i];
 
     inum = ialloc(T_FILE);
-
-    bzero(&de, sizeof(de));
-    de.inum = xshort(inum);
-    strncpy(de.name, argv[i], DIRSIZ);
-    iappend(rootino, &de, sizeof(de));
+    rootlink(argv[i], inum);
 
     while((cc = read(fd, buf, sizeof(buf))) > 0)
       iappend(inum, buf, cc);
@@ -169,8 +170,8 @@ main(int argc, char *argv[])
     close(fd);
   }
 
-  // Fix size of root inode dir to be block aligned
-  {
+  // Write the root directory and mark it if it came out hashed
+  if(writeroot(rootino)){
     struct dinode din;
     int i, found = 0;
 
@@ -184,10 +185,10 @@ main(int argc, char *argv[])
     }
 
     if(!found){
-      // Read from disk using IMAP_BLOCK/IMAP_SLOT
+      // Read from disk using the imap block and slot
       char ibuf[BSIZE];
       struct dinode *dip;
-      uint block = IMAP_BLOCK(imap[rootino]);
+      uint block = imap[rootino].block;
       uint slot = IMAP_SLOT(imap[rootino]);
 
       rsect(block, ibuf);
@@ -195,9 +196,7 @@ main(int argc, char *argv[])
       memmove(&din, dip, sizeof(din));
     }
 
-    off = xint(din.size);
-    off = ((off/BSIZE) + 1) * BSIZE;
-    din.size = xint(off);
+    din.major = xshort(DIR_HASHED);
 
     // Write back via lfs_write_inode (handles buffer)
     lfs_write_inode(rootino, &din);
@@ -282,6 +281,7 @@ lfs_flush_ssb_with_next(uint next_seg_addr)
   // Copy entries first (convert to little-endian / disk format)
   for(int i = 0; i < ssb_count; i++){
     ssb_ptr->entries[i].type = ssb_buf[i].type;
+    ssb_ptr->entries[i].slot = ssb_buf[i].slot;
     ssb_ptr->entries[i].inum = xint(ssb_buf[i].inum);
     ssb_ptr->entries[i].offset = xint(ssb_buf[i].offset);
     ssb_ptr->entries[i].version = xint(ssb_buf[i].version);
@@ -321,6 +321,7 @@ lfs_alloc_with_ssb(uchar type, uint inum, uint offset, uint version)
   // Add SSB entry if type is specified
   if(type != 0){
     ssb_buf[ssb_count].type = type;
+    ssb_buf[ssb_count].slot = (block - LFS_SEGSTART) % LFS_SEGSIZE;
     ssb_buf[ssb_count].inum = inum;
     ssb_buf[ssb_count].offset = offset;
     ssb_buf[ssb_count].version = version;
@@ -356,9 +357,9 @@ lfs_flush_inodes(void)
   dip = (struct dinode*)buf;
   for(i = 0; i < dirty_count; i++){
     memmove(&dip[i], &dirty_inodes[i], sizeof(struct dinode));
-    // Update imap with encoded value (block << 12 | version << 4 | slot)
     // version starts at 0 for newly created inodes
-    imap[dirty_inums[i]] = IMAP_ENCODE(block, 0, i);
+    imap[dirty_inums[i]].block = block;
+    imap[dirty_inums[i]].vslot = IMAP_VSLOT(0, i);
   }
   wsect(block, buf);
 
@@ -390,27 +391,36 @@ lfs_write_inode(uint inum, struct dinode *dip)
   dirty_count++;
 }
 
-// Write imap blocks to the log
+// Write imap blocks to the log, then the index blocks naming them
 void
 lfs_write_imap(void)
 {
-  char buf[BSIZE];
-  uint nblocks = (LFS_NINODES + IMAP_ENTRIES_PER_BLOCK - 1) / IMAP_ENTRIES_PER_BLOCK;
+  struct imap_entry buf[IMAP_ENTRIES_PER_BLOCK];
+  uint ind[NIMAP_IND][IMAP_ADDRS_PER_IND];
+  // Only as many blocks as the inodes allocated so far need; the
+  // kernel grows the map from there.
+  uint nblocks = (freeinode + IMAP_ENTRIES_PER_BLOCK - 1) / IMAP_ENTRIES_PER_BLOCK;
   uint i, j;
 
   cp.imap_nblocks = xint(nblocks);
+  memset(ind, 0, sizeof(ind));
 
-  for(i = 0; i < nblocks && i < NIMAP_BLOCKS; i++){
+  for(i = 0; i < nblocks; i++){
     uint block = lfs_alloc();
-    cp.imap_addrs[i] = xint(block);
+    ind[i / IMAP_ADDRS_PER_IND][i % IMAP_ADDRS_PER_IND] = xint(block);
 
-    memset(buf, 0, BSIZE);
-    uint *p = (uint*)buf;
-    for(j = 0; j < IMAP_ENTRIES_PER_BLOCK && (i * IMAP_ENTRIES_PER_BLOCK + j) < LFS_NINODES; j++){
-      p[j] = xint(imap[i * IMAP_ENTRIES_PER_BLOCK + j]);
+    for(j = 0; j < IMAP_ENTRIES_PER_BLOCK; j++){
+      buf[j].block = xint(imap[i * IMAP_ENTRIES_PER_BLOCK + j].block);
+      buf[j].vslot = xint(imap[i * IMAP_ENTRIES_PER_BLOCK + j].vslot);
     }
     wsect(block, buf);
   }
+
+  for(i = 0; i * IMAP_ADDRS_PER_IND < nblocks; i++){
+    uint block = lfs_alloc();
+    cp.imap_ind[i] = xint(block);
+    wsect(block, ind[i]);
+  }
 }
 
 // Write checkpoint to fixed location with header/footer timestamps
@@ -471,7 +481,7 @@ ialloc(ushort type)
   uint inum = freeinode++;
   struct dinode din;
 
-  if(inum >= LFS_NINODES){
+  if(inum >= LFS_MAXINODES){
     fprintf(stderr, "ialloc: no inodes\n");
     exit(1);
   }
@@ -497,8 +507,8 @@ iappend(uint inum, void *xp, int n)
   struct dinode din;
   char buf[BSIZE];
   char ibuf[BSIZE];
-  uint indirect[NINDIRECT];
-  uint x;
+  uint indirect[NINDIRECT], indirect2[NINDIRECT];
+  uint x, l2, l2key;
   int i, found = 0;
 
   // Read current inode - first check dirty buffer
@@ -511,8 +521,8 @@ iappend(uint inum, void *xp, int n)
   }
 
   if(!found){
-    // Read from disk using IMAP_BLOCK/IMAP_SLOT
-    uint block = IMAP_BLOCK(imap[inum]);
+    // Read from disk using the imap block and slot
+    uint block = imap[inum].block;
     uint slot = IMAP_SLOT(imap[inum]);
     struct dinode *dip;
 
@@ -533,7 +543,7 @@ iappend(uint inum, void *xp, int n)
         din.addrs[fbn] = xint(lfs_alloc_with_ssb(SSB_TYPE_DATA, inum, fbn, 0));
       }
       x = xint(din.addrs[fbn]);
-    } else {
+    } else if(fbn < NDIRECT + NINDIRECT){
       if(xint(din.addrs[NDIRECT]) == 0){
         // Allocate indirect block with SSB entry
         din.addrs[NDIRECT] = xint(lfs_alloc_with_ssb(SSB_TYPE_INDIRECT, inum, NDIRECT, 0));
@@ -548,6 +558,30 @@ iappend(uint inum, void *xp, int n)
         wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
       }
       x = xint(indirect[fbn-NDIRECT]);
+    } else {
+      // Double indirect: the second-level block is named in its SSB
+      // entry by the first file block it maps
+      l2 = (fbn - NDIRECT - NINDIRECT) / NINDIRECT;
+      l2key = NDIRECT + NINDIRECT + l2 * NINDIRECT;
+      if(xint(din.addrs[NDIRECT+1]) == 0){
+        din.addrs[NDIRECT+1] = xint(lfs_alloc_with_ssb(SSB_TYPE_DINDIRECT, inum, NDIRECT+1, 0));
+        memset(indirect, 0, sizeof(indirect));
+        wsect(xint(din.addrs[NDIRECT+1]), indirect);
+      }
+      rsect(xint(din.addrs[NDIRECT+1]), (char*)indirect);
+      if(indirect[l2] == 0){
+        indirect[l2] = xint(lfs_alloc_with_ssb(SSB_TYPE_INDIRECT, inum, l2key, 0));
+        wsect(xint(din.addrs[NDIRECT+1]), (char*)indirect);
+        memset(indirect2, 0, sizeof(indirect2));
+        wsect(xint(indirect[l2]), indirect2);
+      }
+      x = xint(indirect[l2]);
+      rsect(x, (char*)indirect2);
+      if(indirect2[fbn - l2key] == 0){
+        indirect2[fbn - l2key] = xint(lfs_alloc_with_ssb(SSB_TYPE_DATA, inum, fbn, 0));
+        wsect(x, (char*)indirect2);
+      }
+      x = xint(indirect2[fbn - l2key]);
     }
 
     n1 = min(n, (fbn + 1) * BSIZE - off);
@@ -564,3 +598,76 @@ iappend(uint inum, void *xp, int n)
   // Write updated inode back to a new location in log
   lfs_write_inode(inum, &din);
 }
+
+// Name hash for hashed directories; must match dirhash() in fs.c.
+uint
+dirhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261U;
+  for(i = 0; i < DIRSIZ && name[i]; i++){
+    h ^= (uchar)name[i];
+    h *= 16777619;
+  }
+  return h;
+}
+
+// Queue a root directory entry for writeroot().
+void
+rootlink(char *name, uint inum)
+{
+  struct dirent *de;
+
+  if(nrootents >= MAXROOTENT){
+    fprintf(stderr, "rootlink: too many entries\n");
+    exit(1);
+  }
+  de = &rootents[nrootents++];
+  bzero(de, sizeof(*de));
+  de->inum = xshort(inum);
+  strncpy(de->name, name, DIRSIZ);
+}
+
+// Append the queued entries to the root directory, block aligned.
+// Uses the hashed layout if asked to with -h, or if the kernel would
+// have converted a directory this big.  Returns 1 if hashed.
+int
+writeroot(uint rootino)
+{
+  static char dir[(NDIRBUCKET + MAXROOTENT/(DPB-1) + 1) * BSIZE];
+  struct dirent *blk;
+  uint tail[NDIRBUCKET], b, nb, nblocks;
+  int i, j;
+
+  bzero(dir, sizeof(dir));
+  if(!hashroot && nrootents <= DIRHASH_MIN*DPB){
+    memmove(dir, rootents, nrootents * sizeof(struct dirent));
+    nblocks = (nrootents * sizeof(struct dirent) + BSIZE - 1) / BSIZE;
+    iappend(rootino, dir, nblocks * BSIZE);
+    return 0;
+  }
+
+  for(b = 0; b < NDIRBUCKET; b++)
+    tail[b] = b;
+  nblocks = NDIRBUCKET;
+  for(i = 0; i < nrootents; i++){
+    b = dirhash(rootents[i].name) % NDIRBUCKET;
+    blk = (struct dirent*)(dir + tail[b]*BSIZE);
+    for(j = 0; j < DPB-1 && blk[j].inum != 0; j++)
+      ;
+    if(j == DPB-1){
+      // Bucket chain full: link in an overflow block
+      nb = nblocks++;
+      tail[b] = nb;
+      nb = xint(nb);
+      memmove(blk[DPB-1].name, &nb, sizeof(nb));
+      blk = (struct dirent*)(dir + tail[b]*BSIZE);
+      j = 0;
+    }
+    blk[j] = rootents[i];
+  }
+  iappend(rootino, dir, nblocks * BSIZE);
+  return 1;
+}
@@ -3,22 +3,29 @@
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define BCACHEPCT    25  // % of free memory for the disk block cache
+#define ICACHEPCT     1  // % of free memory for the inode cache
+#define NDENTRY     256  // cached directory lookups
 #define FSSIZE       20000  // size of file system in blocks (increased for LFS overhead)
 
 // LFS parameters
-#define LFS_NINODES   200  // maximum number of inodes in LFS
 #define LFS_SEGSIZE   32   // segment size in blocks (reduced to fit SSB)
 #define LFS_SEGSTART  4    // first segment starts at block 4 (after boot, sb, cp0, cp1)
+#define LFS_NDIRTYIND 32   // indirect blocks kept dirty in memory until inode flush
+#define LFS_NDIRTYDATA 64  // most file data blocks cached dirty until inode flush
+#define LFS_NDIRTYINODE 128 // inodes staged in memory before a flush (8 inode blocks)
 
 // GC parameters
 #define GC_THRESHOLD      30   // GC trigger threshold (disk usage %) - trigger early
 #define GC_TARGET_SEGS    8    // Number of segments to clean per GC run
 #define GC_UTIL_THRESHOLD 95   // Max utilization to consider for cleaning (%)
+#define GC_LOWAT          8    // wake the cleaner below this many free segments
+#define GC_HIWAT          16   // the cleaner stops at this many free segments
+#define GC_CRITICAL       4    // writers clean inline below this many
+#define GC_IDLE_TICKS     10   // log idle this long lets the cleaner run above GC_LOWAT
 
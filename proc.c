@@ -16,6 +16,7 @@ static struct proc *initproc;
 
 int nextpid = 1;
 extern void forkret(void);
+extern void kforkret(void);
 extern void trapret(void);
 
 static void wakeup1(void *chan);
@@ -153,6 +154,31 @@ userinit(void)
   release(&ptable.lock);
 }
 
+// Start a kernel process that runs fn, which must never return.
+// It has no user memory and never leaves the kernel.
+void
+kproc(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0)
+    panic("kproc");
+  if((p->pgdir = setupkvm()) == 0)
+    panic("kproc: out of memory?");
+
+  // Start at kforkret, which returns to fn instead of trapret.
+  *(uint*)(p->context + 1) = (uint)fn;
+  p->context->eip = (uint)kforkret;
+
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+
+  p->state = RUNNABLE;
+
+  release(&ptable.lock);
+}
+
 // Grow current process's memory by n bytes.
 // Return 0 on success, -1 on failure.
 int
@@ -412,6 +438,15 @@ forkret(void)
   // Return to "caller", actually trapret (see allocproc).
 }
 
+// A kernel process's very first scheduling by scheduler()
+// will swtch here.  "Return" to its function (see kproc).
+void
+kforkret(void)
+{
+  // Still holding ptable.lock from scheduler.
+  release(&ptable.lock);
+}
+
 // Atomically release lock and sleep on chan.
 // Reacquires lock when awakened.
 void
@@ -114,6 +114,19 @@ sys_fstat(void)
   return filestat(f, st);
 }
 
+// Write the file's cached data and inode to the log and checkpoint.
+// LFS has one log, so this syncs the whole file system.
+int
+sys_fsync(void)
+{
+  struct file *f;
+
+  if(argfd(0, 0, &f) < 0 || f->type != FD_INODE)
+    return -1;
+  lfs_fsync();
+  return 0;
+}
+
 // Create the path new as a link to the same inode as old.
 int
 sys_link(void)
@@ -165,17 +178,23 @@ bad:
 }
 
 // Is the directory dp empty except for "." and ".." ?
+// A hashed directory keeps the dots in their buckets, not up front.
 static int
 isdirempty(struct inode *dp)
 {
   int off;
   struct dirent de;
 
-  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+  off = dp->major == DIR_HASHED ? 0 : 2*sizeof(de);
+  for(; off<dp->size; off+=sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("isdirempty: readi");
-    if(de.inum != 0)
-      return 0;
+    if(de.inum == 0)
+      continue;
+    if(dp->major == DIR_HASHED &&
+       (namecmp(de.name, ".") == 0 || namecmp(de.name, "..") == 0))
+      continue;
+    return 0;
   }
   return 1;
 }
@@ -218,6 +237,7 @@ sys_unlink(void)
   memset(&de, 0, sizeof(de));
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("unlink: writei");
+  dcache_invalidate(dp, name);
   if(ip->type == T_DIR){
     dp->nlink--;
     iupdate(dp);
@@ -257,7 +277,7 @@ create(char *path, short type, short major, short minor)
     return 0;
   }
 
-  if((ip = ialloc(dp->dev, type)) == 0)
+  if((ip = ialloc(dp->dev, type, dp->inum)) == 0)
     panic("create: ialloc");
 
   ilock(ip);
@@ -110,8 +110,11 @@ trap(struct trapframe *tf)
      tf->trapno == T_IRQ0+IRQ_TIMER)
     yield();
 
-  // LFS: Periodic sync (safe to call here, before returning to user mode)
-  if(myproc() && cpuid() == 0 && ticks - last_sync_tick >= LFS_SYNC_INTERVAL){
+  // LFS: Periodic sync.  Only when interrupting user code: a process
+  // trapped in the kernel may hold sleep-locks (buffers, the segment
+  // writer) that lfs_sync() would need.
+  if(myproc() && cpuid() == 0 && (tf->cs&3) == DPL_USER &&
+     ticks - last_sync_tick >= LFS_SYNC_INTERVAL){
     last_sync_tick = ticks;
     lfs_sync();
   }
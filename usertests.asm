@@ -0,0 +1,7559 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 e7 58 00 00       	push   $0x58e7
+      16:	6a 01                	push   $0x1
+      18:	e8 83 43 00 00       	call   43a0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 fb 58 00 00       	push   $0x58fb
+      26:	e8 68 42 00 00       	call   4293 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 c4 61 00 00       	push   $0x61c4
+      39:	6a 01                	push   $0x1
+      3b:	e8 60 43 00 00       	call   43a0 <printf>
+    exit();
+      40:	e8 0e 42 00 00       	call   4253 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 fb 58 00 00       	push   $0x58fb
+      51:	e8 3d 42 00 00       	call   4293 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 1d 42 00 00       	call   427b <close>
+
+  argptest();
+      5e:	e8 1d 3f 00 00       	call   3f80 <argptest>
+  createdelete();
+      63:	e8 78 14 00 00       	call   14e0 <createdelete>
+  linkunlink();
+      68:	e8 13 1d 00 00       	call   1d80 <linkunlink>
+  concreate();
+      6d:	e8 0e 1a 00 00       	call   1a80 <concreate>
+  fourfiles();
+      72:	e8 69 12 00 00       	call   12e0 <fourfiles>
+  sharedfd();
+      77:	e8 a4 10 00 00       	call   1120 <sharedfd>
+
+  bigargtest();
+      7c:	e8 cf 3b 00 00       	call   3c50 <bigargtest>
+  bigwrite();
+      81:	e8 1a 2b 00 00       	call   2ba0 <bigwrite>
+  fsynctest();
+      86:	e8 f5 2b 00 00       	call   2c80 <fsynctest>
+  bigargtest();
+      8b:	e8 c0 3b 00 00       	call   3c50 <bigargtest>
+  bsstest();
+      90:	e8 4b 3b 00 00       	call   3be0 <bsstest>
+  sbrktest();
+      95:	e8 46 36 00 00       	call   36e0 <sbrktest>
+  validatetest();
+      9a:	e8 91 3a 00 00       	call   3b30 <validatetest>
+
+  opentest();
+      9f:	e8 6c 03 00 00       	call   410 <opentest>
+  writetest();
+      a4:	e8 f7 03 00 00       	call   4a0 <writetest>
+  writetest1();
+      a9:	e8 d2 05 00 00       	call   680 <writetest1>
+  createtest();
+      ae:	e8 8d 07 00 00       	call   840 <createtest>
+  manyinodes();
+      b3:	e8 38 08 00 00       	call   8f0 <manyinodes>
+
+  openiputtest();
+      b8:	e8 53 02 00 00       	call   310 <openiputtest>
+  exitiputtest();
+      bd:	e8 4e 01 00 00       	call   210 <exitiputtest>
+  iputtest();
+      c2:	e8 69 00 00 00       	call   130 <iputtest>
+
+  mem();
+      c7:	e8 84 0f 00 00       	call   1050 <mem>
+  pipe1();
+      cc:	e8 ff 0b 00 00       	call   cd0 <pipe1>
+  preempt();
+      d1:	e8 9a 0d 00 00       	call   e70 <preempt>
+  exitwait();
+      d6:	e8 f5 0e 00 00       	call   fd0 <exitwait>
+
+  rmdot();
+      db:	e8 b0 30 00 00       	call   3190 <rmdot>
+  fourteen();
+      e0:	e8 6b 2f 00 00       	call   3050 <fourteen>
+  bigfile();
+      e5:	e8 96 2d 00 00       	call   2e80 <bigfile>
+  subdir();
+      ea:	e8 d1 23 00 00       	call   24c0 <subdir>
+  dcachetest();
+      ef:	e8 cc 1e 00 00       	call   1fc0 <dcachetest>
+  dcachefill();
+      f4:	e8 07 21 00 00       	call   2200 <dcachefill>
+  linktest();
+      f9:	e8 72 17 00 00       	call   1870 <linktest>
+  unlinkread();
+      fe:	e8 dd 15 00 00       	call   16e0 <unlinkread>
+  dirfile();
+     103:	e8 08 32 00 00       	call   3310 <dirfile>
+  iref();
+     108:	e8 03 34 00 00       	call   3510 <iref>
+  forktest();
+     10d:	e8 1e 35 00 00       	call   3630 <forktest>
+  bigdir(); // slow
+     112:	e8 79 1d 00 00       	call   1e90 <bigdir>
+
+  uio();
+     117:	e8 f4 3d 00 00       	call   3f10 <uio>
+
+  exectest();
+     11c:	e8 5f 0b 00 00       	call   c80 <exectest>
+
+  exit();
+     121:	e8 2d 41 00 00       	call   4253 <exit>
+     126:	66 90                	xchg   %ax,%ax
+     128:	66 90                	xchg   %ax,%ax
+     12a:	66 90                	xchg   %ax,%ax
+     12c:	66 90                	xchg   %ax,%ax
+     12e:	66 90                	xchg   %ax,%ax
+
+00000130 <iputtest>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     136:	68 5a 47 00 00       	push   $0x475a
+     13b:	ff 35 e8 6b 00 00    	push   0x6be8
+     141:	e8 5a 42 00 00       	call   43a0 <printf>
+  if(mkdir("iputdir") < 0){
+     146:	c7 04 24 ef 46 00 00 	movl   $0x46ef,(%esp)
+     14d:	e8 69 41 00 00       	call   42bb <mkdir>
+     152:	83 c4 10             	add    $0x10,%esp
+     155:	85 c0                	test   %eax,%eax
+     157:	78 58                	js     1b1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     159:	83 ec 0c             	sub    $0xc,%esp
+     15c:	68 ef 46 00 00       	push   $0x46ef
+     161:	e8 5d 41 00 00       	call   42c3 <chdir>
+     166:	83 c4 10             	add    $0x10,%esp
+     169:	85 c0                	test   %eax,%eax
+     16b:	0f 88 85 00 00 00    	js     1f6 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     171:	83 ec 0c             	sub    $0xc,%esp
+     174:	68 ec 46 00 00       	push   $0x46ec
+     179:	e8 25 41 00 00       	call   42a3 <unlink>
+     17e:	83 c4 10             	add    $0x10,%esp
+     181:	85 c0                	test   %eax,%eax
+     183:	78 5a                	js     1df <iputtest+0xaf>
+  if(chdir("/") < 0){
+     185:	83 ec 0c             	sub    $0xc,%esp
+     188:	68 87 4f 00 00       	push   $0x4f87
+     18d:	e8 31 41 00 00       	call   42c3 <chdir>
+     192:	83 c4 10             	add    $0x10,%esp
+     195:	85 c0                	test   %eax,%eax
+     197:	78 2f                	js     1c8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     199:	83 ec 08             	sub    $0x8,%esp
+     19c:	68 92 47 00 00       	push   $0x4792
+     1a1:	ff 35 e8 6b 00 00    	push   0x6be8
+     1a7:	e8 f4 41 00 00       	call   43a0 <printf>
+}
+     1ac:	83 c4 10             	add    $0x10,%esp
+     1af:	c9                   	leave
+     1b0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1b1:	50                   	push   %eax
+     1b2:	50                   	push   %eax
+     1b3:	68 c8 46 00 00       	push   $0x46c8
+     1b8:	ff 35 e8 6b 00 00    	push   0x6be8
+     1be:	e8 dd 41 00 00       	call   43a0 <printf>
+    exit();
+     1c3:	e8 8b 40 00 00       	call   4253 <exit>
+    printf(stdout, "chdir / failed\n");
+     1c8:	50                   	push   %eax
+     1c9:	50                   	push   %eax
+     1ca:	68 11 47 00 00       	push   $0x4711
+     1cf:	ff 35 e8 6b 00 00    	push   0x6be8
+     1d5:	e8 c6 41 00 00       	call   43a0 <printf>
+    exit();
+     1da:	e8 74 40 00 00       	call   4253 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     1df:	52                   	push   %edx
+     1e0:	52                   	push   %edx
+     1e1:	68 f7 46 00 00       	push   $0x46f7
+     1e6:	ff 35 e8 6b 00 00    	push   0x6be8
+     1ec:	e8 af 41 00 00       	call   43a0 <printf>
+    exit();
+     1f1:	e8 5d 40 00 00       	call   4253 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     1f6:	51                   	push   %ecx
+     1f7:	51                   	push   %ecx
+     1f8:	68 d6 46 00 00       	push   $0x46d6
+     1fd:	ff 35 e8 6b 00 00    	push   0x6be8
+     203:	e8 98 41 00 00       	call   43a0 <printf>
+    exit();
+     208:	e8 46 40 00 00       	call   4253 <exit>
+     20d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000210 <exitiputtest>:
+{
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+     213:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     216:	68 21 47 00 00       	push   $0x4721
+     21b:	ff 35 e8 6b 00 00    	push   0x6be8
+     221:	e8 7a 41 00 00       	call   43a0 <printf>
+  pid = fork();
+     226:	e8 20 40 00 00       	call   424b <fork>
+  if(pid < 0){
+     22b:	83 c4 10             	add    $0x10,%esp
+     22e:	85 c0                	test   %eax,%eax
+     230:	0f 88 8a 00 00 00    	js     2c0 <exitiputtest+0xb0>
+  if(pid == 0){
+     236:	75 50                	jne    288 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     238:	83 ec 0c             	sub    $0xc,%esp
+     23b:	68 ef 46 00 00       	push   $0x46ef
+     240:	e8 76 40 00 00       	call   42bb <mkdir>
+     245:	83 c4 10             	add    $0x10,%esp
+     248:	85 c0                	test   %eax,%eax
+     24a:	0f 88 87 00 00 00    	js     2d7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     250:	83 ec 0c             	sub    $0xc,%esp
+     253:	68 ef 46 00 00       	push   $0x46ef
+     258:	e8 66 40 00 00       	call   42c3 <chdir>
+     25d:	83 c4 10             	add    $0x10,%esp
+     260:	85 c0                	test   %eax,%eax
+     262:	0f 88 86 00 00 00    	js     2ee <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     268:	83 ec 0c             	sub    $0xc,%esp
+     26b:	68 ec 46 00 00       	push   $0x46ec
+     270:	e8 2e 40 00 00       	call   42a3 <unlink>
+     275:	83 c4 10             	add    $0x10,%esp
+     278:	85 c0                	test   %eax,%eax
+     27a:	78 2c                	js     2a8 <exitiputtest+0x98>
+    exit();
+     27c:	e8 d2 3f 00 00       	call   4253 <exit>
+     281:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     288:	e8 ce 3f 00 00       	call   425b <wait>
+  printf(stdout, "exitiput test ok\n");
+     28d:	83 ec 08             	sub    $0x8,%esp
+     290:	68 44 47 00 00       	push   $0x4744
+     295:	ff 35 e8 6b 00 00    	push   0x6be8
+     29b:	e8 00 41 00 00       	call   43a0 <printf>
+}
+     2a0:	83 c4 10             	add    $0x10,%esp
+     2a3:	c9                   	leave
+     2a4:	c3                   	ret
+     2a5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     2a8:	83 ec 08             	sub    $0x8,%esp
+     2ab:	68 f7 46 00 00       	push   $0x46f7
+     2b0:	ff 35 e8 6b 00 00    	push   0x6be8
+     2b6:	e8 e5 40 00 00       	call   43a0 <printf>
+      exit();
+     2bb:	e8 93 3f 00 00       	call   4253 <exit>
+    printf(stdout, "fork failed\n");
+     2c0:	51                   	push   %ecx
+     2c1:	51                   	push   %ecx
+     2c2:	68 3a 58 00 00       	push   $0x583a
+     2c7:	ff 35 e8 6b 00 00    	push   0x6be8
+     2cd:	e8 ce 40 00 00       	call   43a0 <printf>
+    exit();
+     2d2:	e8 7c 3f 00 00       	call   4253 <exit>
+      printf(stdout, "mkdir failed\n");
+     2d7:	52                   	push   %edx
+     2d8:	52                   	push   %edx
+     2d9:	68 c8 46 00 00       	push   $0x46c8
+     2de:	ff 35 e8 6b 00 00    	push   0x6be8
+     2e4:	e8 b7 40 00 00       	call   43a0 <printf>
+      exit();
+     2e9:	e8 65 3f 00 00       	call   4253 <exit>
+      printf(stdout, "child chdir failed\n");
+     2ee:	50                   	push   %eax
+     2ef:	50                   	push   %eax
+     2f0:	68 30 47 00 00       	push   $0x4730
+     2f5:	ff 35 e8 6b 00 00    	push   0x6be8
+     2fb:	e8 a0 40 00 00       	call   43a0 <printf>
+      exit();
+     300:	e8 4e 3f 00 00       	call   4253 <exit>
+     305:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <openiputtest>:
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     316:	68 56 47 00 00       	push   $0x4756
+     31b:	ff 35 e8 6b 00 00    	push   0x6be8
+     321:	e8 7a 40 00 00       	call   43a0 <printf>
+  if(mkdir("oidir") < 0){
+     326:	c7 04 24 65 47 00 00 	movl   $0x4765,(%esp)
+     32d:	e8 89 3f 00 00       	call   42bb <mkdir>
+     332:	83 c4 10             	add    $0x10,%esp
+     335:	85 c0                	test   %eax,%eax
+     337:	0f 88 9f 00 00 00    	js     3dc <openiputtest+0xcc>
+  pid = fork();
+     33d:	e8 09 3f 00 00       	call   424b <fork>
+  if(pid < 0){
+     342:	85 c0                	test   %eax,%eax
+     344:	78 7f                	js     3c5 <openiputtest+0xb5>
+  if(pid == 0){
+     346:	75 38                	jne    380 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     348:	83 ec 08             	sub    $0x8,%esp
+     34b:	6a 02                	push   $0x2
+     34d:	68 65 47 00 00       	push   $0x4765
+     352:	e8 3c 3f 00 00       	call   4293 <open>
+    if(fd >= 0){
+     357:	83 c4 10             	add    $0x10,%esp
+     35a:	85 c0                	test   %eax,%eax
+     35c:	78 62                	js     3c0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     35e:	83 ec 08             	sub    $0x8,%esp
+     361:	68 1c 59 00 00       	push   $0x591c
+     366:	ff 35 e8 6b 00 00    	push   0x6be8
+     36c:	e8 2f 40 00 00       	call   43a0 <printf>
+      exit();
+     371:	e8 dd 3e 00 00       	call   4253 <exit>
+     376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     37d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     380:	83 ec 0c             	sub    $0xc,%esp
+     383:	6a 01                	push   $0x1
+     385:	e8 59 3f 00 00       	call   42e3 <sleep>
+  if(unlink("oidir") != 0){
+     38a:	c7 04 24 65 47 00 00 	movl   $0x4765,(%esp)
+     391:	e8 0d 3f 00 00       	call   42a3 <unlink>
+     396:	83 c4 10             	add    $0x10,%esp
+     399:	85 c0                	test   %eax,%eax
+     39b:	75 56                	jne    3f3 <openiputtest+0xe3>
+  wait();
+     39d:	e8 b9 3e 00 00       	call   425b <wait>
+  printf(stdout, "openiput test ok\n");
+     3a2:	83 ec 08             	sub    $0x8,%esp
+     3a5:	68 8e 47 00 00       	push   $0x478e
+     3aa:	ff 35 e8 6b 00 00    	push   0x6be8
+     3b0:	e8 eb 3f 00 00       	call   43a0 <printf>
+}
+     3b5:	83 c4 10             	add    $0x10,%esp
+     3b8:	c9                   	leave
+     3b9:	c3                   	ret
+     3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     3c0:	e8 8e 3e 00 00       	call   4253 <exit>
+    printf(stdout, "fork failed\n");
+     3c5:	52                   	push   %edx
+     3c6:	52                   	push   %edx
+     3c7:	68 3a 58 00 00       	push   $0x583a
+     3cc:	ff 35 e8 6b 00 00    	push   0x6be8
+     3d2:	e8 c9 3f 00 00       	call   43a0 <printf>
+    exit();
+     3d7:	e8 77 3e 00 00       	call   4253 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     3dc:	51                   	push   %ecx
+     3dd:	51                   	push   %ecx
+     3de:	68 6b 47 00 00       	push   $0x476b
+     3e3:	ff 35 e8 6b 00 00    	push   0x6be8
+     3e9:	e8 b2 3f 00 00       	call   43a0 <printf>
+    exit();
+     3ee:	e8 60 3e 00 00       	call   4253 <exit>
+    printf(stdout, "unlink failed\n");
+     3f3:	50                   	push   %eax
+     3f4:	50                   	push   %eax
+     3f5:	68 7f 47 00 00       	push   $0x477f
+     3fa:	ff 35 e8 6b 00 00    	push   0x6be8
+     400:	e8 9b 3f 00 00       	call   43a0 <printf>
+    exit();
+     405:	e8 49 3e 00 00       	call   4253 <exit>
+     40a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000410 <opentest>:
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     416:	68 a0 47 00 00       	push   $0x47a0
+     41b:	ff 35 e8 6b 00 00    	push   0x6be8
+     421:	e8 7a 3f 00 00       	call   43a0 <printf>
+  fd = open("echo", 0);
+     426:	58                   	pop    %eax
+     427:	5a                   	pop    %edx
+     428:	6a 00                	push   $0x0
+     42a:	68 ab 47 00 00       	push   $0x47ab
+     42f:	e8 5f 3e 00 00       	call   4293 <open>
+  if(fd < 0){
+     434:	83 c4 10             	add    $0x10,%esp
+     437:	85 c0                	test   %eax,%eax
+     439:	78 36                	js     471 <opentest+0x61>
+  close(fd);
+     43b:	83 ec 0c             	sub    $0xc,%esp
+     43e:	50                   	push   %eax
+     43f:	e8 37 3e 00 00       	call   427b <close>
+  fd = open("doesnotexist", 0);
+     444:	5a                   	pop    %edx
+     445:	59                   	pop    %ecx
+     446:	6a 00                	push   $0x0
+     448:	68 c3 47 00 00       	push   $0x47c3
+     44d:	e8 41 3e 00 00       	call   4293 <open>
+  if(fd >= 0){
+     452:	83 c4 10             	add    $0x10,%esp
+     455:	85 c0                	test   %eax,%eax
+     457:	79 2f                	jns    488 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     459:	83 ec 08             	sub    $0x8,%esp
+     45c:	68 ee 47 00 00       	push   $0x47ee
+     461:	ff 35 e8 6b 00 00    	push   0x6be8
+     467:	e8 34 3f 00 00       	call   43a0 <printf>
+}
+     46c:	83 c4 10             	add    $0x10,%esp
+     46f:	c9                   	leave
+     470:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     471:	50                   	push   %eax
+     472:	50                   	push   %eax
+     473:	68 b0 47 00 00       	push   $0x47b0
+     478:	ff 35 e8 6b 00 00    	push   0x6be8
+     47e:	e8 1d 3f 00 00       	call   43a0 <printf>
+    exit();
+     483:	e8 cb 3d 00 00       	call   4253 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     488:	50                   	push   %eax
+     489:	50                   	push   %eax
+     48a:	68 d0 47 00 00       	push   $0x47d0
+     48f:	ff 35 e8 6b 00 00    	push   0x6be8
+     495:	e8 06 3f 00 00       	call   43a0 <printf>
+    exit();
+     49a:	e8 b4 3d 00 00       	call   4253 <exit>
+     49f:	90                   	nop
+
+000004a0 <writetest>:
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	56                   	push   %esi
+     4a4:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     4a5:	83 ec 08             	sub    $0x8,%esp
+     4a8:	68 fc 47 00 00       	push   $0x47fc
+     4ad:	ff 35 e8 6b 00 00    	push   0x6be8
+     4b3:	e8 e8 3e 00 00       	call   43a0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     4b8:	58                   	pop    %eax
+     4b9:	5a                   	pop    %edx
+     4ba:	68 02 02 00 00       	push   $0x202
+     4bf:	68 0d 48 00 00       	push   $0x480d
+     4c4:	e8 ca 3d 00 00       	call   4293 <open>
+  if(fd >= 0){
+     4c9:	83 c4 10             	add    $0x10,%esp
+     4cc:	85 c0                	test   %eax,%eax
+     4ce:	0f 88 88 01 00 00    	js     65c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     4d4:	83 ec 08             	sub    $0x8,%esp
+     4d7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     4d9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     4db:	68 13 48 00 00       	push   $0x4813
+     4e0:	ff 35 e8 6b 00 00    	push   0x6be8
+     4e6:	e8 b5 3e 00 00       	call   43a0 <printf>
+     4eb:	83 c4 10             	add    $0x10,%esp
+     4ee:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     4f0:	83 ec 04             	sub    $0x4,%esp
+     4f3:	6a 0a                	push   $0xa
+     4f5:	68 4a 48 00 00       	push   $0x484a
+     4fa:	56                   	push   %esi
+     4fb:	e8 73 3d 00 00       	call   4273 <write>
+     500:	83 c4 10             	add    $0x10,%esp
+     503:	83 f8 0a             	cmp    $0xa,%eax
+     506:	0f 85 d9 00 00 00    	jne    5e5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     50c:	83 ec 04             	sub    $0x4,%esp
+     50f:	6a 0a                	push   $0xa
+     511:	68 55 48 00 00       	push   $0x4855
+     516:	56                   	push   %esi
+     517:	e8 57 3d 00 00       	call   4273 <write>
+     51c:	83 c4 10             	add    $0x10,%esp
+     51f:	83 f8 0a             	cmp    $0xa,%eax
+     522:	0f 85 d6 00 00 00    	jne    5fe <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     528:	83 c3 01             	add    $0x1,%ebx
+     52b:	83 fb 64             	cmp    $0x64,%ebx
+     52e:	75 c0                	jne    4f0 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     530:	83 ec 08             	sub    $0x8,%esp
+     533:	68 60 48 00 00       	push   $0x4860
+     538:	ff 35 e8 6b 00 00    	push   0x6be8
+     53e:	e8 5d 3e 00 00       	call   43a0 <printf>
+  close(fd);
+     543:	89 34 24             	mov    %esi,(%esp)
+     546:	e8 30 3d 00 00       	call   427b <close>
+  fd = open("small", O_RDONLY);
+     54b:	5b                   	pop    %ebx
+     54c:	5e                   	pop    %esi
+     54d:	6a 00                	push   $0x0
+     54f:	68 0d 48 00 00       	push   $0x480d
+     554:	e8 3a 3d 00 00       	call   4293 <open>
+  if(fd >= 0){
+     559:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     55c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     55e:	85 c0                	test   %eax,%eax
+     560:	0f 88 b1 00 00 00    	js     617 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     566:	83 ec 08             	sub    $0x8,%esp
+     569:	68 6b 48 00 00       	push   $0x486b
+     56e:	ff 35 e8 6b 00 00    	push   0x6be8
+     574:	e8 27 3e 00 00       	call   43a0 <printf>
+  i = read(fd, buf, 2000);
+     579:	83 c4 0c             	add    $0xc,%esp
+     57c:	68 d0 07 00 00       	push   $0x7d0
+     581:	68 20 93 00 00       	push   $0x9320
+     586:	53                   	push   %ebx
+     587:	e8 df 3c 00 00       	call   426b <read>
+  if(i == 2000){
+     58c:	83 c4 10             	add    $0x10,%esp
+     58f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     594:	0f 85 94 00 00 00    	jne    62e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     59a:	83 ec 08             	sub    $0x8,%esp
+     59d:	68 9f 48 00 00       	push   $0x489f
+     5a2:	ff 35 e8 6b 00 00    	push   0x6be8
+     5a8:	e8 f3 3d 00 00       	call   43a0 <printf>
+  close(fd);
+     5ad:	89 1c 24             	mov    %ebx,(%esp)
+     5b0:	e8 c6 3c 00 00       	call   427b <close>
+  if(unlink("small") < 0){
+     5b5:	c7 04 24 0d 48 00 00 	movl   $0x480d,(%esp)
+     5bc:	e8 e2 3c 00 00       	call   42a3 <unlink>
+     5c1:	83 c4 10             	add    $0x10,%esp
+     5c4:	85 c0                	test   %eax,%eax
+     5c6:	78 7d                	js     645 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     5c8:	83 ec 08             	sub    $0x8,%esp
+     5cb:	68 c7 48 00 00       	push   $0x48c7
+     5d0:	ff 35 e8 6b 00 00    	push   0x6be8
+     5d6:	e8 c5 3d 00 00       	call   43a0 <printf>
+}
+     5db:	83 c4 10             	add    $0x10,%esp
+     5de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5e1:	5b                   	pop    %ebx
+     5e2:	5e                   	pop    %esi
+     5e3:	5d                   	pop    %ebp
+     5e4:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     5e5:	83 ec 04             	sub    $0x4,%esp
+     5e8:	53                   	push   %ebx
+     5e9:	68 40 59 00 00       	push   $0x5940
+     5ee:	ff 35 e8 6b 00 00    	push   0x6be8
+     5f4:	e8 a7 3d 00 00       	call   43a0 <printf>
+      exit();
+     5f9:	e8 55 3c 00 00       	call   4253 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     5fe:	83 ec 04             	sub    $0x4,%esp
+     601:	53                   	push   %ebx
+     602:	68 64 59 00 00       	push   $0x5964
+     607:	ff 35 e8 6b 00 00    	push   0x6be8
+     60d:	e8 8e 3d 00 00       	call   43a0 <printf>
+      exit();
+     612:	e8 3c 3c 00 00       	call   4253 <exit>
+    printf(stdout, "error: open small failed!\n");
+     617:	51                   	push   %ecx
+     618:	51                   	push   %ecx
+     619:	68 84 48 00 00       	push   $0x4884
+     61e:	ff 35 e8 6b 00 00    	push   0x6be8
+     624:	e8 77 3d 00 00       	call   43a0 <printf>
+    exit();
+     629:	e8 25 3c 00 00       	call   4253 <exit>
+    printf(stdout, "read failed\n");
+     62e:	52                   	push   %edx
+     62f:	52                   	push   %edx
+     630:	68 6d 53 00 00       	push   $0x536d
+     635:	ff 35 e8 6b 00 00    	push   0x6be8
+     63b:	e8 60 3d 00 00       	call   43a0 <printf>
+    exit();
+     640:	e8 0e 3c 00 00       	call   4253 <exit>
+    printf(stdout, "unlink small failed\n");
+     645:	50                   	push   %eax
+     646:	50                   	push   %eax
+     647:	68 b2 48 00 00       	push   $0x48b2
+     64c:	ff 35 e8 6b 00 00    	push   0x6be8
+     652:	e8 49 3d 00 00       	call   43a0 <printf>
+    exit();
+     657:	e8 f7 3b 00 00       	call   4253 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     65c:	50                   	push   %eax
+     65d:	50                   	push   %eax
+     65e:	68 2e 48 00 00       	push   $0x482e
+     663:	ff 35 e8 6b 00 00    	push   0x6be8
+     669:	e8 32 3d 00 00       	call   43a0 <printf>
+    exit();
+     66e:	e8 e0 3b 00 00       	call   4253 <exit>
+     673:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000680 <writetest1>:
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	56                   	push   %esi
+     684:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     685:	83 ec 08             	sub    $0x8,%esp
+     688:	68 db 48 00 00       	push   $0x48db
+     68d:	ff 35 e8 6b 00 00    	push   0x6be8
+     693:	e8 08 3d 00 00       	call   43a0 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     698:	58                   	pop    %eax
+     699:	5a                   	pop    %edx
+     69a:	68 02 02 00 00       	push   $0x202
+     69f:	68 55 49 00 00       	push   $0x4955
+     6a4:	e8 ea 3b 00 00       	call   4293 <open>
+  if(fd < 0){
+     6a9:	83 c4 10             	add    $0x10,%esp
+     6ac:	85 c0                	test   %eax,%eax
+     6ae:	0f 88 5d 01 00 00    	js     811 <writetest1+0x191>
+     6b4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < BIGWRITES; i++){
+     6b6:	31 db                	xor    %ebx,%ebx
+     6b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bf:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     6c0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     6c3:	89 1d 20 93 00 00    	mov    %ebx,0x9320
+    if(write(fd, buf, 512) != 512){
+     6c9:	68 00 02 00 00       	push   $0x200
+     6ce:	68 20 93 00 00       	push   $0x9320
+     6d3:	56                   	push   %esi
+     6d4:	e8 9a 3b 00 00       	call   4273 <write>
+     6d9:	83 c4 10             	add    $0x10,%esp
+     6dc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6e1:	0f 85 b3 00 00 00    	jne    79a <writetest1+0x11a>
+  for(i = 0; i < BIGWRITES; i++){
+     6e7:	83 c3 01             	add    $0x1,%ebx
+     6ea:	81 fb 18 04 00 00    	cmp    $0x418,%ebx
+     6f0:	75 ce                	jne    6c0 <writetest1+0x40>
+  close(fd);
+     6f2:	83 ec 0c             	sub    $0xc,%esp
+     6f5:	56                   	push   %esi
+     6f6:	e8 80 3b 00 00       	call   427b <close>
+  fd = open("big", O_RDONLY);
+     6fb:	5b                   	pop    %ebx
+     6fc:	5e                   	pop    %esi
+     6fd:	6a 00                	push   $0x0
+     6ff:	68 55 49 00 00       	push   $0x4955
+     704:	e8 8a 3b 00 00       	call   4293 <open>
+  if(fd < 0){
+     709:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     70c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     70e:	85 c0                	test   %eax,%eax
+     710:	0f 88 e4 00 00 00    	js     7fa <writetest1+0x17a>
+  n = 0;
+     716:	31 f6                	xor    %esi,%esi
+     718:	eb 1d                	jmp    737 <writetest1+0xb7>
+     71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     720:	3d 00 02 00 00       	cmp    $0x200,%eax
+     725:	0f 85 9f 00 00 00    	jne    7ca <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     72b:	a1 20 93 00 00       	mov    0x9320,%eax
+     730:	39 f0                	cmp    %esi,%eax
+     732:	75 7f                	jne    7b3 <writetest1+0x133>
+    n++;
+     734:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     737:	83 ec 04             	sub    $0x4,%esp
+     73a:	68 00 02 00 00       	push   $0x200
+     73f:	68 20 93 00 00       	push   $0x9320
+     744:	53                   	push   %ebx
+     745:	e8 21 3b 00 00       	call   426b <read>
+    if(i == 0){
+     74a:	83 c4 10             	add    $0x10,%esp
+     74d:	85 c0                	test   %eax,%eax
+     74f:	75 cf                	jne    720 <writetest1+0xa0>
+      if(n != BIGWRITES){
+     751:	81 fe 18 04 00 00    	cmp    $0x418,%esi
+     757:	0f 85 86 00 00 00    	jne    7e3 <writetest1+0x163>
+  close(fd);
+     75d:	83 ec 0c             	sub    $0xc,%esp
+     760:	53                   	push   %ebx
+     761:	e8 15 3b 00 00       	call   427b <close>
+  if(unlink("big") < 0){
+     766:	c7 04 24 55 49 00 00 	movl   $0x4955,(%esp)
+     76d:	e8 31 3b 00 00       	call   42a3 <unlink>
+     772:	83 c4 10             	add    $0x10,%esp
+     775:	85 c0                	test   %eax,%eax
+     777:	0f 88 ab 00 00 00    	js     828 <writetest1+0x1a8>
+  printf(stdout, "big files ok\n");
+     77d:	83 ec 08             	sub    $0x8,%esp
+     780:	68 7c 49 00 00       	push   $0x497c
+     785:	ff 35 e8 6b 00 00    	push   0x6be8
+     78b:	e8 10 3c 00 00       	call   43a0 <printf>
+}
+     790:	83 c4 10             	add    $0x10,%esp
+     793:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     796:	5b                   	pop    %ebx
+     797:	5e                   	pop    %esi
+     798:	5d                   	pop    %ebp
+     799:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     79a:	83 ec 04             	sub    $0x4,%esp
+     79d:	53                   	push   %ebx
+     79e:	68 05 49 00 00       	push   $0x4905
+     7a3:	ff 35 e8 6b 00 00    	push   0x6be8
+     7a9:	e8 f2 3b 00 00       	call   43a0 <printf>
+      exit();
+     7ae:	e8 a0 3a 00 00       	call   4253 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     7b3:	50                   	push   %eax
+     7b4:	56                   	push   %esi
+     7b5:	68 88 59 00 00       	push   $0x5988
+     7ba:	ff 35 e8 6b 00 00    	push   0x6be8
+     7c0:	e8 db 3b 00 00       	call   43a0 <printf>
+      exit();
+     7c5:	e8 89 3a 00 00       	call   4253 <exit>
+      printf(stdout, "read failed %d\n", i);
+     7ca:	83 ec 04             	sub    $0x4,%esp
+     7cd:	50                   	push   %eax
+     7ce:	68 59 49 00 00       	push   $0x4959
+     7d3:	ff 35 e8 6b 00 00    	push   0x6be8
+     7d9:	e8 c2 3b 00 00       	call   43a0 <printf>
+      exit();
+     7de:	e8 70 3a 00 00       	call   4253 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     7e3:	52                   	push   %edx
+     7e4:	56                   	push   %esi
+     7e5:	68 3c 49 00 00       	push   $0x493c
+     7ea:	ff 35 e8 6b 00 00    	push   0x6be8
+     7f0:	e8 ab 3b 00 00       	call   43a0 <printf>
+        exit();
+     7f5:	e8 59 3a 00 00       	call   4253 <exit>
+    printf(stdout, "error: open big failed!\n");
+     7fa:	51                   	push   %ecx
+     7fb:	51                   	push   %ecx
+     7fc:	68 23 49 00 00       	push   $0x4923
+     801:	ff 35 e8 6b 00 00    	push   0x6be8
+     807:	e8 94 3b 00 00       	call   43a0 <printf>
+    exit();
+     80c:	e8 42 3a 00 00       	call   4253 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     811:	50                   	push   %eax
+     812:	50                   	push   %eax
+     813:	68 eb 48 00 00       	push   $0x48eb
+     818:	ff 35 e8 6b 00 00    	push   0x6be8
+     81e:	e8 7d 3b 00 00       	call   43a0 <printf>
+    exit();
+     823:	e8 2b 3a 00 00       	call   4253 <exit>
+    printf(stdout, "unlink big failed\n");
+     828:	50                   	push   %eax
+     829:	50                   	push   %eax
+     82a:	68 69 49 00 00       	push   $0x4969
+     82f:	ff 35 e8 6b 00 00    	push   0x6be8
+     835:	e8 66 3b 00 00       	call   43a0 <printf>
+    exit();
+     83a:	e8 14 3a 00 00       	call   4253 <exit>
+     83f:	90                   	nop
+
+00000840 <createtest>:
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	53                   	push   %ebx
+  name[2] = '\0';
+     844:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     849:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     84c:	68 a8 59 00 00       	push   $0x59a8
+     851:	ff 35 e8 6b 00 00    	push   0x6be8
+     857:	e8 44 3b 00 00       	call   43a0 <printf>
+  name[0] = 'a';
+     85c:	c6 05 10 93 00 00 61 	movb   $0x61,0x9310
+  name[2] = '\0';
+     863:	83 c4 10             	add    $0x10,%esp
+     866:	c6 05 12 93 00 00 00 	movb   $0x0,0x9312
+  for(i = 0; i < 52; i++){
+     86d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     870:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     873:	88 1d 11 93 00 00    	mov    %bl,0x9311
+  for(i = 0; i < 52; i++){
+     879:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     87c:	68 02 02 00 00       	push   $0x202
+     881:	68 10 93 00 00       	push   $0x9310
+     886:	e8 08 3a 00 00       	call   4293 <open>
+    close(fd);
+     88b:	89 04 24             	mov    %eax,(%esp)
+     88e:	e8 e8 39 00 00       	call   427b <close>
+  for(i = 0; i < 52; i++){
+     893:	83 c4 10             	add    $0x10,%esp
+     896:	80 fb 64             	cmp    $0x64,%bl
+     899:	75 d5                	jne    870 <createtest+0x30>
+  name[0] = 'a';
+     89b:	c6 05 10 93 00 00 61 	movb   $0x61,0x9310
+  name[2] = '\0';
+     8a2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     8a7:	c6 05 12 93 00 00 00 	movb   $0x0,0x9312
+  for(i = 0; i < 52; i++){
+     8ae:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     8b0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     8b3:	88 1d 11 93 00 00    	mov    %bl,0x9311
+  for(i = 0; i < 52; i++){
+     8b9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     8bc:	68 10 93 00 00       	push   $0x9310
+     8c1:	e8 dd 39 00 00       	call   42a3 <unlink>
+  for(i = 0; i < 52; i++){
+     8c6:	83 c4 10             	add    $0x10,%esp
+     8c9:	80 fb 64             	cmp    $0x64,%bl
+     8cc:	75 e2                	jne    8b0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8ce:	83 ec 08             	sub    $0x8,%esp
+     8d1:	68 d0 59 00 00       	push   $0x59d0
+     8d6:	ff 35 e8 6b 00 00    	push   0x6be8
+     8dc:	e8 bf 3a 00 00       	call   43a0 <printf>
+}
+     8e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8e4:	83 c4 10             	add    $0x10,%esp
+     8e7:	c9                   	leave
+     8e8:	c3                   	ret
+     8e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008f0 <manyinodes>:
+{
+     8f0:	55                   	push   %ebp
+     8f1:	89 e5                	mov    %esp,%ebp
+     8f3:	57                   	push   %edi
+     8f4:	56                   	push   %esi
+     8f5:	53                   	push   %ebx
+     8f6:	83 ec 44             	sub    $0x44,%esp
+  printf(stdout, "many inodes test\n");
+     8f9:	68 8a 49 00 00       	push   $0x498a
+     8fe:	ff 35 e8 6b 00 00    	push   0x6be8
+     904:	e8 97 3a 00 00       	call   43a0 <printf>
+  if(mkdir("inodes") < 0 || chdir("inodes") < 0){
+     909:	c7 04 24 9c 49 00 00 	movl   $0x499c,(%esp)
+     910:	e8 a6 39 00 00       	call   42bb <mkdir>
+     915:	83 c4 10             	add    $0x10,%esp
+     918:	85 c0                	test   %eax,%eax
+     91a:	0f 88 61 02 00 00    	js     b81 <manyinodes+0x291>
+     920:	83 ec 0c             	sub    $0xc,%esp
+     923:	68 9c 49 00 00       	push   $0x499c
+     928:	e8 96 39 00 00       	call   42c3 <chdir>
+     92d:	83 c4 10             	add    $0x10,%esp
+     930:	85 c0                	test   %eax,%eax
+     932:	0f 88 49 02 00 00    	js     b81 <manyinodes+0x291>
+  fn[0] = 'i';
+     938:	c6 45 ce 69          	movb   $0x69,-0x32(%ebp)
+  for(i = 0; i < 1000; i++){
+     93c:	31 db                	xor    %ebx,%ebx
+     93e:	8d 7d ce             	lea    -0x32(%ebp),%edi
+  fn[5] = '\0';
+     941:	c6 45 d3 00          	movb   $0x0,-0x2d(%ebp)
+  maxino = 0;
+     945:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+     94c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    fn[2] = '0' + (i / 100) % 10;
+     950:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    fd = open(fn, O_CREATE|O_RDWR);
+     955:	83 ec 08             	sub    $0x8,%esp
+    fn[1] = '0' + i / 1000;
+     958:	c6 45 cf 30          	movb   $0x30,-0x31(%ebp)
+    fn[2] = '0' + (i / 100) % 10;
+     95c:	f7 e3                	mul    %ebx
+    fn[3] = '0' + (i / 10) % 10;
+     95e:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    fn[2] = '0' + (i / 100) % 10;
+     963:	c1 ea 05             	shr    $0x5,%edx
+     966:	83 c2 30             	add    $0x30,%edx
+     969:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    fn[3] = '0' + (i / 10) % 10;
+     96c:	f7 e3                	mul    %ebx
+     96e:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     973:	89 d1                	mov    %edx,%ecx
+     975:	c1 e9 03             	shr    $0x3,%ecx
+     978:	f7 e1                	mul    %ecx
+     97a:	89 c8                	mov    %ecx,%eax
+     97c:	c1 ea 03             	shr    $0x3,%edx
+     97f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     982:	01 d2                	add    %edx,%edx
+     984:	29 d0                	sub    %edx,%eax
+    fn[4] = '0' + i % 10;
+     986:	8d 14 89             	lea    (%ecx,%ecx,4),%edx
+    fn[3] = '0' + (i / 10) % 10;
+     989:	83 c0 30             	add    $0x30,%eax
+    fn[4] = '0' + i % 10;
+     98c:	01 d2                	add    %edx,%edx
+    fn[3] = '0' + (i / 10) % 10;
+     98e:	88 45 d1             	mov    %al,-0x2f(%ebp)
+    fn[4] = '0' + i % 10;
+     991:	89 d8                	mov    %ebx,%eax
+     993:	29 d0                	sub    %edx,%eax
+     995:	83 c0 30             	add    $0x30,%eax
+     998:	88 45 d2             	mov    %al,-0x2e(%ebp)
+    fd = open(fn, O_CREATE|O_RDWR);
+     99b:	68 02 02 00 00       	push   $0x202
+     9a0:	57                   	push   %edi
+     9a1:	e8 ed 38 00 00       	call   4293 <open>
+    if(fd < 0){
+     9a6:	83 c4 10             	add    $0x10,%esp
+    fd = open(fn, O_CREATE|O_RDWR);
+     9a9:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+     9ab:	85 c0                	test   %eax,%eax
+     9ad:	0f 88 6c 01 00 00    	js     b1f <manyinodes+0x22f>
+    if(fstat(fd, &st) < 0){
+     9b3:	83 ec 08             	sub    $0x8,%esp
+     9b6:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     9b9:	50                   	push   %eax
+     9ba:	56                   	push   %esi
+     9bb:	e8 eb 38 00 00       	call   42ab <fstat>
+     9c0:	83 c4 10             	add    $0x10,%esp
+     9c3:	85 c0                	test   %eax,%eax
+     9c5:	0f 88 6d 01 00 00    	js     b38 <manyinodes+0x248>
+    if(st.ino > maxino)
+     9cb:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     9ce:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     9d1:	39 c1                	cmp    %eax,%ecx
+     9d3:	0f 43 c1             	cmovae %ecx,%eax
+    write(fd, fn, sizeof(fn));
+     9d6:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < 1000; i++){
+     9d9:	83 c3 01             	add    $0x1,%ebx
+     9dc:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    write(fd, fn, sizeof(fn));
+     9df:	6a 06                	push   $0x6
+     9e1:	57                   	push   %edi
+     9e2:	56                   	push   %esi
+     9e3:	e8 8b 38 00 00       	call   4273 <write>
+    close(fd);
+     9e8:	89 34 24             	mov    %esi,(%esp)
+     9eb:	e8 8b 38 00 00       	call   427b <close>
+  for(i = 0; i < 1000; i++){
+     9f0:	83 c4 10             	add    $0x10,%esp
+     9f3:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+     9f9:	0f 85 51 ff ff ff    	jne    950 <manyinodes+0x60>
+  if(maxino < 1000){
+     9ff:	81 7d c4 e7 03 00 00 	cmpl   $0x3e7,-0x3c(%ebp)
+     a06:	0f 86 5c 01 00 00    	jbe    b68 <manyinodes+0x278>
+  for(i = 0; i < 1000; i++){
+     a0c:	31 db                	xor    %ebx,%ebx
+     a0e:	66 90                	xchg   %ax,%ax
+    fn[2] = '0' + (i / 100) % 10;
+     a10:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    fd = open(fn, O_RDONLY);
+     a15:	83 ec 08             	sub    $0x8,%esp
+    fn[1] = '0' + i / 1000;
+     a18:	c6 45 cf 30          	movb   $0x30,-0x31(%ebp)
+    fn[2] = '0' + (i / 100) % 10;
+     a1c:	f7 e3                	mul    %ebx
+    fn[3] = '0' + (i / 10) % 10;
+     a1e:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    fn[2] = '0' + (i / 100) % 10;
+     a23:	c1 ea 05             	shr    $0x5,%edx
+     a26:	83 c2 30             	add    $0x30,%edx
+     a29:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    fn[3] = '0' + (i / 10) % 10;
+     a2c:	f7 e3                	mul    %ebx
+     a2e:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     a33:	89 d1                	mov    %edx,%ecx
+     a35:	c1 e9 03             	shr    $0x3,%ecx
+     a38:	f7 e1                	mul    %ecx
+     a3a:	89 c8                	mov    %ecx,%eax
+     a3c:	c1 ea 03             	shr    $0x3,%edx
+     a3f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     a42:	01 d2                	add    %edx,%edx
+     a44:	29 d0                	sub    %edx,%eax
+    fn[4] = '0' + i % 10;
+     a46:	8d 14 89             	lea    (%ecx,%ecx,4),%edx
+    fn[3] = '0' + (i / 10) % 10;
+     a49:	83 c0 30             	add    $0x30,%eax
+    fn[4] = '0' + i % 10;
+     a4c:	01 d2                	add    %edx,%edx
+    fn[3] = '0' + (i / 10) % 10;
+     a4e:	88 45 d1             	mov    %al,-0x2f(%ebp)
+    fn[4] = '0' + i % 10;
+     a51:	89 d8                	mov    %ebx,%eax
+     a53:	29 d0                	sub    %edx,%eax
+     a55:	83 c0 30             	add    $0x30,%eax
+     a58:	88 45 d2             	mov    %al,-0x2e(%ebp)
+    fd = open(fn, O_RDONLY);
+     a5b:	6a 00                	push   $0x0
+     a5d:	57                   	push   %edi
+     a5e:	e8 30 38 00 00       	call   4293 <open>
+    if(fd < 0 || read(fd, buf, sizeof(fn)) != sizeof(fn) ||
+     a63:	83 c4 10             	add    $0x10,%esp
+    fd = open(fn, O_RDONLY);
+     a66:	89 c6                	mov    %eax,%esi
+    if(fd < 0 || read(fd, buf, sizeof(fn)) != sizeof(fn) ||
+     a68:	85 c0                	test   %eax,%eax
+     a6a:	0f 88 96 00 00 00    	js     b06 <manyinodes+0x216>
+     a70:	83 ec 04             	sub    $0x4,%esp
+     a73:	6a 06                	push   $0x6
+     a75:	68 20 93 00 00       	push   $0x9320
+     a7a:	50                   	push   %eax
+     a7b:	e8 eb 37 00 00       	call   426b <read>
+     a80:	83 c4 10             	add    $0x10,%esp
+     a83:	83 f8 06             	cmp    $0x6,%eax
+     a86:	75 7e                	jne    b06 <manyinodes+0x216>
+       strcmp(buf, fn) != 0){
+     a88:	83 ec 08             	sub    $0x8,%esp
+     a8b:	57                   	push   %edi
+     a8c:	68 20 93 00 00       	push   $0x9320
+     a91:	e8 aa 35 00 00       	call   4040 <strcmp>
+    if(fd < 0 || read(fd, buf, sizeof(fn)) != sizeof(fn) ||
+     a96:	83 c4 10             	add    $0x10,%esp
+     a99:	85 c0                	test   %eax,%eax
+     a9b:	75 69                	jne    b06 <manyinodes+0x216>
+    close(fd);
+     a9d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 1000; i++){
+     aa0:	83 c3 01             	add    $0x1,%ebx
+    close(fd);
+     aa3:	56                   	push   %esi
+     aa4:	e8 d2 37 00 00       	call   427b <close>
+    unlink(fn);
+     aa9:	89 3c 24             	mov    %edi,(%esp)
+     aac:	e8 f2 37 00 00       	call   42a3 <unlink>
+  for(i = 0; i < 1000; i++){
+     ab1:	83 c4 10             	add    $0x10,%esp
+     ab4:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+     aba:	0f 85 50 ff ff ff    	jne    a10 <manyinodes+0x120>
+  if(chdir("..") < 0 || unlink("inodes") < 0){
+     ac0:	83 ec 0c             	sub    $0xc,%esp
+     ac3:	68 dc 50 00 00       	push   $0x50dc
+     ac8:	e8 f6 37 00 00       	call   42c3 <chdir>
+     acd:	83 c4 10             	add    $0x10,%esp
+     ad0:	85 c0                	test   %eax,%eax
+     ad2:	78 7d                	js     b51 <manyinodes+0x261>
+     ad4:	83 ec 0c             	sub    $0xc,%esp
+     ad7:	68 9c 49 00 00       	push   $0x499c
+     adc:	e8 c2 37 00 00       	call   42a3 <unlink>
+     ae1:	83 c4 10             	add    $0x10,%esp
+     ae4:	85 c0                	test   %eax,%eax
+     ae6:	78 69                	js     b51 <manyinodes+0x261>
+  printf(stdout, "many inodes ok\n");
+     ae8:	83 ec 08             	sub    $0x8,%esp
+     aeb:	68 09 4a 00 00       	push   $0x4a09
+     af0:	ff 35 e8 6b 00 00    	push   0x6be8
+     af6:	e8 a5 38 00 00       	call   43a0 <printf>
+}
+     afb:	83 c4 10             	add    $0x10,%esp
+     afe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b01:	5b                   	pop    %ebx
+     b02:	5e                   	pop    %esi
+     b03:	5f                   	pop    %edi
+     b04:	5d                   	pop    %ebp
+     b05:	c3                   	ret
+      printf(stdout, "read %s failed\n", fn);
+     b06:	83 ec 04             	sub    $0x4,%esp
+     b09:	57                   	push   %edi
+     b0a:	68 e3 49 00 00       	push   $0x49e3
+     b0f:	ff 35 e8 6b 00 00    	push   0x6be8
+     b15:	e8 86 38 00 00       	call   43a0 <printf>
+      exit();
+     b1a:	e8 34 37 00 00       	call   4253 <exit>
+      printf(stdout, "create %s failed\n", fn);
+     b1f:	83 ec 04             	sub    $0x4,%esp
+     b22:	57                   	push   %edi
+     b23:	68 cb 4d 00 00       	push   $0x4dcb
+     b28:	ff 35 e8 6b 00 00    	push   0x6be8
+     b2e:	e8 6d 38 00 00       	call   43a0 <printf>
+      exit();
+     b33:	e8 1b 37 00 00       	call   4253 <exit>
+      printf(stdout, "fstat %s failed\n", fn);
+     b38:	83 ec 04             	sub    $0x4,%esp
+     b3b:	57                   	push   %edi
+     b3c:	68 b8 49 00 00       	push   $0x49b8
+     b41:	ff 35 e8 6b 00 00    	push   0x6be8
+     b47:	e8 54 38 00 00       	call   43a0 <printf>
+      exit();
+     b4c:	e8 02 37 00 00       	call   4253 <exit>
+    printf(stdout, "unlink inodes failed\n");
+     b51:	50                   	push   %eax
+     b52:	50                   	push   %eax
+     b53:	68 f3 49 00 00       	push   $0x49f3
+     b58:	ff 35 e8 6b 00 00    	push   0x6be8
+     b5e:	e8 3d 38 00 00       	call   43a0 <printf>
+    exit();
+     b63:	e8 eb 36 00 00       	call   4253 <exit>
+    printf(stdout, "many inodes: max inum %d\n", maxino);
+     b68:	52                   	push   %edx
+     b69:	ff 75 c4             	push   -0x3c(%ebp)
+     b6c:	68 c9 49 00 00       	push   $0x49c9
+     b71:	ff 35 e8 6b 00 00    	push   0x6be8
+     b77:	e8 24 38 00 00       	call   43a0 <printf>
+    exit();
+     b7c:	e8 d2 36 00 00       	call   4253 <exit>
+    printf(stdout, "mkdir inodes failed\n");
+     b81:	51                   	push   %ecx
+     b82:	51                   	push   %ecx
+     b83:	68 a3 49 00 00       	push   $0x49a3
+     b88:	ff 35 e8 6b 00 00    	push   0x6be8
+     b8e:	e8 0d 38 00 00       	call   43a0 <printf>
+    exit();
+     b93:	e8 bb 36 00 00       	call   4253 <exit>
+     b98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b9f:	90                   	nop
+
+00000ba0 <dirtest>:
+{
+     ba0:	55                   	push   %ebp
+     ba1:	89 e5                	mov    %esp,%ebp
+     ba3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     ba6:	68 19 4a 00 00       	push   $0x4a19
+     bab:	ff 35 e8 6b 00 00    	push   0x6be8
+     bb1:	e8 ea 37 00 00       	call   43a0 <printf>
+  if(mkdir("dir0") < 0){
+     bb6:	c7 04 24 25 4a 00 00 	movl   $0x4a25,(%esp)
+     bbd:	e8 f9 36 00 00       	call   42bb <mkdir>
+     bc2:	83 c4 10             	add    $0x10,%esp
+     bc5:	85 c0                	test   %eax,%eax
+     bc7:	78 58                	js     c21 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     bc9:	83 ec 0c             	sub    $0xc,%esp
+     bcc:	68 25 4a 00 00       	push   $0x4a25
+     bd1:	e8 ed 36 00 00       	call   42c3 <chdir>
+     bd6:	83 c4 10             	add    $0x10,%esp
+     bd9:	85 c0                	test   %eax,%eax
+     bdb:	0f 88 85 00 00 00    	js     c66 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     be1:	83 ec 0c             	sub    $0xc,%esp
+     be4:	68 dc 50 00 00       	push   $0x50dc
+     be9:	e8 d5 36 00 00       	call   42c3 <chdir>
+     bee:	83 c4 10             	add    $0x10,%esp
+     bf1:	85 c0                	test   %eax,%eax
+     bf3:	78 5a                	js     c4f <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     bf5:	83 ec 0c             	sub    $0xc,%esp
+     bf8:	68 25 4a 00 00       	push   $0x4a25
+     bfd:	e8 a1 36 00 00       	call   42a3 <unlink>
+     c02:	83 c4 10             	add    $0x10,%esp
+     c05:	85 c0                	test   %eax,%eax
+     c07:	78 2f                	js     c38 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     c09:	83 ec 08             	sub    $0x8,%esp
+     c0c:	68 62 4a 00 00       	push   $0x4a62
+     c11:	ff 35 e8 6b 00 00    	push   0x6be8
+     c17:	e8 84 37 00 00       	call   43a0 <printf>
+}
+     c1c:	83 c4 10             	add    $0x10,%esp
+     c1f:	c9                   	leave
+     c20:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     c21:	50                   	push   %eax
+     c22:	50                   	push   %eax
+     c23:	68 c8 46 00 00       	push   $0x46c8
+     c28:	ff 35 e8 6b 00 00    	push   0x6be8
+     c2e:	e8 6d 37 00 00       	call   43a0 <printf>
+    exit();
+     c33:	e8 1b 36 00 00       	call   4253 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     c38:	50                   	push   %eax
+     c39:	50                   	push   %eax
+     c3a:	68 4e 4a 00 00       	push   $0x4a4e
+     c3f:	ff 35 e8 6b 00 00    	push   0x6be8
+     c45:	e8 56 37 00 00       	call   43a0 <printf>
+    exit();
+     c4a:	e8 04 36 00 00       	call   4253 <exit>
+    printf(stdout, "chdir .. failed\n");
+     c4f:	52                   	push   %edx
+     c50:	52                   	push   %edx
+     c51:	68 3d 4a 00 00       	push   $0x4a3d
+     c56:	ff 35 e8 6b 00 00    	push   0x6be8
+     c5c:	e8 3f 37 00 00       	call   43a0 <printf>
+    exit();
+     c61:	e8 ed 35 00 00       	call   4253 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     c66:	51                   	push   %ecx
+     c67:	51                   	push   %ecx
+     c68:	68 2a 4a 00 00       	push   $0x4a2a
+     c6d:	ff 35 e8 6b 00 00    	push   0x6be8
+     c73:	e8 28 37 00 00       	call   43a0 <printf>
+    exit();
+     c78:	e8 d6 35 00 00       	call   4253 <exit>
+     c7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c80 <exectest>:
+{
+     c80:	55                   	push   %ebp
+     c81:	89 e5                	mov    %esp,%ebp
+     c83:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     c86:	68 71 4a 00 00       	push   $0x4a71
+     c8b:	ff 35 e8 6b 00 00    	push   0x6be8
+     c91:	e8 0a 37 00 00       	call   43a0 <printf>
+  if(exec("echo", echoargv) < 0){
+     c96:	5a                   	pop    %edx
+     c97:	59                   	pop    %ecx
+     c98:	68 ec 6b 00 00       	push   $0x6bec
+     c9d:	68 ab 47 00 00       	push   $0x47ab
+     ca2:	e8 e4 35 00 00       	call   428b <exec>
+     ca7:	83 c4 10             	add    $0x10,%esp
+     caa:	85 c0                	test   %eax,%eax
+     cac:	78 02                	js     cb0 <exectest+0x30>
+}
+     cae:	c9                   	leave
+     caf:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     cb0:	50                   	push   %eax
+     cb1:	50                   	push   %eax
+     cb2:	68 7c 4a 00 00       	push   $0x4a7c
+     cb7:	ff 35 e8 6b 00 00    	push   0x6be8
+     cbd:	e8 de 36 00 00       	call   43a0 <printf>
+    exit();
+     cc2:	e8 8c 35 00 00       	call   4253 <exit>
+     cc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cce:	66 90                	xchg   %ax,%ax
+
+00000cd0 <pipe1>:
+{
+     cd0:	55                   	push   %ebp
+     cd1:	89 e5                	mov    %esp,%ebp
+     cd3:	57                   	push   %edi
+     cd4:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     cd5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     cd8:	53                   	push   %ebx
+     cd9:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     cdc:	50                   	push   %eax
+     cdd:	e8 81 35 00 00       	call   4263 <pipe>
+     ce2:	83 c4 10             	add    $0x10,%esp
+     ce5:	85 c0                	test   %eax,%eax
+     ce7:	0f 85 41 01 00 00    	jne    e2e <pipe1+0x15e>
+     ced:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     cef:	e8 57 35 00 00       	call   424b <fork>
+  if(pid == 0){
+     cf4:	85 c0                	test   %eax,%eax
+     cf6:	0f 84 92 00 00 00    	je     d8e <pipe1+0xbe>
+  } else if(pid > 0){
+     cfc:	0f 8e 3f 01 00 00    	jle    e41 <pipe1+0x171>
+    close(fds[1]);
+     d02:	83 ec 0c             	sub    $0xc,%esp
+     d05:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     d08:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     d0a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     d0f:	e8 67 35 00 00       	call   427b <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     d14:	83 c4 10             	add    $0x10,%esp
+     d17:	83 ec 04             	sub    $0x4,%esp
+     d1a:	57                   	push   %edi
+     d1b:	68 20 93 00 00       	push   $0x9320
+     d20:	ff 75 e0             	push   -0x20(%ebp)
+     d23:	e8 43 35 00 00       	call   426b <read>
+     d28:	83 c4 10             	add    $0x10,%esp
+     d2b:	89 c1                	mov    %eax,%ecx
+     d2d:	85 c0                	test   %eax,%eax
+     d2f:	0f 8e b8 00 00 00    	jle    ded <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     d35:	89 f0                	mov    %esi,%eax
+     d37:	32 05 20 93 00 00    	xor    0x9320,%al
+     d3d:	0f b6 c0             	movzbl %al,%eax
+     d40:	85 c0                	test   %eax,%eax
+     d42:	75 30                	jne    d74 <pipe1+0xa4>
+     d44:	83 c6 01             	add    $0x1,%esi
+     d47:	eb 0f                	jmp    d58 <pipe1+0x88>
+     d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d50:	38 90 20 93 00 00    	cmp    %dl,0x9320(%eax)
+     d56:	75 1c                	jne    d74 <pipe1+0xa4>
+     d58:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     d5b:	83 c0 01             	add    $0x1,%eax
+     d5e:	39 c1                	cmp    %eax,%ecx
+     d60:	75 ee                	jne    d50 <pipe1+0x80>
+      cc = cc * 2;
+     d62:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     d64:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     d69:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     d6b:	89 d6                	mov    %edx,%esi
+     d6d:	39 c7                	cmp    %eax,%edi
+     d6f:	0f 4f f8             	cmovg  %eax,%edi
+     d72:	eb a3                	jmp    d17 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     d74:	83 ec 08             	sub    $0x8,%esp
+     d77:	68 ab 4a 00 00       	push   $0x4aab
+     d7c:	6a 01                	push   $0x1
+     d7e:	e8 1d 36 00 00       	call   43a0 <printf>
+     d83:	83 c4 10             	add    $0x10,%esp
+}
+     d86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d89:	5b                   	pop    %ebx
+     d8a:	5e                   	pop    %esi
+     d8b:	5f                   	pop    %edi
+     d8c:	5d                   	pop    %ebp
+     d8d:	c3                   	ret
+    close(fds[0]);
+     d8e:	83 ec 0c             	sub    $0xc,%esp
+     d91:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     d94:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     d96:	e8 e0 34 00 00       	call   427b <close>
+     d9b:	83 c4 10             	add    $0x10,%esp
+     d9e:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     da0:	31 c0                	xor    %eax,%eax
+     da2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     da8:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     dab:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     dae:	88 90 1f 93 00 00    	mov    %dl,0x931f(%eax)
+      for(i = 0; i < 1033; i++)
+     db4:	3d 09 04 00 00       	cmp    $0x409,%eax
+     db9:	75 ed                	jne    da8 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     dbb:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     dbe:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     dc4:	68 09 04 00 00       	push   $0x409
+     dc9:	68 20 93 00 00       	push   $0x9320
+     dce:	ff 75 e4             	push   -0x1c(%ebp)
+     dd1:	e8 9d 34 00 00       	call   4273 <write>
+     dd6:	83 c4 10             	add    $0x10,%esp
+     dd9:	3d 09 04 00 00       	cmp    $0x409,%eax
+     dde:	75 74                	jne    e54 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     de0:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     de6:	75 b8                	jne    da0 <pipe1+0xd0>
+    exit();
+     de8:	e8 66 34 00 00       	call   4253 <exit>
+    if(total != 5 * 1033){
+     ded:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     df3:	75 26                	jne    e1b <pipe1+0x14b>
+    close(fds[0]);
+     df5:	83 ec 0c             	sub    $0xc,%esp
+     df8:	ff 75 e0             	push   -0x20(%ebp)
+     dfb:	e8 7b 34 00 00       	call   427b <close>
+    wait();
+     e00:	e8 56 34 00 00       	call   425b <wait>
+  printf(1, "pipe1 ok\n");
+     e05:	5a                   	pop    %edx
+     e06:	59                   	pop    %ecx
+     e07:	68 d0 4a 00 00       	push   $0x4ad0
+     e0c:	6a 01                	push   $0x1
+     e0e:	e8 8d 35 00 00       	call   43a0 <printf>
+     e13:	83 c4 10             	add    $0x10,%esp
+     e16:	e9 6b ff ff ff       	jmp    d86 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     e1b:	56                   	push   %esi
+     e1c:	53                   	push   %ebx
+     e1d:	68 b9 4a 00 00       	push   $0x4ab9
+     e22:	6a 01                	push   $0x1
+     e24:	e8 77 35 00 00       	call   43a0 <printf>
+      exit();
+     e29:	e8 25 34 00 00       	call   4253 <exit>
+    printf(1, "pipe() failed\n");
+     e2e:	50                   	push   %eax
+     e2f:	50                   	push   %eax
+     e30:	68 8e 4a 00 00       	push   $0x4a8e
+     e35:	6a 01                	push   $0x1
+     e37:	e8 64 35 00 00       	call   43a0 <printf>
+    exit();
+     e3c:	e8 12 34 00 00       	call   4253 <exit>
+    printf(1, "fork() failed\n");
+     e41:	50                   	push   %eax
+     e42:	50                   	push   %eax
+     e43:	68 da 4a 00 00       	push   $0x4ada
+     e48:	6a 01                	push   $0x1
+     e4a:	e8 51 35 00 00       	call   43a0 <printf>
+    exit();
+     e4f:	e8 ff 33 00 00       	call   4253 <exit>
+        printf(1, "pipe1 oops 1\n");
+     e54:	57                   	push   %edi
+     e55:	57                   	push   %edi
+     e56:	68 9d 4a 00 00       	push   $0x4a9d
+     e5b:	6a 01                	push   $0x1
+     e5d:	e8 3e 35 00 00       	call   43a0 <printf>
+        exit();
+     e62:	e8 ec 33 00 00       	call   4253 <exit>
+     e67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6e:	66 90                	xchg   %ax,%ax
+
+00000e70 <preempt>:
+{
+     e70:	55                   	push   %ebp
+     e71:	89 e5                	mov    %esp,%ebp
+     e73:	57                   	push   %edi
+     e74:	56                   	push   %esi
+     e75:	53                   	push   %ebx
+     e76:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     e79:	68 e9 4a 00 00       	push   $0x4ae9
+     e7e:	6a 01                	push   $0x1
+     e80:	e8 1b 35 00 00       	call   43a0 <printf>
+  pid1 = fork();
+     e85:	e8 c1 33 00 00       	call   424b <fork>
+  if(pid1 == 0)
+     e8a:	83 c4 10             	add    $0x10,%esp
+     e8d:	85 c0                	test   %eax,%eax
+     e8f:	75 07                	jne    e98 <preempt+0x28>
+    for(;;)
+     e91:	eb fe                	jmp    e91 <preempt+0x21>
+     e93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e97:	90                   	nop
+     e98:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     e9a:	e8 ac 33 00 00       	call   424b <fork>
+     e9f:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     ea1:	85 c0                	test   %eax,%eax
+     ea3:	75 0b                	jne    eb0 <preempt+0x40>
+    for(;;)
+     ea5:	eb fe                	jmp    ea5 <preempt+0x35>
+     ea7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eae:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     eb0:	83 ec 0c             	sub    $0xc,%esp
+     eb3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     eb6:	50                   	push   %eax
+     eb7:	e8 a7 33 00 00       	call   4263 <pipe>
+  pid3 = fork();
+     ebc:	e8 8a 33 00 00       	call   424b <fork>
+  if(pid3 == 0){
+     ec1:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     ec4:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     ec6:	85 c0                	test   %eax,%eax
+     ec8:	75 3e                	jne    f08 <preempt+0x98>
+    close(pfds[0]);
+     eca:	83 ec 0c             	sub    $0xc,%esp
+     ecd:	ff 75 e0             	push   -0x20(%ebp)
+     ed0:	e8 a6 33 00 00       	call   427b <close>
+    if(write(pfds[1], "x", 1) != 1)
+     ed5:	83 c4 0c             	add    $0xc,%esp
+     ed8:	6a 01                	push   $0x1
+     eda:	68 c0 51 00 00       	push   $0x51c0
+     edf:	ff 75 e4             	push   -0x1c(%ebp)
+     ee2:	e8 8c 33 00 00       	call   4273 <write>
+     ee7:	83 c4 10             	add    $0x10,%esp
+     eea:	83 f8 01             	cmp    $0x1,%eax
+     eed:	0f 85 b8 00 00 00    	jne    fab <preempt+0x13b>
+    close(pfds[1]);
+     ef3:	83 ec 0c             	sub    $0xc,%esp
+     ef6:	ff 75 e4             	push   -0x1c(%ebp)
+     ef9:	e8 7d 33 00 00       	call   427b <close>
+     efe:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     f01:	eb fe                	jmp    f01 <preempt+0x91>
+     f03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f07:	90                   	nop
+  close(pfds[1]);
+     f08:	83 ec 0c             	sub    $0xc,%esp
+     f0b:	ff 75 e4             	push   -0x1c(%ebp)
+     f0e:	e8 68 33 00 00       	call   427b <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     f13:	83 c4 0c             	add    $0xc,%esp
+     f16:	68 00 20 00 00       	push   $0x2000
+     f1b:	68 20 93 00 00       	push   $0x9320
+     f20:	ff 75 e0             	push   -0x20(%ebp)
+     f23:	e8 43 33 00 00       	call   426b <read>
+     f28:	83 c4 10             	add    $0x10,%esp
+     f2b:	83 f8 01             	cmp    $0x1,%eax
+     f2e:	75 67                	jne    f97 <preempt+0x127>
+  close(pfds[0]);
+     f30:	83 ec 0c             	sub    $0xc,%esp
+     f33:	ff 75 e0             	push   -0x20(%ebp)
+     f36:	e8 40 33 00 00       	call   427b <close>
+  printf(1, "kill... ");
+     f3b:	58                   	pop    %eax
+     f3c:	5a                   	pop    %edx
+     f3d:	68 1a 4b 00 00       	push   $0x4b1a
+     f42:	6a 01                	push   $0x1
+     f44:	e8 57 34 00 00       	call   43a0 <printf>
+  kill(pid1);
+     f49:	89 1c 24             	mov    %ebx,(%esp)
+     f4c:	e8 32 33 00 00       	call   4283 <kill>
+  kill(pid2);
+     f51:	89 34 24             	mov    %esi,(%esp)
+     f54:	e8 2a 33 00 00       	call   4283 <kill>
+  kill(pid3);
+     f59:	89 3c 24             	mov    %edi,(%esp)
+     f5c:	e8 22 33 00 00       	call   4283 <kill>
+  printf(1, "wait... ");
+     f61:	59                   	pop    %ecx
+     f62:	5b                   	pop    %ebx
+     f63:	68 23 4b 00 00       	push   $0x4b23
+     f68:	6a 01                	push   $0x1
+     f6a:	e8 31 34 00 00       	call   43a0 <printf>
+  wait();
+     f6f:	e8 e7 32 00 00       	call   425b <wait>
+  wait();
+     f74:	e8 e2 32 00 00       	call   425b <wait>
+  wait();
+     f79:	e8 dd 32 00 00       	call   425b <wait>
+  printf(1, "preempt ok\n");
+     f7e:	5e                   	pop    %esi
+     f7f:	5f                   	pop    %edi
+     f80:	68 2c 4b 00 00       	push   $0x4b2c
+     f85:	6a 01                	push   $0x1
+     f87:	e8 14 34 00 00       	call   43a0 <printf>
+     f8c:	83 c4 10             	add    $0x10,%esp
+}
+     f8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f92:	5b                   	pop    %ebx
+     f93:	5e                   	pop    %esi
+     f94:	5f                   	pop    %edi
+     f95:	5d                   	pop    %ebp
+     f96:	c3                   	ret
+    printf(1, "preempt read error");
+     f97:	83 ec 08             	sub    $0x8,%esp
+     f9a:	68 07 4b 00 00       	push   $0x4b07
+     f9f:	6a 01                	push   $0x1
+     fa1:	e8 fa 33 00 00       	call   43a0 <printf>
+     fa6:	83 c4 10             	add    $0x10,%esp
+     fa9:	eb e4                	jmp    f8f <preempt+0x11f>
+      printf(1, "preempt write error");
+     fab:	83 ec 08             	sub    $0x8,%esp
+     fae:	68 f3 4a 00 00       	push   $0x4af3
+     fb3:	6a 01                	push   $0x1
+     fb5:	e8 e6 33 00 00       	call   43a0 <printf>
+     fba:	83 c4 10             	add    $0x10,%esp
+     fbd:	e9 31 ff ff ff       	jmp    ef3 <preempt+0x83>
+     fc2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000fd0 <exitwait>:
+{
+     fd0:	55                   	push   %ebp
+     fd1:	89 e5                	mov    %esp,%ebp
+     fd3:	56                   	push   %esi
+     fd4:	be 64 00 00 00       	mov    $0x64,%esi
+     fd9:	53                   	push   %ebx
+     fda:	eb 14                	jmp    ff0 <exitwait+0x20>
+     fdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     fe0:	74 68                	je     104a <exitwait+0x7a>
+      if(wait() != pid){
+     fe2:	e8 74 32 00 00       	call   425b <wait>
+     fe7:	39 d8                	cmp    %ebx,%eax
+     fe9:	75 2d                	jne    1018 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     feb:	83 ee 01             	sub    $0x1,%esi
+     fee:	74 41                	je     1031 <exitwait+0x61>
+    pid = fork();
+     ff0:	e8 56 32 00 00       	call   424b <fork>
+     ff5:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     ff7:	85 c0                	test   %eax,%eax
+     ff9:	79 e5                	jns    fe0 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     ffb:	83 ec 08             	sub    $0x8,%esp
+     ffe:	68 3a 58 00 00       	push   $0x583a
+    1003:	6a 01                	push   $0x1
+    1005:	e8 96 33 00 00       	call   43a0 <printf>
+      return;
+    100a:	83 c4 10             	add    $0x10,%esp
+}
+    100d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1010:	5b                   	pop    %ebx
+    1011:	5e                   	pop    %esi
+    1012:	5d                   	pop    %ebp
+    1013:	c3                   	ret
+    1014:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+    1018:	83 ec 08             	sub    $0x8,%esp
+    101b:	68 38 4b 00 00       	push   $0x4b38
+    1020:	6a 01                	push   $0x1
+    1022:	e8 79 33 00 00       	call   43a0 <printf>
+        return;
+    1027:	83 c4 10             	add    $0x10,%esp
+}
+    102a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    102d:	5b                   	pop    %ebx
+    102e:	5e                   	pop    %esi
+    102f:	5d                   	pop    %ebp
+    1030:	c3                   	ret
+  printf(1, "exitwait ok\n");
+    1031:	83 ec 08             	sub    $0x8,%esp
+    1034:	68 48 4b 00 00       	push   $0x4b48
+    1039:	6a 01                	push   $0x1
+    103b:	e8 60 33 00 00       	call   43a0 <printf>
+    1040:	83 c4 10             	add    $0x10,%esp
+}
+    1043:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1046:	5b                   	pop    %ebx
+    1047:	5e                   	pop    %esi
+    1048:	5d                   	pop    %ebp
+    1049:	c3                   	ret
+      exit();
+    104a:	e8 04 32 00 00       	call   4253 <exit>
+    104f:	90                   	nop
+
+00001050 <mem>:
+{
+    1050:	55                   	push   %ebp
+    1051:	89 e5                	mov    %esp,%ebp
+    1053:	56                   	push   %esi
+    1054:	31 f6                	xor    %esi,%esi
+    1056:	53                   	push   %ebx
+  printf(1, "mem test\n");
+    1057:	83 ec 08             	sub    $0x8,%esp
+    105a:	68 55 4b 00 00       	push   $0x4b55
+    105f:	6a 01                	push   $0x1
+    1061:	e8 3a 33 00 00       	call   43a0 <printf>
+  ppid = getpid();
+    1066:	e8 68 32 00 00       	call   42d3 <getpid>
+    106b:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+    106d:	e8 d9 31 00 00       	call   424b <fork>
+    1072:	83 c4 10             	add    $0x10,%esp
+    1075:	85 c0                	test   %eax,%eax
+    1077:	74 0b                	je     1084 <mem+0x34>
+    1079:	e9 8a 00 00 00       	jmp    1108 <mem+0xb8>
+    107e:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+    1080:	89 30                	mov    %esi,(%eax)
+    1082:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+    1084:	83 ec 0c             	sub    $0xc,%esp
+    1087:	68 11 27 00 00       	push   $0x2711
+    108c:	e8 4f 35 00 00       	call   45e0 <malloc>
+    1091:	83 c4 10             	add    $0x10,%esp
+    1094:	85 c0                	test   %eax,%eax
+    1096:	75 e8                	jne    1080 <mem+0x30>
+    while(m1){
+    1098:	85 f6                	test   %esi,%esi
+    109a:	74 18                	je     10b4 <mem+0x64>
+    109c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+    10a0:	89 f0                	mov    %esi,%eax
+      free(m1);
+    10a2:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+    10a5:	8b 36                	mov    (%esi),%esi
+      free(m1);
+    10a7:	50                   	push   %eax
+    10a8:	e8 a3 34 00 00       	call   4550 <free>
+    while(m1){
+    10ad:	83 c4 10             	add    $0x10,%esp
+    10b0:	85 f6                	test   %esi,%esi
+    10b2:	75 ec                	jne    10a0 <mem+0x50>
+    m1 = malloc(1024*20);
+    10b4:	83 ec 0c             	sub    $0xc,%esp
+    10b7:	68 00 50 00 00       	push   $0x5000
+    10bc:	e8 1f 35 00 00       	call   45e0 <malloc>
+    if(m1 == 0){
+    10c1:	83 c4 10             	add    $0x10,%esp
+    10c4:	85 c0                	test   %eax,%eax
+    10c6:	74 20                	je     10e8 <mem+0x98>
+    free(m1);
+    10c8:	83 ec 0c             	sub    $0xc,%esp
+    10cb:	50                   	push   %eax
+    10cc:	e8 7f 34 00 00       	call   4550 <free>
+    printf(1, "mem ok\n");
+    10d1:	58                   	pop    %eax
+    10d2:	5a                   	pop    %edx
+    10d3:	68 79 4b 00 00       	push   $0x4b79
+    10d8:	6a 01                	push   $0x1
+    10da:	e8 c1 32 00 00       	call   43a0 <printf>
+    exit();
+    10df:	e8 6f 31 00 00       	call   4253 <exit>
+    10e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+    10e8:	83 ec 08             	sub    $0x8,%esp
+    10eb:	68 5f 4b 00 00       	push   $0x4b5f
+    10f0:	6a 01                	push   $0x1
+    10f2:	e8 a9 32 00 00       	call   43a0 <printf>
+      kill(ppid);
+    10f7:	89 1c 24             	mov    %ebx,(%esp)
+    10fa:	e8 84 31 00 00       	call   4283 <kill>
+      exit();
+    10ff:	e8 4f 31 00 00       	call   4253 <exit>
+    1104:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1108:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    110b:	5b                   	pop    %ebx
+    110c:	5e                   	pop    %esi
+    110d:	5d                   	pop    %ebp
+    wait();
+    110e:	e9 48 31 00 00       	jmp    425b <wait>
+    1113:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001120 <sharedfd>:
+{
+    1120:	55                   	push   %ebp
+    1121:	89 e5                	mov    %esp,%ebp
+    1123:	57                   	push   %edi
+    1124:	56                   	push   %esi
+    1125:	53                   	push   %ebx
+    1126:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+    1129:	68 81 4b 00 00       	push   $0x4b81
+    112e:	6a 01                	push   $0x1
+    1130:	e8 6b 32 00 00       	call   43a0 <printf>
+  unlink("sharedfd");
+    1135:	c7 04 24 90 4b 00 00 	movl   $0x4b90,(%esp)
+    113c:	e8 62 31 00 00       	call   42a3 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    1141:	5b                   	pop    %ebx
+    1142:	5e                   	pop    %esi
+    1143:	68 02 02 00 00       	push   $0x202
+    1148:	68 90 4b 00 00       	push   $0x4b90
+    114d:	e8 41 31 00 00       	call   4293 <open>
+  if(fd < 0){
+    1152:	83 c4 10             	add    $0x10,%esp
+    1155:	85 c0                	test   %eax,%eax
+    1157:	0f 88 2a 01 00 00    	js     1287 <sharedfd+0x167>
+    115d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    115f:	8d 75 de             	lea    -0x22(%ebp),%esi
+    1162:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    1167:	e8 df 30 00 00       	call   424b <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    116c:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    116f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1172:	19 c0                	sbb    %eax,%eax
+    1174:	83 ec 04             	sub    $0x4,%esp
+    1177:	83 e0 f3             	and    $0xfffffff3,%eax
+    117a:	6a 0a                	push   $0xa
+    117c:	83 c0 70             	add    $0x70,%eax
+    117f:	50                   	push   %eax
+    1180:	56                   	push   %esi
+    1181:	e8 4a 2f 00 00       	call   40d0 <memset>
+    1186:	83 c4 10             	add    $0x10,%esp
+    1189:	eb 0a                	jmp    1195 <sharedfd+0x75>
+    118b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    118f:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    1190:	83 eb 01             	sub    $0x1,%ebx
+    1193:	74 26                	je     11bb <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    1195:	83 ec 04             	sub    $0x4,%esp
+    1198:	6a 0a                	push   $0xa
+    119a:	56                   	push   %esi
+    119b:	57                   	push   %edi
+    119c:	e8 d2 30 00 00       	call   4273 <write>
+    11a1:	83 c4 10             	add    $0x10,%esp
+    11a4:	83 f8 0a             	cmp    $0xa,%eax
+    11a7:	74 e7                	je     1190 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    11a9:	83 ec 08             	sub    $0x8,%esp
+    11ac:	68 24 5a 00 00       	push   $0x5a24
+    11b1:	6a 01                	push   $0x1
+    11b3:	e8 e8 31 00 00       	call   43a0 <printf>
+      break;
+    11b8:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    11bb:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    11be:	85 c9                	test   %ecx,%ecx
+    11c0:	0f 84 f5 00 00 00    	je     12bb <sharedfd+0x19b>
+    wait();
+    11c6:	e8 90 30 00 00       	call   425b <wait>
+  close(fd);
+    11cb:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    11ce:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    11d0:	57                   	push   %edi
+    11d1:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    11d4:	e8 a2 30 00 00       	call   427b <close>
+  fd = open("sharedfd", 0);
+    11d9:	58                   	pop    %eax
+    11da:	5a                   	pop    %edx
+    11db:	6a 00                	push   $0x0
+    11dd:	68 90 4b 00 00       	push   $0x4b90
+    11e2:	e8 ac 30 00 00       	call   4293 <open>
+  if(fd < 0){
+    11e7:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    11ea:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    11ec:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    11ef:	85 c0                	test   %eax,%eax
+    11f1:	0f 88 aa 00 00 00    	js     12a1 <sharedfd+0x181>
+    11f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11fe:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    1200:	83 ec 04             	sub    $0x4,%esp
+    1203:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1206:	6a 0a                	push   $0xa
+    1208:	56                   	push   %esi
+    1209:	ff 75 d0             	push   -0x30(%ebp)
+    120c:	e8 5a 30 00 00       	call   426b <read>
+    1211:	83 c4 10             	add    $0x10,%esp
+    1214:	85 c0                	test   %eax,%eax
+    1216:	7e 28                	jle    1240 <sharedfd+0x120>
+    1218:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    121b:	89 f0                	mov    %esi,%eax
+    121d:	eb 13                	jmp    1232 <sharedfd+0x112>
+    121f:	90                   	nop
+        np++;
+    1220:	80 f9 70             	cmp    $0x70,%cl
+    1223:	0f 94 c1             	sete   %cl
+    1226:	0f b6 c9             	movzbl %cl,%ecx
+    1229:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    122b:	83 c0 01             	add    $0x1,%eax
+    122e:	39 f8                	cmp    %edi,%eax
+    1230:	74 ce                	je     1200 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    1232:	0f b6 08             	movzbl (%eax),%ecx
+    1235:	80 f9 63             	cmp    $0x63,%cl
+    1238:	75 e6                	jne    1220 <sharedfd+0x100>
+        nc++;
+    123a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    123d:	eb ec                	jmp    122b <sharedfd+0x10b>
+    123f:	90                   	nop
+  close(fd);
+    1240:	83 ec 0c             	sub    $0xc,%esp
+    1243:	ff 75 d0             	push   -0x30(%ebp)
+    1246:	e8 30 30 00 00       	call   427b <close>
+  unlink("sharedfd");
+    124b:	c7 04 24 90 4b 00 00 	movl   $0x4b90,(%esp)
+    1252:	e8 4c 30 00 00       	call   42a3 <unlink>
+  if(nc == 10000 && np == 10000){
+    1257:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    125a:	83 c4 10             	add    $0x10,%esp
+    125d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    1263:	75 5b                	jne    12c0 <sharedfd+0x1a0>
+    1265:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    126b:	75 53                	jne    12c0 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    126d:	83 ec 08             	sub    $0x8,%esp
+    1270:	68 99 4b 00 00       	push   $0x4b99
+    1275:	6a 01                	push   $0x1
+    1277:	e8 24 31 00 00       	call   43a0 <printf>
+    127c:	83 c4 10             	add    $0x10,%esp
+}
+    127f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1282:	5b                   	pop    %ebx
+    1283:	5e                   	pop    %esi
+    1284:	5f                   	pop    %edi
+    1285:	5d                   	pop    %ebp
+    1286:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1287:	83 ec 08             	sub    $0x8,%esp
+    128a:	68 f8 59 00 00       	push   $0x59f8
+    128f:	6a 01                	push   $0x1
+    1291:	e8 0a 31 00 00       	call   43a0 <printf>
+    return;
+    1296:	83 c4 10             	add    $0x10,%esp
+}
+    1299:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    129c:	5b                   	pop    %ebx
+    129d:	5e                   	pop    %esi
+    129e:	5f                   	pop    %edi
+    129f:	5d                   	pop    %ebp
+    12a0:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    12a1:	83 ec 08             	sub    $0x8,%esp
+    12a4:	68 44 5a 00 00       	push   $0x5a44
+    12a9:	6a 01                	push   $0x1
+    12ab:	e8 f0 30 00 00       	call   43a0 <printf>
+    return;
+    12b0:	83 c4 10             	add    $0x10,%esp
+}
+    12b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12b6:	5b                   	pop    %ebx
+    12b7:	5e                   	pop    %esi
+    12b8:	5f                   	pop    %edi
+    12b9:	5d                   	pop    %ebp
+    12ba:	c3                   	ret
+    exit();
+    12bb:	e8 93 2f 00 00       	call   4253 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    12c0:	53                   	push   %ebx
+    12c1:	52                   	push   %edx
+    12c2:	68 a6 4b 00 00       	push   $0x4ba6
+    12c7:	6a 01                	push   $0x1
+    12c9:	e8 d2 30 00 00       	call   43a0 <printf>
+    exit();
+    12ce:	e8 80 2f 00 00       	call   4253 <exit>
+    12d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000012e0 <fourfiles>:
+{
+    12e0:	55                   	push   %ebp
+    12e1:	89 e5                	mov    %esp,%ebp
+    12e3:	57                   	push   %edi
+    12e4:	56                   	push   %esi
+    12e5:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    12e6:	31 db                	xor    %ebx,%ebx
+{
+    12e8:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    12eb:	c7 45 d8 bb 4b 00 00 	movl   $0x4bbb,-0x28(%ebp)
+    12f2:	c7 45 dc 04 4d 00 00 	movl   $0x4d04,-0x24(%ebp)
+    12f9:	c7 45 e0 08 4d 00 00 	movl   $0x4d08,-0x20(%ebp)
+    1300:	c7 45 e4 be 4b 00 00 	movl   $0x4bbe,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    1307:	68 c1 4b 00 00       	push   $0x4bc1
+    130c:	6a 01                	push   $0x1
+    130e:	e8 8d 30 00 00       	call   43a0 <printf>
+    1313:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    1316:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    131a:	83 ec 0c             	sub    $0xc,%esp
+    131d:	56                   	push   %esi
+    131e:	e8 80 2f 00 00       	call   42a3 <unlink>
+    pid = fork();
+    1323:	e8 23 2f 00 00       	call   424b <fork>
+    if(pid < 0){
+    1328:	83 c4 10             	add    $0x10,%esp
+    132b:	85 c0                	test   %eax,%eax
+    132d:	0f 88 65 01 00 00    	js     1498 <fourfiles+0x1b8>
+    if(pid == 0){
+    1333:	0f 84 eb 00 00 00    	je     1424 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    1339:	83 c3 01             	add    $0x1,%ebx
+    133c:	83 fb 04             	cmp    $0x4,%ebx
+    133f:	75 d5                	jne    1316 <fourfiles+0x36>
+    wait();
+    1341:	e8 15 2f 00 00       	call   425b <wait>
+  for(i = 0; i < 2; i++){
+    1346:	31 f6                	xor    %esi,%esi
+    wait();
+    1348:	e8 0e 2f 00 00       	call   425b <wait>
+    134d:	e8 09 2f 00 00       	call   425b <wait>
+    1352:	e8 04 2f 00 00       	call   425b <wait>
+    fname = names[i];
+    1357:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    135b:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    135e:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    1360:	6a 00                	push   $0x0
+    1362:	53                   	push   %ebx
+    1363:	e8 2b 2f 00 00       	call   4293 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1368:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    136b:	83 c4 10             	add    $0x10,%esp
+    136e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    1371:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1378:	83 ec 04             	sub    $0x4,%esp
+    137b:	68 00 20 00 00       	push   $0x2000
+    1380:	68 20 93 00 00       	push   $0x9320
+    1385:	ff 75 d4             	push   -0x2c(%ebp)
+    1388:	e8 de 2e 00 00       	call   426b <read>
+    138d:	83 c4 10             	add    $0x10,%esp
+    1390:	89 c3                	mov    %eax,%ebx
+    1392:	85 c0                	test   %eax,%eax
+    1394:	7e 28                	jle    13be <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    1396:	31 c0                	xor    %eax,%eax
+    1398:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    139f:	90                   	nop
+        if(buf[j] != '0'+i){
+    13a0:	83 fe 01             	cmp    $0x1,%esi
+    13a3:	0f be 88 20 93 00 00 	movsbl 0x9320(%eax),%ecx
+    13aa:	19 d2                	sbb    %edx,%edx
+    13ac:	83 c2 31             	add    $0x31,%edx
+    13af:	39 d1                	cmp    %edx,%ecx
+    13b1:	75 5d                	jne    1410 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    13b3:	83 c0 01             	add    $0x1,%eax
+    13b6:	39 c3                	cmp    %eax,%ebx
+    13b8:	75 e6                	jne    13a0 <fourfiles+0xc0>
+      total += n;
+    13ba:	01 df                	add    %ebx,%edi
+    13bc:	eb ba                	jmp    1378 <fourfiles+0x98>
+    close(fd);
+    13be:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    13c1:	83 ec 0c             	sub    $0xc,%esp
+    13c4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    13c7:	51                   	push   %ecx
+    13c8:	e8 ae 2e 00 00       	call   427b <close>
+    if(total != 12*500){
+    13cd:	83 c4 10             	add    $0x10,%esp
+    13d0:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    13d6:	0f 85 d0 00 00 00    	jne    14ac <fourfiles+0x1cc>
+    unlink(fname);
+    13dc:	83 ec 0c             	sub    $0xc,%esp
+    13df:	53                   	push   %ebx
+    13e0:	e8 be 2e 00 00       	call   42a3 <unlink>
+  for(i = 0; i < 2; i++){
+    13e5:	83 c4 10             	add    $0x10,%esp
+    13e8:	85 f6                	test   %esi,%esi
+    13ea:	75 0a                	jne    13f6 <fourfiles+0x116>
+    13ec:	be 01 00 00 00       	mov    $0x1,%esi
+    13f1:	e9 61 ff ff ff       	jmp    1357 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    13f6:	83 ec 08             	sub    $0x8,%esp
+    13f9:	68 ff 4b 00 00       	push   $0x4bff
+    13fe:	6a 01                	push   $0x1
+    1400:	e8 9b 2f 00 00       	call   43a0 <printf>
+}
+    1405:	83 c4 10             	add    $0x10,%esp
+    1408:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    140b:	5b                   	pop    %ebx
+    140c:	5e                   	pop    %esi
+    140d:	5f                   	pop    %edi
+    140e:	5d                   	pop    %ebp
+    140f:	c3                   	ret
+          printf(1, "wrong char\n");
+    1410:	83 ec 08             	sub    $0x8,%esp
+    1413:	68 e2 4b 00 00       	push   $0x4be2
+    1418:	6a 01                	push   $0x1
+    141a:	e8 81 2f 00 00       	call   43a0 <printf>
+          exit();
+    141f:	e8 2f 2e 00 00       	call   4253 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1424:	83 ec 08             	sub    $0x8,%esp
+    1427:	68 02 02 00 00       	push   $0x202
+    142c:	56                   	push   %esi
+    142d:	e8 61 2e 00 00       	call   4293 <open>
+      if(fd < 0){
+    1432:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    1435:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    1437:	85 c0                	test   %eax,%eax
+    1439:	78 45                	js     1480 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    143b:	83 ec 04             	sub    $0x4,%esp
+    143e:	83 c3 30             	add    $0x30,%ebx
+    1441:	68 00 02 00 00       	push   $0x200
+    1446:	53                   	push   %ebx
+    1447:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    144c:	68 20 93 00 00       	push   $0x9320
+    1451:	e8 7a 2c 00 00       	call   40d0 <memset>
+    1456:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    1459:	83 ec 04             	sub    $0x4,%esp
+    145c:	68 f4 01 00 00       	push   $0x1f4
+    1461:	68 20 93 00 00       	push   $0x9320
+    1466:	56                   	push   %esi
+    1467:	e8 07 2e 00 00       	call   4273 <write>
+    146c:	83 c4 10             	add    $0x10,%esp
+    146f:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    1474:	75 49                	jne    14bf <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    1476:	83 eb 01             	sub    $0x1,%ebx
+    1479:	75 de                	jne    1459 <fourfiles+0x179>
+      exit();
+    147b:	e8 d3 2d 00 00       	call   4253 <exit>
+        printf(1, "create failed\n");
+    1480:	51                   	push   %ecx
+    1481:	51                   	push   %ecx
+    1482:	68 5c 4e 00 00       	push   $0x4e5c
+    1487:	6a 01                	push   $0x1
+    1489:	e8 12 2f 00 00       	call   43a0 <printf>
+        exit();
+    148e:	e8 c0 2d 00 00       	call   4253 <exit>
+    1493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1497:	90                   	nop
+      printf(1, "fork failed\n");
+    1498:	83 ec 08             	sub    $0x8,%esp
+    149b:	68 3a 58 00 00       	push   $0x583a
+    14a0:	6a 01                	push   $0x1
+    14a2:	e8 f9 2e 00 00       	call   43a0 <printf>
+      exit();
+    14a7:	e8 a7 2d 00 00       	call   4253 <exit>
+      printf(1, "wrong length %d\n", total);
+    14ac:	50                   	push   %eax
+    14ad:	57                   	push   %edi
+    14ae:	68 ee 4b 00 00       	push   $0x4bee
+    14b3:	6a 01                	push   $0x1
+    14b5:	e8 e6 2e 00 00       	call   43a0 <printf>
+      exit();
+    14ba:	e8 94 2d 00 00       	call   4253 <exit>
+          printf(1, "write failed %d\n", n);
+    14bf:	52                   	push   %edx
+    14c0:	50                   	push   %eax
+    14c1:	68 d1 4b 00 00       	push   $0x4bd1
+    14c6:	6a 01                	push   $0x1
+    14c8:	e8 d3 2e 00 00       	call   43a0 <printf>
+          exit();
+    14cd:	e8 81 2d 00 00       	call   4253 <exit>
+    14d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000014e0 <createdelete>:
+{
+    14e0:	55                   	push   %ebp
+    14e1:	89 e5                	mov    %esp,%ebp
+    14e3:	57                   	push   %edi
+    14e4:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    14e5:	31 f6                	xor    %esi,%esi
+{
+    14e7:	53                   	push   %ebx
+    14e8:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    14eb:	68 0d 4c 00 00       	push   $0x4c0d
+    14f0:	6a 01                	push   $0x1
+    14f2:	e8 a9 2e 00 00       	call   43a0 <printf>
+    14f7:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    14fa:	e8 4c 2d 00 00       	call   424b <fork>
+    14ff:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1501:	85 c0                	test   %eax,%eax
+    1503:	0f 88 ac 01 00 00    	js     16b5 <createdelete+0x1d5>
+    if(pid == 0){
+    1509:	0f 84 01 01 00 00    	je     1610 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    150f:	83 c6 01             	add    $0x1,%esi
+    1512:	83 fe 04             	cmp    $0x4,%esi
+    1515:	75 e3                	jne    14fa <createdelete+0x1a>
+    wait();
+    1517:	e8 3f 2d 00 00       	call   425b <wait>
+  for(i = 0; i < N; i++){
+    151c:	31 ff                	xor    %edi,%edi
+    151e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    1521:	e8 35 2d 00 00       	call   425b <wait>
+    1526:	e8 30 2d 00 00       	call   425b <wait>
+    152b:	e8 2b 2d 00 00       	call   425b <wait>
+  name[0] = name[1] = name[2] = 0;
+    1530:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    1534:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    1538:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    153a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    153d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    1542:	0f 94 c2             	sete   %dl
+    1545:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    1548:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    154b:	0f 9f c0             	setg   %al
+    154e:	09 c2                	or     %eax,%edx
+    1550:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    1553:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    1557:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    155a:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    155d:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    1560:	6a 00                	push   $0x0
+    1562:	56                   	push   %esi
+    1563:	e8 2b 2d 00 00       	call   4293 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    1568:	83 c4 10             	add    $0x10,%esp
+    156b:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    156f:	74 7f                	je     15f0 <createdelete+0x110>
+    1571:	85 c0                	test   %eax,%eax
+    1573:	0f 88 27 01 00 00    	js     16a0 <createdelete+0x1c0>
+        close(fd);
+    1579:	83 ec 0c             	sub    $0xc,%esp
+    157c:	50                   	push   %eax
+    157d:	e8 f9 2c 00 00       	call   427b <close>
+    1582:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    1585:	83 c3 01             	add    $0x1,%ebx
+    1588:	80 fb 74             	cmp    $0x74,%bl
+    158b:	75 c6                	jne    1553 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    158d:	83 c7 01             	add    $0x1,%edi
+    1590:	83 ff 14             	cmp    $0x14,%edi
+    1593:	75 a3                	jne    1538 <createdelete+0x58>
+    1595:	bf 70 00 00 00       	mov    $0x70,%edi
+    159a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    15a0:	8d 47 c0             	lea    -0x40(%edi),%eax
+    15a3:	bb 04 00 00 00       	mov    $0x4,%ebx
+    15a8:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    15ab:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    15ad:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    15b0:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    15b3:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    15b7:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    15ba:	56                   	push   %esi
+    15bb:	e8 e3 2c 00 00       	call   42a3 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    15c0:	83 c4 10             	add    $0x10,%esp
+    15c3:	83 eb 01             	sub    $0x1,%ebx
+    15c6:	75 e3                	jne    15ab <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    15c8:	83 c7 01             	add    $0x1,%edi
+    15cb:	89 f8                	mov    %edi,%eax
+    15cd:	3c 84                	cmp    $0x84,%al
+    15cf:	75 cf                	jne    15a0 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    15d1:	83 ec 08             	sub    $0x8,%esp
+    15d4:	68 20 4c 00 00       	push   $0x4c20
+    15d9:	6a 01                	push   $0x1
+    15db:	e8 c0 2d 00 00       	call   43a0 <printf>
+}
+    15e0:	83 c4 10             	add    $0x10,%esp
+    15e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15e6:	5b                   	pop    %ebx
+    15e7:	5e                   	pop    %esi
+    15e8:	5f                   	pop    %edi
+    15e9:	5d                   	pop    %ebp
+    15ea:	c3                   	ret
+    15eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15ef:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    15f0:	85 c0                	test   %eax,%eax
+    15f2:	78 91                	js     1585 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    15f4:	50                   	push   %eax
+    15f5:	56                   	push   %esi
+    15f6:	68 94 5a 00 00       	push   $0x5a94
+    15fb:	6a 01                	push   $0x1
+    15fd:	e8 9e 2d 00 00       	call   43a0 <printf>
+        exit();
+    1602:	e8 4c 2c 00 00       	call   4253 <exit>
+    1607:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    160e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    1610:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    1613:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1617:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    161a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    161d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1620:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1623:	8d 43 30             	lea    0x30(%ebx),%eax
+    1626:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1629:	68 02 02 00 00       	push   $0x202
+    162e:	56                   	push   %esi
+    162f:	e8 5f 2c 00 00       	call   4293 <open>
+        if(fd < 0){
+    1634:	83 c4 10             	add    $0x10,%esp
+    1637:	85 c0                	test   %eax,%eax
+    1639:	0f 88 8a 00 00 00    	js     16c9 <createdelete+0x1e9>
+        close(fd);
+    163f:	83 ec 0c             	sub    $0xc,%esp
+    1642:	50                   	push   %eax
+    1643:	e8 33 2c 00 00       	call   427b <close>
+        if(i > 0 && (i % 2 ) == 0){
+    1648:	83 c4 10             	add    $0x10,%esp
+    164b:	85 db                	test   %ebx,%ebx
+    164d:	74 19                	je     1668 <createdelete+0x188>
+    164f:	f6 c3 01             	test   $0x1,%bl
+    1652:	74 1b                	je     166f <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    1654:	83 c3 01             	add    $0x1,%ebx
+    1657:	83 fb 14             	cmp    $0x14,%ebx
+    165a:	75 c4                	jne    1620 <createdelete+0x140>
+      exit();
+    165c:	e8 f2 2b 00 00       	call   4253 <exit>
+    1661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    1668:	bb 01 00 00 00       	mov    $0x1,%ebx
+    166d:	eb b1                	jmp    1620 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    166f:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    1671:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    1674:	d1 f8                	sar    %eax
+    1676:	83 c0 30             	add    $0x30,%eax
+    1679:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    167c:	56                   	push   %esi
+    167d:	e8 21 2c 00 00       	call   42a3 <unlink>
+    1682:	83 c4 10             	add    $0x10,%esp
+    1685:	85 c0                	test   %eax,%eax
+    1687:	79 cb                	jns    1654 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    1689:	52                   	push   %edx
+    168a:	52                   	push   %edx
+    168b:	68 7f 47 00 00       	push   $0x477f
+    1690:	6a 01                	push   $0x1
+    1692:	e8 09 2d 00 00       	call   43a0 <printf>
+            exit();
+    1697:	e8 b7 2b 00 00       	call   4253 <exit>
+    169c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    16a0:	83 ec 04             	sub    $0x4,%esp
+    16a3:	56                   	push   %esi
+    16a4:	68 70 5a 00 00       	push   $0x5a70
+    16a9:	6a 01                	push   $0x1
+    16ab:	e8 f0 2c 00 00       	call   43a0 <printf>
+        exit();
+    16b0:	e8 9e 2b 00 00       	call   4253 <exit>
+      printf(1, "fork failed\n");
+    16b5:	83 ec 08             	sub    $0x8,%esp
+    16b8:	68 3a 58 00 00       	push   $0x583a
+    16bd:	6a 01                	push   $0x1
+    16bf:	e8 dc 2c 00 00       	call   43a0 <printf>
+      exit();
+    16c4:	e8 8a 2b 00 00       	call   4253 <exit>
+          printf(1, "create failed\n");
+    16c9:	83 ec 08             	sub    $0x8,%esp
+    16cc:	68 5c 4e 00 00       	push   $0x4e5c
+    16d1:	6a 01                	push   $0x1
+    16d3:	e8 c8 2c 00 00       	call   43a0 <printf>
+          exit();
+    16d8:	e8 76 2b 00 00       	call   4253 <exit>
+    16dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000016e0 <unlinkread>:
+{
+    16e0:	55                   	push   %ebp
+    16e1:	89 e5                	mov    %esp,%ebp
+    16e3:	56                   	push   %esi
+    16e4:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    16e5:	83 ec 08             	sub    $0x8,%esp
+    16e8:	68 31 4c 00 00       	push   $0x4c31
+    16ed:	6a 01                	push   $0x1
+    16ef:	e8 ac 2c 00 00       	call   43a0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    16f4:	5b                   	pop    %ebx
+    16f5:	5e                   	pop    %esi
+    16f6:	68 02 02 00 00       	push   $0x202
+    16fb:	68 42 4c 00 00       	push   $0x4c42
+    1700:	e8 8e 2b 00 00       	call   4293 <open>
+  if(fd < 0){
+    1705:	83 c4 10             	add    $0x10,%esp
+    1708:	85 c0                	test   %eax,%eax
+    170a:	0f 88 e6 00 00 00    	js     17f6 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1710:	83 ec 04             	sub    $0x4,%esp
+    1713:	89 c3                	mov    %eax,%ebx
+    1715:	6a 05                	push   $0x5
+    1717:	68 67 4c 00 00       	push   $0x4c67
+    171c:	50                   	push   %eax
+    171d:	e8 51 2b 00 00       	call   4273 <write>
+  close(fd);
+    1722:	89 1c 24             	mov    %ebx,(%esp)
+    1725:	e8 51 2b 00 00       	call   427b <close>
+  fd = open("unlinkread", O_RDWR);
+    172a:	58                   	pop    %eax
+    172b:	5a                   	pop    %edx
+    172c:	6a 02                	push   $0x2
+    172e:	68 42 4c 00 00       	push   $0x4c42
+    1733:	e8 5b 2b 00 00       	call   4293 <open>
+  if(fd < 0){
+    1738:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    173b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    173d:	85 c0                	test   %eax,%eax
+    173f:	0f 88 10 01 00 00    	js     1855 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    1745:	83 ec 0c             	sub    $0xc,%esp
+    1748:	68 42 4c 00 00       	push   $0x4c42
+    174d:	e8 51 2b 00 00       	call   42a3 <unlink>
+    1752:	83 c4 10             	add    $0x10,%esp
+    1755:	85 c0                	test   %eax,%eax
+    1757:	0f 85 e5 00 00 00    	jne    1842 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    175d:	83 ec 08             	sub    $0x8,%esp
+    1760:	68 02 02 00 00       	push   $0x202
+    1765:	68 42 4c 00 00       	push   $0x4c42
+    176a:	e8 24 2b 00 00       	call   4293 <open>
+  write(fd1, "yyy", 3);
+    176f:	83 c4 0c             	add    $0xc,%esp
+    1772:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1774:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    1776:	68 9f 4c 00 00       	push   $0x4c9f
+    177b:	50                   	push   %eax
+    177c:	e8 f2 2a 00 00       	call   4273 <write>
+  close(fd1);
+    1781:	89 34 24             	mov    %esi,(%esp)
+    1784:	e8 f2 2a 00 00       	call   427b <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1789:	83 c4 0c             	add    $0xc,%esp
+    178c:	68 00 20 00 00       	push   $0x2000
+    1791:	68 20 93 00 00       	push   $0x9320
+    1796:	53                   	push   %ebx
+    1797:	e8 cf 2a 00 00       	call   426b <read>
+    179c:	83 c4 10             	add    $0x10,%esp
+    179f:	83 f8 05             	cmp    $0x5,%eax
+    17a2:	0f 85 87 00 00 00    	jne    182f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    17a8:	80 3d 20 93 00 00 68 	cmpb   $0x68,0x9320
+    17af:	75 6b                	jne    181c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    17b1:	83 ec 04             	sub    $0x4,%esp
+    17b4:	6a 0a                	push   $0xa
+    17b6:	68 20 93 00 00       	push   $0x9320
+    17bb:	53                   	push   %ebx
+    17bc:	e8 b2 2a 00 00       	call   4273 <write>
+    17c1:	83 c4 10             	add    $0x10,%esp
+    17c4:	83 f8 0a             	cmp    $0xa,%eax
+    17c7:	75 40                	jne    1809 <unlinkread+0x129>
+  close(fd);
+    17c9:	83 ec 0c             	sub    $0xc,%esp
+    17cc:	53                   	push   %ebx
+    17cd:	e8 a9 2a 00 00       	call   427b <close>
+  unlink("unlinkread");
+    17d2:	c7 04 24 42 4c 00 00 	movl   $0x4c42,(%esp)
+    17d9:	e8 c5 2a 00 00       	call   42a3 <unlink>
+  printf(1, "unlinkread ok\n");
+    17de:	58                   	pop    %eax
+    17df:	5a                   	pop    %edx
+    17e0:	68 ea 4c 00 00       	push   $0x4cea
+    17e5:	6a 01                	push   $0x1
+    17e7:	e8 b4 2b 00 00       	call   43a0 <printf>
+}
+    17ec:	83 c4 10             	add    $0x10,%esp
+    17ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    17f2:	5b                   	pop    %ebx
+    17f3:	5e                   	pop    %esi
+    17f4:	5d                   	pop    %ebp
+    17f5:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    17f6:	51                   	push   %ecx
+    17f7:	51                   	push   %ecx
+    17f8:	68 4d 4c 00 00       	push   $0x4c4d
+    17fd:	6a 01                	push   $0x1
+    17ff:	e8 9c 2b 00 00       	call   43a0 <printf>
+    exit();
+    1804:	e8 4a 2a 00 00       	call   4253 <exit>
+    printf(1, "unlinkread write failed\n");
+    1809:	51                   	push   %ecx
+    180a:	51                   	push   %ecx
+    180b:	68 d1 4c 00 00       	push   $0x4cd1
+    1810:	6a 01                	push   $0x1
+    1812:	e8 89 2b 00 00       	call   43a0 <printf>
+    exit();
+    1817:	e8 37 2a 00 00       	call   4253 <exit>
+    printf(1, "unlinkread wrong data\n");
+    181c:	53                   	push   %ebx
+    181d:	53                   	push   %ebx
+    181e:	68 ba 4c 00 00       	push   $0x4cba
+    1823:	6a 01                	push   $0x1
+    1825:	e8 76 2b 00 00       	call   43a0 <printf>
+    exit();
+    182a:	e8 24 2a 00 00       	call   4253 <exit>
+    printf(1, "unlinkread read failed");
+    182f:	56                   	push   %esi
+    1830:	56                   	push   %esi
+    1831:	68 a3 4c 00 00       	push   $0x4ca3
+    1836:	6a 01                	push   $0x1
+    1838:	e8 63 2b 00 00       	call   43a0 <printf>
+    exit();
+    183d:	e8 11 2a 00 00       	call   4253 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1842:	50                   	push   %eax
+    1843:	50                   	push   %eax
+    1844:	68 85 4c 00 00       	push   $0x4c85
+    1849:	6a 01                	push   $0x1
+    184b:	e8 50 2b 00 00       	call   43a0 <printf>
+    exit();
+    1850:	e8 fe 29 00 00       	call   4253 <exit>
+    printf(1, "open unlinkread failed\n");
+    1855:	50                   	push   %eax
+    1856:	50                   	push   %eax
+    1857:	68 6d 4c 00 00       	push   $0x4c6d
+    185c:	6a 01                	push   $0x1
+    185e:	e8 3d 2b 00 00       	call   43a0 <printf>
+    exit();
+    1863:	e8 eb 29 00 00       	call   4253 <exit>
+    1868:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    186f:	90                   	nop
+
+00001870 <linktest>:
+{
+    1870:	55                   	push   %ebp
+    1871:	89 e5                	mov    %esp,%ebp
+    1873:	53                   	push   %ebx
+    1874:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    1877:	68 f9 4c 00 00       	push   $0x4cf9
+    187c:	6a 01                	push   $0x1
+    187e:	e8 1d 2b 00 00       	call   43a0 <printf>
+  unlink("lf1");
+    1883:	c7 04 24 03 4d 00 00 	movl   $0x4d03,(%esp)
+    188a:	e8 14 2a 00 00       	call   42a3 <unlink>
+  unlink("lf2");
+    188f:	c7 04 24 07 4d 00 00 	movl   $0x4d07,(%esp)
+    1896:	e8 08 2a 00 00       	call   42a3 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    189b:	58                   	pop    %eax
+    189c:	5a                   	pop    %edx
+    189d:	68 02 02 00 00       	push   $0x202
+    18a2:	68 03 4d 00 00       	push   $0x4d03
+    18a7:	e8 e7 29 00 00       	call   4293 <open>
+  if(fd < 0){
+    18ac:	83 c4 10             	add    $0x10,%esp
+    18af:	85 c0                	test   %eax,%eax
+    18b1:	0f 88 1e 01 00 00    	js     19d5 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    18b7:	83 ec 04             	sub    $0x4,%esp
+    18ba:	89 c3                	mov    %eax,%ebx
+    18bc:	6a 05                	push   $0x5
+    18be:	68 67 4c 00 00       	push   $0x4c67
+    18c3:	50                   	push   %eax
+    18c4:	e8 aa 29 00 00       	call   4273 <write>
+    18c9:	83 c4 10             	add    $0x10,%esp
+    18cc:	83 f8 05             	cmp    $0x5,%eax
+    18cf:	0f 85 98 01 00 00    	jne    1a6d <linktest+0x1fd>
+  close(fd);
+    18d5:	83 ec 0c             	sub    $0xc,%esp
+    18d8:	53                   	push   %ebx
+    18d9:	e8 9d 29 00 00       	call   427b <close>
+  if(link("lf1", "lf2") < 0){
+    18de:	5b                   	pop    %ebx
+    18df:	58                   	pop    %eax
+    18e0:	68 07 4d 00 00       	push   $0x4d07
+    18e5:	68 03 4d 00 00       	push   $0x4d03
+    18ea:	e8 c4 29 00 00       	call   42b3 <link>
+    18ef:	83 c4 10             	add    $0x10,%esp
+    18f2:	85 c0                	test   %eax,%eax
+    18f4:	0f 88 60 01 00 00    	js     1a5a <linktest+0x1ea>
+  unlink("lf1");
+    18fa:	83 ec 0c             	sub    $0xc,%esp
+    18fd:	68 03 4d 00 00       	push   $0x4d03
+    1902:	e8 9c 29 00 00       	call   42a3 <unlink>
+  if(open("lf1", 0) >= 0){
+    1907:	58                   	pop    %eax
+    1908:	5a                   	pop    %edx
+    1909:	6a 00                	push   $0x0
+    190b:	68 03 4d 00 00       	push   $0x4d03
+    1910:	e8 7e 29 00 00       	call   4293 <open>
+    1915:	83 c4 10             	add    $0x10,%esp
+    1918:	85 c0                	test   %eax,%eax
+    191a:	0f 89 27 01 00 00    	jns    1a47 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    1920:	83 ec 08             	sub    $0x8,%esp
+    1923:	6a 00                	push   $0x0
+    1925:	68 07 4d 00 00       	push   $0x4d07
+    192a:	e8 64 29 00 00       	call   4293 <open>
+  if(fd < 0){
+    192f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1932:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1934:	85 c0                	test   %eax,%eax
+    1936:	0f 88 f8 00 00 00    	js     1a34 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    193c:	83 ec 04             	sub    $0x4,%esp
+    193f:	68 00 20 00 00       	push   $0x2000
+    1944:	68 20 93 00 00       	push   $0x9320
+    1949:	50                   	push   %eax
+    194a:	e8 1c 29 00 00       	call   426b <read>
+    194f:	83 c4 10             	add    $0x10,%esp
+    1952:	83 f8 05             	cmp    $0x5,%eax
+    1955:	0f 85 c6 00 00 00    	jne    1a21 <linktest+0x1b1>
+  close(fd);
+    195b:	83 ec 0c             	sub    $0xc,%esp
+    195e:	53                   	push   %ebx
+    195f:	e8 17 29 00 00       	call   427b <close>
+  if(link("lf2", "lf2") >= 0){
+    1964:	58                   	pop    %eax
+    1965:	5a                   	pop    %edx
+    1966:	68 07 4d 00 00       	push   $0x4d07
+    196b:	68 07 4d 00 00       	push   $0x4d07
+    1970:	e8 3e 29 00 00       	call   42b3 <link>
+    1975:	83 c4 10             	add    $0x10,%esp
+    1978:	85 c0                	test   %eax,%eax
+    197a:	0f 89 8e 00 00 00    	jns    1a0e <linktest+0x19e>
+  unlink("lf2");
+    1980:	83 ec 0c             	sub    $0xc,%esp
+    1983:	68 07 4d 00 00       	push   $0x4d07
+    1988:	e8 16 29 00 00       	call   42a3 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    198d:	59                   	pop    %ecx
+    198e:	5b                   	pop    %ebx
+    198f:	68 03 4d 00 00       	push   $0x4d03
+    1994:	68 07 4d 00 00       	push   $0x4d07
+    1999:	e8 15 29 00 00       	call   42b3 <link>
+    199e:	83 c4 10             	add    $0x10,%esp
+    19a1:	85 c0                	test   %eax,%eax
+    19a3:	79 56                	jns    19fb <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    19a5:	83 ec 08             	sub    $0x8,%esp
+    19a8:	68 03 4d 00 00       	push   $0x4d03
+    19ad:	68 dd 50 00 00       	push   $0x50dd
+    19b2:	e8 fc 28 00 00       	call   42b3 <link>
+    19b7:	83 c4 10             	add    $0x10,%esp
+    19ba:	85 c0                	test   %eax,%eax
+    19bc:	79 2a                	jns    19e8 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    19be:	83 ec 08             	sub    $0x8,%esp
+    19c1:	68 a1 4d 00 00       	push   $0x4da1
+    19c6:	6a 01                	push   $0x1
+    19c8:	e8 d3 29 00 00       	call   43a0 <printf>
+}
+    19cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    19d0:	83 c4 10             	add    $0x10,%esp
+    19d3:	c9                   	leave
+    19d4:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    19d5:	50                   	push   %eax
+    19d6:	50                   	push   %eax
+    19d7:	68 0b 4d 00 00       	push   $0x4d0b
+    19dc:	6a 01                	push   $0x1
+    19de:	e8 bd 29 00 00       	call   43a0 <printf>
+    exit();
+    19e3:	e8 6b 28 00 00       	call   4253 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    19e8:	50                   	push   %eax
+    19e9:	50                   	push   %eax
+    19ea:	68 85 4d 00 00       	push   $0x4d85
+    19ef:	6a 01                	push   $0x1
+    19f1:	e8 aa 29 00 00       	call   43a0 <printf>
+    exit();
+    19f6:	e8 58 28 00 00       	call   4253 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    19fb:	52                   	push   %edx
+    19fc:	52                   	push   %edx
+    19fd:	68 dc 5a 00 00       	push   $0x5adc
+    1a02:	6a 01                	push   $0x1
+    1a04:	e8 97 29 00 00       	call   43a0 <printf>
+    exit();
+    1a09:	e8 45 28 00 00       	call   4253 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    1a0e:	50                   	push   %eax
+    1a0f:	50                   	push   %eax
+    1a10:	68 67 4d 00 00       	push   $0x4d67
+    1a15:	6a 01                	push   $0x1
+    1a17:	e8 84 29 00 00       	call   43a0 <printf>
+    exit();
+    1a1c:	e8 32 28 00 00       	call   4253 <exit>
+    printf(1, "read lf2 failed\n");
+    1a21:	51                   	push   %ecx
+    1a22:	51                   	push   %ecx
+    1a23:	68 56 4d 00 00       	push   $0x4d56
+    1a28:	6a 01                	push   $0x1
+    1a2a:	e8 71 29 00 00       	call   43a0 <printf>
+    exit();
+    1a2f:	e8 1f 28 00 00       	call   4253 <exit>
+    printf(1, "open lf2 failed\n");
+    1a34:	53                   	push   %ebx
+    1a35:	53                   	push   %ebx
+    1a36:	68 45 4d 00 00       	push   $0x4d45
+    1a3b:	6a 01                	push   $0x1
+    1a3d:	e8 5e 29 00 00       	call   43a0 <printf>
+    exit();
+    1a42:	e8 0c 28 00 00       	call   4253 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1a47:	50                   	push   %eax
+    1a48:	50                   	push   %eax
+    1a49:	68 b4 5a 00 00       	push   $0x5ab4
+    1a4e:	6a 01                	push   $0x1
+    1a50:	e8 4b 29 00 00       	call   43a0 <printf>
+    exit();
+    1a55:	e8 f9 27 00 00       	call   4253 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    1a5a:	51                   	push   %ecx
+    1a5b:	51                   	push   %ecx
+    1a5c:	68 30 4d 00 00       	push   $0x4d30
+    1a61:	6a 01                	push   $0x1
+    1a63:	e8 38 29 00 00       	call   43a0 <printf>
+    exit();
+    1a68:	e8 e6 27 00 00       	call   4253 <exit>
+    printf(1, "write lf1 failed\n");
+    1a6d:	50                   	push   %eax
+    1a6e:	50                   	push   %eax
+    1a6f:	68 1e 4d 00 00       	push   $0x4d1e
+    1a74:	6a 01                	push   $0x1
+    1a76:	e8 25 29 00 00       	call   43a0 <printf>
+    exit();
+    1a7b:	e8 d3 27 00 00       	call   4253 <exit>
+
+00001a80 <concreate>:
+{
+    1a80:	55                   	push   %ebp
+    1a81:	89 e5                	mov    %esp,%ebp
+    1a83:	57                   	push   %edi
+    1a84:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    1a85:	31 f6                	xor    %esi,%esi
+{
+    1a87:	53                   	push   %ebx
+    1a88:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    1a8b:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    1a8e:	68 ae 4d 00 00       	push   $0x4dae
+    1a93:	6a 01                	push   $0x1
+    1a95:	e8 06 29 00 00       	call   43a0 <printf>
+  file[0] = 'C';
+    1a9a:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    1a9e:	83 c4 10             	add    $0x10,%esp
+    1aa1:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    1aa5:	eb 4c                	jmp    1af3 <concreate+0x73>
+    1aa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1aae:	66 90                	xchg   %ax,%ax
+    1ab0:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1ab6:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    1abb:	0f 83 8f 00 00 00    	jae    1b50 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1ac1:	83 ec 08             	sub    $0x8,%esp
+    1ac4:	68 02 02 00 00       	push   $0x202
+    1ac9:	53                   	push   %ebx
+    1aca:	e8 c4 27 00 00       	call   4293 <open>
+      if(fd < 0){
+    1acf:	83 c4 10             	add    $0x10,%esp
+    1ad2:	85 c0                	test   %eax,%eax
+    1ad4:	78 63                	js     1b39 <concreate+0xb9>
+      close(fd);
+    1ad6:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1ad9:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    1adc:	50                   	push   %eax
+    1add:	e8 99 27 00 00       	call   427b <close>
+    1ae2:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1ae5:	e8 71 27 00 00       	call   425b <wait>
+  for(i = 0; i < 40; i++){
+    1aea:	83 fe 28             	cmp    $0x28,%esi
+    1aed:	0f 84 7f 00 00 00    	je     1b72 <concreate+0xf2>
+    unlink(file);
+    1af3:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1af6:	8d 46 30             	lea    0x30(%esi),%eax
+    1af9:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    1afc:	53                   	push   %ebx
+    1afd:	e8 a1 27 00 00       	call   42a3 <unlink>
+    pid = fork();
+    1b02:	e8 44 27 00 00       	call   424b <fork>
+    if(pid && (i % 3) == 1){
+    1b07:	83 c4 10             	add    $0x10,%esp
+    1b0a:	85 c0                	test   %eax,%eax
+    1b0c:	75 a2                	jne    1ab0 <concreate+0x30>
+      link("C0", file);
+    1b0e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1b14:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    1b1a:	0f 83 d0 00 00 00    	jae    1bf0 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    1b20:	83 ec 08             	sub    $0x8,%esp
+    1b23:	68 02 02 00 00       	push   $0x202
+    1b28:	53                   	push   %ebx
+    1b29:	e8 65 27 00 00       	call   4293 <open>
+      if(fd < 0){
+    1b2e:	83 c4 10             	add    $0x10,%esp
+    1b31:	85 c0                	test   %eax,%eax
+    1b33:	0f 89 ea 01 00 00    	jns    1d23 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    1b39:	83 ec 04             	sub    $0x4,%esp
+    1b3c:	53                   	push   %ebx
+    1b3d:	68 c1 4d 00 00       	push   $0x4dc1
+    1b42:	6a 01                	push   $0x1
+    1b44:	e8 57 28 00 00       	call   43a0 <printf>
+        exit();
+    1b49:	e8 05 27 00 00       	call   4253 <exit>
+    1b4e:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    1b50:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    1b53:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    1b56:	53                   	push   %ebx
+    1b57:	68 be 4d 00 00       	push   $0x4dbe
+    1b5c:	e8 52 27 00 00       	call   42b3 <link>
+    1b61:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1b64:	e8 f2 26 00 00       	call   425b <wait>
+  for(i = 0; i < 40; i++){
+    1b69:	83 fe 28             	cmp    $0x28,%esi
+    1b6c:	0f 85 81 ff ff ff    	jne    1af3 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    1b72:	83 ec 04             	sub    $0x4,%esp
+    1b75:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    1b78:	6a 28                	push   $0x28
+    1b7a:	6a 00                	push   $0x0
+    1b7c:	50                   	push   %eax
+    1b7d:	e8 4e 25 00 00       	call   40d0 <memset>
+  fd = open(".", 0);
+    1b82:	5e                   	pop    %esi
+    1b83:	5f                   	pop    %edi
+    1b84:	6a 00                	push   $0x0
+    1b86:	68 dd 50 00 00       	push   $0x50dd
+    1b8b:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    1b8e:	e8 00 27 00 00       	call   4293 <open>
+  n = 0;
+    1b93:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    1b9a:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    1b9d:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    1b9f:	90                   	nop
+    1ba0:	83 ec 04             	sub    $0x4,%esp
+    1ba3:	6a 10                	push   $0x10
+    1ba5:	57                   	push   %edi
+    1ba6:	56                   	push   %esi
+    1ba7:	e8 bf 26 00 00       	call   426b <read>
+    1bac:	83 c4 10             	add    $0x10,%esp
+    1baf:	85 c0                	test   %eax,%eax
+    1bb1:	7e 5d                	jle    1c10 <concreate+0x190>
+    if(de.inum == 0)
+    1bb3:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1bb8:	74 e6                	je     1ba0 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1bba:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    1bbe:	75 e0                	jne    1ba0 <concreate+0x120>
+    1bc0:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1bc4:	75 da                	jne    1ba0 <concreate+0x120>
+      i = de.name[1] - '0';
+    1bc6:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    1bca:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    1bcd:	83 f8 27             	cmp    $0x27,%eax
+    1bd0:	0f 87 5e 01 00 00    	ja     1d34 <concreate+0x2b4>
+      if(fa[i]){
+    1bd6:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    1bdb:	0f 85 7e 01 00 00    	jne    1d5f <concreate+0x2df>
+      n++;
+    1be1:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1be5:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    1bea:	eb b4                	jmp    1ba0 <concreate+0x120>
+    1bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1bf0:	83 ec 08             	sub    $0x8,%esp
+    1bf3:	53                   	push   %ebx
+    1bf4:	68 be 4d 00 00       	push   $0x4dbe
+    1bf9:	e8 b5 26 00 00       	call   42b3 <link>
+    1bfe:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1c01:	e8 4d 26 00 00       	call   4253 <exit>
+    1c06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c0d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    1c10:	83 ec 0c             	sub    $0xc,%esp
+    1c13:	56                   	push   %esi
+    1c14:	e8 62 26 00 00       	call   427b <close>
+  if(n != 40){
+    1c19:	83 c4 10             	add    $0x10,%esp
+    1c1c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1c20:	0f 85 26 01 00 00    	jne    1d4c <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    1c26:	31 f6                	xor    %esi,%esi
+    1c28:	eb 48                	jmp    1c72 <concreate+0x1f2>
+    1c2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    1c30:	85 ff                	test   %edi,%edi
+    1c32:	74 05                	je     1c39 <concreate+0x1b9>
+    1c34:	83 f8 01             	cmp    $0x1,%eax
+    1c37:	74 68                	je     1ca1 <concreate+0x221>
+      unlink(file);
+    1c39:	83 ec 0c             	sub    $0xc,%esp
+    1c3c:	53                   	push   %ebx
+    1c3d:	e8 61 26 00 00       	call   42a3 <unlink>
+      unlink(file);
+    1c42:	89 1c 24             	mov    %ebx,(%esp)
+    1c45:	e8 59 26 00 00       	call   42a3 <unlink>
+      unlink(file);
+    1c4a:	89 1c 24             	mov    %ebx,(%esp)
+    1c4d:	e8 51 26 00 00       	call   42a3 <unlink>
+      unlink(file);
+    1c52:	89 1c 24             	mov    %ebx,(%esp)
+    1c55:	e8 49 26 00 00       	call   42a3 <unlink>
+    1c5a:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    1c5d:	85 ff                	test   %edi,%edi
+    1c5f:	74 a0                	je     1c01 <concreate+0x181>
+      wait();
+    1c61:	e8 f5 25 00 00       	call   425b <wait>
+  for(i = 0; i < 40; i++){
+    1c66:	83 c6 01             	add    $0x1,%esi
+    1c69:	83 fe 28             	cmp    $0x28,%esi
+    1c6c:	0f 84 86 00 00 00    	je     1cf8 <concreate+0x278>
+    file[1] = '0' + i;
+    1c72:	8d 46 30             	lea    0x30(%esi),%eax
+    1c75:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    1c78:	e8 ce 25 00 00       	call   424b <fork>
+    1c7d:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    1c7f:	85 c0                	test   %eax,%eax
+    1c81:	0f 88 88 00 00 00    	js     1d0f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    1c87:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    1c8c:	f7 e6                	mul    %esi
+    1c8e:	89 d0                	mov    %edx,%eax
+    1c90:	83 e2 fe             	and    $0xfffffffe,%edx
+    1c93:	d1 e8                	shr    %eax
+    1c95:	01 c2                	add    %eax,%edx
+    1c97:	89 f0                	mov    %esi,%eax
+    1c99:	29 d0                	sub    %edx,%eax
+    1c9b:	89 c1                	mov    %eax,%ecx
+    1c9d:	09 f9                	or     %edi,%ecx
+    1c9f:	75 8f                	jne    1c30 <concreate+0x1b0>
+      close(open(file, 0));
+    1ca1:	83 ec 08             	sub    $0x8,%esp
+    1ca4:	6a 00                	push   $0x0
+    1ca6:	53                   	push   %ebx
+    1ca7:	e8 e7 25 00 00       	call   4293 <open>
+    1cac:	89 04 24             	mov    %eax,(%esp)
+    1caf:	e8 c7 25 00 00       	call   427b <close>
+      close(open(file, 0));
+    1cb4:	58                   	pop    %eax
+    1cb5:	5a                   	pop    %edx
+    1cb6:	6a 00                	push   $0x0
+    1cb8:	53                   	push   %ebx
+    1cb9:	e8 d5 25 00 00       	call   4293 <open>
+    1cbe:	89 04 24             	mov    %eax,(%esp)
+    1cc1:	e8 b5 25 00 00       	call   427b <close>
+      close(open(file, 0));
+    1cc6:	59                   	pop    %ecx
+    1cc7:	58                   	pop    %eax
+    1cc8:	6a 00                	push   $0x0
+    1cca:	53                   	push   %ebx
+    1ccb:	e8 c3 25 00 00       	call   4293 <open>
+    1cd0:	89 04 24             	mov    %eax,(%esp)
+    1cd3:	e8 a3 25 00 00       	call   427b <close>
+      close(open(file, 0));
+    1cd8:	58                   	pop    %eax
+    1cd9:	5a                   	pop    %edx
+    1cda:	6a 00                	push   $0x0
+    1cdc:	53                   	push   %ebx
+    1cdd:	e8 b1 25 00 00       	call   4293 <open>
+    1ce2:	89 04 24             	mov    %eax,(%esp)
+    1ce5:	e8 91 25 00 00       	call   427b <close>
+    1cea:	83 c4 10             	add    $0x10,%esp
+    1ced:	e9 6b ff ff ff       	jmp    1c5d <concreate+0x1dd>
+    1cf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1cf8:	83 ec 08             	sub    $0x8,%esp
+    1cfb:	68 13 4e 00 00       	push   $0x4e13
+    1d00:	6a 01                	push   $0x1
+    1d02:	e8 99 26 00 00       	call   43a0 <printf>
+}
+    1d07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d0a:	5b                   	pop    %ebx
+    1d0b:	5e                   	pop    %esi
+    1d0c:	5f                   	pop    %edi
+    1d0d:	5d                   	pop    %ebp
+    1d0e:	c3                   	ret
+      printf(1, "fork failed\n");
+    1d0f:	83 ec 08             	sub    $0x8,%esp
+    1d12:	68 3a 58 00 00       	push   $0x583a
+    1d17:	6a 01                	push   $0x1
+    1d19:	e8 82 26 00 00       	call   43a0 <printf>
+      exit();
+    1d1e:	e8 30 25 00 00       	call   4253 <exit>
+      close(fd);
+    1d23:	83 ec 0c             	sub    $0xc,%esp
+    1d26:	50                   	push   %eax
+    1d27:	e8 4f 25 00 00       	call   427b <close>
+    1d2c:	83 c4 10             	add    $0x10,%esp
+    1d2f:	e9 cd fe ff ff       	jmp    1c01 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    1d34:	83 ec 04             	sub    $0x4,%esp
+    1d37:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1d3a:	50                   	push   %eax
+    1d3b:	68 dd 4d 00 00       	push   $0x4ddd
+    1d40:	6a 01                	push   $0x1
+    1d42:	e8 59 26 00 00       	call   43a0 <printf>
+        exit();
+    1d47:	e8 07 25 00 00       	call   4253 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    1d4c:	51                   	push   %ecx
+    1d4d:	51                   	push   %ecx
+    1d4e:	68 00 5b 00 00       	push   $0x5b00
+    1d53:	6a 01                	push   $0x1
+    1d55:	e8 46 26 00 00       	call   43a0 <printf>
+    exit();
+    1d5a:	e8 f4 24 00 00       	call   4253 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1d5f:	83 ec 04             	sub    $0x4,%esp
+    1d62:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1d65:	50                   	push   %eax
+    1d66:	68 f6 4d 00 00       	push   $0x4df6
+    1d6b:	6a 01                	push   $0x1
+    1d6d:	e8 2e 26 00 00       	call   43a0 <printf>
+        exit();
+    1d72:	e8 dc 24 00 00       	call   4253 <exit>
+    1d77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d7e:	66 90                	xchg   %ax,%ax
+
+00001d80 <linkunlink>:
+{
+    1d80:	55                   	push   %ebp
+    1d81:	89 e5                	mov    %esp,%ebp
+    1d83:	57                   	push   %edi
+    1d84:	56                   	push   %esi
+    1d85:	53                   	push   %ebx
+    1d86:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    1d89:	68 21 4e 00 00       	push   $0x4e21
+    1d8e:	6a 01                	push   $0x1
+    1d90:	e8 0b 26 00 00       	call   43a0 <printf>
+  unlink("x");
+    1d95:	c7 04 24 c0 51 00 00 	movl   $0x51c0,(%esp)
+    1d9c:	e8 02 25 00 00       	call   42a3 <unlink>
+  pid = fork();
+    1da1:	e8 a5 24 00 00       	call   424b <fork>
+  if(pid < 0){
+    1da6:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1da9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1dac:	85 c0                	test   %eax,%eax
+    1dae:	0f 88 b6 00 00 00    	js     1e6a <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    1db4:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    1db8:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    1dbd:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    1dc2:	19 ff                	sbb    %edi,%edi
+    1dc4:	83 e7 60             	and    $0x60,%edi
+    1dc7:	83 c7 01             	add    $0x1,%edi
+    1dca:	eb 1e                	jmp    1dea <linkunlink+0x6a>
+    1dcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    1dd0:	83 f8 01             	cmp    $0x1,%eax
+    1dd3:	74 7b                	je     1e50 <linkunlink+0xd0>
+      unlink("x");
+    1dd5:	83 ec 0c             	sub    $0xc,%esp
+    1dd8:	68 c0 51 00 00       	push   $0x51c0
+    1ddd:	e8 c1 24 00 00       	call   42a3 <unlink>
+    1de2:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1de5:	83 eb 01             	sub    $0x1,%ebx
+    1de8:	74 41                	je     1e2b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    1dea:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    1df0:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    1df6:	89 f8                	mov    %edi,%eax
+    1df8:	f7 e6                	mul    %esi
+    1dfa:	89 d0                	mov    %edx,%eax
+    1dfc:	83 e2 fe             	and    $0xfffffffe,%edx
+    1dff:	d1 e8                	shr    %eax
+    1e01:	01 c2                	add    %eax,%edx
+    1e03:	89 f8                	mov    %edi,%eax
+    1e05:	29 d0                	sub    %edx,%eax
+    1e07:	75 c7                	jne    1dd0 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    1e09:	83 ec 08             	sub    $0x8,%esp
+    1e0c:	68 02 02 00 00       	push   $0x202
+    1e11:	68 c0 51 00 00       	push   $0x51c0
+    1e16:	e8 78 24 00 00       	call   4293 <open>
+    1e1b:	89 04 24             	mov    %eax,(%esp)
+    1e1e:	e8 58 24 00 00       	call   427b <close>
+    1e23:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1e26:	83 eb 01             	sub    $0x1,%ebx
+    1e29:	75 bf                	jne    1dea <linkunlink+0x6a>
+  if(pid)
+    1e2b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1e2e:	85 c0                	test   %eax,%eax
+    1e30:	74 4b                	je     1e7d <linkunlink+0xfd>
+    wait();
+    1e32:	e8 24 24 00 00       	call   425b <wait>
+  printf(1, "linkunlink ok\n");
+    1e37:	83 ec 08             	sub    $0x8,%esp
+    1e3a:	68 36 4e 00 00       	push   $0x4e36
+    1e3f:	6a 01                	push   $0x1
+    1e41:	e8 5a 25 00 00       	call   43a0 <printf>
+}
+    1e46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e49:	5b                   	pop    %ebx
+    1e4a:	5e                   	pop    %esi
+    1e4b:	5f                   	pop    %edi
+    1e4c:	5d                   	pop    %ebp
+    1e4d:	c3                   	ret
+    1e4e:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    1e50:	83 ec 08             	sub    $0x8,%esp
+    1e53:	68 c0 51 00 00       	push   $0x51c0
+    1e58:	68 32 4e 00 00       	push   $0x4e32
+    1e5d:	e8 51 24 00 00       	call   42b3 <link>
+    1e62:	83 c4 10             	add    $0x10,%esp
+    1e65:	e9 7b ff ff ff       	jmp    1de5 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    1e6a:	52                   	push   %edx
+    1e6b:	52                   	push   %edx
+    1e6c:	68 3a 58 00 00       	push   $0x583a
+    1e71:	6a 01                	push   $0x1
+    1e73:	e8 28 25 00 00       	call   43a0 <printf>
+    exit();
+    1e78:	e8 d6 23 00 00       	call   4253 <exit>
+    exit();
+    1e7d:	e8 d1 23 00 00       	call   4253 <exit>
+    1e82:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001e90 <bigdir>:
+{
+    1e90:	55                   	push   %ebp
+    1e91:	89 e5                	mov    %esp,%ebp
+    1e93:	57                   	push   %edi
+    1e94:	56                   	push   %esi
+    1e95:	53                   	push   %ebx
+    1e96:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    1e99:	68 45 4e 00 00       	push   $0x4e45
+    1e9e:	6a 01                	push   $0x1
+    1ea0:	e8 fb 24 00 00       	call   43a0 <printf>
+  unlink("bd");
+    1ea5:	c7 04 24 52 4e 00 00 	movl   $0x4e52,(%esp)
+    1eac:	e8 f2 23 00 00       	call   42a3 <unlink>
+  fd = open("bd", O_CREATE);
+    1eb1:	5a                   	pop    %edx
+    1eb2:	59                   	pop    %ecx
+    1eb3:	68 00 02 00 00       	push   $0x200
+    1eb8:	68 52 4e 00 00       	push   $0x4e52
+    1ebd:	e8 d1 23 00 00       	call   4293 <open>
+  if(fd < 0){
+    1ec2:	83 c4 10             	add    $0x10,%esp
+    1ec5:	85 c0                	test   %eax,%eax
+    1ec7:	0f 88 de 00 00 00    	js     1fab <bigdir+0x11b>
+  close(fd);
+    1ecd:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    1ed0:	31 f6                	xor    %esi,%esi
+    1ed2:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    1ed5:	50                   	push   %eax
+    1ed6:	e8 a0 23 00 00       	call   427b <close>
+    1edb:	83 c4 10             	add    $0x10,%esp
+    1ede:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    1ee0:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    1ee2:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    1ee5:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1ee9:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1eec:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1ef0:	83 c0 30             	add    $0x30,%eax
+    1ef3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1ef6:	89 f0                	mov    %esi,%eax
+    1ef8:	83 e0 3f             	and    $0x3f,%eax
+    1efb:	83 c0 30             	add    $0x30,%eax
+    1efe:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    1f01:	57                   	push   %edi
+    1f02:	68 52 4e 00 00       	push   $0x4e52
+    1f07:	e8 a7 23 00 00       	call   42b3 <link>
+    1f0c:	83 c4 10             	add    $0x10,%esp
+    1f0f:	89 c3                	mov    %eax,%ebx
+    1f11:	85 c0                	test   %eax,%eax
+    1f13:	75 6e                	jne    1f83 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    1f15:	83 c6 01             	add    $0x1,%esi
+    1f18:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1f1e:	75 c0                	jne    1ee0 <bigdir+0x50>
+  unlink("bd");
+    1f20:	83 ec 0c             	sub    $0xc,%esp
+    1f23:	68 52 4e 00 00       	push   $0x4e52
+    1f28:	e8 76 23 00 00       	call   42a3 <unlink>
+    1f2d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    1f30:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1f32:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    1f35:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1f39:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1f3c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1f40:	83 c0 30             	add    $0x30,%eax
+    1f43:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1f46:	89 d8                	mov    %ebx,%eax
+    1f48:	83 e0 3f             	and    $0x3f,%eax
+    1f4b:	83 c0 30             	add    $0x30,%eax
+    1f4e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    1f51:	57                   	push   %edi
+    1f52:	e8 4c 23 00 00       	call   42a3 <unlink>
+    1f57:	83 c4 10             	add    $0x10,%esp
+    1f5a:	85 c0                	test   %eax,%eax
+    1f5c:	75 39                	jne    1f97 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    1f5e:	83 c3 01             	add    $0x1,%ebx
+    1f61:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1f67:	75 c7                	jne    1f30 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    1f69:	83 ec 08             	sub    $0x8,%esp
+    1f6c:	68 94 4e 00 00       	push   $0x4e94
+    1f71:	6a 01                	push   $0x1
+    1f73:	e8 28 24 00 00       	call   43a0 <printf>
+    1f78:	83 c4 10             	add    $0x10,%esp
+}
+    1f7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f7e:	5b                   	pop    %ebx
+    1f7f:	5e                   	pop    %esi
+    1f80:	5f                   	pop    %edi
+    1f81:	5d                   	pop    %ebp
+    1f82:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    1f83:	83 ec 08             	sub    $0x8,%esp
+    1f86:	68 6b 4e 00 00       	push   $0x4e6b
+    1f8b:	6a 01                	push   $0x1
+    1f8d:	e8 0e 24 00 00       	call   43a0 <printf>
+      exit();
+    1f92:	e8 bc 22 00 00       	call   4253 <exit>
+      printf(1, "bigdir unlink failed");
+    1f97:	83 ec 08             	sub    $0x8,%esp
+    1f9a:	68 7f 4e 00 00       	push   $0x4e7f
+    1f9f:	6a 01                	push   $0x1
+    1fa1:	e8 fa 23 00 00       	call   43a0 <printf>
+      exit();
+    1fa6:	e8 a8 22 00 00       	call   4253 <exit>
+    printf(1, "bigdir create failed\n");
+    1fab:	50                   	push   %eax
+    1fac:	50                   	push   %eax
+    1fad:	68 55 4e 00 00       	push   $0x4e55
+    1fb2:	6a 01                	push   $0x1
+    1fb4:	e8 e7 23 00 00       	call   43a0 <printf>
+    exit();
+    1fb9:	e8 95 22 00 00       	call   4253 <exit>
+    1fbe:	66 90                	xchg   %ax,%ax
+
+00001fc0 <dcachetest>:
+{
+    1fc0:	55                   	push   %ebp
+    1fc1:	89 e5                	mov    %esp,%ebp
+    1fc3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "dcache test\n");
+    1fc6:	68 9f 4e 00 00       	push   $0x4e9f
+    1fcb:	6a 01                	push   $0x1
+    1fcd:	e8 ce 23 00 00       	call   43a0 <printf>
+  if(open("dcd/f", 0) >= 0){
+    1fd2:	5a                   	pop    %edx
+    1fd3:	59                   	pop    %ecx
+    1fd4:	6a 00                	push   $0x0
+    1fd6:	68 ac 4e 00 00       	push   $0x4eac
+    1fdb:	e8 b3 22 00 00       	call   4293 <open>
+    1fe0:	83 c4 10             	add    $0x10,%esp
+    1fe3:	85 c0                	test   %eax,%eax
+    1fe5:	0f 89 fb 01 00 00    	jns    21e6 <dcachetest+0x226>
+  if(mkdir("dcd") != 0){
+    1feb:	83 ec 0c             	sub    $0xc,%esp
+    1fee:	68 c8 4e 00 00       	push   $0x4ec8
+    1ff3:	e8 c3 22 00 00       	call   42bb <mkdir>
+    1ff8:	83 c4 10             	add    $0x10,%esp
+    1ffb:	85 c0                	test   %eax,%eax
+    1ffd:	0f 85 d0 01 00 00    	jne    21d3 <dcachetest+0x213>
+  if(open("dcd/f", 0) >= 0){
+    2003:	83 ec 08             	sub    $0x8,%esp
+    2006:	6a 00                	push   $0x0
+    2008:	68 ac 4e 00 00       	push   $0x4eac
+    200d:	e8 81 22 00 00       	call   4293 <open>
+    2012:	83 c4 10             	add    $0x10,%esp
+    2015:	85 c0                	test   %eax,%eax
+    2017:	0f 89 a3 01 00 00    	jns    21c0 <dcachetest+0x200>
+  fd = open("dcd/f", O_CREATE|O_RDWR);
+    201d:	83 ec 08             	sub    $0x8,%esp
+    2020:	68 02 02 00 00       	push   $0x202
+    2025:	68 ac 4e 00 00       	push   $0x4eac
+    202a:	e8 64 22 00 00       	call   4293 <open>
+  if(fd < 0){
+    202f:	83 c4 10             	add    $0x10,%esp
+    2032:	85 c0                	test   %eax,%eax
+    2034:	0f 88 73 01 00 00    	js     21ad <dcachetest+0x1ed>
+  close(fd);
+    203a:	83 ec 0c             	sub    $0xc,%esp
+    203d:	50                   	push   %eax
+    203e:	e8 38 22 00 00       	call   427b <close>
+  if((fd = open("dcd/f", 0)) < 0){
+    2043:	59                   	pop    %ecx
+    2044:	58                   	pop    %eax
+    2045:	6a 00                	push   $0x0
+    2047:	68 ac 4e 00 00       	push   $0x4eac
+    204c:	e8 42 22 00 00       	call   4293 <open>
+    2051:	83 c4 10             	add    $0x10,%esp
+    2054:	85 c0                	test   %eax,%eax
+    2056:	0f 88 3e 01 00 00    	js     219a <dcachetest+0x1da>
+  close(fd);
+    205c:	83 ec 0c             	sub    $0xc,%esp
+    205f:	50                   	push   %eax
+    2060:	e8 16 22 00 00       	call   427b <close>
+  if(unlink("dcd/f") != 0){
+    2065:	c7 04 24 ac 4e 00 00 	movl   $0x4eac,(%esp)
+    206c:	e8 32 22 00 00       	call   42a3 <unlink>
+    2071:	83 c4 10             	add    $0x10,%esp
+    2074:	85 c0                	test   %eax,%eax
+    2076:	0f 85 0b 01 00 00    	jne    2187 <dcachetest+0x1c7>
+  if(open("dcd/f", 0) >= 0){
+    207c:	83 ec 08             	sub    $0x8,%esp
+    207f:	6a 00                	push   $0x0
+    2081:	68 ac 4e 00 00       	push   $0x4eac
+    2086:	e8 08 22 00 00       	call   4293 <open>
+    208b:	83 c4 10             	add    $0x10,%esp
+    208e:	85 c0                	test   %eax,%eax
+    2090:	0f 89 de 00 00 00    	jns    2174 <dcachetest+0x1b4>
+  if(open("dcd/../dcd/.", 0) < 0){
+    2096:	83 ec 08             	sub    $0x8,%esp
+    2099:	6a 00                	push   $0x0
+    209b:	68 3b 4f 00 00       	push   $0x4f3b
+    20a0:	e8 ee 21 00 00       	call   4293 <open>
+    20a5:	83 c4 10             	add    $0x10,%esp
+    20a8:	85 c0                	test   %eax,%eax
+    20aa:	0f 88 b1 00 00 00    	js     2161 <dcachetest+0x1a1>
+  if(unlink("dcd") != 0){
+    20b0:	83 ec 0c             	sub    $0xc,%esp
+    20b3:	68 c8 4e 00 00       	push   $0x4ec8
+    20b8:	e8 e6 21 00 00       	call   42a3 <unlink>
+    20bd:	83 c4 10             	add    $0x10,%esp
+    20c0:	85 c0                	test   %eax,%eax
+    20c2:	0f 85 86 00 00 00    	jne    214e <dcachetest+0x18e>
+  if(open("dcd/.", 0) >= 0){
+    20c8:	83 ec 08             	sub    $0x8,%esp
+    20cb:	6a 00                	push   $0x0
+    20cd:	68 42 4f 00 00       	push   $0x4f42
+    20d2:	e8 bc 21 00 00       	call   4293 <open>
+    20d7:	83 c4 10             	add    $0x10,%esp
+    20da:	85 c0                	test   %eax,%eax
+    20dc:	79 5d                	jns    213b <dcachetest+0x17b>
+  if(mkdir("dcd") != 0 || open("dcd/f", 0) >= 0){
+    20de:	83 ec 0c             	sub    $0xc,%esp
+    20e1:	68 c8 4e 00 00       	push   $0x4ec8
+    20e6:	e8 d0 21 00 00       	call   42bb <mkdir>
+    20eb:	83 c4 10             	add    $0x10,%esp
+    20ee:	85 c0                	test   %eax,%eax
+    20f0:	75 36                	jne    2128 <dcachetest+0x168>
+    20f2:	83 ec 08             	sub    $0x8,%esp
+    20f5:	6a 00                	push   $0x0
+    20f7:	68 ac 4e 00 00       	push   $0x4eac
+    20fc:	e8 92 21 00 00       	call   4293 <open>
+    2101:	83 c4 10             	add    $0x10,%esp
+    2104:	85 c0                	test   %eax,%eax
+    2106:	79 20                	jns    2128 <dcachetest+0x168>
+  unlink("dcd");
+    2108:	83 ec 0c             	sub    $0xc,%esp
+    210b:	68 c8 4e 00 00       	push   $0x4ec8
+    2110:	e8 8e 21 00 00       	call   42a3 <unlink>
+  printf(1, "dcache ok\n");
+    2115:	58                   	pop    %eax
+    2116:	5a                   	pop    %edx
+    2117:	68 63 4f 00 00       	push   $0x4f63
+    211c:	6a 01                	push   $0x1
+    211e:	e8 7d 22 00 00       	call   43a0 <printf>
+}
+    2123:	83 c4 10             	add    $0x10,%esp
+    2126:	c9                   	leave
+    2127:	c3                   	ret
+    printf(1, "dcache: recreated dcd is wrong\n");
+    2128:	51                   	push   %ecx
+    2129:	51                   	push   %ecx
+    212a:	68 cc 5b 00 00       	push   $0x5bcc
+    212f:	6a 01                	push   $0x1
+    2131:	e8 6a 22 00 00       	call   43a0 <printf>
+    exit();
+    2136:	e8 18 21 00 00       	call   4253 <exit>
+    printf(1, "dcache: dcd still there after unlink\n");
+    213b:	50                   	push   %eax
+    213c:	50                   	push   %eax
+    213d:	68 a4 5b 00 00       	push   $0x5ba4
+    2142:	6a 01                	push   $0x1
+    2144:	e8 57 22 00 00       	call   43a0 <printf>
+    exit();
+    2149:	e8 05 21 00 00       	call   4253 <exit>
+    printf(1, "dcache: unlink dcd failed\n");
+    214e:	50                   	push   %eax
+    214f:	50                   	push   %eax
+    2150:	68 48 4f 00 00       	push   $0x4f48
+    2155:	6a 01                	push   $0x1
+    2157:	e8 44 22 00 00       	call   43a0 <printf>
+    exit();
+    215c:	e8 f2 20 00 00       	call   4253 <exit>
+    printf(1, "dcache: open dcd/../dcd/. failed\n");
+    2161:	50                   	push   %eax
+    2162:	50                   	push   %eax
+    2163:	68 80 5b 00 00       	push   $0x5b80
+    2168:	6a 01                	push   $0x1
+    216a:	e8 31 22 00 00       	call   43a0 <printf>
+    exit();
+    216f:	e8 df 20 00 00       	call   4253 <exit>
+    printf(1, "dcache: dcd/f still there after unlink\n");
+    2174:	50                   	push   %eax
+    2175:	50                   	push   %eax
+    2176:	68 58 5b 00 00       	push   $0x5b58
+    217b:	6a 01                	push   $0x1
+    217d:	e8 1e 22 00 00       	call   43a0 <printf>
+    exit();
+    2182:	e8 cc 20 00 00       	call   4253 <exit>
+    printf(1, "dcache: unlink dcd/f failed\n");
+    2187:	50                   	push   %eax
+    2188:	50                   	push   %eax
+    2189:	68 1e 4f 00 00       	push   $0x4f1e
+    218e:	6a 01                	push   $0x1
+    2190:	e8 0b 22 00 00       	call   43a0 <printf>
+    exit();
+    2195:	e8 b9 20 00 00       	call   4253 <exit>
+    printf(1, "dcache: open dcd/f failed\n");
+    219a:	52                   	push   %edx
+    219b:	52                   	push   %edx
+    219c:	68 03 4f 00 00       	push   $0x4f03
+    21a1:	6a 01                	push   $0x1
+    21a3:	e8 f8 21 00 00       	call   43a0 <printf>
+    exit();
+    21a8:	e8 a6 20 00 00       	call   4253 <exit>
+    printf(1, "dcache: create dcd/f failed\n");
+    21ad:	50                   	push   %eax
+    21ae:	50                   	push   %eax
+    21af:	68 e6 4e 00 00       	push   $0x4ee6
+    21b4:	6a 01                	push   $0x1
+    21b6:	e8 e5 21 00 00       	call   43a0 <printf>
+    exit();
+    21bb:	e8 93 20 00 00       	call   4253 <exit>
+    printf(1, "dcache: dcd/f exists in new dir\n");
+    21c0:	50                   	push   %eax
+    21c1:	50                   	push   %eax
+    21c2:	68 34 5b 00 00       	push   $0x5b34
+    21c7:	6a 01                	push   $0x1
+    21c9:	e8 d2 21 00 00       	call   43a0 <printf>
+    exit();
+    21ce:	e8 80 20 00 00       	call   4253 <exit>
+    printf(1, "dcache: mkdir dcd failed\n");
+    21d3:	50                   	push   %eax
+    21d4:	50                   	push   %eax
+    21d5:	68 cc 4e 00 00       	push   $0x4ecc
+    21da:	6a 01                	push   $0x1
+    21dc:	e8 bf 21 00 00       	call   43a0 <printf>
+    exit();
+    21e1:	e8 6d 20 00 00       	call   4253 <exit>
+    printf(1, "dcache: dcd/f exists\n");
+    21e6:	50                   	push   %eax
+    21e7:	50                   	push   %eax
+    21e8:	68 b2 4e 00 00       	push   $0x4eb2
+    21ed:	6a 01                	push   $0x1
+    21ef:	e8 ac 21 00 00       	call   43a0 <printf>
+    exit();
+    21f4:	e8 5a 20 00 00       	call   4253 <exit>
+    21f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002200 <dcachefill>:
+{
+    2200:	55                   	push   %ebp
+    2201:	89 e5                	mov    %esp,%ebp
+    2203:	57                   	push   %edi
+    2204:	56                   	push   %esi
+    2205:	53                   	push   %ebx
+    2206:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "dcache fill test\n");
+    2209:	68 6e 4f 00 00       	push   $0x4f6e
+    220e:	6a 01                	push   $0x1
+    2210:	e8 8b 21 00 00       	call   43a0 <printf>
+  if(mkdir("dcf") != 0){
+    2215:	c7 04 24 80 4f 00 00 	movl   $0x4f80,(%esp)
+    221c:	e8 9a 20 00 00       	call   42bb <mkdir>
+    2221:	83 c4 10             	add    $0x10,%esp
+    2224:	85 c0                	test   %eax,%eax
+    2226:	0f 85 6a 02 00 00    	jne    2496 <dcachefill+0x296>
+  strcpy(path, "dcf/");
+    222c:	83 ec 08             	sub    $0x8,%esp
+    222f:	89 c3                	mov    %eax,%ebx
+    2231:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  for(i = 0; i < N; i++){
+    2234:	31 f6                	xor    %esi,%esi
+  strcpy(path, "dcf/");
+    2236:	68 84 4f 00 00       	push   $0x4f84
+    path[5] = '0' + (i/10)%10;
+    223b:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+  strcpy(path, "dcf/");
+    2240:	50                   	push   %eax
+    2241:	e8 ca 1d 00 00       	call   4010 <strcpy>
+  path[7] = 0;
+    2246:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    224a:	83 c4 10             	add    $0x10,%esp
+    224d:	eb 10                	jmp    225f <dcachefill+0x5f>
+    224f:	90                   	nop
+  for(i = 0; i < N; i++){
+    2250:	83 c6 01             	add    $0x1,%esi
+    2253:	81 fe 80 01 00 00    	cmp    $0x180,%esi
+    2259:	0f 84 96 00 00 00    	je     22f5 <dcachefill+0xf5>
+    path[4] = '0' + i/100;
+    225f:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    if(open(path, 0) >= 0){
+    2264:	83 ec 08             	sub    $0x8,%esp
+    path[4] = '0' + i/100;
+    2267:	f7 e6                	mul    %esi
+    path[5] = '0' + (i/10)%10;
+    2269:	89 f0                	mov    %esi,%eax
+    path[4] = '0' + i/100;
+    226b:	c1 ea 05             	shr    $0x5,%edx
+    226e:	83 c2 30             	add    $0x30,%edx
+    2271:	88 55 e4             	mov    %dl,-0x1c(%ebp)
+    path[5] = '0' + (i/10)%10;
+    2274:	f7 e7                	mul    %edi
+    2276:	89 d1                	mov    %edx,%ecx
+    2278:	c1 e9 03             	shr    $0x3,%ecx
+    227b:	89 c8                	mov    %ecx,%eax
+    227d:	f7 e7                	mul    %edi
+    227f:	89 c8                	mov    %ecx,%eax
+    2281:	c1 ea 03             	shr    $0x3,%edx
+    2284:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    2287:	01 d2                	add    %edx,%edx
+    2289:	29 d0                	sub    %edx,%eax
+    path[6] = '0' + i%10;
+    228b:	8d 14 89             	lea    (%ecx,%ecx,4),%edx
+    path[5] = '0' + (i/10)%10;
+    228e:	83 c0 30             	add    $0x30,%eax
+    path[6] = '0' + i%10;
+    2291:	01 d2                	add    %edx,%edx
+    path[5] = '0' + (i/10)%10;
+    2293:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    path[6] = '0' + i%10;
+    2296:	89 f0                	mov    %esi,%eax
+    2298:	29 d0                	sub    %edx,%eax
+    229a:	83 c0 30             	add    $0x30,%eax
+    229d:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    if(open(path, 0) >= 0){
+    22a0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    22a3:	6a 00                	push   $0x0
+    22a5:	50                   	push   %eax
+    22a6:	e8 e8 1f 00 00       	call   4293 <open>
+    22ab:	83 c4 10             	add    $0x10,%esp
+    22ae:	85 c0                	test   %eax,%eax
+    22b0:	0f 89 b0 01 00 00    	jns    2466 <dcachefill+0x266>
+    if(i % 2 == 0){
+    22b6:	f7 c6 01 00 00 00    	test   $0x1,%esi
+    22bc:	75 92                	jne    2250 <dcachefill+0x50>
+      if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+    22be:	83 ec 08             	sub    $0x8,%esp
+    22c1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    22c4:	68 02 02 00 00       	push   $0x202
+    22c9:	50                   	push   %eax
+    22ca:	e8 c4 1f 00 00       	call   4293 <open>
+    22cf:	83 c4 10             	add    $0x10,%esp
+    22d2:	85 c0                	test   %eax,%eax
+    22d4:	0f 88 a4 01 00 00    	js     247e <dcachefill+0x27e>
+      close(fd);
+    22da:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < N; i++){
+    22dd:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    22e0:	50                   	push   %eax
+    22e1:	e8 95 1f 00 00       	call   427b <close>
+    22e6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < N; i++){
+    22e9:	81 fe 80 01 00 00    	cmp    $0x180,%esi
+    22ef:	0f 85 6a ff ff ff    	jne    225f <dcachefill+0x5f>
+  for(i = 0; i < N; i += 3){
+    22f5:	31 f6                	xor    %esi,%esi
+    path[5] = '0' + (i/10)%10;
+    22f7:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+    22fc:	eb 0d                	jmp    230b <dcachefill+0x10b>
+    22fe:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < N; i += 3){
+    2300:	83 c6 03             	add    $0x3,%esi
+    2303:	81 fe 80 01 00 00    	cmp    $0x180,%esi
+    2309:	74 75                	je     2380 <dcachefill+0x180>
+    path[4] = '0' + i/100;
+    230b:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    2310:	f7 e6                	mul    %esi
+    path[5] = '0' + (i/10)%10;
+    2312:	89 f0                	mov    %esi,%eax
+    path[4] = '0' + i/100;
+    2314:	c1 ea 05             	shr    $0x5,%edx
+    2317:	83 c2 30             	add    $0x30,%edx
+    231a:	88 55 e4             	mov    %dl,-0x1c(%ebp)
+    path[5] = '0' + (i/10)%10;
+    231d:	f7 e7                	mul    %edi
+    231f:	89 d1                	mov    %edx,%ecx
+    2321:	c1 e9 03             	shr    $0x3,%ecx
+    2324:	89 c8                	mov    %ecx,%eax
+    2326:	f7 e7                	mul    %edi
+    2328:	89 c8                	mov    %ecx,%eax
+    232a:	c1 ea 03             	shr    $0x3,%edx
+    232d:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    2330:	01 d2                	add    %edx,%edx
+    2332:	29 d0                	sub    %edx,%eax
+    path[6] = '0' + i%10;
+    2334:	8d 14 89             	lea    (%ecx,%ecx,4),%edx
+    path[5] = '0' + (i/10)%10;
+    2337:	83 c0 30             	add    $0x30,%eax
+    path[6] = '0' + i%10;
+    233a:	01 d2                	add    %edx,%edx
+    path[5] = '0' + (i/10)%10;
+    233c:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    path[6] = '0' + i%10;
+    233f:	89 f0                	mov    %esi,%eax
+    2341:	29 d0                	sub    %edx,%eax
+    2343:	83 c0 30             	add    $0x30,%eax
+    2346:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    if(i % 2 == 0 && unlink(path) != 0){
+    2349:	f7 c6 01 00 00 00    	test   $0x1,%esi
+    234f:	75 af                	jne    2300 <dcachefill+0x100>
+    2351:	83 ec 0c             	sub    $0xc,%esp
+    2354:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    2357:	50                   	push   %eax
+    2358:	e8 46 1f 00 00       	call   42a3 <unlink>
+    235d:	83 c4 10             	add    $0x10,%esp
+    2360:	85 c0                	test   %eax,%eax
+    2362:	74 9c                	je     2300 <dcachefill+0x100>
+      printf(1, "dcache fill: unlink %s failed\n", path);
+    2364:	83 ec 04             	sub    $0x4,%esp
+    2367:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    236a:	50                   	push   %eax
+    236b:	68 2c 5c 00 00       	push   $0x5c2c
+    2370:	6a 01                	push   $0x1
+    2372:	e8 29 20 00 00       	call   43a0 <printf>
+      exit();
+    2377:	e8 d7 1e 00 00       	call   4253 <exit>
+    237c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    path[4] = '0' + i/100;
+    2380:	bf 1f 85 eb 51       	mov    $0x51eb851f,%edi
+    path[5] = '0' + (i/10)%10;
+    2385:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+    238a:	eb 38                	jmp    23c4 <dcachefill+0x1c4>
+    238c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2390:	69 d3 ab aa aa aa    	imul   $0xaaaaaaab,%ebx,%edx
+    if((fd >= 0) != (i % 2 == 0 && i % 3 != 0)){
+    2396:	81 fa 55 55 55 55    	cmp    $0x55555555,%edx
+    239c:	76 7b                	jbe    2419 <dcachefill+0x219>
+    239e:	85 c0                	test   %eax,%eax
+    23a0:	78 7b                	js     241d <dcachefill+0x21d>
+      close(fd);
+    23a2:	83 ec 0c             	sub    $0xc,%esp
+    23a5:	50                   	push   %eax
+    23a6:	e8 d0 1e 00 00       	call   427b <close>
+      unlink(path);
+    23ab:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    23ae:	89 04 24             	mov    %eax,(%esp)
+    23b1:	e8 ed 1e 00 00       	call   42a3 <unlink>
+    23b6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < N; i++){
+    23b9:	83 c3 01             	add    $0x1,%ebx
+    23bc:	81 fb 80 01 00 00    	cmp    $0x180,%ebx
+    23c2:	74 74                	je     2438 <dcachefill+0x238>
+    path[4] = '0' + i/100;
+    23c4:	89 d8                	mov    %ebx,%eax
+    fd = open(path, 0);
+    23c6:	83 ec 08             	sub    $0x8,%esp
+    path[4] = '0' + i/100;
+    23c9:	f7 e7                	mul    %edi
+    path[5] = '0' + (i/10)%10;
+    23cb:	89 d8                	mov    %ebx,%eax
+    path[4] = '0' + i/100;
+    23cd:	c1 ea 05             	shr    $0x5,%edx
+    23d0:	83 c2 30             	add    $0x30,%edx
+    23d3:	88 55 e4             	mov    %dl,-0x1c(%ebp)
+    path[5] = '0' + (i/10)%10;
+    23d6:	f7 e6                	mul    %esi
+    23d8:	89 d1                	mov    %edx,%ecx
+    23da:	c1 e9 03             	shr    $0x3,%ecx
+    23dd:	89 c8                	mov    %ecx,%eax
+    23df:	f7 e6                	mul    %esi
+    23e1:	89 c8                	mov    %ecx,%eax
+    23e3:	c1 ea 03             	shr    $0x3,%edx
+    23e6:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    23e9:	01 d2                	add    %edx,%edx
+    23eb:	29 d0                	sub    %edx,%eax
+    path[6] = '0' + i%10;
+    23ed:	8d 14 89             	lea    (%ecx,%ecx,4),%edx
+    path[5] = '0' + (i/10)%10;
+    23f0:	83 c0 30             	add    $0x30,%eax
+    path[6] = '0' + i%10;
+    23f3:	01 d2                	add    %edx,%edx
+    path[5] = '0' + (i/10)%10;
+    23f5:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    path[6] = '0' + i%10;
+    23f8:	89 d8                	mov    %ebx,%eax
+    23fa:	29 d0                	sub    %edx,%eax
+    23fc:	83 c0 30             	add    $0x30,%eax
+    23ff:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    fd = open(path, 0);
+    2402:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    2405:	6a 00                	push   $0x0
+    2407:	50                   	push   %eax
+    2408:	e8 86 1e 00 00       	call   4293 <open>
+    if((fd >= 0) != (i % 2 == 0 && i % 3 != 0)){
+    240d:	83 c4 10             	add    $0x10,%esp
+    2410:	f6 c3 01             	test   $0x1,%bl
+    2413:	0f 84 77 ff ff ff    	je     2390 <dcachefill+0x190>
+    2419:	85 c0                	test   %eax,%eax
+    241b:	78 9c                	js     23b9 <dcachefill+0x1b9>
+      printf(1, "dcache fill: %s wrong after eviction\n", path);
+    241d:	83 ec 04             	sub    $0x4,%esp
+    2420:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    2423:	50                   	push   %eax
+    2424:	68 4c 5c 00 00       	push   $0x5c4c
+    2429:	6a 01                	push   $0x1
+    242b:	e8 70 1f 00 00       	call   43a0 <printf>
+      exit();
+    2430:	e8 1e 1e 00 00       	call   4253 <exit>
+    2435:	8d 76 00             	lea    0x0(%esi),%esi
+  if(unlink("dcf") != 0){
+    2438:	83 ec 0c             	sub    $0xc,%esp
+    243b:	68 80 4f 00 00       	push   $0x4f80
+    2440:	e8 5e 1e 00 00       	call   42a3 <unlink>
+    2445:	83 c4 10             	add    $0x10,%esp
+    2448:	85 c0                	test   %eax,%eax
+    244a:	75 5d                	jne    24a9 <dcachefill+0x2a9>
+  printf(1, "dcache fill ok\n");
+    244c:	83 ec 08             	sub    $0x8,%esp
+    244f:	68 a1 4f 00 00       	push   $0x4fa1
+    2454:	6a 01                	push   $0x1
+    2456:	e8 45 1f 00 00       	call   43a0 <printf>
+}
+    245b:	83 c4 10             	add    $0x10,%esp
+    245e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2461:	5b                   	pop    %ebx
+    2462:	5e                   	pop    %esi
+    2463:	5f                   	pop    %edi
+    2464:	5d                   	pop    %ebp
+    2465:	c3                   	ret
+      printf(1, "dcache fill: %s exists\n", path);
+    2466:	83 ec 04             	sub    $0x4,%esp
+    2469:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    246c:	50                   	push   %eax
+    246d:	68 89 4f 00 00       	push   $0x4f89
+    2472:	6a 01                	push   $0x1
+    2474:	e8 27 1f 00 00       	call   43a0 <printf>
+      exit();
+    2479:	e8 d5 1d 00 00       	call   4253 <exit>
+        printf(1, "dcache fill: create %s failed\n", path);
+    247e:	83 ec 04             	sub    $0x4,%esp
+    2481:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    2484:	50                   	push   %eax
+    2485:	68 0c 5c 00 00       	push   $0x5c0c
+    248a:	6a 01                	push   $0x1
+    248c:	e8 0f 1f 00 00       	call   43a0 <printf>
+        exit();
+    2491:	e8 bd 1d 00 00       	call   4253 <exit>
+    printf(1, "dcache fill: mkdir dcf failed\n");
+    2496:	52                   	push   %edx
+    2497:	52                   	push   %edx
+    2498:	68 ec 5b 00 00       	push   $0x5bec
+    249d:	6a 01                	push   $0x1
+    249f:	e8 fc 1e 00 00       	call   43a0 <printf>
+    exit();
+    24a4:	e8 aa 1d 00 00       	call   4253 <exit>
+    printf(1, "dcache fill: unlink dcf failed\n");
+    24a9:	50                   	push   %eax
+    24aa:	50                   	push   %eax
+    24ab:	68 74 5c 00 00       	push   $0x5c74
+    24b0:	6a 01                	push   $0x1
+    24b2:	e8 e9 1e 00 00       	call   43a0 <printf>
+    exit();
+    24b7:	e8 97 1d 00 00       	call   4253 <exit>
+    24bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000024c0 <subdir>:
+{
+    24c0:	55                   	push   %ebp
+    24c1:	89 e5                	mov    %esp,%ebp
+    24c3:	53                   	push   %ebx
+    24c4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    24c7:	68 b1 4f 00 00       	push   $0x4fb1
+    24cc:	6a 01                	push   $0x1
+    24ce:	e8 cd 1e 00 00       	call   43a0 <printf>
+  unlink("ff");
+    24d3:	c7 04 24 3a 50 00 00 	movl   $0x503a,(%esp)
+    24da:	e8 c4 1d 00 00       	call   42a3 <unlink>
+  if(mkdir("dd") != 0){
+    24df:	c7 04 24 d7 50 00 00 	movl   $0x50d7,(%esp)
+    24e6:	e8 d0 1d 00 00       	call   42bb <mkdir>
+    24eb:	83 c4 10             	add    $0x10,%esp
+    24ee:	85 c0                	test   %eax,%eax
+    24f0:	0f 85 b3 05 00 00    	jne    2aa9 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    24f6:	83 ec 08             	sub    $0x8,%esp
+    24f9:	68 02 02 00 00       	push   $0x202
+    24fe:	68 10 50 00 00       	push   $0x5010
+    2503:	e8 8b 1d 00 00       	call   4293 <open>
+  if(fd < 0){
+    2508:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    250b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    250d:	85 c0                	test   %eax,%eax
+    250f:	0f 88 81 05 00 00    	js     2a96 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    2515:	83 ec 04             	sub    $0x4,%esp
+    2518:	6a 02                	push   $0x2
+    251a:	68 3a 50 00 00       	push   $0x503a
+    251f:	50                   	push   %eax
+    2520:	e8 4e 1d 00 00       	call   4273 <write>
+  close(fd);
+    2525:	89 1c 24             	mov    %ebx,(%esp)
+    2528:	e8 4e 1d 00 00       	call   427b <close>
+  if(unlink("dd") >= 0){
+    252d:	c7 04 24 d7 50 00 00 	movl   $0x50d7,(%esp)
+    2534:	e8 6a 1d 00 00       	call   42a3 <unlink>
+    2539:	83 c4 10             	add    $0x10,%esp
+    253c:	85 c0                	test   %eax,%eax
+    253e:	0f 89 3f 05 00 00    	jns    2a83 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    2544:	83 ec 0c             	sub    $0xc,%esp
+    2547:	68 eb 4f 00 00       	push   $0x4feb
+    254c:	e8 6a 1d 00 00       	call   42bb <mkdir>
+    2551:	83 c4 10             	add    $0x10,%esp
+    2554:	85 c0                	test   %eax,%eax
+    2556:	0f 85 14 05 00 00    	jne    2a70 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    255c:	83 ec 08             	sub    $0x8,%esp
+    255f:	68 02 02 00 00       	push   $0x202
+    2564:	68 0d 50 00 00       	push   $0x500d
+    2569:	e8 25 1d 00 00       	call   4293 <open>
+  if(fd < 0){
+    256e:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2571:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2573:	85 c0                	test   %eax,%eax
+    2575:	0f 88 24 04 00 00    	js     299f <subdir+0x4df>
+  write(fd, "FF", 2);
+    257b:	83 ec 04             	sub    $0x4,%esp
+    257e:	6a 02                	push   $0x2
+    2580:	68 2e 50 00 00       	push   $0x502e
+    2585:	50                   	push   %eax
+    2586:	e8 e8 1c 00 00       	call   4273 <write>
+  close(fd);
+    258b:	89 1c 24             	mov    %ebx,(%esp)
+    258e:	e8 e8 1c 00 00       	call   427b <close>
+  fd = open("dd/dd/../ff", 0);
+    2593:	58                   	pop    %eax
+    2594:	5a                   	pop    %edx
+    2595:	6a 00                	push   $0x0
+    2597:	68 31 50 00 00       	push   $0x5031
+    259c:	e8 f2 1c 00 00       	call   4293 <open>
+  if(fd < 0){
+    25a1:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    25a4:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    25a6:	85 c0                	test   %eax,%eax
+    25a8:	0f 88 de 03 00 00    	js     298c <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    25ae:	83 ec 04             	sub    $0x4,%esp
+    25b1:	68 00 20 00 00       	push   $0x2000
+    25b6:	68 20 93 00 00       	push   $0x9320
+    25bb:	50                   	push   %eax
+    25bc:	e8 aa 1c 00 00       	call   426b <read>
+  if(cc != 2 || buf[0] != 'f'){
+    25c1:	83 c4 10             	add    $0x10,%esp
+    25c4:	83 f8 02             	cmp    $0x2,%eax
+    25c7:	0f 85 3a 03 00 00    	jne    2907 <subdir+0x447>
+    25cd:	80 3d 20 93 00 00 66 	cmpb   $0x66,0x9320
+    25d4:	0f 85 2d 03 00 00    	jne    2907 <subdir+0x447>
+  close(fd);
+    25da:	83 ec 0c             	sub    $0xc,%esp
+    25dd:	53                   	push   %ebx
+    25de:	e8 98 1c 00 00       	call   427b <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    25e3:	59                   	pop    %ecx
+    25e4:	5b                   	pop    %ebx
+    25e5:	68 71 50 00 00       	push   $0x5071
+    25ea:	68 0d 50 00 00       	push   $0x500d
+    25ef:	e8 bf 1c 00 00       	call   42b3 <link>
+    25f4:	83 c4 10             	add    $0x10,%esp
+    25f7:	85 c0                	test   %eax,%eax
+    25f9:	0f 85 c6 03 00 00    	jne    29c5 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    25ff:	83 ec 0c             	sub    $0xc,%esp
+    2602:	68 0d 50 00 00       	push   $0x500d
+    2607:	e8 97 1c 00 00       	call   42a3 <unlink>
+    260c:	83 c4 10             	add    $0x10,%esp
+    260f:	85 c0                	test   %eax,%eax
+    2611:	0f 85 16 03 00 00    	jne    292d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2617:	83 ec 08             	sub    $0x8,%esp
+    261a:	6a 00                	push   $0x0
+    261c:	68 0d 50 00 00       	push   $0x500d
+    2621:	e8 6d 1c 00 00       	call   4293 <open>
+    2626:	83 c4 10             	add    $0x10,%esp
+    2629:	85 c0                	test   %eax,%eax
+    262b:	0f 89 2c 04 00 00    	jns    2a5d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    2631:	83 ec 0c             	sub    $0xc,%esp
+    2634:	68 d7 50 00 00       	push   $0x50d7
+    2639:	e8 85 1c 00 00       	call   42c3 <chdir>
+    263e:	83 c4 10             	add    $0x10,%esp
+    2641:	85 c0                	test   %eax,%eax
+    2643:	0f 85 01 04 00 00    	jne    2a4a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    2649:	83 ec 0c             	sub    $0xc,%esp
+    264c:	68 a5 50 00 00       	push   $0x50a5
+    2651:	e8 6d 1c 00 00       	call   42c3 <chdir>
+    2656:	83 c4 10             	add    $0x10,%esp
+    2659:	85 c0                	test   %eax,%eax
+    265b:	0f 85 b9 02 00 00    	jne    291a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    2661:	83 ec 0c             	sub    $0xc,%esp
+    2664:	68 cb 50 00 00       	push   $0x50cb
+    2669:	e8 55 1c 00 00       	call   42c3 <chdir>
+    266e:	83 c4 10             	add    $0x10,%esp
+    2671:	85 c0                	test   %eax,%eax
+    2673:	0f 85 a1 02 00 00    	jne    291a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    2679:	83 ec 0c             	sub    $0xc,%esp
+    267c:	68 da 50 00 00       	push   $0x50da
+    2681:	e8 3d 1c 00 00       	call   42c3 <chdir>
+    2686:	83 c4 10             	add    $0x10,%esp
+    2689:	85 c0                	test   %eax,%eax
+    268b:	0f 85 21 03 00 00    	jne    29b2 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    2691:	83 ec 08             	sub    $0x8,%esp
+    2694:	6a 00                	push   $0x0
+    2696:	68 71 50 00 00       	push   $0x5071
+    269b:	e8 f3 1b 00 00       	call   4293 <open>
+  if(fd < 0){
+    26a0:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    26a3:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    26a5:	85 c0                	test   %eax,%eax
+    26a7:	0f 88 e0 04 00 00    	js     2b8d <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    26ad:	83 ec 04             	sub    $0x4,%esp
+    26b0:	68 00 20 00 00       	push   $0x2000
+    26b5:	68 20 93 00 00       	push   $0x9320
+    26ba:	50                   	push   %eax
+    26bb:	e8 ab 1b 00 00       	call   426b <read>
+    26c0:	83 c4 10             	add    $0x10,%esp
+    26c3:	83 f8 02             	cmp    $0x2,%eax
+    26c6:	0f 85 ae 04 00 00    	jne    2b7a <subdir+0x6ba>
+  close(fd);
+    26cc:	83 ec 0c             	sub    $0xc,%esp
+    26cf:	53                   	push   %ebx
+    26d0:	e8 a6 1b 00 00       	call   427b <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    26d5:	58                   	pop    %eax
+    26d6:	5a                   	pop    %edx
+    26d7:	6a 00                	push   $0x0
+    26d9:	68 0d 50 00 00       	push   $0x500d
+    26de:	e8 b0 1b 00 00       	call   4293 <open>
+    26e3:	83 c4 10             	add    $0x10,%esp
+    26e6:	85 c0                	test   %eax,%eax
+    26e8:	0f 89 65 02 00 00    	jns    2953 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    26ee:	83 ec 08             	sub    $0x8,%esp
+    26f1:	68 02 02 00 00       	push   $0x202
+    26f6:	68 25 51 00 00       	push   $0x5125
+    26fb:	e8 93 1b 00 00       	call   4293 <open>
+    2700:	83 c4 10             	add    $0x10,%esp
+    2703:	85 c0                	test   %eax,%eax
+    2705:	0f 89 35 02 00 00    	jns    2940 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    270b:	83 ec 08             	sub    $0x8,%esp
+    270e:	68 02 02 00 00       	push   $0x202
+    2713:	68 4a 51 00 00       	push   $0x514a
+    2718:	e8 76 1b 00 00       	call   4293 <open>
+    271d:	83 c4 10             	add    $0x10,%esp
+    2720:	85 c0                	test   %eax,%eax
+    2722:	0f 89 0f 03 00 00    	jns    2a37 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    2728:	83 ec 08             	sub    $0x8,%esp
+    272b:	68 00 02 00 00       	push   $0x200
+    2730:	68 d7 50 00 00       	push   $0x50d7
+    2735:	e8 59 1b 00 00       	call   4293 <open>
+    273a:	83 c4 10             	add    $0x10,%esp
+    273d:	85 c0                	test   %eax,%eax
+    273f:	0f 89 df 02 00 00    	jns    2a24 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    2745:	83 ec 08             	sub    $0x8,%esp
+    2748:	6a 02                	push   $0x2
+    274a:	68 d7 50 00 00       	push   $0x50d7
+    274f:	e8 3f 1b 00 00       	call   4293 <open>
+    2754:	83 c4 10             	add    $0x10,%esp
+    2757:	85 c0                	test   %eax,%eax
+    2759:	0f 89 b2 02 00 00    	jns    2a11 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    275f:	83 ec 08             	sub    $0x8,%esp
+    2762:	6a 01                	push   $0x1
+    2764:	68 d7 50 00 00       	push   $0x50d7
+    2769:	e8 25 1b 00 00       	call   4293 <open>
+    276e:	83 c4 10             	add    $0x10,%esp
+    2771:	85 c0                	test   %eax,%eax
+    2773:	0f 89 85 02 00 00    	jns    29fe <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    2779:	83 ec 08             	sub    $0x8,%esp
+    277c:	68 b9 51 00 00       	push   $0x51b9
+    2781:	68 25 51 00 00       	push   $0x5125
+    2786:	e8 28 1b 00 00       	call   42b3 <link>
+    278b:	83 c4 10             	add    $0x10,%esp
+    278e:	85 c0                	test   %eax,%eax
+    2790:	0f 84 55 02 00 00    	je     29eb <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2796:	83 ec 08             	sub    $0x8,%esp
+    2799:	68 b9 51 00 00       	push   $0x51b9
+    279e:	68 4a 51 00 00       	push   $0x514a
+    27a3:	e8 0b 1b 00 00       	call   42b3 <link>
+    27a8:	83 c4 10             	add    $0x10,%esp
+    27ab:	85 c0                	test   %eax,%eax
+    27ad:	0f 84 25 02 00 00    	je     29d8 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    27b3:	83 ec 08             	sub    $0x8,%esp
+    27b6:	68 71 50 00 00       	push   $0x5071
+    27bb:	68 10 50 00 00       	push   $0x5010
+    27c0:	e8 ee 1a 00 00       	call   42b3 <link>
+    27c5:	83 c4 10             	add    $0x10,%esp
+    27c8:	85 c0                	test   %eax,%eax
+    27ca:	0f 84 a9 01 00 00    	je     2979 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    27d0:	83 ec 0c             	sub    $0xc,%esp
+    27d3:	68 25 51 00 00       	push   $0x5125
+    27d8:	e8 de 1a 00 00       	call   42bb <mkdir>
+    27dd:	83 c4 10             	add    $0x10,%esp
+    27e0:	85 c0                	test   %eax,%eax
+    27e2:	0f 84 7e 01 00 00    	je     2966 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    27e8:	83 ec 0c             	sub    $0xc,%esp
+    27eb:	68 4a 51 00 00       	push   $0x514a
+    27f0:	e8 c6 1a 00 00       	call   42bb <mkdir>
+    27f5:	83 c4 10             	add    $0x10,%esp
+    27f8:	85 c0                	test   %eax,%eax
+    27fa:	0f 84 67 03 00 00    	je     2b67 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    2800:	83 ec 0c             	sub    $0xc,%esp
+    2803:	68 71 50 00 00       	push   $0x5071
+    2808:	e8 ae 1a 00 00       	call   42bb <mkdir>
+    280d:	83 c4 10             	add    $0x10,%esp
+    2810:	85 c0                	test   %eax,%eax
+    2812:	0f 84 3c 03 00 00    	je     2b54 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    2818:	83 ec 0c             	sub    $0xc,%esp
+    281b:	68 4a 51 00 00       	push   $0x514a
+    2820:	e8 7e 1a 00 00       	call   42a3 <unlink>
+    2825:	83 c4 10             	add    $0x10,%esp
+    2828:	85 c0                	test   %eax,%eax
+    282a:	0f 84 11 03 00 00    	je     2b41 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2830:	83 ec 0c             	sub    $0xc,%esp
+    2833:	68 25 51 00 00       	push   $0x5125
+    2838:	e8 66 1a 00 00       	call   42a3 <unlink>
+    283d:	83 c4 10             	add    $0x10,%esp
+    2840:	85 c0                	test   %eax,%eax
+    2842:	0f 84 e6 02 00 00    	je     2b2e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    2848:	83 ec 0c             	sub    $0xc,%esp
+    284b:	68 10 50 00 00       	push   $0x5010
+    2850:	e8 6e 1a 00 00       	call   42c3 <chdir>
+    2855:	83 c4 10             	add    $0x10,%esp
+    2858:	85 c0                	test   %eax,%eax
+    285a:	0f 84 bb 02 00 00    	je     2b1b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    2860:	83 ec 0c             	sub    $0xc,%esp
+    2863:	68 bc 51 00 00       	push   $0x51bc
+    2868:	e8 56 1a 00 00       	call   42c3 <chdir>
+    286d:	83 c4 10             	add    $0x10,%esp
+    2870:	85 c0                	test   %eax,%eax
+    2872:	0f 84 90 02 00 00    	je     2b08 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    2878:	83 ec 0c             	sub    $0xc,%esp
+    287b:	68 71 50 00 00       	push   $0x5071
+    2880:	e8 1e 1a 00 00       	call   42a3 <unlink>
+    2885:	83 c4 10             	add    $0x10,%esp
+    2888:	85 c0                	test   %eax,%eax
+    288a:	0f 85 9d 00 00 00    	jne    292d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    2890:	83 ec 0c             	sub    $0xc,%esp
+    2893:	68 10 50 00 00       	push   $0x5010
+    2898:	e8 06 1a 00 00       	call   42a3 <unlink>
+    289d:	83 c4 10             	add    $0x10,%esp
+    28a0:	85 c0                	test   %eax,%eax
+    28a2:	0f 85 4d 02 00 00    	jne    2af5 <subdir+0x635>
+  if(unlink("dd") == 0){
+    28a8:	83 ec 0c             	sub    $0xc,%esp
+    28ab:	68 d7 50 00 00       	push   $0x50d7
+    28b0:	e8 ee 19 00 00       	call   42a3 <unlink>
+    28b5:	83 c4 10             	add    $0x10,%esp
+    28b8:	85 c0                	test   %eax,%eax
+    28ba:	0f 84 22 02 00 00    	je     2ae2 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    28c0:	83 ec 0c             	sub    $0xc,%esp
+    28c3:	68 ec 4f 00 00       	push   $0x4fec
+    28c8:	e8 d6 19 00 00       	call   42a3 <unlink>
+    28cd:	83 c4 10             	add    $0x10,%esp
+    28d0:	85 c0                	test   %eax,%eax
+    28d2:	0f 88 f7 01 00 00    	js     2acf <subdir+0x60f>
+  if(unlink("dd") < 0){
+    28d8:	83 ec 0c             	sub    $0xc,%esp
+    28db:	68 d7 50 00 00       	push   $0x50d7
+    28e0:	e8 be 19 00 00       	call   42a3 <unlink>
+    28e5:	83 c4 10             	add    $0x10,%esp
+    28e8:	85 c0                	test   %eax,%eax
+    28ea:	0f 88 cc 01 00 00    	js     2abc <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    28f0:	83 ec 08             	sub    $0x8,%esp
+    28f3:	68 b9 52 00 00       	push   $0x52b9
+    28f8:	6a 01                	push   $0x1
+    28fa:	e8 a1 1a 00 00       	call   43a0 <printf>
+}
+    28ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2902:	83 c4 10             	add    $0x10,%esp
+    2905:	c9                   	leave
+    2906:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2907:	50                   	push   %eax
+    2908:	50                   	push   %eax
+    2909:	68 56 50 00 00       	push   $0x5056
+    290e:	6a 01                	push   $0x1
+    2910:	e8 8b 1a 00 00       	call   43a0 <printf>
+    exit();
+    2915:	e8 39 19 00 00       	call   4253 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    291a:	50                   	push   %eax
+    291b:	50                   	push   %eax
+    291c:	68 b1 50 00 00       	push   $0x50b1
+    2921:	6a 01                	push   $0x1
+    2923:	e8 78 1a 00 00       	call   43a0 <printf>
+    exit();
+    2928:	e8 26 19 00 00       	call   4253 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    292d:	50                   	push   %eax
+    292e:	50                   	push   %eax
+    292f:	68 7c 50 00 00       	push   $0x507c
+    2934:	6a 01                	push   $0x1
+    2936:	e8 65 1a 00 00       	call   43a0 <printf>
+    exit();
+    293b:	e8 13 19 00 00       	call   4253 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2940:	51                   	push   %ecx
+    2941:	51                   	push   %ecx
+    2942:	68 2e 51 00 00       	push   $0x512e
+    2947:	6a 01                	push   $0x1
+    2949:	e8 52 1a 00 00       	call   43a0 <printf>
+    exit();
+    294e:	e8 00 19 00 00       	call   4253 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2953:	53                   	push   %ebx
+    2954:	53                   	push   %ebx
+    2955:	68 04 5d 00 00       	push   $0x5d04
+    295a:	6a 01                	push   $0x1
+    295c:	e8 3f 1a 00 00       	call   43a0 <printf>
+    exit();
+    2961:	e8 ed 18 00 00       	call   4253 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2966:	51                   	push   %ecx
+    2967:	51                   	push   %ecx
+    2968:	68 c2 51 00 00       	push   $0x51c2
+    296d:	6a 01                	push   $0x1
+    296f:	e8 2c 1a 00 00       	call   43a0 <printf>
+    exit();
+    2974:	e8 da 18 00 00       	call   4253 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2979:	53                   	push   %ebx
+    297a:	53                   	push   %ebx
+    297b:	68 74 5d 00 00       	push   $0x5d74
+    2980:	6a 01                	push   $0x1
+    2982:	e8 19 1a 00 00       	call   43a0 <printf>
+    exit();
+    2987:	e8 c7 18 00 00       	call   4253 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    298c:	50                   	push   %eax
+    298d:	50                   	push   %eax
+    298e:	68 3d 50 00 00       	push   $0x503d
+    2993:	6a 01                	push   $0x1
+    2995:	e8 06 1a 00 00       	call   43a0 <printf>
+    exit();
+    299a:	e8 b4 18 00 00       	call   4253 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    299f:	51                   	push   %ecx
+    29a0:	51                   	push   %ecx
+    29a1:	68 16 50 00 00       	push   $0x5016
+    29a6:	6a 01                	push   $0x1
+    29a8:	e8 f3 19 00 00       	call   43a0 <printf>
+    exit();
+    29ad:	e8 a1 18 00 00       	call   4253 <exit>
+    printf(1, "chdir ./.. failed\n");
+    29b2:	50                   	push   %eax
+    29b3:	50                   	push   %eax
+    29b4:	68 df 50 00 00       	push   $0x50df
+    29b9:	6a 01                	push   $0x1
+    29bb:	e8 e0 19 00 00       	call   43a0 <printf>
+    exit();
+    29c0:	e8 8e 18 00 00       	call   4253 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    29c5:	52                   	push   %edx
+    29c6:	52                   	push   %edx
+    29c7:	68 bc 5c 00 00       	push   $0x5cbc
+    29cc:	6a 01                	push   $0x1
+    29ce:	e8 cd 19 00 00       	call   43a0 <printf>
+    exit();
+    29d3:	e8 7b 18 00 00       	call   4253 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    29d8:	50                   	push   %eax
+    29d9:	50                   	push   %eax
+    29da:	68 50 5d 00 00       	push   $0x5d50
+    29df:	6a 01                	push   $0x1
+    29e1:	e8 ba 19 00 00       	call   43a0 <printf>
+    exit();
+    29e6:	e8 68 18 00 00       	call   4253 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    29eb:	50                   	push   %eax
+    29ec:	50                   	push   %eax
+    29ed:	68 2c 5d 00 00       	push   $0x5d2c
+    29f2:	6a 01                	push   $0x1
+    29f4:	e8 a7 19 00 00       	call   43a0 <printf>
+    exit();
+    29f9:	e8 55 18 00 00       	call   4253 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    29fe:	50                   	push   %eax
+    29ff:	50                   	push   %eax
+    2a00:	68 9e 51 00 00       	push   $0x519e
+    2a05:	6a 01                	push   $0x1
+    2a07:	e8 94 19 00 00       	call   43a0 <printf>
+    exit();
+    2a0c:	e8 42 18 00 00       	call   4253 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    2a11:	50                   	push   %eax
+    2a12:	50                   	push   %eax
+    2a13:	68 85 51 00 00       	push   $0x5185
+    2a18:	6a 01                	push   $0x1
+    2a1a:	e8 81 19 00 00       	call   43a0 <printf>
+    exit();
+    2a1f:	e8 2f 18 00 00       	call   4253 <exit>
+    printf(1, "create dd succeeded!\n");
+    2a24:	50                   	push   %eax
+    2a25:	50                   	push   %eax
+    2a26:	68 6f 51 00 00       	push   $0x516f
+    2a2b:	6a 01                	push   $0x1
+    2a2d:	e8 6e 19 00 00       	call   43a0 <printf>
+    exit();
+    2a32:	e8 1c 18 00 00       	call   4253 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2a37:	52                   	push   %edx
+    2a38:	52                   	push   %edx
+    2a39:	68 53 51 00 00       	push   $0x5153
+    2a3e:	6a 01                	push   $0x1
+    2a40:	e8 5b 19 00 00       	call   43a0 <printf>
+    exit();
+    2a45:	e8 09 18 00 00       	call   4253 <exit>
+    printf(1, "chdir dd failed\n");
+    2a4a:	50                   	push   %eax
+    2a4b:	50                   	push   %eax
+    2a4c:	68 94 50 00 00       	push   $0x5094
+    2a51:	6a 01                	push   $0x1
+    2a53:	e8 48 19 00 00       	call   43a0 <printf>
+    exit();
+    2a58:	e8 f6 17 00 00       	call   4253 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    2a5d:	50                   	push   %eax
+    2a5e:	50                   	push   %eax
+    2a5f:	68 e0 5c 00 00       	push   $0x5ce0
+    2a64:	6a 01                	push   $0x1
+    2a66:	e8 35 19 00 00       	call   43a0 <printf>
+    exit();
+    2a6b:	e8 e3 17 00 00       	call   4253 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    2a70:	53                   	push   %ebx
+    2a71:	53                   	push   %ebx
+    2a72:	68 f2 4f 00 00       	push   $0x4ff2
+    2a77:	6a 01                	push   $0x1
+    2a79:	e8 22 19 00 00       	call   43a0 <printf>
+    exit();
+    2a7e:	e8 d0 17 00 00       	call   4253 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    2a83:	50                   	push   %eax
+    2a84:	50                   	push   %eax
+    2a85:	68 94 5c 00 00       	push   $0x5c94
+    2a8a:	6a 01                	push   $0x1
+    2a8c:	e8 0f 19 00 00       	call   43a0 <printf>
+    exit();
+    2a91:	e8 bd 17 00 00       	call   4253 <exit>
+    printf(1, "create dd/ff failed\n");
+    2a96:	50                   	push   %eax
+    2a97:	50                   	push   %eax
+    2a98:	68 d6 4f 00 00       	push   $0x4fd6
+    2a9d:	6a 01                	push   $0x1
+    2a9f:	e8 fc 18 00 00       	call   43a0 <printf>
+    exit();
+    2aa4:	e8 aa 17 00 00       	call   4253 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    2aa9:	50                   	push   %eax
+    2aaa:	50                   	push   %eax
+    2aab:	68 be 4f 00 00       	push   $0x4fbe
+    2ab0:	6a 01                	push   $0x1
+    2ab2:	e8 e9 18 00 00       	call   43a0 <printf>
+    exit();
+    2ab7:	e8 97 17 00 00       	call   4253 <exit>
+    printf(1, "unlink dd failed\n");
+    2abc:	50                   	push   %eax
+    2abd:	50                   	push   %eax
+    2abe:	68 a7 52 00 00       	push   $0x52a7
+    2ac3:	6a 01                	push   $0x1
+    2ac5:	e8 d6 18 00 00       	call   43a0 <printf>
+    exit();
+    2aca:	e8 84 17 00 00       	call   4253 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    2acf:	52                   	push   %edx
+    2ad0:	52                   	push   %edx
+    2ad1:	68 92 52 00 00       	push   $0x5292
+    2ad6:	6a 01                	push   $0x1
+    2ad8:	e8 c3 18 00 00       	call   43a0 <printf>
+    exit();
+    2add:	e8 71 17 00 00       	call   4253 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2ae2:	51                   	push   %ecx
+    2ae3:	51                   	push   %ecx
+    2ae4:	68 98 5d 00 00       	push   $0x5d98
+    2ae9:	6a 01                	push   $0x1
+    2aeb:	e8 b0 18 00 00       	call   43a0 <printf>
+    exit();
+    2af0:	e8 5e 17 00 00       	call   4253 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    2af5:	53                   	push   %ebx
+    2af6:	53                   	push   %ebx
+    2af7:	68 7d 52 00 00       	push   $0x527d
+    2afc:	6a 01                	push   $0x1
+    2afe:	e8 9d 18 00 00       	call   43a0 <printf>
+    exit();
+    2b03:	e8 4b 17 00 00       	call   4253 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2b08:	50                   	push   %eax
+    2b09:	50                   	push   %eax
+    2b0a:	68 65 52 00 00       	push   $0x5265
+    2b0f:	6a 01                	push   $0x1
+    2b11:	e8 8a 18 00 00       	call   43a0 <printf>
+    exit();
+    2b16:	e8 38 17 00 00       	call   4253 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    2b1b:	50                   	push   %eax
+    2b1c:	50                   	push   %eax
+    2b1d:	68 4d 52 00 00       	push   $0x524d
+    2b22:	6a 01                	push   $0x1
+    2b24:	e8 77 18 00 00       	call   43a0 <printf>
+    exit();
+    2b29:	e8 25 17 00 00       	call   4253 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    2b2e:	50                   	push   %eax
+    2b2f:	50                   	push   %eax
+    2b30:	68 31 52 00 00       	push   $0x5231
+    2b35:	6a 01                	push   $0x1
+    2b37:	e8 64 18 00 00       	call   43a0 <printf>
+    exit();
+    2b3c:	e8 12 17 00 00       	call   4253 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2b41:	50                   	push   %eax
+    2b42:	50                   	push   %eax
+    2b43:	68 15 52 00 00       	push   $0x5215
+    2b48:	6a 01                	push   $0x1
+    2b4a:	e8 51 18 00 00       	call   43a0 <printf>
+    exit();
+    2b4f:	e8 ff 16 00 00       	call   4253 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    2b54:	50                   	push   %eax
+    2b55:	50                   	push   %eax
+    2b56:	68 f8 51 00 00       	push   $0x51f8
+    2b5b:	6a 01                	push   $0x1
+    2b5d:	e8 3e 18 00 00       	call   43a0 <printf>
+    exit();
+    2b62:	e8 ec 16 00 00       	call   4253 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    2b67:	52                   	push   %edx
+    2b68:	52                   	push   %edx
+    2b69:	68 dd 51 00 00       	push   $0x51dd
+    2b6e:	6a 01                	push   $0x1
+    2b70:	e8 2b 18 00 00       	call   43a0 <printf>
+    exit();
+    2b75:	e8 d9 16 00 00       	call   4253 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    2b7a:	51                   	push   %ecx
+    2b7b:	51                   	push   %ecx
+    2b7c:	68 0a 51 00 00       	push   $0x510a
+    2b81:	6a 01                	push   $0x1
+    2b83:	e8 18 18 00 00       	call   43a0 <printf>
+    exit();
+    2b88:	e8 c6 16 00 00       	call   4253 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    2b8d:	53                   	push   %ebx
+    2b8e:	53                   	push   %ebx
+    2b8f:	68 f2 50 00 00       	push   $0x50f2
+    2b94:	6a 01                	push   $0x1
+    2b96:	e8 05 18 00 00       	call   43a0 <printf>
+    exit();
+    2b9b:	e8 b3 16 00 00       	call   4253 <exit>
+
+00002ba0 <bigwrite>:
+{
+    2ba0:	55                   	push   %ebp
+    2ba1:	89 e5                	mov    %esp,%ebp
+    2ba3:	56                   	push   %esi
+    2ba4:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    2ba5:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    2baa:	83 ec 08             	sub    $0x8,%esp
+    2bad:	68 c4 52 00 00       	push   $0x52c4
+    2bb2:	6a 01                	push   $0x1
+    2bb4:	e8 e7 17 00 00       	call   43a0 <printf>
+  unlink("bigwrite");
+    2bb9:	c7 04 24 d3 52 00 00 	movl   $0x52d3,(%esp)
+    2bc0:	e8 de 16 00 00       	call   42a3 <unlink>
+    2bc5:	83 c4 10             	add    $0x10,%esp
+    2bc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2bcf:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2bd0:	83 ec 08             	sub    $0x8,%esp
+    2bd3:	68 02 02 00 00       	push   $0x202
+    2bd8:	68 d3 52 00 00       	push   $0x52d3
+    2bdd:	e8 b1 16 00 00       	call   4293 <open>
+    if(fd < 0){
+    2be2:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2be5:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    2be7:	85 c0                	test   %eax,%eax
+    2be9:	78 7e                	js     2c69 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    2beb:	83 ec 04             	sub    $0x4,%esp
+    2bee:	53                   	push   %ebx
+    2bef:	68 20 93 00 00       	push   $0x9320
+    2bf4:	50                   	push   %eax
+    2bf5:	e8 79 16 00 00       	call   4273 <write>
+      if(cc != sz){
+    2bfa:	83 c4 10             	add    $0x10,%esp
+    2bfd:	39 d8                	cmp    %ebx,%eax
+    2bff:	75 55                	jne    2c56 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    2c01:	83 ec 04             	sub    $0x4,%esp
+    2c04:	53                   	push   %ebx
+    2c05:	68 20 93 00 00       	push   $0x9320
+    2c0a:	56                   	push   %esi
+    2c0b:	e8 63 16 00 00       	call   4273 <write>
+      if(cc != sz){
+    2c10:	83 c4 10             	add    $0x10,%esp
+    2c13:	39 c3                	cmp    %eax,%ebx
+    2c15:	75 3f                	jne    2c56 <bigwrite+0xb6>
+    close(fd);
+    2c17:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    2c1a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    2c20:	56                   	push   %esi
+    2c21:	e8 55 16 00 00       	call   427b <close>
+    unlink("bigwrite");
+    2c26:	c7 04 24 d3 52 00 00 	movl   $0x52d3,(%esp)
+    2c2d:	e8 71 16 00 00       	call   42a3 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2c32:	83 c4 10             	add    $0x10,%esp
+    2c35:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    2c3b:	75 93                	jne    2bd0 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    2c3d:	83 ec 08             	sub    $0x8,%esp
+    2c40:	68 06 53 00 00       	push   $0x5306
+    2c45:	6a 01                	push   $0x1
+    2c47:	e8 54 17 00 00       	call   43a0 <printf>
+}
+    2c4c:	83 c4 10             	add    $0x10,%esp
+    2c4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2c52:	5b                   	pop    %ebx
+    2c53:	5e                   	pop    %esi
+    2c54:	5d                   	pop    %ebp
+    2c55:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2c56:	50                   	push   %eax
+    2c57:	53                   	push   %ebx
+    2c58:	68 f4 52 00 00       	push   $0x52f4
+    2c5d:	6a 01                	push   $0x1
+    2c5f:	e8 3c 17 00 00       	call   43a0 <printf>
+        exit();
+    2c64:	e8 ea 15 00 00       	call   4253 <exit>
+      printf(1, "cannot create bigwrite\n");
+    2c69:	83 ec 08             	sub    $0x8,%esp
+    2c6c:	68 dc 52 00 00       	push   $0x52dc
+    2c71:	6a 01                	push   $0x1
+    2c73:	e8 28 17 00 00       	call   43a0 <printf>
+      exit();
+    2c78:	e8 d6 15 00 00       	call   4253 <exit>
+    2c7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002c80 <fsynctest>:
+{
+    2c80:	55                   	push   %ebp
+    2c81:	89 e5                	mov    %esp,%ebp
+    2c83:	56                   	push   %esi
+    2c84:	53                   	push   %ebx
+    2c85:	83 ec 18             	sub    $0x18,%esp
+  printf(1, "fsync test\n");
+    2c88:	68 13 53 00 00       	push   $0x5313
+    2c8d:	6a 01                	push   $0x1
+    2c8f:	e8 0c 17 00 00       	call   43a0 <printf>
+  unlink("fsyncfile");
+    2c94:	c7 04 24 1f 53 00 00 	movl   $0x531f,(%esp)
+    2c9b:	e8 03 16 00 00       	call   42a3 <unlink>
+  fd = open("fsyncfile", O_CREATE | O_RDWR);
+    2ca0:	58                   	pop    %eax
+    2ca1:	5a                   	pop    %edx
+    2ca2:	68 02 02 00 00       	push   $0x202
+    2ca7:	68 1f 53 00 00       	push   $0x531f
+    2cac:	e8 e2 15 00 00       	call   4293 <open>
+  if(fd < 0){
+    2cb1:	83 c4 10             	add    $0x10,%esp
+    2cb4:	85 c0                	test   %eax,%eax
+    2cb6:	0f 88 89 01 00 00    	js     2e45 <fsynctest+0x1c5>
+    2cbc:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 10; i++){
+    2cbe:	31 db                	xor    %ebx,%ebx
+    memset(buf, 'a' + i, 3*BSIZE);
+    2cc0:	83 ec 04             	sub    $0x4,%esp
+    2cc3:	8d 43 61             	lea    0x61(%ebx),%eax
+    2cc6:	68 00 0c 00 00       	push   $0xc00
+    2ccb:	50                   	push   %eax
+    2ccc:	68 20 93 00 00       	push   $0x9320
+    2cd1:	e8 fa 13 00 00       	call   40d0 <memset>
+    if(write(fd, buf, 3*BSIZE) != 3*BSIZE){
+    2cd6:	83 c4 0c             	add    $0xc,%esp
+    2cd9:	68 00 0c 00 00       	push   $0xc00
+    2cde:	68 20 93 00 00       	push   $0x9320
+    2ce3:	56                   	push   %esi
+    2ce4:	e8 8a 15 00 00       	call   4273 <write>
+    2ce9:	83 c4 10             	add    $0x10,%esp
+    2cec:	3d 00 0c 00 00       	cmp    $0xc00,%eax
+    2cf1:	0f 85 39 01 00 00    	jne    2e30 <fsynctest+0x1b0>
+    close(fd);
+    2cf7:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 10; i++){
+    2cfa:	83 c3 01             	add    $0x1,%ebx
+    close(fd);
+    2cfd:	56                   	push   %esi
+    2cfe:	e8 78 15 00 00       	call   427b <close>
+    fd = open("fsyncfile", O_RDWR);
+    2d03:	5e                   	pop    %esi
+    2d04:	58                   	pop    %eax
+    2d05:	6a 02                	push   $0x2
+    2d07:	68 1f 53 00 00       	push   $0x531f
+    2d0c:	e8 82 15 00 00       	call   4293 <open>
+  for(i = 0; i < 10; i++){
+    2d11:	83 c4 10             	add    $0x10,%esp
+    fd = open("fsyncfile", O_RDWR);
+    2d14:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 10; i++){
+    2d16:	83 fb 0a             	cmp    $0xa,%ebx
+    2d19:	75 a5                	jne    2cc0 <fsynctest+0x40>
+  if(fsync(fd) != 0){
+    2d1b:	83 ec 0c             	sub    $0xc,%esp
+    2d1e:	50                   	push   %eax
+    2d1f:	e8 cf 15 00 00       	call   42f3 <fsync>
+    2d24:	83 c4 10             	add    $0x10,%esp
+    2d27:	89 c3                	mov    %eax,%ebx
+    2d29:	85 c0                	test   %eax,%eax
+    2d2b:	0f 85 e8 00 00 00    	jne    2e19 <fsynctest+0x199>
+  close(fd);
+    2d31:	83 ec 0c             	sub    $0xc,%esp
+    2d34:	56                   	push   %esi
+    2d35:	e8 41 15 00 00       	call   427b <close>
+  fd = open("fsyncfile", 0);
+    2d3a:	58                   	pop    %eax
+    2d3b:	5a                   	pop    %edx
+    2d3c:	6a 00                	push   $0x0
+    2d3e:	68 1f 53 00 00       	push   $0x531f
+    2d43:	e8 4b 15 00 00       	call   4293 <open>
+  if(read(fd, buf, sizeof(buf)) != 3*BSIZE){
+    2d48:	83 c4 0c             	add    $0xc,%esp
+    2d4b:	68 00 20 00 00       	push   $0x2000
+  fd = open("fsyncfile", 0);
+    2d50:	89 c6                	mov    %eax,%esi
+  if(read(fd, buf, sizeof(buf)) != 3*BSIZE){
+    2d52:	68 20 93 00 00       	push   $0x9320
+    2d57:	50                   	push   %eax
+    2d58:	e8 0e 15 00 00       	call   426b <read>
+    2d5d:	83 c4 10             	add    $0x10,%esp
+    2d60:	3d 00 0c 00 00       	cmp    $0xc00,%eax
+    2d65:	0f 85 9b 00 00 00    	jne    2e06 <fsynctest+0x186>
+    2d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2d6f:	90                   	nop
+    if(buf[j] != 'a' + 9){
+    2d70:	80 bb 20 93 00 00 6a 	cmpb   $0x6a,0x9320(%ebx)
+    2d77:	75 79                	jne    2df2 <fsynctest+0x172>
+  for(j = 0; j < 3*BSIZE; j++){
+    2d79:	83 c3 01             	add    $0x1,%ebx
+    2d7c:	81 fb 00 0c 00 00    	cmp    $0xc00,%ebx
+    2d82:	75 ec                	jne    2d70 <fsynctest+0xf0>
+  close(fd);
+    2d84:	83 ec 0c             	sub    $0xc,%esp
+    2d87:	56                   	push   %esi
+    2d88:	e8 ee 14 00 00       	call   427b <close>
+  unlink("fsyncfile");
+    2d8d:	c7 04 24 1f 53 00 00 	movl   $0x531f,(%esp)
+    2d94:	e8 0a 15 00 00       	call   42a3 <unlink>
+  if(pipe(pfd) != 0){
+    2d99:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    2d9c:	89 04 24             	mov    %eax,(%esp)
+    2d9f:	e8 bf 14 00 00       	call   4263 <pipe>
+    2da4:	83 c4 10             	add    $0x10,%esp
+    2da7:	85 c0                	test   %eax,%eax
+    2da9:	0f 85 bc 00 00 00    	jne    2e6b <fsynctest+0x1eb>
+  if(fsync(pfd[0]) != -1){
+    2daf:	83 ec 0c             	sub    $0xc,%esp
+    2db2:	ff 75 f0             	push   -0x10(%ebp)
+    2db5:	e8 39 15 00 00       	call   42f3 <fsync>
+    2dba:	83 c4 10             	add    $0x10,%esp
+    2dbd:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2dc0:	0f 85 92 00 00 00    	jne    2e58 <fsynctest+0x1d8>
+  close(pfd[0]);
+    2dc6:	83 ec 0c             	sub    $0xc,%esp
+    2dc9:	ff 75 f0             	push   -0x10(%ebp)
+    2dcc:	e8 aa 14 00 00       	call   427b <close>
+  close(pfd[1]);
+    2dd1:	58                   	pop    %eax
+    2dd2:	ff 75 f4             	push   -0xc(%ebp)
+    2dd5:	e8 a1 14 00 00       	call   427b <close>
+  printf(1, "fsync ok\n");
+    2dda:	5a                   	pop    %edx
+    2ddb:	59                   	pop    %ecx
+    2ddc:	68 a8 53 00 00       	push   $0x53a8
+    2de1:	6a 01                	push   $0x1
+    2de3:	e8 b8 15 00 00       	call   43a0 <printf>
+}
+    2de8:	83 c4 10             	add    $0x10,%esp
+    2deb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2dee:	5b                   	pop    %ebx
+    2def:	5e                   	pop    %esi
+    2df0:	5d                   	pop    %ebp
+    2df1:	c3                   	ret
+      printf(1, "fsync wrong data\n");
+    2df2:	83 ec 08             	sub    $0x8,%esp
+    2df5:	68 7a 53 00 00       	push   $0x537a
+    2dfa:	6a 01                	push   $0x1
+    2dfc:	e8 9f 15 00 00       	call   43a0 <printf>
+      exit();
+    2e01:	e8 4d 14 00 00       	call   4253 <exit>
+    printf(1, "fsync read failed\n");
+    2e06:	50                   	push   %eax
+    2e07:	50                   	push   %eax
+    2e08:	68 67 53 00 00       	push   $0x5367
+    2e0d:	6a 01                	push   $0x1
+    2e0f:	e8 8c 15 00 00       	call   43a0 <printf>
+    exit();
+    2e14:	e8 3a 14 00 00       	call   4253 <exit>
+    printf(1, "fsync failed\n");
+    2e19:	51                   	push   %ecx
+    2e1a:	51                   	push   %ecx
+    2e1b:	68 59 53 00 00       	push   $0x5359
+    2e20:	6a 01                	push   $0x1
+    2e22:	e8 79 15 00 00       	call   43a0 <printf>
+    exit();
+    2e27:	e8 27 14 00 00       	call   4253 <exit>
+    2e2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "fsync write %d failed\n", i);
+    2e30:	83 ec 04             	sub    $0x4,%esp
+    2e33:	53                   	push   %ebx
+    2e34:	68 42 53 00 00       	push   $0x5342
+    2e39:	6a 01                	push   $0x1
+    2e3b:	e8 60 15 00 00       	call   43a0 <printf>
+      exit();
+    2e40:	e8 0e 14 00 00       	call   4253 <exit>
+    printf(1, "cannot create fsyncfile\n");
+    2e45:	50                   	push   %eax
+    2e46:	50                   	push   %eax
+    2e47:	68 29 53 00 00       	push   $0x5329
+    2e4c:	6a 01                	push   $0x1
+    2e4e:	e8 4d 15 00 00       	call   43a0 <printf>
+    exit();
+    2e53:	e8 fb 13 00 00       	call   4253 <exit>
+    printf(1, "fsync of a pipe succeeded!\n");
+    2e58:	53                   	push   %ebx
+    2e59:	53                   	push   %ebx
+    2e5a:	68 8c 53 00 00       	push   $0x538c
+    2e5f:	6a 01                	push   $0x1
+    2e61:	e8 3a 15 00 00       	call   43a0 <printf>
+    exit();
+    2e66:	e8 e8 13 00 00       	call   4253 <exit>
+    printf(1, "pipe() failed\n");
+    2e6b:	56                   	push   %esi
+    2e6c:	56                   	push   %esi
+    2e6d:	68 8e 4a 00 00       	push   $0x4a8e
+    2e72:	6a 01                	push   $0x1
+    2e74:	e8 27 15 00 00       	call   43a0 <printf>
+    exit();
+    2e79:	e8 d5 13 00 00       	call   4253 <exit>
+    2e7e:	66 90                	xchg   %ax,%ax
+
+00002e80 <bigfile>:
+{
+    2e80:	55                   	push   %ebp
+    2e81:	89 e5                	mov    %esp,%ebp
+    2e83:	57                   	push   %edi
+    2e84:	56                   	push   %esi
+    2e85:	53                   	push   %ebx
+    2e86:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    2e89:	68 b2 53 00 00       	push   $0x53b2
+    2e8e:	6a 01                	push   $0x1
+    2e90:	e8 0b 15 00 00       	call   43a0 <printf>
+  unlink("bigfile");
+    2e95:	c7 04 24 ce 53 00 00 	movl   $0x53ce,(%esp)
+    2e9c:	e8 02 14 00 00       	call   42a3 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2ea1:	58                   	pop    %eax
+    2ea2:	5a                   	pop    %edx
+    2ea3:	68 02 02 00 00       	push   $0x202
+    2ea8:	68 ce 53 00 00       	push   $0x53ce
+    2ead:	e8 e1 13 00 00       	call   4293 <open>
+  if(fd < 0){
+    2eb2:	83 c4 10             	add    $0x10,%esp
+    2eb5:	85 c0                	test   %eax,%eax
+    2eb7:	0f 88 5e 01 00 00    	js     301b <bigfile+0x19b>
+    2ebd:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    2ebf:	31 db                	xor    %ebx,%ebx
+    2ec1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    2ec8:	83 ec 04             	sub    $0x4,%esp
+    2ecb:	68 58 02 00 00       	push   $0x258
+    2ed0:	53                   	push   %ebx
+    2ed1:	68 20 93 00 00       	push   $0x9320
+    2ed6:	e8 f5 11 00 00       	call   40d0 <memset>
+    if(write(fd, buf, 600) != 600){
+    2edb:	83 c4 0c             	add    $0xc,%esp
+    2ede:	68 58 02 00 00       	push   $0x258
+    2ee3:	68 20 93 00 00       	push   $0x9320
+    2ee8:	56                   	push   %esi
+    2ee9:	e8 85 13 00 00       	call   4273 <write>
+    2eee:	83 c4 10             	add    $0x10,%esp
+    2ef1:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2ef6:	0f 85 f8 00 00 00    	jne    2ff4 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    2efc:	83 c3 01             	add    $0x1,%ebx
+    2eff:	83 fb 14             	cmp    $0x14,%ebx
+    2f02:	75 c4                	jne    2ec8 <bigfile+0x48>
+  close(fd);
+    2f04:	83 ec 0c             	sub    $0xc,%esp
+    2f07:	56                   	push   %esi
+    2f08:	e8 6e 13 00 00       	call   427b <close>
+  fd = open("bigfile", 0);
+    2f0d:	5e                   	pop    %esi
+    2f0e:	5f                   	pop    %edi
+    2f0f:	6a 00                	push   $0x0
+    2f11:	68 ce 53 00 00       	push   $0x53ce
+    2f16:	e8 78 13 00 00       	call   4293 <open>
+  if(fd < 0){
+    2f1b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    2f1e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    2f20:	85 c0                	test   %eax,%eax
+    2f22:	0f 88 e0 00 00 00    	js     3008 <bigfile+0x188>
+  total = 0;
+    2f28:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    2f2a:	31 ff                	xor    %edi,%edi
+    2f2c:	eb 30                	jmp    2f5e <bigfile+0xde>
+    2f2e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    2f30:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2f35:	0f 85 91 00 00 00    	jne    2fcc <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    2f3b:	89 fa                	mov    %edi,%edx
+    2f3d:	0f be 05 20 93 00 00 	movsbl 0x9320,%eax
+    2f44:	d1 fa                	sar    %edx
+    2f46:	39 d0                	cmp    %edx,%eax
+    2f48:	75 6e                	jne    2fb8 <bigfile+0x138>
+    2f4a:	0f be 15 4b 94 00 00 	movsbl 0x944b,%edx
+    2f51:	39 d0                	cmp    %edx,%eax
+    2f53:	75 63                	jne    2fb8 <bigfile+0x138>
+    total += cc;
+    2f55:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    2f5b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    2f5e:	83 ec 04             	sub    $0x4,%esp
+    2f61:	68 2c 01 00 00       	push   $0x12c
+    2f66:	68 20 93 00 00       	push   $0x9320
+    2f6b:	56                   	push   %esi
+    2f6c:	e8 fa 12 00 00       	call   426b <read>
+    if(cc < 0){
+    2f71:	83 c4 10             	add    $0x10,%esp
+    2f74:	85 c0                	test   %eax,%eax
+    2f76:	78 68                	js     2fe0 <bigfile+0x160>
+    if(cc == 0)
+    2f78:	75 b6                	jne    2f30 <bigfile+0xb0>
+  close(fd);
+    2f7a:	83 ec 0c             	sub    $0xc,%esp
+    2f7d:	56                   	push   %esi
+    2f7e:	e8 f8 12 00 00       	call   427b <close>
+  if(total != 20*600){
+    2f83:	83 c4 10             	add    $0x10,%esp
+    2f86:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    2f8c:	0f 85 9c 00 00 00    	jne    302e <bigfile+0x1ae>
+  unlink("bigfile");
+    2f92:	83 ec 0c             	sub    $0xc,%esp
+    2f95:	68 ce 53 00 00       	push   $0x53ce
+    2f9a:	e8 04 13 00 00       	call   42a3 <unlink>
+  printf(1, "bigfile test ok\n");
+    2f9f:	58                   	pop    %eax
+    2fa0:	5a                   	pop    %edx
+    2fa1:	68 5d 54 00 00       	push   $0x545d
+    2fa6:	6a 01                	push   $0x1
+    2fa8:	e8 f3 13 00 00       	call   43a0 <printf>
+}
+    2fad:	83 c4 10             	add    $0x10,%esp
+    2fb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2fb3:	5b                   	pop    %ebx
+    2fb4:	5e                   	pop    %esi
+    2fb5:	5f                   	pop    %edi
+    2fb6:	5d                   	pop    %ebp
+    2fb7:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    2fb8:	83 ec 08             	sub    $0x8,%esp
+    2fbb:	68 2a 54 00 00       	push   $0x542a
+    2fc0:	6a 01                	push   $0x1
+    2fc2:	e8 d9 13 00 00       	call   43a0 <printf>
+      exit();
+    2fc7:	e8 87 12 00 00       	call   4253 <exit>
+      printf(1, "short read bigfile\n");
+    2fcc:	83 ec 08             	sub    $0x8,%esp
+    2fcf:	68 16 54 00 00       	push   $0x5416
+    2fd4:	6a 01                	push   $0x1
+    2fd6:	e8 c5 13 00 00       	call   43a0 <printf>
+      exit();
+    2fdb:	e8 73 12 00 00       	call   4253 <exit>
+      printf(1, "read bigfile failed\n");
+    2fe0:	83 ec 08             	sub    $0x8,%esp
+    2fe3:	68 01 54 00 00       	push   $0x5401
+    2fe8:	6a 01                	push   $0x1
+    2fea:	e8 b1 13 00 00       	call   43a0 <printf>
+      exit();
+    2fef:	e8 5f 12 00 00       	call   4253 <exit>
+      printf(1, "write bigfile failed\n");
+    2ff4:	83 ec 08             	sub    $0x8,%esp
+    2ff7:	68 d6 53 00 00       	push   $0x53d6
+    2ffc:	6a 01                	push   $0x1
+    2ffe:	e8 9d 13 00 00       	call   43a0 <printf>
+      exit();
+    3003:	e8 4b 12 00 00       	call   4253 <exit>
+    printf(1, "cannot open bigfile\n");
+    3008:	53                   	push   %ebx
+    3009:	53                   	push   %ebx
+    300a:	68 ec 53 00 00       	push   $0x53ec
+    300f:	6a 01                	push   $0x1
+    3011:	e8 8a 13 00 00       	call   43a0 <printf>
+    exit();
+    3016:	e8 38 12 00 00       	call   4253 <exit>
+    printf(1, "cannot create bigfile");
+    301b:	50                   	push   %eax
+    301c:	50                   	push   %eax
+    301d:	68 c0 53 00 00       	push   $0x53c0
+    3022:	6a 01                	push   $0x1
+    3024:	e8 77 13 00 00       	call   43a0 <printf>
+    exit();
+    3029:	e8 25 12 00 00       	call   4253 <exit>
+    printf(1, "read bigfile wrong total\n");
+    302e:	51                   	push   %ecx
+    302f:	51                   	push   %ecx
+    3030:	68 43 54 00 00       	push   $0x5443
+    3035:	6a 01                	push   $0x1
+    3037:	e8 64 13 00 00       	call   43a0 <printf>
+    exit();
+    303c:	e8 12 12 00 00       	call   4253 <exit>
+    3041:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3048:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    304f:	90                   	nop
+
+00003050 <fourteen>:
+{
+    3050:	55                   	push   %ebp
+    3051:	89 e5                	mov    %esp,%ebp
+    3053:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    3056:	68 6e 54 00 00       	push   $0x546e
+    305b:	6a 01                	push   $0x1
+    305d:	e8 3e 13 00 00       	call   43a0 <printf>
+  if(mkdir("12345678901234") != 0){
+    3062:	c7 04 24 a9 54 00 00 	movl   $0x54a9,(%esp)
+    3069:	e8 4d 12 00 00       	call   42bb <mkdir>
+    306e:	83 c4 10             	add    $0x10,%esp
+    3071:	85 c0                	test   %eax,%eax
+    3073:	0f 85 97 00 00 00    	jne    3110 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    3079:	83 ec 0c             	sub    $0xc,%esp
+    307c:	68 b8 5d 00 00       	push   $0x5db8
+    3081:	e8 35 12 00 00       	call   42bb <mkdir>
+    3086:	83 c4 10             	add    $0x10,%esp
+    3089:	85 c0                	test   %eax,%eax
+    308b:	0f 85 de 00 00 00    	jne    316f <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    3091:	83 ec 08             	sub    $0x8,%esp
+    3094:	68 00 02 00 00       	push   $0x200
+    3099:	68 08 5e 00 00       	push   $0x5e08
+    309e:	e8 f0 11 00 00       	call   4293 <open>
+  if(fd < 0){
+    30a3:	83 c4 10             	add    $0x10,%esp
+    30a6:	85 c0                	test   %eax,%eax
+    30a8:	0f 88 ae 00 00 00    	js     315c <fourteen+0x10c>
+  close(fd);
+    30ae:	83 ec 0c             	sub    $0xc,%esp
+    30b1:	50                   	push   %eax
+    30b2:	e8 c4 11 00 00       	call   427b <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    30b7:	58                   	pop    %eax
+    30b8:	5a                   	pop    %edx
+    30b9:	6a 00                	push   $0x0
+    30bb:	68 78 5e 00 00       	push   $0x5e78
+    30c0:	e8 ce 11 00 00       	call   4293 <open>
+  if(fd < 0){
+    30c5:	83 c4 10             	add    $0x10,%esp
+    30c8:	85 c0                	test   %eax,%eax
+    30ca:	78 7d                	js     3149 <fourteen+0xf9>
+  close(fd);
+    30cc:	83 ec 0c             	sub    $0xc,%esp
+    30cf:	50                   	push   %eax
+    30d0:	e8 a6 11 00 00       	call   427b <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    30d5:	c7 04 24 9a 54 00 00 	movl   $0x549a,(%esp)
+    30dc:	e8 da 11 00 00       	call   42bb <mkdir>
+    30e1:	83 c4 10             	add    $0x10,%esp
+    30e4:	85 c0                	test   %eax,%eax
+    30e6:	74 4e                	je     3136 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    30e8:	83 ec 0c             	sub    $0xc,%esp
+    30eb:	68 14 5f 00 00       	push   $0x5f14
+    30f0:	e8 c6 11 00 00       	call   42bb <mkdir>
+    30f5:	83 c4 10             	add    $0x10,%esp
+    30f8:	85 c0                	test   %eax,%eax
+    30fa:	74 27                	je     3123 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    30fc:	83 ec 08             	sub    $0x8,%esp
+    30ff:	68 b8 54 00 00       	push   $0x54b8
+    3104:	6a 01                	push   $0x1
+    3106:	e8 95 12 00 00       	call   43a0 <printf>
+}
+    310b:	83 c4 10             	add    $0x10,%esp
+    310e:	c9                   	leave
+    310f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    3110:	50                   	push   %eax
+    3111:	50                   	push   %eax
+    3112:	68 7d 54 00 00       	push   $0x547d
+    3117:	6a 01                	push   $0x1
+    3119:	e8 82 12 00 00       	call   43a0 <printf>
+    exit();
+    311e:	e8 30 11 00 00       	call   4253 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    3123:	50                   	push   %eax
+    3124:	50                   	push   %eax
+    3125:	68 34 5f 00 00       	push   $0x5f34
+    312a:	6a 01                	push   $0x1
+    312c:	e8 6f 12 00 00       	call   43a0 <printf>
+    exit();
+    3131:	e8 1d 11 00 00       	call   4253 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    3136:	52                   	push   %edx
+    3137:	52                   	push   %edx
+    3138:	68 e4 5e 00 00       	push   $0x5ee4
+    313d:	6a 01                	push   $0x1
+    313f:	e8 5c 12 00 00       	call   43a0 <printf>
+    exit();
+    3144:	e8 0a 11 00 00       	call   4253 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    3149:	51                   	push   %ecx
+    314a:	51                   	push   %ecx
+    314b:	68 a8 5e 00 00       	push   $0x5ea8
+    3150:	6a 01                	push   $0x1
+    3152:	e8 49 12 00 00       	call   43a0 <printf>
+    exit();
+    3157:	e8 f7 10 00 00       	call   4253 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    315c:	51                   	push   %ecx
+    315d:	51                   	push   %ecx
+    315e:	68 38 5e 00 00       	push   $0x5e38
+    3163:	6a 01                	push   $0x1
+    3165:	e8 36 12 00 00       	call   43a0 <printf>
+    exit();
+    316a:	e8 e4 10 00 00       	call   4253 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    316f:	50                   	push   %eax
+    3170:	50                   	push   %eax
+    3171:	68 d8 5d 00 00       	push   $0x5dd8
+    3176:	6a 01                	push   $0x1
+    3178:	e8 23 12 00 00       	call   43a0 <printf>
+    exit();
+    317d:	e8 d1 10 00 00       	call   4253 <exit>
+    3182:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003190 <rmdot>:
+{
+    3190:	55                   	push   %ebp
+    3191:	89 e5                	mov    %esp,%ebp
+    3193:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    3196:	68 c5 54 00 00       	push   $0x54c5
+    319b:	6a 01                	push   $0x1
+    319d:	e8 fe 11 00 00       	call   43a0 <printf>
+  if(mkdir("dots") != 0){
+    31a2:	c7 04 24 d1 54 00 00 	movl   $0x54d1,(%esp)
+    31a9:	e8 0d 11 00 00       	call   42bb <mkdir>
+    31ae:	83 c4 10             	add    $0x10,%esp
+    31b1:	85 c0                	test   %eax,%eax
+    31b3:	0f 85 b0 00 00 00    	jne    3269 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    31b9:	83 ec 0c             	sub    $0xc,%esp
+    31bc:	68 d1 54 00 00       	push   $0x54d1
+    31c1:	e8 fd 10 00 00       	call   42c3 <chdir>
+    31c6:	83 c4 10             	add    $0x10,%esp
+    31c9:	85 c0                	test   %eax,%eax
+    31cb:	0f 85 1d 01 00 00    	jne    32ee <rmdot+0x15e>
+  if(unlink(".") == 0){
+    31d1:	83 ec 0c             	sub    $0xc,%esp
+    31d4:	68 dd 50 00 00       	push   $0x50dd
+    31d9:	e8 c5 10 00 00       	call   42a3 <unlink>
+    31de:	83 c4 10             	add    $0x10,%esp
+    31e1:	85 c0                	test   %eax,%eax
+    31e3:	0f 84 f2 00 00 00    	je     32db <rmdot+0x14b>
+  if(unlink("..") == 0){
+    31e9:	83 ec 0c             	sub    $0xc,%esp
+    31ec:	68 dc 50 00 00       	push   $0x50dc
+    31f1:	e8 ad 10 00 00       	call   42a3 <unlink>
+    31f6:	83 c4 10             	add    $0x10,%esp
+    31f9:	85 c0                	test   %eax,%eax
+    31fb:	0f 84 c7 00 00 00    	je     32c8 <rmdot+0x138>
+  if(chdir("/") != 0){
+    3201:	83 ec 0c             	sub    $0xc,%esp
+    3204:	68 87 4f 00 00       	push   $0x4f87
+    3209:	e8 b5 10 00 00       	call   42c3 <chdir>
+    320e:	83 c4 10             	add    $0x10,%esp
+    3211:	85 c0                	test   %eax,%eax
+    3213:	0f 85 9c 00 00 00    	jne    32b5 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    3219:	83 ec 0c             	sub    $0xc,%esp
+    321c:	68 19 55 00 00       	push   $0x5519
+    3221:	e8 7d 10 00 00       	call   42a3 <unlink>
+    3226:	83 c4 10             	add    $0x10,%esp
+    3229:	85 c0                	test   %eax,%eax
+    322b:	74 75                	je     32a2 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    322d:	83 ec 0c             	sub    $0xc,%esp
+    3230:	68 37 55 00 00       	push   $0x5537
+    3235:	e8 69 10 00 00       	call   42a3 <unlink>
+    323a:	83 c4 10             	add    $0x10,%esp
+    323d:	85 c0                	test   %eax,%eax
+    323f:	74 4e                	je     328f <rmdot+0xff>
+  if(unlink("dots") != 0){
+    3241:	83 ec 0c             	sub    $0xc,%esp
+    3244:	68 d1 54 00 00       	push   $0x54d1
+    3249:	e8 55 10 00 00       	call   42a3 <unlink>
+    324e:	83 c4 10             	add    $0x10,%esp
+    3251:	85 c0                	test   %eax,%eax
+    3253:	75 27                	jne    327c <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    3255:	83 ec 08             	sub    $0x8,%esp
+    3258:	68 6c 55 00 00       	push   $0x556c
+    325d:	6a 01                	push   $0x1
+    325f:	e8 3c 11 00 00       	call   43a0 <printf>
+}
+    3264:	83 c4 10             	add    $0x10,%esp
+    3267:	c9                   	leave
+    3268:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    3269:	50                   	push   %eax
+    326a:	50                   	push   %eax
+    326b:	68 d6 54 00 00       	push   $0x54d6
+    3270:	6a 01                	push   $0x1
+    3272:	e8 29 11 00 00       	call   43a0 <printf>
+    exit();
+    3277:	e8 d7 0f 00 00       	call   4253 <exit>
+    printf(1, "unlink dots failed!\n");
+    327c:	50                   	push   %eax
+    327d:	50                   	push   %eax
+    327e:	68 57 55 00 00       	push   $0x5557
+    3283:	6a 01                	push   $0x1
+    3285:	e8 16 11 00 00       	call   43a0 <printf>
+    exit();
+    328a:	e8 c4 0f 00 00       	call   4253 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    328f:	52                   	push   %edx
+    3290:	52                   	push   %edx
+    3291:	68 3f 55 00 00       	push   $0x553f
+    3296:	6a 01                	push   $0x1
+    3298:	e8 03 11 00 00       	call   43a0 <printf>
+    exit();
+    329d:	e8 b1 0f 00 00       	call   4253 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    32a2:	51                   	push   %ecx
+    32a3:	51                   	push   %ecx
+    32a4:	68 20 55 00 00       	push   $0x5520
+    32a9:	6a 01                	push   $0x1
+    32ab:	e8 f0 10 00 00       	call   43a0 <printf>
+    exit();
+    32b0:	e8 9e 0f 00 00       	call   4253 <exit>
+    printf(1, "chdir / failed\n");
+    32b5:	50                   	push   %eax
+    32b6:	50                   	push   %eax
+    32b7:	68 11 47 00 00       	push   $0x4711
+    32bc:	6a 01                	push   $0x1
+    32be:	e8 dd 10 00 00       	call   43a0 <printf>
+    exit();
+    32c3:	e8 8b 0f 00 00       	call   4253 <exit>
+    printf(1, "rm .. worked!\n");
+    32c8:	50                   	push   %eax
+    32c9:	50                   	push   %eax
+    32ca:	68 0a 55 00 00       	push   $0x550a
+    32cf:	6a 01                	push   $0x1
+    32d1:	e8 ca 10 00 00       	call   43a0 <printf>
+    exit();
+    32d6:	e8 78 0f 00 00       	call   4253 <exit>
+    printf(1, "rm . worked!\n");
+    32db:	50                   	push   %eax
+    32dc:	50                   	push   %eax
+    32dd:	68 fc 54 00 00       	push   $0x54fc
+    32e2:	6a 01                	push   $0x1
+    32e4:	e8 b7 10 00 00       	call   43a0 <printf>
+    exit();
+    32e9:	e8 65 0f 00 00       	call   4253 <exit>
+    printf(1, "chdir dots failed\n");
+    32ee:	50                   	push   %eax
+    32ef:	50                   	push   %eax
+    32f0:	68 e9 54 00 00       	push   $0x54e9
+    32f5:	6a 01                	push   $0x1
+    32f7:	e8 a4 10 00 00       	call   43a0 <printf>
+    exit();
+    32fc:	e8 52 0f 00 00       	call   4253 <exit>
+    3301:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3308:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    330f:	90                   	nop
+
+00003310 <dirfile>:
+{
+    3310:	55                   	push   %ebp
+    3311:	89 e5                	mov    %esp,%ebp
+    3313:	53                   	push   %ebx
+    3314:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    3317:	68 76 55 00 00       	push   $0x5576
+    331c:	6a 01                	push   $0x1
+    331e:	e8 7d 10 00 00       	call   43a0 <printf>
+  fd = open("dirfile", O_CREATE);
+    3323:	5b                   	pop    %ebx
+    3324:	58                   	pop    %eax
+    3325:	68 00 02 00 00       	push   $0x200
+    332a:	68 83 55 00 00       	push   $0x5583
+    332f:	e8 5f 0f 00 00       	call   4293 <open>
+  if(fd < 0){
+    3334:	83 c4 10             	add    $0x10,%esp
+    3337:	85 c0                	test   %eax,%eax
+    3339:	0f 88 43 01 00 00    	js     3482 <dirfile+0x172>
+  close(fd);
+    333f:	83 ec 0c             	sub    $0xc,%esp
+    3342:	50                   	push   %eax
+    3343:	e8 33 0f 00 00       	call   427b <close>
+  if(chdir("dirfile") == 0){
+    3348:	c7 04 24 83 55 00 00 	movl   $0x5583,(%esp)
+    334f:	e8 6f 0f 00 00       	call   42c3 <chdir>
+    3354:	83 c4 10             	add    $0x10,%esp
+    3357:	85 c0                	test   %eax,%eax
+    3359:	0f 84 10 01 00 00    	je     346f <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    335f:	83 ec 08             	sub    $0x8,%esp
+    3362:	6a 00                	push   $0x0
+    3364:	68 bc 55 00 00       	push   $0x55bc
+    3369:	e8 25 0f 00 00       	call   4293 <open>
+  if(fd >= 0){
+    336e:	83 c4 10             	add    $0x10,%esp
+    3371:	85 c0                	test   %eax,%eax
+    3373:	0f 89 e3 00 00 00    	jns    345c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    3379:	83 ec 08             	sub    $0x8,%esp
+    337c:	68 00 02 00 00       	push   $0x200
+    3381:	68 bc 55 00 00       	push   $0x55bc
+    3386:	e8 08 0f 00 00       	call   4293 <open>
+  if(fd >= 0){
+    338b:	83 c4 10             	add    $0x10,%esp
+    338e:	85 c0                	test   %eax,%eax
+    3390:	0f 89 c6 00 00 00    	jns    345c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    3396:	83 ec 0c             	sub    $0xc,%esp
+    3399:	68 bc 55 00 00       	push   $0x55bc
+    339e:	e8 18 0f 00 00       	call   42bb <mkdir>
+    33a3:	83 c4 10             	add    $0x10,%esp
+    33a6:	85 c0                	test   %eax,%eax
+    33a8:	0f 84 46 01 00 00    	je     34f4 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    33ae:	83 ec 0c             	sub    $0xc,%esp
+    33b1:	68 bc 55 00 00       	push   $0x55bc
+    33b6:	e8 e8 0e 00 00       	call   42a3 <unlink>
+    33bb:	83 c4 10             	add    $0x10,%esp
+    33be:	85 c0                	test   %eax,%eax
+    33c0:	0f 84 1b 01 00 00    	je     34e1 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    33c6:	83 ec 08             	sub    $0x8,%esp
+    33c9:	68 bc 55 00 00       	push   $0x55bc
+    33ce:	68 20 56 00 00       	push   $0x5620
+    33d3:	e8 db 0e 00 00       	call   42b3 <link>
+    33d8:	83 c4 10             	add    $0x10,%esp
+    33db:	85 c0                	test   %eax,%eax
+    33dd:	0f 84 eb 00 00 00    	je     34ce <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    33e3:	83 ec 0c             	sub    $0xc,%esp
+    33e6:	68 83 55 00 00       	push   $0x5583
+    33eb:	e8 b3 0e 00 00       	call   42a3 <unlink>
+    33f0:	83 c4 10             	add    $0x10,%esp
+    33f3:	85 c0                	test   %eax,%eax
+    33f5:	0f 85 c0 00 00 00    	jne    34bb <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    33fb:	83 ec 08             	sub    $0x8,%esp
+    33fe:	6a 02                	push   $0x2
+    3400:	68 dd 50 00 00       	push   $0x50dd
+    3405:	e8 89 0e 00 00       	call   4293 <open>
+  if(fd >= 0){
+    340a:	83 c4 10             	add    $0x10,%esp
+    340d:	85 c0                	test   %eax,%eax
+    340f:	0f 89 93 00 00 00    	jns    34a8 <dirfile+0x198>
+  fd = open(".", 0);
+    3415:	83 ec 08             	sub    $0x8,%esp
+    3418:	6a 00                	push   $0x0
+    341a:	68 dd 50 00 00       	push   $0x50dd
+    341f:	e8 6f 0e 00 00       	call   4293 <open>
+  if(write(fd, "x", 1) > 0){
+    3424:	83 c4 0c             	add    $0xc,%esp
+    3427:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    3429:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    342b:	68 c0 51 00 00       	push   $0x51c0
+    3430:	50                   	push   %eax
+    3431:	e8 3d 0e 00 00       	call   4273 <write>
+    3436:	83 c4 10             	add    $0x10,%esp
+    3439:	85 c0                	test   %eax,%eax
+    343b:	7f 58                	jg     3495 <dirfile+0x185>
+  close(fd);
+    343d:	83 ec 0c             	sub    $0xc,%esp
+    3440:	53                   	push   %ebx
+    3441:	e8 35 0e 00 00       	call   427b <close>
+  printf(1, "dir vs file OK\n");
+    3446:	58                   	pop    %eax
+    3447:	5a                   	pop    %edx
+    3448:	68 53 56 00 00       	push   $0x5653
+    344d:	6a 01                	push   $0x1
+    344f:	e8 4c 0f 00 00       	call   43a0 <printf>
+}
+    3454:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3457:	83 c4 10             	add    $0x10,%esp
+    345a:	c9                   	leave
+    345b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    345c:	50                   	push   %eax
+    345d:	50                   	push   %eax
+    345e:	68 c7 55 00 00       	push   $0x55c7
+    3463:	6a 01                	push   $0x1
+    3465:	e8 36 0f 00 00       	call   43a0 <printf>
+    exit();
+    346a:	e8 e4 0d 00 00       	call   4253 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    346f:	52                   	push   %edx
+    3470:	52                   	push   %edx
+    3471:	68 a2 55 00 00       	push   $0x55a2
+    3476:	6a 01                	push   $0x1
+    3478:	e8 23 0f 00 00       	call   43a0 <printf>
+    exit();
+    347d:	e8 d1 0d 00 00       	call   4253 <exit>
+    printf(1, "create dirfile failed\n");
+    3482:	51                   	push   %ecx
+    3483:	51                   	push   %ecx
+    3484:	68 8b 55 00 00       	push   $0x558b
+    3489:	6a 01                	push   $0x1
+    348b:	e8 10 0f 00 00       	call   43a0 <printf>
+    exit();
+    3490:	e8 be 0d 00 00       	call   4253 <exit>
+    printf(1, "write . succeeded!\n");
+    3495:	51                   	push   %ecx
+    3496:	51                   	push   %ecx
+    3497:	68 3f 56 00 00       	push   $0x563f
+    349c:	6a 01                	push   $0x1
+    349e:	e8 fd 0e 00 00       	call   43a0 <printf>
+    exit();
+    34a3:	e8 ab 0d 00 00       	call   4253 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    34a8:	53                   	push   %ebx
+    34a9:	53                   	push   %ebx
+    34aa:	68 88 5f 00 00       	push   $0x5f88
+    34af:	6a 01                	push   $0x1
+    34b1:	e8 ea 0e 00 00       	call   43a0 <printf>
+    exit();
+    34b6:	e8 98 0d 00 00       	call   4253 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    34bb:	50                   	push   %eax
+    34bc:	50                   	push   %eax
+    34bd:	68 27 56 00 00       	push   $0x5627
+    34c2:	6a 01                	push   $0x1
+    34c4:	e8 d7 0e 00 00       	call   43a0 <printf>
+    exit();
+    34c9:	e8 85 0d 00 00       	call   4253 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    34ce:	50                   	push   %eax
+    34cf:	50                   	push   %eax
+    34d0:	68 68 5f 00 00       	push   $0x5f68
+    34d5:	6a 01                	push   $0x1
+    34d7:	e8 c4 0e 00 00       	call   43a0 <printf>
+    exit();
+    34dc:	e8 72 0d 00 00       	call   4253 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    34e1:	50                   	push   %eax
+    34e2:	50                   	push   %eax
+    34e3:	68 02 56 00 00       	push   $0x5602
+    34e8:	6a 01                	push   $0x1
+    34ea:	e8 b1 0e 00 00       	call   43a0 <printf>
+    exit();
+    34ef:	e8 5f 0d 00 00       	call   4253 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    34f4:	50                   	push   %eax
+    34f5:	50                   	push   %eax
+    34f6:	68 e5 55 00 00       	push   $0x55e5
+    34fb:	6a 01                	push   $0x1
+    34fd:	e8 9e 0e 00 00       	call   43a0 <printf>
+    exit();
+    3502:	e8 4c 0d 00 00       	call   4253 <exit>
+    3507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    350e:	66 90                	xchg   %ax,%ax
+
+00003510 <iref>:
+{
+    3510:	55                   	push   %ebp
+    3511:	89 e5                	mov    %esp,%ebp
+    3513:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    3514:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    3519:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    351c:	68 63 56 00 00       	push   $0x5663
+    3521:	6a 01                	push   $0x1
+    3523:	e8 78 0e 00 00       	call   43a0 <printf>
+    3528:	83 c4 10             	add    $0x10,%esp
+    352b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    352f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    3530:	83 ec 0c             	sub    $0xc,%esp
+    3533:	68 74 56 00 00       	push   $0x5674
+    3538:	e8 7e 0d 00 00       	call   42bb <mkdir>
+    353d:	83 c4 10             	add    $0x10,%esp
+    3540:	85 c0                	test   %eax,%eax
+    3542:	0f 85 bb 00 00 00    	jne    3603 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    3548:	83 ec 0c             	sub    $0xc,%esp
+    354b:	68 74 56 00 00       	push   $0x5674
+    3550:	e8 6e 0d 00 00       	call   42c3 <chdir>
+    3555:	83 c4 10             	add    $0x10,%esp
+    3558:	85 c0                	test   %eax,%eax
+    355a:	0f 85 b7 00 00 00    	jne    3617 <iref+0x107>
+    mkdir("");
+    3560:	83 ec 0c             	sub    $0xc,%esp
+    3563:	68 78 4b 00 00       	push   $0x4b78
+    3568:	e8 4e 0d 00 00       	call   42bb <mkdir>
+    link("README", "");
+    356d:	59                   	pop    %ecx
+    356e:	58                   	pop    %eax
+    356f:	68 78 4b 00 00       	push   $0x4b78
+    3574:	68 20 56 00 00       	push   $0x5620
+    3579:	e8 35 0d 00 00       	call   42b3 <link>
+    fd = open("", O_CREATE);
+    357e:	58                   	pop    %eax
+    357f:	5a                   	pop    %edx
+    3580:	68 00 02 00 00       	push   $0x200
+    3585:	68 78 4b 00 00       	push   $0x4b78
+    358a:	e8 04 0d 00 00       	call   4293 <open>
+    if(fd >= 0)
+    358f:	83 c4 10             	add    $0x10,%esp
+    3592:	85 c0                	test   %eax,%eax
+    3594:	78 0c                	js     35a2 <iref+0x92>
+      close(fd);
+    3596:	83 ec 0c             	sub    $0xc,%esp
+    3599:	50                   	push   %eax
+    359a:	e8 dc 0c 00 00       	call   427b <close>
+    359f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    35a2:	83 ec 08             	sub    $0x8,%esp
+    35a5:	68 00 02 00 00       	push   $0x200
+    35aa:	68 bf 51 00 00       	push   $0x51bf
+    35af:	e8 df 0c 00 00       	call   4293 <open>
+    if(fd >= 0)
+    35b4:	83 c4 10             	add    $0x10,%esp
+    35b7:	85 c0                	test   %eax,%eax
+    35b9:	78 0c                	js     35c7 <iref+0xb7>
+      close(fd);
+    35bb:	83 ec 0c             	sub    $0xc,%esp
+    35be:	50                   	push   %eax
+    35bf:	e8 b7 0c 00 00       	call   427b <close>
+    35c4:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    35c7:	83 ec 0c             	sub    $0xc,%esp
+    35ca:	68 bf 51 00 00       	push   $0x51bf
+    35cf:	e8 cf 0c 00 00       	call   42a3 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    35d4:	83 c4 10             	add    $0x10,%esp
+    35d7:	83 eb 01             	sub    $0x1,%ebx
+    35da:	0f 85 50 ff ff ff    	jne    3530 <iref+0x20>
+  chdir("/");
+    35e0:	83 ec 0c             	sub    $0xc,%esp
+    35e3:	68 87 4f 00 00       	push   $0x4f87
+    35e8:	e8 d6 0c 00 00       	call   42c3 <chdir>
+  printf(1, "empty file name OK\n");
+    35ed:	58                   	pop    %eax
+    35ee:	5a                   	pop    %edx
+    35ef:	68 a2 56 00 00       	push   $0x56a2
+    35f4:	6a 01                	push   $0x1
+    35f6:	e8 a5 0d 00 00       	call   43a0 <printf>
+}
+    35fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    35fe:	83 c4 10             	add    $0x10,%esp
+    3601:	c9                   	leave
+    3602:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    3603:	83 ec 08             	sub    $0x8,%esp
+    3606:	68 7a 56 00 00       	push   $0x567a
+    360b:	6a 01                	push   $0x1
+    360d:	e8 8e 0d 00 00       	call   43a0 <printf>
+      exit();
+    3612:	e8 3c 0c 00 00       	call   4253 <exit>
+      printf(1, "chdir irefd failed\n");
+    3617:	83 ec 08             	sub    $0x8,%esp
+    361a:	68 8e 56 00 00       	push   $0x568e
+    361f:	6a 01                	push   $0x1
+    3621:	e8 7a 0d 00 00       	call   43a0 <printf>
+      exit();
+    3626:	e8 28 0c 00 00       	call   4253 <exit>
+    362b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    362f:	90                   	nop
+
+00003630 <forktest>:
+{
+    3630:	55                   	push   %ebp
+    3631:	89 e5                	mov    %esp,%ebp
+    3633:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    3634:	31 db                	xor    %ebx,%ebx
+{
+    3636:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    3639:	68 b6 56 00 00       	push   $0x56b6
+    363e:	6a 01                	push   $0x1
+    3640:	e8 5b 0d 00 00       	call   43a0 <printf>
+    3645:	83 c4 10             	add    $0x10,%esp
+    3648:	eb 13                	jmp    365d <forktest+0x2d>
+    364a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    3650:	74 4d                	je     369f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    3652:	83 c3 01             	add    $0x1,%ebx
+    3655:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    365b:	74 6e                	je     36cb <forktest+0x9b>
+    pid = fork();
+    365d:	e8 e9 0b 00 00       	call   424b <fork>
+    if(pid < 0)
+    3662:	85 c0                	test   %eax,%eax
+    3664:	79 ea                	jns    3650 <forktest+0x20>
+  for(; n > 0; n--){
+    3666:	85 db                	test   %ebx,%ebx
+    3668:	74 14                	je     367e <forktest+0x4e>
+    366a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    3670:	e8 e6 0b 00 00       	call   425b <wait>
+    3675:	85 c0                	test   %eax,%eax
+    3677:	78 2b                	js     36a4 <forktest+0x74>
+  for(; n > 0; n--){
+    3679:	83 eb 01             	sub    $0x1,%ebx
+    367c:	75 f2                	jne    3670 <forktest+0x40>
+  if(wait() != -1){
+    367e:	e8 d8 0b 00 00       	call   425b <wait>
+    3683:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3686:	75 30                	jne    36b8 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    3688:	83 ec 08             	sub    $0x8,%esp
+    368b:	68 e8 56 00 00       	push   $0x56e8
+    3690:	6a 01                	push   $0x1
+    3692:	e8 09 0d 00 00       	call   43a0 <printf>
+}
+    3697:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    369a:	83 c4 10             	add    $0x10,%esp
+    369d:	c9                   	leave
+    369e:	c3                   	ret
+      exit();
+    369f:	e8 af 0b 00 00       	call   4253 <exit>
+      printf(1, "wait stopped early\n");
+    36a4:	83 ec 08             	sub    $0x8,%esp
+    36a7:	68 c1 56 00 00       	push   $0x56c1
+    36ac:	6a 01                	push   $0x1
+    36ae:	e8 ed 0c 00 00       	call   43a0 <printf>
+      exit();
+    36b3:	e8 9b 0b 00 00       	call   4253 <exit>
+    printf(1, "wait got too many\n");
+    36b8:	50                   	push   %eax
+    36b9:	50                   	push   %eax
+    36ba:	68 d5 56 00 00       	push   $0x56d5
+    36bf:	6a 01                	push   $0x1
+    36c1:	e8 da 0c 00 00       	call   43a0 <printf>
+    exit();
+    36c6:	e8 88 0b 00 00       	call   4253 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    36cb:	52                   	push   %edx
+    36cc:	52                   	push   %edx
+    36cd:	68 a8 5f 00 00       	push   $0x5fa8
+    36d2:	6a 01                	push   $0x1
+    36d4:	e8 c7 0c 00 00       	call   43a0 <printf>
+    exit();
+    36d9:	e8 75 0b 00 00       	call   4253 <exit>
+    36de:	66 90                	xchg   %ax,%ax
+
+000036e0 <sbrktest>:
+{
+    36e0:	55                   	push   %ebp
+    36e1:	89 e5                	mov    %esp,%ebp
+    36e3:	57                   	push   %edi
+    36e4:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    36e5:	31 f6                	xor    %esi,%esi
+{
+    36e7:	53                   	push   %ebx
+    36e8:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    36eb:	68 f6 56 00 00       	push   $0x56f6
+    36f0:	ff 35 e8 6b 00 00    	push   0x6be8
+    36f6:	e8 a5 0c 00 00       	call   43a0 <printf>
+  oldbrk = sbrk(0);
+    36fb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3702:	e8 d4 0b 00 00       	call   42db <sbrk>
+    3707:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    370a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3711:	e8 c5 0b 00 00       	call   42db <sbrk>
+    3716:	83 c4 10             	add    $0x10,%esp
+    3719:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    371b:	eb 05                	jmp    3722 <sbrktest+0x42>
+    371d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    3720:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    3722:	83 ec 0c             	sub    $0xc,%esp
+    3725:	6a 01                	push   $0x1
+    3727:	e8 af 0b 00 00       	call   42db <sbrk>
+    if(b != a){
+    372c:	83 c4 10             	add    $0x10,%esp
+    372f:	39 d8                	cmp    %ebx,%eax
+    3731:	0f 85 9c 02 00 00    	jne    39d3 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    3737:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    373a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    373d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    3740:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    3746:	75 d8                	jne    3720 <sbrktest+0x40>
+  pid = fork();
+    3748:	e8 fe 0a 00 00       	call   424b <fork>
+    374d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    374f:	85 c0                	test   %eax,%eax
+    3751:	0f 88 02 03 00 00    	js     3a59 <sbrktest+0x379>
+  c = sbrk(1);
+    3757:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    375a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    375d:	6a 01                	push   $0x1
+    375f:	e8 77 0b 00 00       	call   42db <sbrk>
+  c = sbrk(1);
+    3764:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    376b:	e8 6b 0b 00 00       	call   42db <sbrk>
+  if(c != a + 1){
+    3770:	83 c4 10             	add    $0x10,%esp
+    3773:	39 c3                	cmp    %eax,%ebx
+    3775:	0f 85 3b 03 00 00    	jne    3ab6 <sbrktest+0x3d6>
+  if(pid == 0)
+    377b:	85 f6                	test   %esi,%esi
+    377d:	0f 84 2e 03 00 00    	je     3ab1 <sbrktest+0x3d1>
+  wait();
+    3783:	e8 d3 0a 00 00       	call   425b <wait>
+  a = sbrk(0);
+    3788:	83 ec 0c             	sub    $0xc,%esp
+    378b:	6a 00                	push   $0x0
+    378d:	e8 49 0b 00 00       	call   42db <sbrk>
+    3792:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    3794:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3799:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    379b:	89 04 24             	mov    %eax,(%esp)
+    379e:	e8 38 0b 00 00       	call   42db <sbrk>
+  if (p != a) {
+    37a3:	83 c4 10             	add    $0x10,%esp
+    37a6:	39 c3                	cmp    %eax,%ebx
+    37a8:	0f 85 94 02 00 00    	jne    3a42 <sbrktest+0x362>
+  a = sbrk(0);
+    37ae:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    37b1:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    37b8:	6a 00                	push   $0x0
+    37ba:	e8 1c 0b 00 00       	call   42db <sbrk>
+  c = sbrk(-4096);
+    37bf:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    37c6:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    37c8:	e8 0e 0b 00 00       	call   42db <sbrk>
+  if(c == (char*)0xffffffff){
+    37cd:	83 c4 10             	add    $0x10,%esp
+    37d0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    37d3:	0f 84 22 03 00 00    	je     3afb <sbrktest+0x41b>
+  c = sbrk(0);
+    37d9:	83 ec 0c             	sub    $0xc,%esp
+    37dc:	6a 00                	push   $0x0
+    37de:	e8 f8 0a 00 00       	call   42db <sbrk>
+  if(c != a - 4096){
+    37e3:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    37e9:	83 c4 10             	add    $0x10,%esp
+    37ec:	39 d0                	cmp    %edx,%eax
+    37ee:	0f 85 f0 02 00 00    	jne    3ae4 <sbrktest+0x404>
+  a = sbrk(0);
+    37f4:	83 ec 0c             	sub    $0xc,%esp
+    37f7:	6a 00                	push   $0x0
+    37f9:	e8 dd 0a 00 00       	call   42db <sbrk>
+  c = sbrk(4096);
+    37fe:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    3805:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    3807:	e8 cf 0a 00 00       	call   42db <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    380c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    380f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    3811:	39 c3                	cmp    %eax,%ebx
+    3813:	0f 85 b4 02 00 00    	jne    3acd <sbrktest+0x3ed>
+    3819:	83 ec 0c             	sub    $0xc,%esp
+    381c:	6a 00                	push   $0x0
+    381e:	e8 b8 0a 00 00       	call   42db <sbrk>
+    3823:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    3829:	83 c4 10             	add    $0x10,%esp
+    382c:	39 c2                	cmp    %eax,%edx
+    382e:	0f 85 99 02 00 00    	jne    3acd <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    3834:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    383b:	0f 84 2f 02 00 00    	je     3a70 <sbrktest+0x390>
+  a = sbrk(0);
+    3841:	83 ec 0c             	sub    $0xc,%esp
+    3844:	6a 00                	push   $0x0
+    3846:	e8 90 0a 00 00       	call   42db <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    384b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    3852:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3854:	e8 82 0a 00 00       	call   42db <sbrk>
+    3859:	89 c2                	mov    %eax,%edx
+    385b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    385e:	29 d0                	sub    %edx,%eax
+    3860:	89 04 24             	mov    %eax,(%esp)
+    3863:	e8 73 0a 00 00       	call   42db <sbrk>
+  if(c != a){
+    3868:	83 c4 10             	add    $0x10,%esp
+    386b:	39 c3                	cmp    %eax,%ebx
+    386d:	0f 85 b8 01 00 00    	jne    3a2b <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3873:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    3878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    387f:	90                   	nop
+    ppid = getpid();
+    3880:	e8 4e 0a 00 00       	call   42d3 <getpid>
+    3885:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    3887:	e8 bf 09 00 00       	call   424b <fork>
+    if(pid < 0){
+    388c:	85 c0                	test   %eax,%eax
+    388e:	0f 88 5d 01 00 00    	js     39f1 <sbrktest+0x311>
+    if(pid == 0){
+    3894:	0f 84 6f 01 00 00    	je     3a09 <sbrktest+0x329>
+    wait();
+    389a:	e8 bc 09 00 00       	call   425b <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    389f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    38a5:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    38ab:	75 d3                	jne    3880 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    38ad:	83 ec 0c             	sub    $0xc,%esp
+    38b0:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    38b3:	50                   	push   %eax
+    38b4:	e8 aa 09 00 00       	call   4263 <pipe>
+    38b9:	83 c4 10             	add    $0x10,%esp
+    38bc:	85 c0                	test   %eax,%eax
+    38be:	0f 85 da 01 00 00    	jne    3a9e <sbrktest+0x3be>
+    38c4:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    38c7:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    38ca:	89 df                	mov    %ebx,%edi
+    38cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    38d0:	e8 76 09 00 00       	call   424b <fork>
+    38d5:	89 07                	mov    %eax,(%edi)
+    38d7:	85 c0                	test   %eax,%eax
+    38d9:	0f 84 91 00 00 00    	je     3970 <sbrktest+0x290>
+    if(pids[i] != -1)
+    38df:	83 f8 ff             	cmp    $0xffffffff,%eax
+    38e2:	74 14                	je     38f8 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    38e4:	83 ec 04             	sub    $0x4,%esp
+    38e7:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    38ea:	6a 01                	push   $0x1
+    38ec:	50                   	push   %eax
+    38ed:	ff 75 b8             	push   -0x48(%ebp)
+    38f0:	e8 76 09 00 00       	call   426b <read>
+    38f5:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    38f8:	83 c7 04             	add    $0x4,%edi
+    38fb:	39 f7                	cmp    %esi,%edi
+    38fd:	75 d1                	jne    38d0 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    38ff:	83 ec 0c             	sub    $0xc,%esp
+    3902:	68 00 10 00 00       	push   $0x1000
+    3907:	e8 cf 09 00 00       	call   42db <sbrk>
+    390c:	83 c4 10             	add    $0x10,%esp
+    390f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3911:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    3918:	8b 03                	mov    (%ebx),%eax
+    391a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    391d:	74 11                	je     3930 <sbrktest+0x250>
+    kill(pids[i]);
+    391f:	83 ec 0c             	sub    $0xc,%esp
+    3922:	50                   	push   %eax
+    3923:	e8 5b 09 00 00       	call   4283 <kill>
+    wait();
+    3928:	e8 2e 09 00 00       	call   425b <wait>
+    392d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3930:	83 c3 04             	add    $0x4,%ebx
+    3933:	39 f3                	cmp    %esi,%ebx
+    3935:	75 e1                	jne    3918 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    3937:	83 ff ff             	cmp    $0xffffffff,%edi
+    393a:	0f 84 47 01 00 00    	je     3a87 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    3940:	83 ec 0c             	sub    $0xc,%esp
+    3943:	6a 00                	push   $0x0
+    3945:	e8 91 09 00 00       	call   42db <sbrk>
+    394a:	83 c4 10             	add    $0x10,%esp
+    394d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    3950:	72 60                	jb     39b2 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    3952:	83 ec 08             	sub    $0x8,%esp
+    3955:	68 9e 57 00 00       	push   $0x579e
+    395a:	ff 35 e8 6b 00 00    	push   0x6be8
+    3960:	e8 3b 0a 00 00       	call   43a0 <printf>
+}
+    3965:	83 c4 10             	add    $0x10,%esp
+    3968:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    396b:	5b                   	pop    %ebx
+    396c:	5e                   	pop    %esi
+    396d:	5f                   	pop    %edi
+    396e:	5d                   	pop    %ebp
+    396f:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    3970:	83 ec 0c             	sub    $0xc,%esp
+    3973:	6a 00                	push   $0x0
+    3975:	e8 61 09 00 00       	call   42db <sbrk>
+    397a:	89 c2                	mov    %eax,%edx
+    397c:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3981:	29 d0                	sub    %edx,%eax
+    3983:	89 04 24             	mov    %eax,(%esp)
+    3986:	e8 50 09 00 00       	call   42db <sbrk>
+      write(fds[1], "x", 1);
+    398b:	83 c4 0c             	add    $0xc,%esp
+    398e:	6a 01                	push   $0x1
+    3990:	68 c0 51 00 00       	push   $0x51c0
+    3995:	ff 75 bc             	push   -0x44(%ebp)
+    3998:	e8 d6 08 00 00       	call   4273 <write>
+    399d:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    39a0:	83 ec 0c             	sub    $0xc,%esp
+    39a3:	68 e8 03 00 00       	push   $0x3e8
+    39a8:	e8 36 09 00 00       	call   42e3 <sleep>
+    39ad:	83 c4 10             	add    $0x10,%esp
+    39b0:	eb ee                	jmp    39a0 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    39b2:	83 ec 0c             	sub    $0xc,%esp
+    39b5:	6a 00                	push   $0x0
+    39b7:	e8 1f 09 00 00       	call   42db <sbrk>
+    39bc:	89 c2                	mov    %eax,%edx
+    39be:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    39c1:	29 d0                	sub    %edx,%eax
+    39c3:	89 04 24             	mov    %eax,(%esp)
+    39c6:	e8 10 09 00 00       	call   42db <sbrk>
+    39cb:	83 c4 10             	add    $0x10,%esp
+    39ce:	e9 7f ff ff ff       	jmp    3952 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    39d3:	83 ec 0c             	sub    $0xc,%esp
+    39d6:	50                   	push   %eax
+    39d7:	53                   	push   %ebx
+    39d8:	56                   	push   %esi
+    39d9:	68 01 57 00 00       	push   $0x5701
+    39de:	ff 35 e8 6b 00 00    	push   0x6be8
+    39e4:	e8 b7 09 00 00       	call   43a0 <printf>
+      exit();
+    39e9:	83 c4 20             	add    $0x20,%esp
+    39ec:	e8 62 08 00 00       	call   4253 <exit>
+      printf(stdout, "fork failed\n");
+    39f1:	83 ec 08             	sub    $0x8,%esp
+    39f4:	68 3a 58 00 00       	push   $0x583a
+    39f9:	ff 35 e8 6b 00 00    	push   0x6be8
+    39ff:	e8 9c 09 00 00       	call   43a0 <printf>
+      exit();
+    3a04:	e8 4a 08 00 00       	call   4253 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3a09:	0f be 03             	movsbl (%ebx),%eax
+    3a0c:	50                   	push   %eax
+    3a0d:	53                   	push   %ebx
+    3a0e:	68 6a 57 00 00       	push   $0x576a
+    3a13:	ff 35 e8 6b 00 00    	push   0x6be8
+    3a19:	e8 82 09 00 00       	call   43a0 <printf>
+      kill(ppid);
+    3a1e:	89 34 24             	mov    %esi,(%esp)
+    3a21:	e8 5d 08 00 00       	call   4283 <kill>
+      exit();
+    3a26:	e8 28 08 00 00       	call   4253 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    3a2b:	50                   	push   %eax
+    3a2c:	53                   	push   %ebx
+    3a2d:	68 9c 60 00 00       	push   $0x609c
+    3a32:	ff 35 e8 6b 00 00    	push   0x6be8
+    3a38:	e8 63 09 00 00       	call   43a0 <printf>
+    exit();
+    3a3d:	e8 11 08 00 00       	call   4253 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3a42:	56                   	push   %esi
+    3a43:	56                   	push   %esi
+    3a44:	68 cc 5f 00 00       	push   $0x5fcc
+    3a49:	ff 35 e8 6b 00 00    	push   0x6be8
+    3a4f:	e8 4c 09 00 00       	call   43a0 <printf>
+    exit();
+    3a54:	e8 fa 07 00 00       	call   4253 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    3a59:	50                   	push   %eax
+    3a5a:	50                   	push   %eax
+    3a5b:	68 1c 57 00 00       	push   $0x571c
+    3a60:	ff 35 e8 6b 00 00    	push   0x6be8
+    3a66:	e8 35 09 00 00       	call   43a0 <printf>
+    exit();
+    3a6b:	e8 e3 07 00 00       	call   4253 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3a70:	51                   	push   %ecx
+    3a71:	51                   	push   %ecx
+    3a72:	68 6c 60 00 00       	push   $0x606c
+    3a77:	ff 35 e8 6b 00 00    	push   0x6be8
+    3a7d:	e8 1e 09 00 00       	call   43a0 <printf>
+    exit();
+    3a82:	e8 cc 07 00 00       	call   4253 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    3a87:	50                   	push   %eax
+    3a88:	50                   	push   %eax
+    3a89:	68 83 57 00 00       	push   $0x5783
+    3a8e:	ff 35 e8 6b 00 00    	push   0x6be8
+    3a94:	e8 07 09 00 00       	call   43a0 <printf>
+    exit();
+    3a99:	e8 b5 07 00 00       	call   4253 <exit>
+    printf(1, "pipe() failed\n");
+    3a9e:	52                   	push   %edx
+    3a9f:	52                   	push   %edx
+    3aa0:	68 8e 4a 00 00       	push   $0x4a8e
+    3aa5:	6a 01                	push   $0x1
+    3aa7:	e8 f4 08 00 00       	call   43a0 <printf>
+    exit();
+    3aac:	e8 a2 07 00 00       	call   4253 <exit>
+    exit();
+    3ab1:	e8 9d 07 00 00       	call   4253 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    3ab6:	57                   	push   %edi
+    3ab7:	57                   	push   %edi
+    3ab8:	68 33 57 00 00       	push   $0x5733
+    3abd:	ff 35 e8 6b 00 00    	push   0x6be8
+    3ac3:	e8 d8 08 00 00       	call   43a0 <printf>
+    exit();
+    3ac8:	e8 86 07 00 00       	call   4253 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    3acd:	56                   	push   %esi
+    3ace:	53                   	push   %ebx
+    3acf:	68 44 60 00 00       	push   $0x6044
+    3ad4:	ff 35 e8 6b 00 00    	push   0x6be8
+    3ada:	e8 c1 08 00 00       	call   43a0 <printf>
+    exit();
+    3adf:	e8 6f 07 00 00       	call   4253 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3ae4:	50                   	push   %eax
+    3ae5:	53                   	push   %ebx
+    3ae6:	68 0c 60 00 00       	push   $0x600c
+    3aeb:	ff 35 e8 6b 00 00    	push   0x6be8
+    3af1:	e8 aa 08 00 00       	call   43a0 <printf>
+    exit();
+    3af6:	e8 58 07 00 00       	call   4253 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    3afb:	53                   	push   %ebx
+    3afc:	53                   	push   %ebx
+    3afd:	68 4f 57 00 00       	push   $0x574f
+    3b02:	ff 35 e8 6b 00 00    	push   0x6be8
+    3b08:	e8 93 08 00 00       	call   43a0 <printf>
+    exit();
+    3b0d:	e8 41 07 00 00       	call   4253 <exit>
+    3b12:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003b20 <validateint>:
+}
+    3b20:	c3                   	ret
+    3b21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b2f:	90                   	nop
+
+00003b30 <validatetest>:
+{
+    3b30:	55                   	push   %ebp
+    3b31:	89 e5                	mov    %esp,%ebp
+    3b33:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3b34:	31 f6                	xor    %esi,%esi
+{
+    3b36:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3b37:	83 ec 08             	sub    $0x8,%esp
+    3b3a:	68 ac 57 00 00       	push   $0x57ac
+    3b3f:	ff 35 e8 6b 00 00    	push   0x6be8
+    3b45:	e8 56 08 00 00       	call   43a0 <printf>
+    3b4a:	83 c4 10             	add    $0x10,%esp
+    3b4d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    3b50:	e8 f6 06 00 00       	call   424b <fork>
+    3b55:	89 c3                	mov    %eax,%ebx
+    3b57:	85 c0                	test   %eax,%eax
+    3b59:	74 63                	je     3bbe <validatetest+0x8e>
+    sleep(0);
+    3b5b:	83 ec 0c             	sub    $0xc,%esp
+    3b5e:	6a 00                	push   $0x0
+    3b60:	e8 7e 07 00 00       	call   42e3 <sleep>
+    sleep(0);
+    3b65:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3b6c:	e8 72 07 00 00       	call   42e3 <sleep>
+    kill(pid);
+    3b71:	89 1c 24             	mov    %ebx,(%esp)
+    3b74:	e8 0a 07 00 00       	call   4283 <kill>
+    wait();
+    3b79:	e8 dd 06 00 00       	call   425b <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    3b7e:	58                   	pop    %eax
+    3b7f:	5a                   	pop    %edx
+    3b80:	56                   	push   %esi
+    3b81:	68 bb 57 00 00       	push   $0x57bb
+    3b86:	e8 28 07 00 00       	call   42b3 <link>
+    3b8b:	83 c4 10             	add    $0x10,%esp
+    3b8e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3b91:	75 30                	jne    3bc3 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3b93:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    3b99:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    3b9f:	75 af                	jne    3b50 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    3ba1:	83 ec 08             	sub    $0x8,%esp
+    3ba4:	68 df 57 00 00       	push   $0x57df
+    3ba9:	ff 35 e8 6b 00 00    	push   0x6be8
+    3baf:	e8 ec 07 00 00       	call   43a0 <printf>
+}
+    3bb4:	83 c4 10             	add    $0x10,%esp
+    3bb7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3bba:	5b                   	pop    %ebx
+    3bbb:	5e                   	pop    %esi
+    3bbc:	5d                   	pop    %ebp
+    3bbd:	c3                   	ret
+      exit();
+    3bbe:	e8 90 06 00 00       	call   4253 <exit>
+      printf(stdout, "link should not succeed\n");
+    3bc3:	83 ec 08             	sub    $0x8,%esp
+    3bc6:	68 c6 57 00 00       	push   $0x57c6
+    3bcb:	ff 35 e8 6b 00 00    	push   0x6be8
+    3bd1:	e8 ca 07 00 00       	call   43a0 <printf>
+      exit();
+    3bd6:	e8 78 06 00 00       	call   4253 <exit>
+    3bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3bdf:	90                   	nop
+
+00003be0 <bsstest>:
+{
+    3be0:	55                   	push   %ebp
+    3be1:	89 e5                	mov    %esp,%ebp
+    3be3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    3be6:	68 ec 57 00 00       	push   $0x57ec
+    3beb:	ff 35 e8 6b 00 00    	push   0x6be8
+    3bf1:	e8 aa 07 00 00       	call   43a0 <printf>
+    3bf6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3bf9:	31 c0                	xor    %eax,%eax
+    3bfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3bff:	90                   	nop
+    if(uninit[i] != '\0'){
+    3c00:	80 b8 00 6c 00 00 00 	cmpb   $0x0,0x6c00(%eax)
+    3c07:	75 22                	jne    3c2b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    3c09:	83 c0 01             	add    $0x1,%eax
+    3c0c:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    3c11:	75 ed                	jne    3c00 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    3c13:	83 ec 08             	sub    $0x8,%esp
+    3c16:	68 07 58 00 00       	push   $0x5807
+    3c1b:	ff 35 e8 6b 00 00    	push   0x6be8
+    3c21:	e8 7a 07 00 00       	call   43a0 <printf>
+}
+    3c26:	83 c4 10             	add    $0x10,%esp
+    3c29:	c9                   	leave
+    3c2a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    3c2b:	83 ec 08             	sub    $0x8,%esp
+    3c2e:	68 f6 57 00 00       	push   $0x57f6
+    3c33:	ff 35 e8 6b 00 00    	push   0x6be8
+    3c39:	e8 62 07 00 00       	call   43a0 <printf>
+      exit();
+    3c3e:	e8 10 06 00 00       	call   4253 <exit>
+    3c43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003c50 <bigargtest>:
+{
+    3c50:	55                   	push   %ebp
+    3c51:	89 e5                	mov    %esp,%ebp
+    3c53:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    3c56:	68 14 58 00 00       	push   $0x5814
+    3c5b:	e8 43 06 00 00       	call   42a3 <unlink>
+  pid = fork();
+    3c60:	e8 e6 05 00 00       	call   424b <fork>
+  if(pid == 0){
+    3c65:	83 c4 10             	add    $0x10,%esp
+    3c68:	85 c0                	test   %eax,%eax
+    3c6a:	74 44                	je     3cb0 <bigargtest+0x60>
+  } else if(pid < 0){
+    3c6c:	0f 88 b1 00 00 00    	js     3d23 <bigargtest+0xd3>
+  wait();
+    3c72:	e8 e4 05 00 00       	call   425b <wait>
+  fd = open("bigarg-ok", 0);
+    3c77:	83 ec 08             	sub    $0x8,%esp
+    3c7a:	6a 00                	push   $0x0
+    3c7c:	68 14 58 00 00       	push   $0x5814
+    3c81:	e8 0d 06 00 00       	call   4293 <open>
+  if(fd < 0){
+    3c86:	83 c4 10             	add    $0x10,%esp
+    3c89:	85 c0                	test   %eax,%eax
+    3c8b:	78 7f                	js     3d0c <bigargtest+0xbc>
+  close(fd);
+    3c8d:	83 ec 0c             	sub    $0xc,%esp
+    3c90:	50                   	push   %eax
+    3c91:	e8 e5 05 00 00       	call   427b <close>
+  unlink("bigarg-ok");
+    3c96:	c7 04 24 14 58 00 00 	movl   $0x5814,(%esp)
+    3c9d:	e8 01 06 00 00       	call   42a3 <unlink>
+}
+    3ca2:	83 c4 10             	add    $0x10,%esp
+    3ca5:	c9                   	leave
+    3ca6:	c3                   	ret
+    3ca7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3cae:	66 90                	xchg   %ax,%ax
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    3cb0:	c7 04 85 20 b3 00 00 	movl   $0x60c0,0xb320(,%eax,4)
+    3cb7:	c0 60 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    3cbb:	83 c0 01             	add    $0x1,%eax
+    3cbe:	83 f8 1f             	cmp    $0x1f,%eax
+    3cc1:	75 ed                	jne    3cb0 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    3cc3:	31 c9                	xor    %ecx,%ecx
+    3cc5:	89 0d 9c b3 00 00    	mov    %ecx,0xb39c
+    exec("echo", args);
+    3ccb:	50                   	push   %eax
+    3ccc:	50                   	push   %eax
+    3ccd:	68 20 b3 00 00       	push   $0xb320
+    3cd2:	68 ab 47 00 00       	push   $0x47ab
+    3cd7:	e8 af 05 00 00       	call   428b <exec>
+    printf(stdout, "bigarg test ok\n");
+    3cdc:	58                   	pop    %eax
+    3cdd:	5a                   	pop    %edx
+    3cde:	68 1e 58 00 00       	push   $0x581e
+    3ce3:	ff 35 e8 6b 00 00    	push   0x6be8
+    3ce9:	e8 b2 06 00 00       	call   43a0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3cee:	59                   	pop    %ecx
+    3cef:	58                   	pop    %eax
+    3cf0:	68 00 02 00 00       	push   $0x200
+    3cf5:	68 14 58 00 00       	push   $0x5814
+    3cfa:	e8 94 05 00 00       	call   4293 <open>
+    close(fd);
+    3cff:	89 04 24             	mov    %eax,(%esp)
+    3d02:	e8 74 05 00 00       	call   427b <close>
+    exit();
+    3d07:	e8 47 05 00 00       	call   4253 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    3d0c:	50                   	push   %eax
+    3d0d:	50                   	push   %eax
+    3d0e:	68 47 58 00 00       	push   $0x5847
+    3d13:	ff 35 e8 6b 00 00    	push   0x6be8
+    3d19:	e8 82 06 00 00       	call   43a0 <printf>
+    exit();
+    3d1e:	e8 30 05 00 00       	call   4253 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    3d23:	52                   	push   %edx
+    3d24:	52                   	push   %edx
+    3d25:	68 2e 58 00 00       	push   $0x582e
+    3d2a:	ff 35 e8 6b 00 00    	push   0x6be8
+    3d30:	e8 6b 06 00 00       	call   43a0 <printf>
+    exit();
+    3d35:	e8 19 05 00 00       	call   4253 <exit>
+    3d3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003d40 <fsfull>:
+{
+    3d40:	55                   	push   %ebp
+    3d41:	89 e5                	mov    %esp,%ebp
+    3d43:	57                   	push   %edi
+    3d44:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    3d45:	31 f6                	xor    %esi,%esi
+{
+    3d47:	53                   	push   %ebx
+    3d48:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    3d4b:	68 5c 58 00 00       	push   $0x585c
+    3d50:	6a 01                	push   $0x1
+    3d52:	e8 49 06 00 00       	call   43a0 <printf>
+    3d57:	83 c4 10             	add    $0x10,%esp
+    3d5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    3d60:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3d65:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    3d6a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    3d6d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3d71:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    3d73:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3d77:	c1 ea 06             	shr    $0x6,%edx
+    3d7a:	8d 42 30             	lea    0x30(%edx),%eax
+    3d7d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3d80:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    3d86:	89 f2                	mov    %esi,%edx
+    3d88:	29 c2                	sub    %eax,%edx
+    3d8a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    3d8f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    3d91:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3d96:	c1 ea 05             	shr    $0x5,%edx
+    3d99:	83 c2 30             	add    $0x30,%edx
+    3d9c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3d9f:	f7 e6                	mul    %esi
+    3da1:	c1 ea 05             	shr    $0x5,%edx
+    3da4:	6b c2 64             	imul   $0x64,%edx,%eax
+    3da7:	89 f2                	mov    %esi,%edx
+    3da9:	29 c2                	sub    %eax,%edx
+    3dab:	89 d0                	mov    %edx,%eax
+    3dad:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    3daf:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3db1:	c1 ea 03             	shr    $0x3,%edx
+    3db4:	83 c2 30             	add    $0x30,%edx
+    3db7:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3dba:	f7 e1                	mul    %ecx
+    3dbc:	89 f0                	mov    %esi,%eax
+    3dbe:	c1 ea 03             	shr    $0x3,%edx
+    3dc1:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3dc4:	01 d2                	add    %edx,%edx
+    3dc6:	29 d0                	sub    %edx,%eax
+    3dc8:	83 c0 30             	add    $0x30,%eax
+    3dcb:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    3dce:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3dd1:	50                   	push   %eax
+    3dd2:	68 69 58 00 00       	push   $0x5869
+    3dd7:	6a 01                	push   $0x1
+    3dd9:	e8 c2 05 00 00       	call   43a0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    3dde:	58                   	pop    %eax
+    3ddf:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3de2:	5a                   	pop    %edx
+    3de3:	68 02 02 00 00       	push   $0x202
+    3de8:	50                   	push   %eax
+    3de9:	e8 a5 04 00 00       	call   4293 <open>
+    if(fd < 0){
+    3dee:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    3df1:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    3df3:	85 c0                	test   %eax,%eax
+    3df5:	78 4f                	js     3e46 <fsfull+0x106>
+    int total = 0;
+    3df7:	31 db                	xor    %ebx,%ebx
+    3df9:	eb 07                	jmp    3e02 <fsfull+0xc2>
+    3dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3dff:	90                   	nop
+      total += cc;
+    3e00:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    3e02:	83 ec 04             	sub    $0x4,%esp
+    3e05:	68 00 02 00 00       	push   $0x200
+    3e0a:	68 20 93 00 00       	push   $0x9320
+    3e0f:	57                   	push   %edi
+    3e10:	e8 5e 04 00 00       	call   4273 <write>
+      if(cc < 512)
+    3e15:	83 c4 10             	add    $0x10,%esp
+    3e18:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    3e1d:	7f e1                	jg     3e00 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    3e1f:	83 ec 04             	sub    $0x4,%esp
+    3e22:	53                   	push   %ebx
+    3e23:	68 85 58 00 00       	push   $0x5885
+    3e28:	6a 01                	push   $0x1
+    3e2a:	e8 71 05 00 00       	call   43a0 <printf>
+    close(fd);
+    3e2f:	89 3c 24             	mov    %edi,(%esp)
+    3e32:	e8 44 04 00 00       	call   427b <close>
+    if(total == 0)
+    3e37:	83 c4 10             	add    $0x10,%esp
+    3e3a:	85 db                	test   %ebx,%ebx
+    3e3c:	74 1e                	je     3e5c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    3e3e:	83 c6 01             	add    $0x1,%esi
+    3e41:	e9 1a ff ff ff       	jmp    3d60 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    3e46:	83 ec 04             	sub    $0x4,%esp
+    3e49:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3e4c:	50                   	push   %eax
+    3e4d:	68 75 58 00 00       	push   $0x5875
+    3e52:	6a 01                	push   $0x1
+    3e54:	e8 47 05 00 00       	call   43a0 <printf>
+      break;
+    3e59:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    3e5c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3e61:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    3e66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e6d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    3e70:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    3e72:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    3e75:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3e79:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    3e7b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3e7f:	c1 ea 06             	shr    $0x6,%edx
+    3e82:	8d 42 30             	lea    0x30(%edx),%eax
+    3e85:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3e88:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    3e8e:	89 f2                	mov    %esi,%edx
+    3e90:	29 c2                	sub    %eax,%edx
+    3e92:	89 d0                	mov    %edx,%eax
+    3e94:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    3e96:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3e98:	c1 ea 05             	shr    $0x5,%edx
+    3e9b:	83 c2 30             	add    $0x30,%edx
+    3e9e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3ea1:	f7 e3                	mul    %ebx
+    3ea3:	c1 ea 05             	shr    $0x5,%edx
+    3ea6:	6b ca 64             	imul   $0x64,%edx,%ecx
+    3ea9:	89 f2                	mov    %esi,%edx
+    3eab:	29 ca                	sub    %ecx,%edx
+    3ead:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    3eb2:	89 d0                	mov    %edx,%eax
+    3eb4:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    3eb6:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3eb8:	c1 ea 03             	shr    $0x3,%edx
+    3ebb:	83 c2 30             	add    $0x30,%edx
+    3ebe:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3ec1:	f7 e1                	mul    %ecx
+    3ec3:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    3ec5:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    3ec8:	c1 ea 03             	shr    $0x3,%edx
+    3ecb:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3ece:	01 d2                	add    %edx,%edx
+    3ed0:	29 d0                	sub    %edx,%eax
+    3ed2:	83 c0 30             	add    $0x30,%eax
+    3ed5:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    3ed8:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3edb:	50                   	push   %eax
+    3edc:	e8 c2 03 00 00       	call   42a3 <unlink>
+  while(nfiles >= 0){
+    3ee1:	83 c4 10             	add    $0x10,%esp
+    3ee4:	83 fe ff             	cmp    $0xffffffff,%esi
+    3ee7:	75 87                	jne    3e70 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    3ee9:	83 ec 08             	sub    $0x8,%esp
+    3eec:	68 95 58 00 00       	push   $0x5895
+    3ef1:	6a 01                	push   $0x1
+    3ef3:	e8 a8 04 00 00       	call   43a0 <printf>
+}
+    3ef8:	83 c4 10             	add    $0x10,%esp
+    3efb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3efe:	5b                   	pop    %ebx
+    3eff:	5e                   	pop    %esi
+    3f00:	5f                   	pop    %edi
+    3f01:	5d                   	pop    %ebp
+    3f02:	c3                   	ret
+    3f03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003f10 <uio>:
+{
+    3f10:	55                   	push   %ebp
+    3f11:	89 e5                	mov    %esp,%ebp
+    3f13:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    3f16:	68 ab 58 00 00       	push   $0x58ab
+    3f1b:	6a 01                	push   $0x1
+    3f1d:	e8 7e 04 00 00       	call   43a0 <printf>
+  pid = fork();
+    3f22:	e8 24 03 00 00       	call   424b <fork>
+  if(pid == 0){
+    3f27:	83 c4 10             	add    $0x10,%esp
+    3f2a:	85 c0                	test   %eax,%eax
+    3f2c:	74 1b                	je     3f49 <uio+0x39>
+  } else if(pid < 0){
+    3f2e:	78 3d                	js     3f6d <uio+0x5d>
+  wait();
+    3f30:	e8 26 03 00 00       	call   425b <wait>
+  printf(1, "uio test done\n");
+    3f35:	83 ec 08             	sub    $0x8,%esp
+    3f38:	68 b5 58 00 00       	push   $0x58b5
+    3f3d:	6a 01                	push   $0x1
+    3f3f:	e8 5c 04 00 00       	call   43a0 <printf>
+}
+    3f44:	83 c4 10             	add    $0x10,%esp
+    3f47:	c9                   	leave
+    3f48:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    3f49:	b8 09 00 00 00       	mov    $0x9,%eax
+    3f4e:	ba 70 00 00 00       	mov    $0x70,%edx
+    3f53:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    3f54:	ba 71 00 00 00       	mov    $0x71,%edx
+    3f59:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    3f5a:	52                   	push   %edx
+    3f5b:	52                   	push   %edx
+    3f5c:	68 a0 61 00 00       	push   $0x61a0
+    3f61:	6a 01                	push   $0x1
+    3f63:	e8 38 04 00 00       	call   43a0 <printf>
+    exit();
+    3f68:	e8 e6 02 00 00       	call   4253 <exit>
+    printf (1, "fork failed\n");
+    3f6d:	50                   	push   %eax
+    3f6e:	50                   	push   %eax
+    3f6f:	68 3a 58 00 00       	push   $0x583a
+    3f74:	6a 01                	push   $0x1
+    3f76:	e8 25 04 00 00       	call   43a0 <printf>
+    exit();
+    3f7b:	e8 d3 02 00 00       	call   4253 <exit>
+
+00003f80 <argptest>:
+{
+    3f80:	55                   	push   %ebp
+    3f81:	89 e5                	mov    %esp,%ebp
+    3f83:	53                   	push   %ebx
+    3f84:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    3f87:	6a 00                	push   $0x0
+    3f89:	68 c4 58 00 00       	push   $0x58c4
+    3f8e:	e8 00 03 00 00       	call   4293 <open>
+  if (fd < 0) {
+    3f93:	83 c4 10             	add    $0x10,%esp
+    3f96:	85 c0                	test   %eax,%eax
+    3f98:	78 39                	js     3fd3 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    3f9a:	83 ec 0c             	sub    $0xc,%esp
+    3f9d:	89 c3                	mov    %eax,%ebx
+    3f9f:	6a 00                	push   $0x0
+    3fa1:	e8 35 03 00 00       	call   42db <sbrk>
+    3fa6:	83 c4 0c             	add    $0xc,%esp
+    3fa9:	83 e8 01             	sub    $0x1,%eax
+    3fac:	6a ff                	push   $0xffffffff
+    3fae:	50                   	push   %eax
+    3faf:	53                   	push   %ebx
+    3fb0:	e8 b6 02 00 00       	call   426b <read>
+  close(fd);
+    3fb5:	89 1c 24             	mov    %ebx,(%esp)
+    3fb8:	e8 be 02 00 00       	call   427b <close>
+  printf(1, "arg test passed\n");
+    3fbd:	58                   	pop    %eax
+    3fbe:	5a                   	pop    %edx
+    3fbf:	68 d6 58 00 00       	push   $0x58d6
+    3fc4:	6a 01                	push   $0x1
+    3fc6:	e8 d5 03 00 00       	call   43a0 <printf>
+}
+    3fcb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3fce:	83 c4 10             	add    $0x10,%esp
+    3fd1:	c9                   	leave
+    3fd2:	c3                   	ret
+    printf(2, "open failed\n");
+    3fd3:	51                   	push   %ecx
+    3fd4:	51                   	push   %ecx
+    3fd5:	68 c9 58 00 00       	push   $0x58c9
+    3fda:	6a 02                	push   $0x2
+    3fdc:	e8 bf 03 00 00       	call   43a0 <printf>
+    exit();
+    3fe1:	e8 6d 02 00 00       	call   4253 <exit>
+    3fe6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3fed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003ff0 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    3ff0:	69 05 e4 6b 00 00 0d 	imul   $0x19660d,0x6be4,%eax
+    3ff7:	66 19 00 
+    3ffa:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    3fff:	a3 e4 6b 00 00       	mov    %eax,0x6be4
+}
+    4004:	c3                   	ret
+    4005:	66 90                	xchg   %ax,%ax
+    4007:	66 90                	xchg   %ax,%ax
+    4009:	66 90                	xchg   %ax,%ax
+    400b:	66 90                	xchg   %ax,%ax
+    400d:	66 90                	xchg   %ax,%ax
+    400f:	90                   	nop
+
+00004010 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    4010:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    4011:	31 c0                	xor    %eax,%eax
+{
+    4013:	89 e5                	mov    %esp,%ebp
+    4015:	53                   	push   %ebx
+    4016:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4019:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    401c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    4020:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    4024:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    4027:	83 c0 01             	add    $0x1,%eax
+    402a:	84 d2                	test   %dl,%dl
+    402c:	75 f2                	jne    4020 <strcpy+0x10>
+    ;
+  return os;
+}
+    402e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4031:	89 c8                	mov    %ecx,%eax
+    4033:	c9                   	leave
+    4034:	c3                   	ret
+    4035:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    403c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004040 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    4040:	55                   	push   %ebp
+    4041:	89 e5                	mov    %esp,%ebp
+    4043:	53                   	push   %ebx
+    4044:	8b 55 08             	mov    0x8(%ebp),%edx
+    4047:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    404a:	0f b6 02             	movzbl (%edx),%eax
+    404d:	84 c0                	test   %al,%al
+    404f:	75 17                	jne    4068 <strcmp+0x28>
+    4051:	eb 3a                	jmp    408d <strcmp+0x4d>
+    4053:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4057:	90                   	nop
+    4058:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    405c:	83 c2 01             	add    $0x1,%edx
+    405f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    4062:	84 c0                	test   %al,%al
+    4064:	74 1a                	je     4080 <strcmp+0x40>
+    p++, q++;
+    4066:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    4068:	0f b6 19             	movzbl (%ecx),%ebx
+    406b:	38 c3                	cmp    %al,%bl
+    406d:	74 e9                	je     4058 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    406f:	29 d8                	sub    %ebx,%eax
+}
+    4071:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4074:	c9                   	leave
+    4075:	c3                   	ret
+    4076:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    407d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    4080:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    4084:	31 c0                	xor    %eax,%eax
+    4086:	29 d8                	sub    %ebx,%eax
+}
+    4088:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    408b:	c9                   	leave
+    408c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    408d:	0f b6 19             	movzbl (%ecx),%ebx
+    4090:	31 c0                	xor    %eax,%eax
+    4092:	eb db                	jmp    406f <strcmp+0x2f>
+    4094:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    409b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    409f:	90                   	nop
+
+000040a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    40a0:	55                   	push   %ebp
+    40a1:	89 e5                	mov    %esp,%ebp
+    40a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    40a6:	80 3a 00             	cmpb   $0x0,(%edx)
+    40a9:	74 15                	je     40c0 <strlen+0x20>
+    40ab:	31 c0                	xor    %eax,%eax
+    40ad:	8d 76 00             	lea    0x0(%esi),%esi
+    40b0:	83 c0 01             	add    $0x1,%eax
+    40b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    40b7:	89 c1                	mov    %eax,%ecx
+    40b9:	75 f5                	jne    40b0 <strlen+0x10>
+    ;
+  return n;
+}
+    40bb:	89 c8                	mov    %ecx,%eax
+    40bd:	5d                   	pop    %ebp
+    40be:	c3                   	ret
+    40bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    40c0:	31 c9                	xor    %ecx,%ecx
+}
+    40c2:	5d                   	pop    %ebp
+    40c3:	89 c8                	mov    %ecx,%eax
+    40c5:	c3                   	ret
+    40c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    40cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000040d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    40d0:	55                   	push   %ebp
+    40d1:	89 e5                	mov    %esp,%ebp
+    40d3:	57                   	push   %edi
+    40d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    40d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    40da:	8b 45 0c             	mov    0xc(%ebp),%eax
+    40dd:	89 d7                	mov    %edx,%edi
+    40df:	fc                   	cld
+    40e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    40e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    40e5:	89 d0                	mov    %edx,%eax
+    40e7:	c9                   	leave
+    40e8:	c3                   	ret
+    40e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000040f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    40f0:	55                   	push   %ebp
+    40f1:	89 e5                	mov    %esp,%ebp
+    40f3:	8b 45 08             	mov    0x8(%ebp),%eax
+    40f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    40fa:	0f b6 10             	movzbl (%eax),%edx
+    40fd:	84 d2                	test   %dl,%dl
+    40ff:	75 12                	jne    4113 <strchr+0x23>
+    4101:	eb 1d                	jmp    4120 <strchr+0x30>
+    4103:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4107:	90                   	nop
+    4108:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    410c:	83 c0 01             	add    $0x1,%eax
+    410f:	84 d2                	test   %dl,%dl
+    4111:	74 0d                	je     4120 <strchr+0x30>
+    if(*s == c)
+    4113:	38 d1                	cmp    %dl,%cl
+    4115:	75 f1                	jne    4108 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    4117:	5d                   	pop    %ebp
+    4118:	c3                   	ret
+    4119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    4120:	31 c0                	xor    %eax,%eax
+}
+    4122:	5d                   	pop    %ebp
+    4123:	c3                   	ret
+    4124:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    412b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    412f:	90                   	nop
+
+00004130 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    4130:	55                   	push   %ebp
+    4131:	89 e5                	mov    %esp,%ebp
+    4133:	57                   	push   %edi
+    4134:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    4135:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    4138:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    4139:	31 db                	xor    %ebx,%ebx
+{
+    413b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    413e:	eb 27                	jmp    4167 <gets+0x37>
+    cc = read(0, &c, 1);
+    4140:	83 ec 04             	sub    $0x4,%esp
+    4143:	6a 01                	push   $0x1
+    4145:	56                   	push   %esi
+    4146:	6a 00                	push   $0x0
+    4148:	e8 1e 01 00 00       	call   426b <read>
+    if(cc < 1)
+    414d:	83 c4 10             	add    $0x10,%esp
+    4150:	85 c0                	test   %eax,%eax
+    4152:	7e 1d                	jle    4171 <gets+0x41>
+      break;
+    buf[i++] = c;
+    4154:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    4158:	8b 55 08             	mov    0x8(%ebp),%edx
+    415b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    415f:	3c 0a                	cmp    $0xa,%al
+    4161:	74 10                	je     4173 <gets+0x43>
+    4163:	3c 0d                	cmp    $0xd,%al
+    4165:	74 0c                	je     4173 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    4167:	89 df                	mov    %ebx,%edi
+    4169:	83 c3 01             	add    $0x1,%ebx
+    416c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    416f:	7c cf                	jl     4140 <gets+0x10>
+    4171:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    4173:	8b 45 08             	mov    0x8(%ebp),%eax
+    4176:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    417a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    417d:	5b                   	pop    %ebx
+    417e:	5e                   	pop    %esi
+    417f:	5f                   	pop    %edi
+    4180:	5d                   	pop    %ebp
+    4181:	c3                   	ret
+    4182:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004190 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    4190:	55                   	push   %ebp
+    4191:	89 e5                	mov    %esp,%ebp
+    4193:	56                   	push   %esi
+    4194:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    4195:	83 ec 08             	sub    $0x8,%esp
+    4198:	6a 00                	push   $0x0
+    419a:	ff 75 08             	push   0x8(%ebp)
+    419d:	e8 f1 00 00 00       	call   4293 <open>
+  if(fd < 0)
+    41a2:	83 c4 10             	add    $0x10,%esp
+    41a5:	85 c0                	test   %eax,%eax
+    41a7:	78 27                	js     41d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    41a9:	83 ec 08             	sub    $0x8,%esp
+    41ac:	ff 75 0c             	push   0xc(%ebp)
+    41af:	89 c3                	mov    %eax,%ebx
+    41b1:	50                   	push   %eax
+    41b2:	e8 f4 00 00 00       	call   42ab <fstat>
+  close(fd);
+    41b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    41ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+    41bc:	e8 ba 00 00 00       	call   427b <close>
+  return r;
+    41c1:	83 c4 10             	add    $0x10,%esp
+}
+    41c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    41c7:	89 f0                	mov    %esi,%eax
+    41c9:	5b                   	pop    %ebx
+    41ca:	5e                   	pop    %esi
+    41cb:	5d                   	pop    %ebp
+    41cc:	c3                   	ret
+    41cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    41d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    41d5:	eb ed                	jmp    41c4 <stat+0x34>
+    41d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    41de:	66 90                	xchg   %ax,%ax
+
+000041e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    41e0:	55                   	push   %ebp
+    41e1:	89 e5                	mov    %esp,%ebp
+    41e3:	53                   	push   %ebx
+    41e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    41e7:	0f be 02             	movsbl (%edx),%eax
+    41ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    41ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    41f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    41f5:	77 1e                	ja     4215 <atoi+0x35>
+    41f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    41fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    4200:	83 c2 01             	add    $0x1,%edx
+    4203:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    4206:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    420a:	0f be 02             	movsbl (%edx),%eax
+    420d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    4210:	80 fb 09             	cmp    $0x9,%bl
+    4213:	76 eb                	jbe    4200 <atoi+0x20>
+  return n;
+}
+    4215:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4218:	89 c8                	mov    %ecx,%eax
+    421a:	c9                   	leave
+    421b:	c3                   	ret
+    421c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004220 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    4220:	55                   	push   %ebp
+    4221:	89 e5                	mov    %esp,%ebp
+    4223:	57                   	push   %edi
+    4224:	56                   	push   %esi
+    4225:	8b 45 10             	mov    0x10(%ebp),%eax
+    4228:	8b 55 08             	mov    0x8(%ebp),%edx
+    422b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    422e:	85 c0                	test   %eax,%eax
+    4230:	7e 13                	jle    4245 <memmove+0x25>
+    4232:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    4234:	89 d7                	mov    %edx,%edi
+    4236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    423d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    4240:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    4241:	39 f8                	cmp    %edi,%eax
+    4243:	75 fb                	jne    4240 <memmove+0x20>
+  return vdst;
+}
+    4245:	5e                   	pop    %esi
+    4246:	89 d0                	mov    %edx,%eax
+    4248:	5f                   	pop    %edi
+    4249:	5d                   	pop    %ebp
+    424a:	c3                   	ret
+
+0000424b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    424b:	b8 01 00 00 00       	mov    $0x1,%eax
+    4250:	cd 40                	int    $0x40
+    4252:	c3                   	ret
+
+00004253 <exit>:
+SYSCALL(exit)
+    4253:	b8 02 00 00 00       	mov    $0x2,%eax
+    4258:	cd 40                	int    $0x40
+    425a:	c3                   	ret
+
+0000425b <wait>:
+SYSCALL(wait)
+    425b:	b8 03 00 00 00       	mov    $0x3,%eax
+    4260:	cd 40                	int    $0x40
+    4262:	c3                   	ret
+
+00004263 <pipe>:
+SYSCALL(pipe)
+    4263:	b8 04 00 00 00       	mov    $0x4,%eax
+    4268:	cd 40                	int    $0x40
+    426a:	c3                   	ret
+
+0000426b <read>:
+SYSCALL(read)
+    426b:	b8 05 00 00 00       	mov    $0x5,%eax
+    4270:	cd 40                	int    $0x40
+    4272:	c3                   	ret
+
+00004273 <write>:
+SYSCALL(write)
+    4273:	b8 10 00 00 00       	mov    $0x10,%eax
+    4278:	cd 40                	int    $0x40
+    427a:	c3                   	ret
+
+0000427b <close>:
+SYSCALL(close)
+    427b:	b8 15 00 00 00       	mov    $0x15,%eax
+    4280:	cd 40                	int    $0x40
+    4282:	c3                   	ret
+
+00004283 <kill>:
+SYSCALL(kill)
+    4283:	b8 06 00 00 00       	mov    $0x6,%eax
+    4288:	cd 40                	int    $0x40
+    428a:	c3                   	ret
+
+0000428b <exec>:
+SYSCALL(exec)
+    428b:	b8 07 00 00 00       	mov    $0x7,%eax
+    4290:	cd 40                	int    $0x40
+    4292:	c3                   	ret
+
+00004293 <open>:
+SYSCALL(open)
+    4293:	b8 0f 00 00 00       	mov    $0xf,%eax
+    4298:	cd 40                	int    $0x40
+    429a:	c3                   	ret
+
+0000429b <mknod>:
+SYSCALL(mknod)
+    429b:	b8 11 00 00 00       	mov    $0x11,%eax
+    42a0:	cd 40                	int    $0x40
+    42a2:	c3                   	ret
+
+000042a3 <unlink>:
+SYSCALL(unlink)
+    42a3:	b8 12 00 00 00       	mov    $0x12,%eax
+    42a8:	cd 40                	int    $0x40
+    42aa:	c3                   	ret
+
+000042ab <fstat>:
+SYSCALL(fstat)
+    42ab:	b8 08 00 00 00       	mov    $0x8,%eax
+    42b0:	cd 40                	int    $0x40
+    42b2:	c3                   	ret
+
+000042b3 <link>:
+SYSCALL(link)
+    42b3:	b8 13 00 00 00       	mov    $0x13,%eax
+    42b8:	cd 40                	int    $0x40
+    42ba:	c3                   	ret
+
+000042bb <mkdir>:
+SYSCALL(mkdir)
+    42bb:	b8 14 00 00 00       	mov    $0x14,%eax
+    42c0:	cd 40                	int    $0x40
+    42c2:	c3                   	ret
+
+000042c3 <chdir>:
+SYSCALL(chdir)
+    42c3:	b8 09 00 00 00       	mov    $0x9,%eax
+    42c8:	cd 40                	int    $0x40
+    42ca:	c3                   	ret
+
+000042cb <dup>:
+SYSCALL(dup)
+    42cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    42d0:	cd 40                	int    $0x40
+    42d2:	c3                   	ret
+
+000042d3 <getpid>:
+SYSCALL(getpid)
+    42d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    42d8:	cd 40                	int    $0x40
+    42da:	c3                   	ret
+
+000042db <sbrk>:
+SYSCALL(sbrk)
+    42db:	b8 0c 00 00 00       	mov    $0xc,%eax
+    42e0:	cd 40                	int    $0x40
+    42e2:	c3                   	ret
+
+000042e3 <sleep>:
+SYSCALL(sleep)
+    42e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    42e8:	cd 40                	int    $0x40
+    42ea:	c3                   	ret
+
+000042eb <uptime>:
+SYSCALL(uptime)
+    42eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    42f0:	cd 40                	int    $0x40
+    42f2:	c3                   	ret
+
+000042f3 <fsync>:
+SYSCALL(fsync)
+    42f3:	b8 16 00 00 00       	mov    $0x16,%eax
+    42f8:	cd 40                	int    $0x40
+    42fa:	c3                   	ret
+    42fb:	66 90                	xchg   %ax,%ax
+    42fd:	66 90                	xchg   %ax,%ax
+    42ff:	90                   	nop
+
+00004300 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    4300:	55                   	push   %ebp
+    4301:	89 e5                	mov    %esp,%ebp
+    4303:	57                   	push   %edi
+    4304:	56                   	push   %esi
+    4305:	53                   	push   %ebx
+    4306:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    4308:	89 d1                	mov    %edx,%ecx
+{
+    430a:	83 ec 3c             	sub    $0x3c,%esp
+    430d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    4310:	85 d2                	test   %edx,%edx
+    4312:	0f 89 80 00 00 00    	jns    4398 <printint+0x98>
+    4318:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    431c:	74 7a                	je     4398 <printint+0x98>
+    x = -xx;
+    431e:	f7 d9                	neg    %ecx
+    neg = 1;
+    4320:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    4325:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    4328:	31 f6                	xor    %esi,%esi
+    432a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    4330:	89 c8                	mov    %ecx,%eax
+    4332:	31 d2                	xor    %edx,%edx
+    4334:	89 f7                	mov    %esi,%edi
+    4336:	f7 f3                	div    %ebx
+    4338:	8d 76 01             	lea    0x1(%esi),%esi
+    433b:	0f b6 92 50 62 00 00 	movzbl 0x6250(%edx),%edx
+    4342:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    4346:	89 ca                	mov    %ecx,%edx
+    4348:	89 c1                	mov    %eax,%ecx
+    434a:	39 da                	cmp    %ebx,%edx
+    434c:	73 e2                	jae    4330 <printint+0x30>
+  if(neg)
+    434e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    4351:	85 c0                	test   %eax,%eax
+    4353:	74 07                	je     435c <printint+0x5c>
+    buf[i++] = '-';
+    4355:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    435a:	89 f7                	mov    %esi,%edi
+    435c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    435f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    4362:	01 df                	add    %ebx,%edi
+    4364:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    4368:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    436b:	83 ec 04             	sub    $0x4,%esp
+    436e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    4371:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    4374:	6a 01                	push   $0x1
+    4376:	50                   	push   %eax
+    4377:	56                   	push   %esi
+    4378:	e8 f6 fe ff ff       	call   4273 <write>
+  while(--i >= 0)
+    437d:	89 f8                	mov    %edi,%eax
+    437f:	83 c4 10             	add    $0x10,%esp
+    4382:	83 ef 01             	sub    $0x1,%edi
+    4385:	39 d8                	cmp    %ebx,%eax
+    4387:	75 df                	jne    4368 <printint+0x68>
+}
+    4389:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    438c:	5b                   	pop    %ebx
+    438d:	5e                   	pop    %esi
+    438e:	5f                   	pop    %edi
+    438f:	5d                   	pop    %ebp
+    4390:	c3                   	ret
+    4391:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    4398:	31 c0                	xor    %eax,%eax
+    439a:	eb 89                	jmp    4325 <printint+0x25>
+    439c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000043a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    43a0:	55                   	push   %ebp
+    43a1:	89 e5                	mov    %esp,%ebp
+    43a3:	57                   	push   %edi
+    43a4:	56                   	push   %esi
+    43a5:	53                   	push   %ebx
+    43a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    43a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    43ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    43af:	0f b6 1e             	movzbl (%esi),%ebx
+    43b2:	83 c6 01             	add    $0x1,%esi
+    43b5:	84 db                	test   %bl,%bl
+    43b7:	74 67                	je     4420 <printf+0x80>
+    43b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    43bc:	31 d2                	xor    %edx,%edx
+    43be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    43c1:	eb 34                	jmp    43f7 <printf+0x57>
+    43c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    43c7:	90                   	nop
+    43c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    43cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    43d0:	83 f8 25             	cmp    $0x25,%eax
+    43d3:	74 18                	je     43ed <printf+0x4d>
+  write(fd, &c, 1);
+    43d5:	83 ec 04             	sub    $0x4,%esp
+    43d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    43db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    43de:	6a 01                	push   $0x1
+    43e0:	50                   	push   %eax
+    43e1:	57                   	push   %edi
+    43e2:	e8 8c fe ff ff       	call   4273 <write>
+    43e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    43ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    43ed:	0f b6 1e             	movzbl (%esi),%ebx
+    43f0:	83 c6 01             	add    $0x1,%esi
+    43f3:	84 db                	test   %bl,%bl
+    43f5:	74 29                	je     4420 <printf+0x80>
+    c = fmt[i] & 0xff;
+    43f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    43fa:	85 d2                	test   %edx,%edx
+    43fc:	74 ca                	je     43c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    43fe:	83 fa 25             	cmp    $0x25,%edx
+    4401:	75 ea                	jne    43ed <printf+0x4d>
+      if(c == 'd'){
+    4403:	83 f8 25             	cmp    $0x25,%eax
+    4406:	0f 84 24 01 00 00    	je     4530 <printf+0x190>
+    440c:	83 e8 63             	sub    $0x63,%eax
+    440f:	83 f8 15             	cmp    $0x15,%eax
+    4412:	77 1c                	ja     4430 <printf+0x90>
+    4414:	ff 24 85 f8 61 00 00 	jmp    *0x61f8(,%eax,4)
+    441b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    441f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    4420:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4423:	5b                   	pop    %ebx
+    4424:	5e                   	pop    %esi
+    4425:	5f                   	pop    %edi
+    4426:	5d                   	pop    %ebp
+    4427:	c3                   	ret
+    4428:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    442f:	90                   	nop
+  write(fd, &c, 1);
+    4430:	83 ec 04             	sub    $0x4,%esp
+    4433:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4436:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    443a:	6a 01                	push   $0x1
+    443c:	52                   	push   %edx
+    443d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    4440:	57                   	push   %edi
+    4441:	e8 2d fe ff ff       	call   4273 <write>
+    4446:	83 c4 0c             	add    $0xc,%esp
+    4449:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    444c:	6a 01                	push   $0x1
+    444e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    4451:	52                   	push   %edx
+    4452:	57                   	push   %edi
+    4453:	e8 1b fe ff ff       	call   4273 <write>
+        putc(fd, c);
+    4458:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    445b:	31 d2                	xor    %edx,%edx
+    445d:	eb 8e                	jmp    43ed <printf+0x4d>
+    445f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    4460:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4463:	83 ec 0c             	sub    $0xc,%esp
+    4466:	b9 10 00 00 00       	mov    $0x10,%ecx
+    446b:	8b 13                	mov    (%ebx),%edx
+    446d:	6a 00                	push   $0x0
+    446f:	89 f8                	mov    %edi,%eax
+        ap++;
+    4471:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    4474:	e8 87 fe ff ff       	call   4300 <printint>
+        ap++;
+    4479:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    447c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    447f:	31 d2                	xor    %edx,%edx
+    4481:	e9 67 ff ff ff       	jmp    43ed <printf+0x4d>
+    4486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    448d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    4490:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    4493:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    4495:	83 c0 04             	add    $0x4,%eax
+    4498:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    449b:	85 db                	test   %ebx,%ebx
+    449d:	0f 84 9d 00 00 00    	je     4540 <printf+0x1a0>
+        while(*s != 0){
+    44a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    44a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    44a8:	84 c0                	test   %al,%al
+    44aa:	0f 84 3d ff ff ff    	je     43ed <printf+0x4d>
+    44b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    44b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    44b6:	89 de                	mov    %ebx,%esi
+    44b8:	89 d3                	mov    %edx,%ebx
+    44ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    44c0:	83 ec 04             	sub    $0x4,%esp
+    44c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    44c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    44c9:	6a 01                	push   $0x1
+    44cb:	53                   	push   %ebx
+    44cc:	57                   	push   %edi
+    44cd:	e8 a1 fd ff ff       	call   4273 <write>
+        while(*s != 0){
+    44d2:	0f b6 06             	movzbl (%esi),%eax
+    44d5:	83 c4 10             	add    $0x10,%esp
+    44d8:	84 c0                	test   %al,%al
+    44da:	75 e4                	jne    44c0 <printf+0x120>
+      state = 0;
+    44dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    44df:	31 d2                	xor    %edx,%edx
+    44e1:	e9 07 ff ff ff       	jmp    43ed <printf+0x4d>
+    44e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    44ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    44f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    44f3:	83 ec 0c             	sub    $0xc,%esp
+    44f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    44fb:	8b 13                	mov    (%ebx),%edx
+    44fd:	6a 01                	push   $0x1
+    44ff:	e9 6b ff ff ff       	jmp    446f <printf+0xcf>
+    4504:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    4508:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    450b:	83 ec 04             	sub    $0x4,%esp
+    450e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    4511:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    4513:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    4516:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    4519:	6a 01                	push   $0x1
+    451b:	52                   	push   %edx
+    451c:	57                   	push   %edi
+    451d:	e8 51 fd ff ff       	call   4273 <write>
+        ap++;
+    4522:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4525:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4528:	31 d2                	xor    %edx,%edx
+    452a:	e9 be fe ff ff       	jmp    43ed <printf+0x4d>
+    452f:	90                   	nop
+  write(fd, &c, 1);
+    4530:	83 ec 04             	sub    $0x4,%esp
+    4533:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4536:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4539:	6a 01                	push   $0x1
+    453b:	e9 11 ff ff ff       	jmp    4451 <printf+0xb1>
+    4540:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    4545:	bb ee 61 00 00       	mov    $0x61ee,%ebx
+    454a:	e9 61 ff ff ff       	jmp    44b0 <printf+0x110>
+    454f:	90                   	nop
+
+00004550 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4550:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4551:	a1 a0 b3 00 00       	mov    0xb3a0,%eax
+{
+    4556:	89 e5                	mov    %esp,%ebp
+    4558:	57                   	push   %edi
+    4559:	56                   	push   %esi
+    455a:	53                   	push   %ebx
+    455b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    455e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4561:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4568:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    456a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    456c:	39 ca                	cmp    %ecx,%edx
+    456e:	73 30                	jae    45a0 <free+0x50>
+    4570:	39 c1                	cmp    %eax,%ecx
+    4572:	72 04                	jb     4578 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4574:	39 c2                	cmp    %eax,%edx
+    4576:	72 f0                	jb     4568 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    4578:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    457b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    457e:	39 f8                	cmp    %edi,%eax
+    4580:	74 2e                	je     45b0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4582:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    4585:	8b 42 04             	mov    0x4(%edx),%eax
+    4588:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    458b:	39 f1                	cmp    %esi,%ecx
+    458d:	74 38                	je     45c7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    458f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    4591:	5b                   	pop    %ebx
+  freep = p;
+    4592:	89 15 a0 b3 00 00    	mov    %edx,0xb3a0
+}
+    4598:	5e                   	pop    %esi
+    4599:	5f                   	pop    %edi
+    459a:	5d                   	pop    %ebp
+    459b:	c3                   	ret
+    459c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    45a0:	39 c1                	cmp    %eax,%ecx
+    45a2:	72 d0                	jb     4574 <free+0x24>
+    45a4:	eb c2                	jmp    4568 <free+0x18>
+    45a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    45ad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    45b0:	03 70 04             	add    0x4(%eax),%esi
+    45b3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    45b6:	8b 02                	mov    (%edx),%eax
+    45b8:	8b 00                	mov    (%eax),%eax
+    45ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    45bd:	8b 42 04             	mov    0x4(%edx),%eax
+    45c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    45c3:	39 f1                	cmp    %esi,%ecx
+    45c5:	75 c8                	jne    458f <free+0x3f>
+    p->s.size += bp->s.size;
+    45c7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    45ca:	89 15 a0 b3 00 00    	mov    %edx,0xb3a0
+    p->s.size += bp->s.size;
+    45d0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    45d3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    45d6:	89 0a                	mov    %ecx,(%edx)
+}
+    45d8:	5b                   	pop    %ebx
+    45d9:	5e                   	pop    %esi
+    45da:	5f                   	pop    %edi
+    45db:	5d                   	pop    %ebp
+    45dc:	c3                   	ret
+    45dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000045e0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    45e0:	55                   	push   %ebp
+    45e1:	89 e5                	mov    %esp,%ebp
+    45e3:	57                   	push   %edi
+    45e4:	56                   	push   %esi
+    45e5:	53                   	push   %ebx
+    45e6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    45e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    45ec:	8b 15 a0 b3 00 00    	mov    0xb3a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    45f2:	8d 78 07             	lea    0x7(%eax),%edi
+    45f5:	c1 ef 03             	shr    $0x3,%edi
+    45f8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    45fb:	85 d2                	test   %edx,%edx
+    45fd:	0f 84 8d 00 00 00    	je     4690 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4603:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4605:	8b 48 04             	mov    0x4(%eax),%ecx
+    4608:	39 f9                	cmp    %edi,%ecx
+    460a:	73 64                	jae    4670 <malloc+0x90>
+  if(nu < 4096)
+    460c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    4611:	39 df                	cmp    %ebx,%edi
+    4613:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    4616:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    461d:	eb 0a                	jmp    4629 <malloc+0x49>
+    461f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4620:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4622:	8b 48 04             	mov    0x4(%eax),%ecx
+    4625:	39 f9                	cmp    %edi,%ecx
+    4627:	73 47                	jae    4670 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    4629:	89 c2                	mov    %eax,%edx
+    462b:	39 05 a0 b3 00 00    	cmp    %eax,0xb3a0
+    4631:	75 ed                	jne    4620 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    4633:	83 ec 0c             	sub    $0xc,%esp
+    4636:	56                   	push   %esi
+    4637:	e8 9f fc ff ff       	call   42db <sbrk>
+  if(p == (char*)-1)
+    463c:	83 c4 10             	add    $0x10,%esp
+    463f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4642:	74 1c                	je     4660 <malloc+0x80>
+  hp->s.size = nu;
+    4644:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    4647:	83 ec 0c             	sub    $0xc,%esp
+    464a:	83 c0 08             	add    $0x8,%eax
+    464d:	50                   	push   %eax
+    464e:	e8 fd fe ff ff       	call   4550 <free>
+  return freep;
+    4653:	8b 15 a0 b3 00 00    	mov    0xb3a0,%edx
+      if((p = morecore(nunits)) == 0)
+    4659:	83 c4 10             	add    $0x10,%esp
+    465c:	85 d2                	test   %edx,%edx
+    465e:	75 c0                	jne    4620 <malloc+0x40>
+        return 0;
+  }
+}
+    4660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    4663:	31 c0                	xor    %eax,%eax
+}
+    4665:	5b                   	pop    %ebx
+    4666:	5e                   	pop    %esi
+    4667:	5f                   	pop    %edi
+    4668:	5d                   	pop    %ebp
+    4669:	c3                   	ret
+    466a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    4670:	39 cf                	cmp    %ecx,%edi
+    4672:	74 4c                	je     46c0 <malloc+0xe0>
+        p->s.size -= nunits;
+    4674:	29 f9                	sub    %edi,%ecx
+    4676:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    4679:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    467c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    467f:	89 15 a0 b3 00 00    	mov    %edx,0xb3a0
+}
+    4685:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    4688:	83 c0 08             	add    $0x8,%eax
+}
+    468b:	5b                   	pop    %ebx
+    468c:	5e                   	pop    %esi
+    468d:	5f                   	pop    %edi
+    468e:	5d                   	pop    %ebp
+    468f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    4690:	c7 05 a0 b3 00 00 a4 	movl   $0xb3a4,0xb3a0
+    4697:	b3 00 00 
+    base.s.size = 0;
+    469a:	b8 a4 b3 00 00       	mov    $0xb3a4,%eax
+    base.s.ptr = freep = prevp = &base;
+    469f:	c7 05 a4 b3 00 00 a4 	movl   $0xb3a4,0xb3a4
+    46a6:	b3 00 00 
+    base.s.size = 0;
+    46a9:	c7 05 a8 b3 00 00 00 	movl   $0x0,0xb3a8
+    46b0:	00 00 00 
+    if(p->s.size >= nunits){
+    46b3:	e9 54 ff ff ff       	jmp    460c <malloc+0x2c>
+    46b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    46bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    46c0:	8b 08                	mov    (%eax),%ecx
+    46c2:	89 0a                	mov    %ecx,(%edx)
+    46c4:	eb b9                	jmp    467f <malloc+0x9f>
@@ -184,6 +184,10 @@ writetest(void)
   printf(stdout, "small file test ok\n");
 }
 
+// 512-byte writes that reach past the indirect block into the
+// second block under the double-indirect one.
+#define BIGWRITES (2*(NDIRECT + 2*NINDIRECT + 1))
+
 void
 writetest1(void)
 {
@@ -197,7 +201,7 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  for(i = 0; i < BIGWRITES; i++){
     ((int*)buf)[0] = i;
     if(write(fd, buf, 512) != 512){
       printf(stdout, "error: write big file failed\n", i);
@@ -217,7 +221,7 @@ writetest1(void)
   for(;;){
     i = read(fd, buf, 512);
     if(i == 0){
-      if(n == MAXFILE - 1){
+      if(n != BIGWRITES){
         printf(stdout, "read only %d blocks from big", n);
         exit();
       }
@@ -264,6 +268,71 @@ createtest(void)
   printf(stdout, "many creates, followed by unlink; ok\n");
 }
 
+// more files than the first imap block describes, so the kernel
+// has to grow the inode map.
+void
+manyinodes(void)
+{
+  char fn[6];
+  int i, fd;
+  uint maxino;
+  struct stat st;
+
+  printf(stdout, "many inodes test\n");
+
+  if(mkdir("inodes") < 0 || chdir("inodes") < 0){
+    printf(stdout, "mkdir inodes failed\n");
+    exit();
+  }
+  // The imap used to hold 200 inodes; go well past that so it has to
+  // grow by several blocks.
+  fn[0] = 'i';
+  fn[5] = '\0';
+  maxino = 0;
+  for(i = 0; i < 1000; i++){
+    fn[1] = '0' + i / 1000;
+    fn[2] = '0' + (i / 100) % 10;
+    fn[3] = '0' + (i / 10) % 10;
+    fn[4] = '0' + i % 10;
+    fd = open(fn, O_CREATE|O_RDWR);
+    if(fd < 0){
+      printf(stdout, "create %s failed\n", fn);
+      exit();
+    }
+    if(fstat(fd, &st) < 0){
+      printf(stdout, "fstat %s failed\n", fn);
+      exit();
+    }
+    if(st.ino > maxino)
+      maxino = st.ino;
+    write(fd, fn, sizeof(fn));
+    close(fd);
+  }
+  if(maxino < 1000){
+    printf(stdout, "many inodes: max inum %d\n", maxino);
+    exit();
+  }
+  for(i = 0; i < 1000; i++){
+    fn[1] = '0' + i / 1000;
+    fn[2] = '0' + (i / 100) % 10;
+    fn[3] = '0' + (i / 10) % 10;
+    fn[4] = '0' + i % 10;
+    fd = open(fn, O_RDONLY);
+    if(fd < 0 || read(fd, buf, sizeof(fn)) != sizeof(fn) ||
+       strcmp(buf, fn) != 0){
+      printf(stdout, "read %s failed\n", fn);
+      exit();
+    }
+    close(fd);
+    unlink(fn);
+  }
+  if(chdir("..") < 0 || unlink("inodes") < 0){
+    printf(stdout, "unlink inodes failed\n");
+    exit();
+  }
+  printf(stdout, "many inodes ok\n");
+}
+
 void dirtest(void)
 {
   printf(stdout, "mkdir test\n");
@@ -931,6 +1000,131 @@ bigdir(void)
   printf(1, "bigdir ok\n");
 }
 
+// name lookups must see creates and unlinks made after they were cached
+void
+dcachetest(void)
+{
+  int fd;
+
+  printf(1, "dcache test\n");
+
+  if(open("dcd/f", 0) >= 0){
+    printf(1, "dcache: dcd/f exists\n");
+    exit();
+  }
+  if(mkdir("dcd") != 0){
+    printf(1, "dcache: mkdir dcd failed\n");
+    exit();
+  }
+  if(open("dcd/f", 0) >= 0){
+    printf(1, "dcache: dcd/f exists in new dir\n");
+    exit();
+  }
+  fd = open("dcd/f", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "dcache: create dcd/f failed\n");
+    exit();
+  }
+  close(fd);
+  if((fd = open("dcd/f", 0)) < 0){
+    printf(1, "dcache: open dcd/f failed\n");
+    exit();
+  }
+  close(fd);
+  if(unlink("dcd/f") != 0){
+    printf(1, "dcache: unlink dcd/f failed\n");
+    exit();
+  }
+  if(open("dcd/f", 0) >= 0){
+    printf(1, "dcache: dcd/f still there after unlink\n");
+    exit();
+  }
+  if(open("dcd/../dcd/.", 0) < 0){
+    printf(1, "dcache: open dcd/../dcd/. failed\n");
+    exit();
+  }
+  if(unlink("dcd") != 0){
+    printf(1, "dcache: unlink dcd failed\n");
+    exit();
+  }
+  if(open("dcd/.", 0) >= 0){
+    printf(1, "dcache: dcd still there after unlink\n");
+    exit();
+  }
+  // a new directory may reuse the old one's inode
+  if(mkdir("dcd") != 0 || open("dcd/f", 0) >= 0){
+    printf(1, "dcache: recreated dcd is wrong\n");
+    exit();
+  }
+  unlink("dcd");
+
+  printf(1, "dcache ok\n");
+}
+
+// more names than the cache holds, so that entries are evicted;
+// the names looked up first must still resolve correctly
+void
+dcachefill(void)
+{
+  enum { N = NDENTRY + NDENTRY/2 };
+  char path[8];
+  int i, fd;
+
+  printf(1, "dcache fill test\n");
+
+  if(mkdir("dcf") != 0){
+    printf(1, "dcache fill: mkdir dcf failed\n");
+    exit();
+  }
+  strcpy(path, "dcf/");
+  path[7] = 0;
+  for(i = 0; i < N; i++){
+    path[4] = '0' + i/100;
+    path[5] = '0' + (i/10)%10;
+    path[6] = '0' + i%10;
+    if(open(path, 0) >= 0){
+      printf(1, "dcache fill: %s exists\n", path);
+      exit();
+    }
+    if(i % 2 == 0){
+      if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+        printf(1, "dcache fill: create %s failed\n", path);
+        exit();
+      }
+      close(fd);
+    }
+  }
+  for(i = 0; i < N; i += 3){
+    path[4] = '0' + i/100;
+    path[5] = '0' + (i/10)%10;
+    path[6] = '0' + i%10;
+    if(i % 2 == 0 && unlink(path) != 0){
+      printf(1, "dcache fill: unlink %s failed\n", path);
+      exit();
+    }
+  }
+  for(i = 0; i < N; i++){
+    path[4] = '0' + i/100;
+    path[5] = '0' + (i/10)%10;
+    path[6] = '0' + i%10;
+    fd = open(path, 0);
+    if((fd >= 0) != (i % 2 == 0 && i % 3 != 0)){
+      printf(1, "dcache fill: %s wrong after eviction\n", path);
+      exit();
+    }
+    if(fd >= 0){
+      close(fd);
+      unlink(path);
+    }
+  }
+  if(unlink("dcf") != 0){
+    printf(1, "dcache fill: unlink dcf failed\n");
+    exit();
+  }
+
+  printf(1, "dcache fill ok\n");
+}
+
 void
 subdir(void)
 {
@@ -1144,6 +1338,64 @@ bigwrite(void)
   printf(1, "bigwrite ok\n");
 }
 
+// rewrite a file many times between syncs, then fsync it.
+// the file system keeps the data cached until the sync.
+void
+fsynctest(void)
+{
+  int fd, i, j, pfd[2];
+
+  printf(1, "fsync test\n");
+
+  unlink("fsyncfile");
+  fd = open("fsyncfile", O_CREATE | O_RDWR);
+  if(fd < 0){
+    printf(1, "cannot create fsyncfile\n");
+    exit();
+  }
+  for(i = 0; i < 10; i++){
+    memset(buf, 'a' + i, 3*BSIZE);
+    if(write(fd, buf, 3*BSIZE) != 3*BSIZE){
+      printf(1, "fsync write %d failed\n", i);
+      exit();
+    }
+    close(fd);
+    fd = open("fsyncfile", O_RDWR);
+  }
+  if(fsync(fd) != 0){
+    printf(1, "fsync failed\n");
+    exit();
+  }
+  close(fd);
+
+  fd = open("fsyncfile", 0);
+  if(read(fd, buf, sizeof(buf)) != 3*BSIZE){
+    printf(1, "fsync read failed\n");
+    exit();
+  }
+  for(j = 0; j < 3*BSIZE; j++){
+    if(buf[j] != 'a' + 9){
+      printf(1, "fsync wrong data\n");
+      exit();
+    }
+  }
+  close(fd);
+  unlink("fsyncfile");
+
+  if(pipe(pfd) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  if(fsync(pfd[0]) != -1){
+    printf(1, "fsync of a pipe succeeded!\n");
+    exit();
+  }
+  close(pfd[0]);
+  close(pfd[1]);
+
+  printf(1, "fsync ok\n");
+}
+
 void
 bigfile(void)
 {
@@ -1347,7 +1599,7 @@ iref(void)
 
   printf(1, "empty file name\n");
 
-  // the 50 is NINODE
+  // more than the 50 inodes the cache used to hold
   for(i = 0; i < 50 + 1; i++){
     if(mkdir("irefd") != 0){
       printf(1, "mkdir irefd failed\n");
@@ -1764,6 +2016,7 @@ main(int argc, char *argv[])
 
   bigargtest();
   bigwrite();
+  fsynctest();
   bigargtest();
   bsstest();
   sbrktest();
@@ -1773,6 +2026,7 @@ main(int argc, char *argv[])
   writetest();
   writetest1();
   createtest();
+  manyinodes();
 
   openiputtest();
   exitiputtest();
@@ -1787,6 +2041,8 @@ main(int argc, char *argv[])
   fourteen();
   bigfile();
   subdir();
+  dcachetest();
+  dcachefill();
   linktest();
   unlinkread();
   dirfile();